@@ -0,0 +1,64 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_COMPILE_CACHE_HPP)
+#define PHYLANX_EXECUTION_TREE_COMPILE_CACHE_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/node.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Generate the AST for the given PhySL source, reusing the result of a
+    /// previous invocation for the same source, if possible.
+    ///
+    /// Generated ASTs are kept in memory, the least recently used ones are
+    /// evicted once the number of entries exceeds the configured capacity
+    /// (see set_compile_cache_capacity or the configuration entry
+    /// 'phylanx.compile_cache.max_entries', defaults to 1024). If a cache
+    /// directory is configured (see set_compile_cache_directory or
+    /// the configuration entry 'phylanx.compile_cache.directory'), the ASTs
+    /// are additionally stored on disk and are reused by later processes.
+    /// Cache entries are keyed by a hash of the source, the Phylanx version,
+    /// and the set of known primitive patterns.
+    PHYLANX_EXPORT std::vector<ast::expression> generate_ast_cached(
+        std::string const& source);
+
+    /// Set the directory used to persistently store generated ASTs, an empty
+    /// string disables the persistent cache.
+    PHYLANX_EXPORT void set_compile_cache_directory(std::string const& dir);
+    PHYLANX_EXPORT std::string get_compile_cache_directory();
+
+    /// Remove all entries from the in-memory cache, the persistent cache is
+    /// not affected.
+    PHYLANX_EXPORT void clear_compile_cache();
+
+    /// Set the maximum number of ASTs kept in memory, zero disables the
+    /// in-memory cache.
+    PHYLANX_EXPORT void set_compile_cache_capacity(std::size_t capacity);
+    PHYLANX_EXPORT std::size_t get_compile_cache_capacity();
+
+    struct compile_cache_statistics
+    {
+        std::size_t memory_hits_;       // ASTs reused from memory
+        std::size_t disk_hits_;         // ASTs loaded from the cache directory
+        std::size_t misses_;            // ASTs that had to be generated
+        std::size_t evictions_;         // ASTs evicted from memory
+        std::size_t size_;              // ASTs currently kept in memory
+    };
+
+    PHYLANX_EXPORT compile_cache_statistics get_compile_cache_statistics();
+
+    /// Return the key used to identify the cache entry for the given source
+    PHYLANX_EXPORT std::uint64_t compile_cache_key(std::string const& source);
+}}}
+
+#endif
@@ -24,6 +24,7 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -99,6 +100,11 @@ namespace phylanx { namespace execution_tree { namespace compiler
         hpx::id_type const& default_locality = hpx::find_here());
 
     /// Create default compilation environment using the given default locality.
+    ///
+    /// The built-in functions are created only once per locality and are
+    /// shared (read-only) by all environments returned from this function.
+    /// Definitions added to the returned environment shadow the built-ins
+    /// without modifying the shared table.
     PHYLANX_EXPORT environment default_environment(
         hpx::id_type const& default_locality = hpx::find_here());
 
@@ -452,9 +458,12 @@ namespace phylanx { namespace execution_tree { namespace compiler
     {
     public:
         using definition_data = compiled_function;
+        using map_type = std::map<util::hashed_string, definition_data>;
+
+        // immutable table of built-in functions, shared between environments
+        using builtins_type = std::shared_ptr<map_type const>;
 
     private:
-        using map_type = std::map<util::hashed_string, definition_data>;
         using iterator = map_type::iterator;
         using const_iterator = map_type::const_iterator;
         using value_type = map_type::value_type;
@@ -467,6 +476,12 @@ namespace phylanx { namespace execution_tree { namespace compiler
                 outer != nullptr ? outer->base_arg_num_ + arg_num : arg_num)
         {}
 
+        explicit environment(builtins_type builtins)
+          : outer_(nullptr)
+          , builtins_(std::move(builtins))
+          , base_arg_num_(0)
+        {}
+
         template <typename F>
         compiled_function* define_variable(std::string name, F&& f)
         {
@@ -522,6 +537,16 @@ namespace phylanx { namespace execution_tree { namespace compiler
             {
                 return outer_->find(name);
             }
+            if (builtins_)
+            {
+                const_iterator bit = builtins_->find(name);
+                if (bit != builtins_->end())
+                {
+                    // the compiled functions are never modified through the
+                    // returned pointer, they are only invoked
+                    return const_cast<compiled_function*>(&bit->second);
+                }
+            }
             return nullptr;
         }
 
@@ -532,6 +557,8 @@ namespace phylanx { namespace execution_tree { namespace compiler
             std::size_t count = definitions_.size();
             if (outer_ != nullptr)
                 count += outer_->size();
+            if (builtins_)
+                count += builtins_->size();
             return count;
         }
 
@@ -543,6 +570,7 @@ namespace phylanx { namespace execution_tree { namespace compiler
     private:
         environment* outer_;
         map_type definitions_;
+        builtins_type builtins_;
         std::size_t base_arg_num_;
     };
 
@@ -40,12 +40,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
         hpx::future<primitive_argument_type> eval(
             primitive_arguments_type const& params,
             eval_context ctx) const override;
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& params,
+            eval_context ctx) const override;
 
         topology expression_topology(std::set<std::string>&& functions,
             std::set<std::string>&& resolve_children) const override;
 
     private:
+        // access the represented variable in the execution context
+        primitive_argument_type const& get_target(eval_context& ctx) const;
+
         util::hashed_string target_name_;   // name of the represented variable
+        variable_slot target_slot_;         // cached location of the variable
     };
 }}}
 
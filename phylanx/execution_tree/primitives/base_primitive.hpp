@@ -14,6 +14,7 @@
 #include <phylanx/execution_tree/primitives/primitive_argument_type.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
+#include <phylanx/util/future_or_value.hpp>
 #include <phylanx/util/generate_error_message.hpp>
 #include <phylanx/util/small_vector.hpp>
 
@@ -224,6 +225,9 @@ namespace phylanx { namespace execution_tree
         std::string const& name = "",
         std::string const& codename = "<unknown>");
 
+    // Extract a ir::node_data<double> type from a given
+    // primitive_argument_type, single precision values are widened, throw if
+    // it doesn't hold a floating point value.
     PHYLANX_EXPORT ir::node_data<double> extract_numeric_value_strict(
         primitive_argument_type const& val,
         std::string const& name = "",
@@ -237,6 +241,75 @@ namespace phylanx { namespace execution_tree
     PHYLANX_EXPORT bool is_numeric_operand_strict(
         primitive_argument_type const& val);
 
+    // Return whether the given value holds numeric data stored in sparse
+    // (compressed) format
+    PHYLANX_EXPORT bool is_sparse_operand(primitive_argument_type const& val);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract a ir::node_data<float> type from a given primitive_argument_type,
+    // converting other numeric element types, throw if it doesn't hold one.
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT float extract_scalar_float32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT float extract_scalar_float32_value(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<float>&& extract_float32_value_strict(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT bool is_float32_operand_strict(
+        primitive_argument_type const& val);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract a ir::node_data<std::int32_t> type from a given
+    // primitive_argument_type, converting other numeric element types, throw
+    // if it doesn't hold one.
+    PHYLANX_EXPORT ir::node_data<std::int32_t> extract_int32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<std::int32_t> extract_int32_value(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT std::int32_t extract_scalar_int32_value(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT std::int32_t extract_scalar_int32_value(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT ir::node_data<std::int32_t> extract_int32_value_strict(
+        primitive_argument_type const& val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+    PHYLANX_EXPORT ir::node_data<std::int32_t>&& extract_int32_value_strict(
+        primitive_argument_type && val,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>");
+
+    PHYLANX_EXPORT bool is_int32_operand_strict(
+        primitive_argument_type const& val);
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::size_t extract_numeric_value_dimension(
         primitive_argument_type const& val,
@@ -327,7 +400,7 @@ namespace phylanx { namespace execution_tree
         eval_context ctx = eval_context{});
 
     // Extract a ir::node_data<std::int64_t> type from a given primitive_argument_type,
-    // throw if it doesn't hold one.
+    // 32 bit integers are widened, throw if it doesn't hold an integer value.
     PHYLANX_EXPORT ir::node_data<std::int64_t> extract_integer_value_strict(
         primitive_argument_type const& val,
         std::string const& name = "",
@@ -476,6 +549,22 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value(val, name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type const& val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value(val, name, codename);
+    }
+    template <>
+    inline ir::node_data<std::int32_t> extract_node_data(
+        primitive_argument_type const& val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_int32_value(val, name, codename);
+    }
 
     template <typename T>
     ir::node_data<T> extract_node_data(
@@ -507,6 +596,22 @@ namespace phylanx { namespace execution_tree
     {
         return extract_boolean_value(std::move(val), name, codename);
     }
+    template <>
+    inline ir::node_data<float> extract_node_data(
+        primitive_argument_type && val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_float32_value(std::move(val), name, codename);
+    }
+    template <>
+    inline ir::node_data<std::int32_t> extract_node_data(
+        primitive_argument_type && val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_int32_value(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
@@ -539,6 +644,22 @@ namespace phylanx { namespace execution_tree
     {
         return extract_scalar_boolean_value(val, name, codename);
     }
+    template <>
+    inline float extract_scalar_data(
+        primitive_argument_type const& val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_scalar_float32_value(val, name, codename);
+    }
+    template <>
+    inline std::int32_t extract_scalar_data(
+        primitive_argument_type const& val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_scalar_int32_value(val, name, codename);
+    }
 
     template <typename T>
     T extract_scalar_data(
@@ -570,6 +691,22 @@ namespace phylanx { namespace execution_tree
     {
         return extract_scalar_boolean_value(std::move(val), name, codename);
     }
+    template <>
+    inline float extract_scalar_data(
+        primitive_argument_type && val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_scalar_float32_value(std::move(val), name, codename);
+    }
+    template <>
+    inline std::int32_t extract_scalar_data(
+        primitive_argument_type && val,
+        std::string const& name,
+        std::string const& codename)
+    {
+        return extract_scalar_int32_value(std::move(val), name, codename);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     // Extract a std::string type from a given primitive_argument_type,
@@ -706,6 +843,35 @@ namespace phylanx { namespace execution_tree
         };
     }
 
+    // Extract a primitive_argument_type from a primitive_argument_type (that
+    // could be a value type). Values and primitives that have finished
+    // evaluating are returned directly, i.e. without allocating a shared
+    // state. Use util::dataflow_or_value to combine the results.
+    PHYLANX_EXPORT util::future_or_value<primitive_argument_type>
+    value_operand_fov(primitive_argument_type const& val,
+        primitive_arguments_type const& args,
+        std::string const& name = "", std::string const& codename = "<unknown>",
+        eval_context ctx = eval_context{});
+    PHYLANX_EXPORT util::future_or_value<primitive_argument_type>
+    value_operand_fov(primitive_argument_type const& val,
+        primitive_arguments_type&& args,
+        std::string const& name = "", std::string const& codename = "<unknown>",
+        eval_context ctx = eval_context{});
+
+    namespace functional
+    {
+        struct value_operand_fov
+        {
+            template <typename... Ts>
+            util::future_or_value<primitive_argument_type> operator()(
+                Ts&&... ts) const
+            {
+                return execution_tree::value_operand_fov(
+                    std::forward<Ts>(ts)...);
+            }
+        };
+    }
+
     // was declared above
     //     PHYLANX_EXPORT primitive_argument_type value_operand_sync(
     //         primitive_argument_type const& val,
@@ -802,6 +968,15 @@ namespace phylanx { namespace execution_tree
         };
     }
 
+    // Extract a node_data<double> from a primitive_argument_type (that could
+    // be a primitive or a literal value), see value_operand_fov.
+    PHYLANX_EXPORT util::future_or_value<ir::node_data<double>>
+    numeric_operand_fov(primitive_argument_type const& val,
+        primitive_arguments_type const& args,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>",
+        eval_context ctx = eval_context{});
+
     PHYLANX_EXPORT ir::node_data<double> numeric_operand_sync(
         primitive_argument_type const& val,
         primitive_arguments_type const& args,
@@ -809,6 +984,21 @@ namespace phylanx { namespace execution_tree
         std::string const& codename = "<unknown>",
         eval_context ctx = eval_context{});
 
+    // Extract a node_data<float> or a node_data<std::int32_t> from a
+    // primitive_argument_type (that could be a primitive or a literal value).
+    PHYLANX_EXPORT hpx::future<ir::node_data<float>> float32_operand(
+        primitive_argument_type const& val,
+        primitive_arguments_type const& args,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>",
+        eval_context ctx = eval_context{});
+    PHYLANX_EXPORT hpx::future<ir::node_data<std::int32_t>> int32_operand(
+        primitive_argument_type const& val,
+        primitive_arguments_type const& args,
+        std::string const& name = "",
+        std::string const& codename = "<unknown>",
+        eval_context ctx = eval_context{});
+
     // Extract a boolean from a primitive_argument_type (that
     // could be a primitive or a literal value).
     PHYLANX_EXPORT hpx::future<std::uint8_t> boolean_operand(
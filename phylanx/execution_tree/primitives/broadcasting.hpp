@@ -0,0 +1,225 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_EXECUTION_TREE_BROADCASTING_HPP)
+#define PHYLANX_EXECUTION_TREE_BROADCASTING_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/storage_pool.hpp>
+
+#include <hpx/throw_exception.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+#include <blaze_tensor/Math.h>
+#endif
+
+namespace phylanx { namespace execution_tree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Shape of an operand as seen by the NumPy broadcasting rules: the
+    // dimensions are aligned to the right (the last dimension always refers
+    // to the columns), missing leading dimensions are represented as ones.
+    struct broadcast_shape
+    {
+        static constexpr std::size_t max_dimensions = 3;
+
+        std::size_t numdims_;
+        std::array<std::size_t, max_dimensions> dims_;
+    };
+
+    template <typename T>
+    broadcast_shape get_broadcast_shape(ir::node_data<T> const& data)
+    {
+        broadcast_shape result{data.num_dimensions(), {{1, 1, 1}}};
+
+        auto const dims = data.dimensions();
+        std::size_t const first =
+            broadcast_shape::max_dimensions - result.numdims_;
+        for (std::size_t i = 0; i != result.numdims_; ++i)
+        {
+            result.dims_[first + i] = dims[i];
+        }
+        return result;
+    }
+
+    /// Return the shape two operands of the given shapes broadcast to,
+    /// throws if the shapes are incompatible.
+    PHYLANX_EXPORT broadcast_shape broadcast_shapes(broadcast_shape const& lhs,
+        broadcast_shape const& rhs, std::string const& name,
+        std::string const& codename);
+
+    /// Return the shape all of the given operands broadcast to
+    template <typename T, typename... Ts>
+    broadcast_shape extract_broadcast_shape(std::string const& name,
+        std::string const& codename, ir::node_data<T> const& arg,
+        ir::node_data<Ts> const&... args)
+    {
+        broadcast_shape const shapes[] = {
+            get_broadcast_shape(arg), get_broadcast_shape(args)...
+        };
+
+        broadcast_shape result = shapes[0];
+        for (std::size_t i = 1; i != sizeof...(Ts) + 1; ++i)
+        {
+            result = broadcast_shapes(result, shapes[i], name, codename);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Read-only view of an operand broadcast to a larger shape. No data is
+    // copied, the stride of every dimension the operand is stretched along
+    // is zero.
+    template <typename T>
+    class broadcast_view
+    {
+    public:
+        explicit broadcast_view(ir::node_data<T> const& data)
+        {
+            switch (data.num_dimensions())
+            {
+            case 0:
+                data_ = &data.scalar();
+                strides_ = {{0, 0, 0}};
+                break;
+
+            case 1:
+                data_ = data.vector().data();
+                strides_ = {{0, 0, 1}};
+                break;
+
+            case 2:
+                {
+                    auto m = data.matrix();
+                    data_ = m.data();
+                    strides_ = {{0, m.spacing(), 1}};
+                }
+                break;
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            case 3:
+                {
+                    auto t = data.tensor();
+                    data_ = t.data();
+                    strides_ = {{t.rows() * t.spacing(), t.spacing(), 1}};
+                }
+                break;
+#endif
+
+            default:
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::broadcast_view",
+                    "operand has unsupported number of dimensions");
+            }
+
+            broadcast_shape const shape = get_broadcast_shape(data);
+            for (std::size_t i = 0; i != broadcast_shape::max_dimensions; ++i)
+            {
+                if (shape.dims_[i] == 1)
+                {
+                    strides_[i] = 0;
+                }
+            }
+        }
+
+        T operator()(
+            std::size_t page, std::size_t row, std::size_t column) const
+        {
+            return data_[
+                page * strides_[0] + row * strides_[1] + column * strides_[2]];
+        }
+
+    private:
+        T const* data_;
+        std::array<std::size_t, broadcast_shape::max_dimensions> strides_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename R, typename F, typename... Ts>
+        void broadcast_apply(R* result, std::size_t page_stride,
+            std::size_t row_stride, broadcast_shape const& shape, F& f,
+            broadcast_view<Ts> const&... views)
+        {
+            for (std::size_t k = 0; k != shape.dims_[0]; ++k)
+            {
+                for (std::size_t i = 0; i != shape.dims_[1]; ++i)
+                {
+                    R* row = result + k * page_stride + i * row_stride;
+                    for (std::size_t j = 0; j != shape.dims_[2]; ++j)
+                    {
+                        row[j] = R(f(views(k, i, j)...));
+                    }
+                }
+            }
+        }
+    }
+
+    /// Apply the given element-wise function to the operands broadcast
+    /// against each other following the NumPy rules. The operands are
+    /// accessed through broadcast views, only the result is allocated.
+    template <typename R, typename F, typename... Ts>
+    ir::node_data<R> broadcast_map(F&& f, std::string const& name,
+        std::string const& codename, ir::node_data<Ts> const&... args)
+    {
+        broadcast_shape const shape =
+            extract_broadcast_shape(name, codename, args...);
+
+        switch (shape.numdims_)
+        {
+        case 0:
+            return ir::node_data<R>{R(f(args.scalar()...))};
+
+        case 1:
+            {
+                auto result = util::storage_pool<R>::vector(shape.dims_[2]);
+                detail::broadcast_apply(result.data(), 0, 0, shape, f,
+                    broadcast_view<Ts>(args)...);
+                return ir::node_data<R>{std::move(result)};
+            }
+
+        case 2:
+            {
+                auto result = util::storage_pool<R>::matrix(
+                    shape.dims_[1], shape.dims_[2]);
+                detail::broadcast_apply(result.data(), 0, result.spacing(),
+                    shape, f, broadcast_view<Ts>(args)...);
+                return ir::node_data<R>{std::move(result)};
+            }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+        case 3:
+            {
+                blaze::DynamicTensor<R> result(
+                    shape.dims_[0], shape.dims_[1], shape.dims_[2]);
+                detail::broadcast_apply(result.data(),
+                    result.rows() * result.spacing(), result.spacing(), shape,
+                    f, broadcast_view<Ts>(args)...);
+                return ir::node_data<R>{std::move(result)};
+            }
+#endif
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::broadcast_map",
+            util::generate_error_message(
+                "operands have unsupported number of dimensions", name,
+                codename));
+    }
+}}
+
+#endif
@@ -50,6 +50,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
     private:
         util::hashed_string target_name_;   // name of the represented variable
+        variable_slot target_slot_;         // cached location of the variable
         std::shared_ptr<primitive_component> target_;
     };
 }}}
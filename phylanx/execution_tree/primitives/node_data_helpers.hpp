@@ -28,15 +28,45 @@ namespace phylanx { namespace execution_tree
     enum node_data_type
     {
         node_data_type_double = 0,
-        node_data_type_int64 = 1,
-        node_data_type_bool = 2,
-        node_data_type_unknown = 3,     // must be largest value
+        node_data_type_float32 = 1,
+        node_data_type_int64 = 2,
+        node_data_type_int32 = 3,
+        node_data_type_bool = 4,
+        node_data_type_unknown = 5,     // must be largest value
     };
 
     /// Extract node_data_type from a primitive name
     PHYLANX_EXPORT node_data_type map_dtype(std::string const& spec);
     PHYLANX_EXPORT node_data_type extract_dtype(std::string name);
 
+    /// Return the data type to be used for the result of an operation
+    /// involving values of the two given types. Single precision values
+    /// combined with integers are promoted to double precision, otherwise
+    /// the type with the smaller node_data_type value is used.
+    PHYLANX_EXPORT node_data_type promote_common_type(
+        node_data_type lhs, node_data_type rhs);
+
+    /// Return the data type to be used for the result of an operation
+    /// involving arrays of the type 'array' and scalars (0-d values) of the
+    /// type 'scalar'. As in NumPy, the scalars don't change the precision of
+    /// the result unless they are of a higher kind (floating point over
+    /// integral over boolean) than the arrays.
+    PHYLANX_EXPORT node_data_type promote_common_type_scalar(
+        node_data_type array, node_data_type scalar);
+
+    namespace detail
+    {
+        // Accumulate the common type of arrays and scalars separately
+        struct common_type
+        {
+            PHYLANX_EXPORT void add(primitive_argument_type const& arg);
+            PHYLANX_EXPORT node_data_type get() const;
+
+            node_data_type array_ = node_data_type_unknown;
+            node_data_type scalar_ = node_data_type_unknown;
+        };
+    }
+
     /// Return the common data type to be used for the result of an operation
     /// involving the given argument.
     PHYLANX_EXPORT node_data_type extract_common_type(
@@ -52,12 +82,10 @@ namespace phylanx { namespace execution_tree
     template <typename... Ts>
     node_data_type extract_common_type(Ts const&... args)
     {
-        int const __dummy[] = {
-            extract_common_type(args)...,
-            node_data_type_unknown
-        };
-        return node_data_type(
-            *std::min_element(&__dummy[0], &__dummy[sizeof...(args)]));
+        detail::common_type result;
+        int const __dummy[] = {(result.add(args), 0)..., 0};
+        (void) __dummy;
+        return result.get();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/ast/node.hpp>
+#include <phylanx/util/future_or_value.hpp>
 #include <phylanx/util/hashed_string.hpp>
 #include <phylanx/util/variant.hpp>
 #include <phylanx/ir/dictionary.hpp>
@@ -22,7 +23,10 @@
 #include <hpx/util/assert.hpp>
 #include <hpx/util/internal_allocator.hpp>
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <iosfwd>
 #include <map>
 #include <memory>
@@ -92,12 +96,70 @@ namespace phylanx { namespace execution_tree
         primitive_argument_type const& val);
 
     ///////////////////////////////////////////////////////////////////////////
+    // Location (frame depth and index inside that frame) of a variable as
+    // found by the last lookup. The primitives accessing variables keep an
+    // instance of this to turn repeated lookups by name into an indexed
+    // access. A cached location is always verified before being used.
+    class variable_slot
+    {
+        static constexpr std::uint64_t invalid_slot = ~std::uint64_t(0);
+
+    public:
+        variable_slot() noexcept
+          : data_(invalid_slot)
+        {
+        }
+
+        variable_slot(variable_slot const& rhs) noexcept
+          : data_(rhs.data_.load(std::memory_order_relaxed))
+        {
+        }
+        variable_slot& operator=(variable_slot const& rhs) noexcept
+        {
+            data_.store(rhs.data_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            return *this;
+        }
+
+        bool get(std::size_t& depth, std::size_t& index) const noexcept
+        {
+            std::uint64_t data = data_.load(std::memory_order_relaxed);
+            if (data == invalid_slot)
+            {
+                return false;
+            }
+            depth = std::size_t(data >> 32);
+            index = std::size_t(data & 0xffffffff);
+            return true;
+        }
+
+        void set(std::size_t depth, std::size_t index) const noexcept
+        {
+            if (depth < 0xffffffff && index < 0xffffffff)
+            {
+                data_.store((std::uint64_t(depth) << 32) | index,
+                    std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        // concurrent evaluations may update the location at any time
+        mutable std::atomic<std::uint64_t> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Variables defined in a frame are stored in a flat array, the position
+    // of a variable does not change once it was defined. The values are held
+    // in a deque, defining more variables in a frame never moves the values
+    // already stored, i.e. pointers returned by get_var stay valid.
     class variable_frame
     {
-        using allocator_type = hpx::util::internal_allocator<
-            std::pair<util::hashed_string const, primitive_argument_type>>;
-        using variables_map_type = std::map<util::hashed_string,
-            primitive_argument_type, std::less<>, allocator_type>;
+        using allocator_type =
+            hpx::util::internal_allocator<primitive_argument_type>;
+        using values_type =
+            std::deque<primitive_argument_type, allocator_type>;
+
+        static constexpr std::size_t npos = std::size_t(-1);
 
     public:
         variable_frame() = default;
@@ -107,14 +169,51 @@ namespace phylanx { namespace execution_tree
         {
         }
 
+        // look up a variable by name
         inline primitive_argument_type* get_var(
             util::hashed_string const& name) noexcept;
         inline primitive_argument_type const* get_var(
             util::hashed_string const& name) const noexcept;
+
+        // look up a variable starting at the given cached location, the
+        // location is updated if the variable was found elsewhere
+        inline primitive_argument_type* get_var(
+            util::hashed_string const& name,
+            variable_slot const& slot) noexcept;
+
         inline primitive_argument_type& set_var(
             util::hashed_string const& name, primitive_argument_type&& var);
+        inline primitive_argument_type& set_var(
+            util::hashed_string const& name, primitive_argument_type&& var,
+            variable_slot const& slot);
 
     private:
+        // store the value of the given variable, returns its index
+        inline std::size_t store(
+            util::hashed_string const& name, primitive_argument_type&& var);
+
+        static std::uint64_t name_bit(util::hashed_string const& name) noexcept
+        {
+            return std::uint64_t(1) << (name.hash() % 64);
+        }
+
+        std::size_t find(util::hashed_string const& name) const noexcept
+        {
+            // quickly reject names that are not defined in this frame
+            if ((names_mask_ & name_bit(name)) == 0)
+            {
+                return npos;
+            }
+            for (std::size_t i = 0; i != names_.size(); ++i)
+            {
+                if (names_[i] == name)
+                {
+                    return i;
+                }
+            }
+            return npos;
+        }
+
         friend class hpx::serialization::access;
         PHYLANX_EXPORT void serialize(hpx::serialization::output_archive& ar,
             unsigned);
@@ -122,7 +221,9 @@ namespace phylanx { namespace execution_tree
             unsigned);
 
     private:
-        variables_map_type variables_;
+        std::vector<util::hashed_string> names_;
+        values_type values_;
+        std::uint64_t names_mask_ = 0;      // one bit per hash of the names
         std::shared_ptr<variable_frame> nextframe_;
     };
 
@@ -179,9 +280,17 @@ namespace phylanx { namespace execution_tree
             HPX_ASSERT(bool(variables_));
             return variables_->get_var(name);
         }
+        primitive_argument_type* get_var(util::hashed_string const& name,
+            variable_slot const& slot) noexcept
+        {
+            HPX_ASSERT(bool(variables_));
+            return variables_->get_var(name, slot);
+        }
 
         inline primitive_argument_type& set_var(util::hashed_string const& name,
             primitive_argument_type&& var);
+        inline primitive_argument_type& set_var(util::hashed_string const& name,
+            primitive_argument_type&& var, variable_slot const& slot);
 
         eval_context& add_frame()
         {
@@ -274,11 +383,58 @@ namespace phylanx { namespace execution_tree
         PHYLANX_EXPORT primitive(hpx::future<hpx::id_type>&& fid,
             std::string const& name, bool register_with_agas = true);
 
-        primitive(primitive const&) = default;
-        primitive(primitive &&) = default;
+        // refer to a lightweight primitive (see
+        // primitive_component::create_lightweight)
+        PHYLANX_EXPORT explicit primitive(
+            std::shared_ptr<primitives::primitive_component> p);
 
-        primitive& operator=(primitive const&) = default;
-        primitive& operator=(primitive &&) = default;
+        primitive(primitive const& rhs)
+          : base_type(rhs)
+          , lightweight_(rhs.lightweight_)
+        {
+            copy_local_component(rhs);
+        }
+        primitive(primitive && rhs)
+          : base_type(std::move(rhs))
+          , lightweight_(std::move(rhs.lightweight_))
+        {
+            copy_local_component(rhs);
+            rhs.reset_local_component();
+        }
+
+        primitive& operator=(primitive const& rhs)
+        {
+            if (this != &rhs)
+            {
+                this->base_type::operator=(rhs);
+                lightweight_ = rhs.lightweight_;
+                copy_local_component(rhs);
+            }
+            return *this;
+        }
+        primitive& operator=(primitive && rhs)
+        {
+            if (this != &rhs)
+            {
+                this->base_type::operator=(std::move(rhs));
+                lightweight_ = std::move(rhs.lightweight_);
+                copy_local_component(rhs);
+                rhs.reset_local_component();
+            }
+            return *this;
+        }
+
+        // Return the name this primitive is registered with. Lightweight
+        // primitives report the name they will be registered with once
+        // they are given a global id.
+        PHYLANX_EXPORT std::string registered_name() const;
+
+        // return the referenced instance if this is a lightweight primitive
+        std::shared_ptr<primitives::primitive_component> const&
+        lightweight_component() const
+        {
+            return lightweight_;
+        }
 
         PHYLANX_EXPORT hpx::future<primitive_argument_type> eval(
             eval_context ctx = eval_context{}) const;
@@ -304,6 +460,12 @@ namespace phylanx { namespace execution_tree
             primitive_arguments_type const& args,
             eval_context ctx = eval_context{}) const;
 
+        // Evaluate the referenced primitive, local evaluations which are
+        // executed directly return their result without creating a future.
+        PHYLANX_EXPORT util::future_or_value<primitive_argument_type>
+        eval_fov(primitive_arguments_type const& args,
+            eval_context ctx = eval_context{}) const;
+
         PHYLANX_EXPORT hpx::future<void> store(primitive_argument_type&&,
             primitive_arguments_type&&, eval_context ctx = eval_context{});
         PHYLANX_EXPORT hpx::future<void> store(primitive_arguments_type&&,
@@ -334,6 +496,33 @@ namespace phylanx { namespace execution_tree
 
     public:
         static bool enable_tracing;
+
+    private:
+        // Return the address of the referenced component if it lives on this
+        // locality, nullptr otherwise. The address is resolved on first use
+        // only and is valid for as long as this client holds a managed id
+        // or refers to a lightweight primitive.
+        PHYLANX_EXPORT primitives::primitive_component* local_component() const;
+
+        void copy_local_component(primitive const& rhs)
+        {
+            bool resolved = rhs.resolved_.load(std::memory_order_acquire);
+            local_.store(
+                resolved ? rhs.local_.load(std::memory_order_relaxed) : nullptr,
+                std::memory_order_relaxed);
+            resolved_.store(resolved, std::memory_order_release);
+        }
+
+        void reset_local_component()
+        {
+            resolved_.store(false, std::memory_order_relaxed);
+            local_.store(nullptr, std::memory_order_relaxed);
+        }
+
+        mutable std::atomic<primitives::primitive_component*> local_{nullptr};
+        mutable std::atomic<bool> resolved_{false};
+
+        std::shared_ptr<primitives::primitive_component> lightweight_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -348,6 +537,8 @@ namespace phylanx { namespace execution_tree
           , std::vector<ast::expression>
           , ir::range
           , phylanx::ir::dictionary
+          , ir::node_data<float>
+          , ir::node_data<std::int32_t>
         >;
 
     PHYLANX_EXPORT primitive_argument_type extract_copy_value(
@@ -367,7 +558,9 @@ namespace phylanx { namespace execution_tree
             primitive_index = 5,
             expression_index = 6,
             list_index = 7,
-            dictionary_index = 8
+            dictionary_index = 8,
+            float32_index = 9,
+            int32_index = 10
         };
 
         primitive_argument_type() = default;
@@ -499,6 +692,80 @@ namespace phylanx { namespace execution_tree
           : argument_value_type{std::move(val)}
         {}
 
+        explicit primitive_argument_type(float val)
+          : argument_value_type{phylanx::ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(
+                blaze::DynamicVector<float> const& val)
+          : argument_value_type{phylanx::ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicVector<float>&& val)
+          : argument_value_type{
+                phylanx::ir::node_data<float>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(
+                blaze::DynamicMatrix<float> const& val)
+          : argument_value_type{phylanx::ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicMatrix<float>&& val)
+          : argument_value_type{
+                phylanx::ir::node_data<float>{std::move(val)}}
+        {}
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+        explicit primitive_argument_type(
+                blaze::DynamicTensor<float> const& val)
+          : argument_value_type{phylanx::ir::node_data<float>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicTensor<float>&& val)
+          : argument_value_type{
+                phylanx::ir::node_data<float>{std::move(val)}}
+        {}
+#endif
+
+        primitive_argument_type(phylanx::ir::node_data<float> const& val)
+          : argument_value_type{val}
+        {}
+        primitive_argument_type(phylanx::ir::node_data<float>&& val)
+          : argument_value_type{std::move(val)}
+        {}
+
+        explicit primitive_argument_type(std::int32_t val)
+          : argument_value_type{phylanx::ir::node_data<std::int32_t>{val}}
+        {}
+        explicit primitive_argument_type(
+                blaze::DynamicVector<std::int32_t> const& val)
+          : argument_value_type{phylanx::ir::node_data<std::int32_t>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicVector<std::int32_t>&& val)
+          : argument_value_type{
+                phylanx::ir::node_data<std::int32_t>{std::move(val)}}
+        {}
+        explicit primitive_argument_type(
+                blaze::DynamicMatrix<std::int32_t> const& val)
+          : argument_value_type{phylanx::ir::node_data<std::int32_t>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicMatrix<std::int32_t>&& val)
+          : argument_value_type{
+                phylanx::ir::node_data<std::int32_t>{std::move(val)}}
+        {}
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+        explicit primitive_argument_type(
+                blaze::DynamicTensor<std::int32_t> const& val)
+          : argument_value_type{phylanx::ir::node_data<std::int32_t>{val}}
+        {}
+        explicit primitive_argument_type(blaze::DynamicTensor<std::int32_t>&& val)
+          : argument_value_type{
+                phylanx::ir::node_data<std::int32_t>{std::move(val)}}
+        {}
+#endif
+
+        primitive_argument_type(phylanx::ir::node_data<std::int32_t> const& val)
+          : argument_value_type{val}
+        {}
+        primitive_argument_type(phylanx::ir::node_data<std::int32_t>&& val)
+          : argument_value_type{std::move(val)}
+        {}
+
         primitive_argument_type(primitive const& val)
           : argument_value_type{val}
         {}
@@ -688,52 +955,132 @@ namespace phylanx { namespace execution_tree
         return variables_->set_var(name, std::move(var));
     }
 
+    primitive_argument_type& eval_context::set_var(
+        util::hashed_string const& name, primitive_argument_type&& var,
+        variable_slot const& slot)
+    {
+        return variables_->set_var(name, std::move(var), slot);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type* variable_frame::get_var(
         util::hashed_string const& name) noexcept
     {
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        for (variable_frame* frame = this; frame != nullptr;
+             frame = frame->nextframe_.get())
         {
-            if (!nextframe_)
+            std::size_t index = frame->find(name);
+            if (index != npos)
             {
-                return nullptr;
+                return &frame->values_[index];
             }
-            return nextframe_->get_var(name);
         }
-        return &it->second;
+        return nullptr;
     }
 
     primitive_argument_type const* variable_frame::get_var(
         util::hashed_string const& name) const noexcept
     {
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        for (variable_frame const* frame = this; frame != nullptr;
+             frame = frame->nextframe_.get())
         {
-            if (!nextframe_)
+            std::size_t index = frame->find(name);
+            if (index != npos)
             {
-                return nullptr;
+                return &frame->values_[index];
             }
-            return nextframe_->get_var(name);
         }
-        return &it->second;
+        return nullptr;
     }
 
-    primitive_argument_type& variable_frame::set_var(
+    primitive_argument_type* variable_frame::get_var(
+        util::hashed_string const& name, variable_slot const& slot) noexcept
+    {
+        std::size_t depth = 0;
+        std::size_t index = 0;
+        if (slot.get(depth, index))
+        {
+            // the variable must not be shadowed by any of the inner frames
+            std::uint64_t const bit = name_bit(name);
+            variable_frame* frame = this;
+            for (/**/; depth != 0 && frame != nullptr; --depth)
+            {
+                if ((frame->names_mask_ & bit) != 0)
+                {
+                    break;
+                }
+                frame = frame->nextframe_.get();
+            }
+
+            if (depth == 0 && frame != nullptr &&
+                index < frame->names_.size() && frame->names_[index] == name)
+            {
+                return &frame->values_[index];
+            }
+        }
+
+        // fall back to looking up the variable by name
+        depth = 0;
+        for (variable_frame* frame = this; frame != nullptr;
+             frame = frame->nextframe_.get(), ++depth)
+        {
+            index = frame->find(name);
+            if (index != npos)
+            {
+                slot.set(depth, index);
+                return &frame->values_[index];
+            }
+        }
+        return nullptr;
+    }
+
+    std::size_t variable_frame::store(
         util::hashed_string const& name, primitive_argument_type&& var)
     {
         // variables are always created in the currently top-most environment
-        auto it = variables_.find(name);
-        if (it == variables_.end())
+        std::size_t index = find(name);
+        if (index == npos)
         {
-            using value_type = variables_map_type::value_type;
-            it = variables_.insert(value_type(name, std::move(var))).first;
+            values_.push_back(std::move(var));
+            try
+            {
+                names_.push_back(name);
+            }
+            catch (...)
+            {
+                values_.pop_back();
+                throw;
+            }
+            names_mask_ |= name_bit(name);
+            return values_.size() - 1;
         }
-        else
+
+        values_[index] = std::move(var);
+        return index;
+    }
+
+    primitive_argument_type& variable_frame::set_var(
+        util::hashed_string const& name, primitive_argument_type&& var)
+    {
+        return values_[store(name, std::move(var))];
+    }
+
+    primitive_argument_type& variable_frame::set_var(
+        util::hashed_string const& name, primitive_argument_type&& var,
+        variable_slot const& slot)
+    {
+        std::size_t depth = 0;
+        std::size_t index = 0;
+        if (slot.get(depth, index) && depth == 0 && index < names_.size() &&
+            names_[index] == name)
         {
-            it->second = std::move(var);
+            values_[index] = std::move(var);
+            return values_[index];
         }
-        return it->second;
+
+        index = store(name, std::move(var));
+        slot.set(0, index);
+        return values_[index];
     }
 }}
 
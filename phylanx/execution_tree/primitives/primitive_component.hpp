@@ -59,6 +59,45 @@ namespace phylanx { namespace execution_tree { namespace primitives
             primitive_->set_eval_context(std::move(ctx));
         }
 
+        // Create a regular instance sharing the given primitive, this is
+        // used for making a lightweight instance globally visible. The new
+        // instance takes over the registration of the given name (if any).
+        primitive_component(std::shared_ptr<primitive_component_base> p,
+                std::string const& name)
+          : primitive_(std::move(p))
+          , promoted_name_(name)
+        {
+        }
+
+        PHYLANX_EXPORT ~primitive_component();
+
+        // Create an instance which is not known to AGAS, see
+        // lightweight_primitives_enabled()
+        PHYLANX_EXPORT static std::shared_ptr<primitive_component>
+        create_lightweight(std::string const& type,
+            primitive_arguments_type&& operands, std::string const& name,
+            std::string const& codename, bool register_with_agas);
+
+        PHYLANX_EXPORT static std::shared_ptr<primitive_component>
+        create_lightweight(std::string const& type,
+            primitive_arguments_type&& operands, eval_context ctx,
+            std::string const& name, std::string const& codename,
+            bool register_with_agas);
+
+        // The global id of a lightweight instance, it is assigned once this
+        // future is waited on.
+        hpx::shared_future<hpx::id_type> const& lightweight_id() const
+        {
+            return lightweight_id_;
+        }
+
+        // the name a lightweight instance is registered with once it is
+        // given a global id
+        std::string const& lightweight_name() const
+        {
+            return lightweight_name_;
+        }
+
         // eval_action
         PHYLANX_EXPORT hpx::future<primitive_argument_type> eval(
             primitive_arguments_type const& params,
@@ -67,6 +106,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         PHYLANX_EXPORT hpx::future<primitive_argument_type> eval_single(
             primitive_argument_type && param, eval_context ctx) const;
 
+        // evaluate on the calling thread, the result is returned directly
+        // if it is available without suspending (not exposed as an action)
+        PHYLANX_EXPORT util::future_or_value<primitive_argument_type>
+        eval_fov(primitive_arguments_type const& params,
+            eval_context ctx) const;
+
         // store_action
         PHYLANX_EXPORT void store(primitive_arguments_type&&,
             primitive_arguments_type&&, eval_context ctx);
@@ -101,9 +146,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         PHYLANX_EXPORT std::int64_t get_eval_count(bool reset) const;
         PHYLANX_EXPORT std::int64_t get_eval_duration(bool reset) const;
         PHYLANX_EXPORT std::int64_t get_direct_execution(bool reset) const;
+        PHYLANX_EXPORT std::int64_t get_eval_decisions(
+            eval_mode mode, bool reset) const;
 
         PHYLANX_EXPORT void enable_measurements();
 
+        // access the shape of the most recent result for trace events
+        PHYLANX_EXPORT util::trace_event_shape get_last_result_shape() const;
+
         // decide whether to execute eval directly
         PHYLANX_EXPORT static hpx::launch select_direct_execution(
             eval_action, hpx::launch policy, hpx::naming::address_type lva);
@@ -111,8 +161,31 @@ namespace phylanx { namespace execution_tree { namespace primitives
             eval_single_action, hpx::launch policy,
             hpx::naming::address_type lva);
 
+        // decide whether to execute eval directly, used for evaluations
+        // which are invoked without going through the eval actions
+        PHYLANX_EXPORT hpx::launch select_direct_eval_execution(
+            hpx::launch policy) const;
+        PHYLANX_EXPORT hpx::launch select_direct_eval_execution(
+            hpx::launch policy, primitive_arguments_type const& params) const;
+        PHYLANX_EXPORT hpx::launch select_direct_eval_execution(
+            hpx::launch policy, primitive_argument_type const& param) const;
+
     private:
+        // return a client referring to this instance
+        primitive this_client() const;
+
+        // assign a global id to a lightweight instance
+        hpx::id_type promote_lightweight() const;
+
         std::shared_ptr<primitive_component_base> primitive_;
+
+        // lightweight instances only
+        std::weak_ptr<primitive_component> self_;
+        hpx::shared_future<hpx::id_type> lightweight_id_;
+        std::string lightweight_name_;
+
+        // promoted instances only
+        std::string promoted_name_;
     };
 }}}
 
@@ -9,6 +9,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/scheduling_policy.hpp>
+#include <phylanx/util/future_or_value.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/util.hpp>
@@ -16,6 +18,7 @@
 #include <hpx/runtime/naming_fwd.hpp>
 #include <hpx/util/internal_allocator.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
@@ -26,6 +29,12 @@
 #include <utility>
 #include <vector>
 
+namespace phylanx { namespace util
+{
+    struct trace_event;
+    struct trace_event_shape;
+}}
+
 namespace phylanx { namespace execution_tree
 {
     ///////////////////////////////////////////////////////////////////////////
@@ -55,6 +64,13 @@ namespace phylanx { namespace execution_tree
             virtual hpx::future<primitive_argument_type> eval(
                 primitive_argument_type && param, eval_context ctx) const;
 
+            // eval_action, returns the result directly if it is available
+            // without suspending. Primitives that can produce their result
+            // without allocating a shared state override this, the default
+            // forwards to eval() above.
+            virtual util::future_or_value<primitive_argument_type> eval_fov(
+                primitive_arguments_type const& params, eval_context ctx) const;
+
             // eval implementation
             virtual hpx::future<primitive_argument_type> eval(
                 primitive_arguments_type const& operands,
@@ -90,15 +106,26 @@ namespace phylanx { namespace execution_tree
             hpx::future<primitive_argument_type> do_eval(
                 primitive_argument_type && param, eval_context ctx) const;
 
+            util::future_or_value<primitive_argument_type> do_eval_fov(
+                primitive_arguments_type const& params,
+                eval_context ctx) const;
+
             // access data for performance counter
             std::int64_t get_eval_count(bool reset) const;
             std::int64_t get_eval_duration(bool reset) const;
             std::int64_t get_direct_execution(bool reset) const;
+            std::int64_t get_eval_decisions(eval_mode mode, bool reset) const;
 
             void enable_measurements();
 
-            // decide whether to execute eval directly
+            // decide whether to execute eval directly, this is delegated to
+            // the currently active scheduling policy; the input size passed
+            // to the policy is estimated from the given arguments (if any)
             hpx::launch select_direct_eval_execution(hpx::launch policy) const;
+            hpx::launch select_direct_eval_execution(hpx::launch policy,
+                primitive_arguments_type const& params) const;
+            hpx::launch select_direct_eval_execution(hpx::launch policy,
+                primitive_argument_type const& param) const;
 
             // A primitive was constructed with no operands if the list of
             // operands is empty or the only provided operand is 'nil' (used
@@ -120,9 +147,43 @@ namespace phylanx { namespace execution_tree
         protected:
             std::string generate_error_message(std::string const& msg) const;
             static bool get_sync_execution();
-            static std::int64_t get_ec_threshold();
-            static std::int64_t get_exec_upper_threshold();
-            static std::int64_t get_exec_lower_threshold();
+
+        private:
+            // estimate the amount of data processed by the next eval
+            std::int64_t estimate_input_size(
+                primitive_arguments_type const& params) const;
+            std::int64_t estimate_input_size(
+                primitive_argument_type const& param) const;
+
+            hpx::launch select_direct_eval_execution_impl(
+                hpx::launch policy, std::int64_t input_size) const;
+
+            // return the cost model of the type of this primitive, it is
+            // looked up on first use
+            cost_model* type_cost_model() const;
+
+            // return the identifier of this primitive in trace events, it is
+            // registered on first use
+            std::uint32_t trace_name() const;
+
+            // create the trace event for the next eval, the event is not
+            // recorded if tracing is disabled (its name is zero)
+            util::trace_event begin_trace_event(
+                primitive_arguments_type const& params) const;
+            util::trace_event begin_trace_event(
+                primitive_argument_type const& param) const;
+
+            // record the measurements once an eval has finished executing
+            void finalize_eval(hpx::future<primitive_argument_type>& f,
+                std::uint64_t started_at, std::int64_t input_size,
+                util::trace_event const& event) const;
+            void record_eval(std::uint64_t started_at,
+                std::int64_t input_size,
+                primitive_argument_type const* result,
+                util::trace_event& event) const;
+
+            // the shape of the result of the most recent traced eval
+            util::trace_event_shape last_result_shape() const;
 
         protected:
             static primitive_arguments_type noargs;
@@ -131,12 +192,28 @@ namespace phylanx { namespace execution_tree
             std::string const name_;        // the unique name of this primitive
             std::string const codename_;    // the name of the original code source
 
-            // Performance counter data
-            mutable std::int64_t eval_count_;
-            mutable std::int64_t eval_duration_;
-            mutable std::int64_t execute_directly_;
+            // Performance counter data, these are updated concurrently by
+            // all evaluations of this primitive
+            mutable std::atomic<std::int64_t> eval_count_;
+            mutable std::atomic<std::int64_t> eval_duration_;
+            mutable std::atomic<std::int64_t> execute_directly_;
             bool measurements_enabled_;
 
+            // Scheduling data
+            std::int64_t operands_size_;
+            mutable std::atomic<std::int64_t> last_result_size_;
+            mutable std::atomic<std::int64_t> eval_decisions_[4];   // by mode
+            mutable std::atomic<cost_model*> cost_model_;
+
+            // Timeline data, identifies this primitive in trace events. The
+            // shape of the most recent result is reported as the shape of
+            // the corresponding operand by the primitives referring to this
+            // one. Concurrent evaluations may leave a mix of two shapes.
+            mutable std::atomic<std::uint32_t> trace_name_;
+            mutable std::atomic<std::int8_t> last_result_ndim_;
+            mutable std::atomic<std::int64_t>
+                last_result_dims_[PHYLANX_MAX_DIMENSIONS];
+
 #if defined(HPX_HAVE_APEX)
             std::string eval_name_;
 #endif
@@ -243,6 +320,15 @@ namespace phylanx { namespace execution_tree
         std::string const& codename = "<unknown>",
         bool register_with_agas = true);
 
+    // When enabled, primitives created on the calling locality are plain
+    // reference counted objects. They are given a global id (and are
+    // registered with AGAS) only once a global reference to them is needed,
+    // e.g. when they are sent to another locality. Until then they are not
+    // visible to the performance counters. Disabled by default, can be
+    // enabled by setting 'phylanx.lightweight_primitives' to 1.
+    PHYLANX_EXPORT bool lightweight_primitives_enabled();
+    PHYLANX_EXPORT void enable_lightweight_primitives(bool enable = true);
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Primitive>
     std::shared_ptr<primitives::primitive_component_base>
@@ -0,0 +1,134 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_SCHEDULING_POLICY_HPP)
+#define PHYLANX_PRIMITIVES_SCHEDULING_POLICY_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+
+#include <hpx/runtime/launch_policy.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace phylanx { namespace execution_tree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The ways a primitive's eval can be scheduled. The numeric values are
+    // exposed through the /phylanx/primitives/<name>/eval_direct counter.
+    enum class eval_mode : std::int8_t
+    {
+        undecided = -1,     // use the launch policy requested by the caller
+        async = 0,          // schedule a new HPX thread
+        sync = 1,           // run eval inline on the calling thread
+        fork = 2            // run eval on a new thread, suspend the caller
+    };
+
+    PHYLANX_EXPORT hpx::launch to_launch_policy(
+        eval_mode mode, hpx::launch policy);
+    PHYLANX_EXPORT char const* get_eval_mode_name(eval_mode mode);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Estimate the amount of data (number of elements) held by the given
+    // value, used as the input size for the cost models below.
+    PHYLANX_EXPORT std::int64_t estimate_data_size(
+        primitive_argument_type const& val);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Online cost model for all primitives of the same type. The model fits
+    // eval_time(n) = overhead + n * cost_per_element using exponentially
+    // decayed least squares, which allows it to follow changing workloads.
+    //
+    // The model is updated by all evaluations of the primitive type
+    // concurrently. It is not protected by a lock, instead all sums are
+    // relaxed atomics; samples added concurrently may be lost, which is
+    // acceptable for an estimate used for scheduling decisions.
+    class PHYLANX_EXPORT cost_model
+    {
+    public:
+        explicit cost_model(double decay = 0.95);
+
+        cost_model(cost_model const&) = delete;
+        cost_model& operator=(cost_model const&) = delete;
+
+        // add a measured eval duration (in ns) for the given input size
+        void add_sample(std::int64_t size, std::int64_t duration);
+
+        // predicted eval duration (in ns) for the given input size
+        double predict(std::int64_t size) const;
+
+        // number of samples this model has seen so far
+        std::int64_t samples() const;
+
+        void reset();
+
+    private:
+        double const decay_;
+        std::atomic<double> weight_;
+        std::atomic<double> sum_n_;
+        std::atomic<double> sum_t_;
+        std::atomic<double> sum_nn_;
+        std::atomic<double> sum_nt_;
+        std::atomic<std::int64_t> samples_;
+    };
+
+    // Retrieve the cost model for all primitives of the given type, the
+    // returned reference stays valid for the lifetime of the application.
+    PHYLANX_EXPORT cost_model& get_cost_model(
+        std::string const& primitive_type);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Data a scheduling policy bases its decision on
+    struct scheduling_data
+    {
+        eval_mode current_mode;         // decision made last time
+        std::int64_t eval_count;        // number of measured evaluations
+        std::int64_t eval_duration;     // accumulated eval time (in ns)
+        std::int64_t input_size;        // estimated size of processed data
+        bool measurements_enabled;
+        cost_model const* model;        // cost model of the primitive type,
+                                        // only if needs_measurements()
+    };
+
+    // A scheduling policy decides how the eval of a primitive is executed.
+    // Policies are registered by name and can be switched at runtime.
+    class PHYLANX_EXPORT scheduling_policy
+    {
+    public:
+        virtual ~scheduling_policy() = default;
+
+        virtual eval_mode select(scheduling_data const& data) const = 0;
+
+        // Return whether this policy requires for every eval to be timed
+        // (instead of only evaluations with an undecided execution mode).
+        virtual bool needs_measurements() const
+        {
+            return false;
+        }
+    };
+
+    // Register a new scheduling policy with the given name, replaces any
+    // policy registered before using the same name.
+    PHYLANX_EXPORT void register_scheduling_policy(std::string const& name,
+        std::shared_ptr<scheduling_policy> policy);
+
+    // Switch the scheduling policy used by all primitives, throws if no
+    // policy with the given name was registered. The initial policy is
+    // selected using the configuration setting 'phylanx.scheduling_policy'
+    // (default: 'hysteresis').
+    PHYLANX_EXPORT void set_scheduling_policy(std::string const& name);
+    PHYLANX_EXPORT std::string get_scheduling_policy_name();
+    PHYLANX_EXPORT std::vector<std::string> list_scheduling_policies();
+
+    // Access the currently active scheduling policy
+    PHYLANX_EXPORT scheduling_policy const& get_scheduling_policy();
+}}
+
+#endif
@@ -33,6 +33,9 @@ namespace phylanx {namespace execution_tree { namespace primitives
         hpx::future<primitive_argument_type> eval(
             primitive_arguments_type const& args,
             eval_context) const override;
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
 
         hpx::future<primitive_argument_type> eval(
             primitive_argument_type&& arg, eval_context ctx) const override;
@@ -34,6 +34,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
             eval_context) const override;
         hpx::future<primitive_argument_type> eval(
             primitive_argument_type && arg, eval_context ctx) const override;
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& params,
+            eval_context ctx) const override;
 
         bool bind(primitive_arguments_type const& params,
             eval_context ctx) const override;
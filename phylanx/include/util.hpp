@@ -15,6 +15,7 @@
 #include <phylanx/util/serialization/ast.hpp>
 #include <phylanx/util/serialization/blaze.hpp>
 #include <phylanx/util/serialization/variant.hpp>
+#include <phylanx/util/trace_events.hpp>
 #include <phylanx/util/truncated_normal_distribution.hpp>
 #include <phylanx/util/variant.hpp>
 
@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -130,6 +131,16 @@ namespace phylanx { namespace ir
         using custom_storage1d_type = blaze::CustomVector<T, true, true>;
         using custom_storage2d_type = blaze::CustomMatrix<T, true, true>;
 
+        using sparse_storage1d_type = blaze::CompressedVector<T>;
+        using sparse_storage2d_type = blaze::CompressedMatrix<T>;
+
+        // compressed data is held with shared ownership, which allows for
+        // ref() to refer to it, it is copied before being modified
+        using shared_sparse_storage1d_type =
+            std::shared_ptr<sparse_storage1d_type>;
+        using shared_sparse_storage2d_type =
+            std::shared_ptr<sparse_storage2d_type>;
+
         constexpr static std::size_t const max_dimensions =
             PHYLANX_MAX_DIMENSIONS;
 
@@ -137,7 +148,8 @@ namespace phylanx { namespace ir
 
         using storage_type = util::variant<
             storage0d_type, storage1d_type, storage2d_type,
-            custom_storage0d_type, custom_storage1d_type, custom_storage2d_type>;
+            custom_storage0d_type, custom_storage1d_type, custom_storage2d_type,
+            shared_sparse_storage1d_type, shared_sparse_storage2d_type>;
 
         enum variant_index
         {
@@ -146,7 +158,9 @@ namespace phylanx { namespace ir
             storage2d = 2,
             custom_storage0d = 3,
             custom_storage1d = 4,
-            custom_storage2d = 5
+            custom_storage2d = 5,
+            sparse_storage1d = 6,
+            sparse_storage2d = 7
         };
 #else
         using storage3d_type = blaze::DynamicTensor<T>;
@@ -155,7 +169,8 @@ namespace phylanx { namespace ir
         using storage_type = util::variant<
             storage0d_type, storage1d_type, storage2d_type, storage3d_type,
             custom_storage0d_type, custom_storage1d_type,
-            custom_storage2d_type, custom_storage3d_type>;
+            custom_storage2d_type, custom_storage3d_type,
+            shared_sparse_storage1d_type, shared_sparse_storage2d_type>;
 
         enum variant_index
         {
@@ -166,7 +181,9 @@ namespace phylanx { namespace ir
             custom_storage0d = 4,
             custom_storage1d = 5,
             custom_storage2d = 6,
-            custom_storage3d = 7
+            custom_storage3d = 7,
+            sparse_storage1d = 8,
+            sparse_storage2d = 9
         };
 #endif
 
@@ -191,6 +208,11 @@ namespace phylanx { namespace ir
         explicit node_data(custom_storage1d_type const& values);
         explicit node_data(custom_storage1d_type && values);
 
+        /// Create node data referring to externally owned memory, the
+        /// memory is kept alive by all instances referring to it
+        node_data(custom_storage1d_type const& values,
+            std::shared_ptr<void const> keep_alive);
+
         /// Create node data for a 2-dimensional value
         explicit node_data(storage2d_type const& values);
         explicit node_data(storage2d_type && values);
@@ -198,6 +220,9 @@ namespace phylanx { namespace ir
         explicit node_data(custom_storage2d_type const& values);
         explicit node_data(custom_storage2d_type && values);
 
+        node_data(custom_storage2d_type const& values,
+            std::shared_ptr<void const> keep_alive);
+
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
         /// Create node data for a 3-dimensional value
         explicit node_data(storage3d_type const& values);
@@ -205,8 +230,19 @@ namespace phylanx { namespace ir
 
         explicit node_data(custom_storage3d_type const& values);
         explicit node_data(custom_storage3d_type && values);
+
+        node_data(custom_storage3d_type const& values,
+            std::shared_ptr<void const> keep_alive);
 #endif
 
+        /// Create node data for a sparse (compressed) 1- or 2-dimensional
+        /// value, only the non-zero elements are stored
+        explicit node_data(sparse_storage1d_type const& values);
+        explicit node_data(sparse_storage1d_type && values);
+
+        explicit node_data(sparse_storage2d_type const& values);
+        explicit node_data(sparse_storage2d_type && values);
+
         // conversion helpers for Python bindings and AST parsing
         explicit node_data(std::vector<T> const& values);
         explicit node_data(std::vector<std::vector<T>> const& values);
@@ -239,6 +275,18 @@ namespace phylanx { namespace ir
         template <typename U>
         static storage_type init_data_from_type(node_data<U> const& d)
         {
+            // sparse data is converted to dense storage as all consumers of
+            // converted data expect dense arrays
+            if (d.is_sparse())
+            {
+                increment_copy_construction_count();
+                if (d.num_dimensions() == 1)
+                {
+                    return storage_type(storage1d_type(d.sparse_vector()));
+                }
+                return storage_type(storage2d_type(d.sparse_matrix()));
+            }
+
             std::size_t dims = d.num_dimensions();
 
             switch (dims)
@@ -275,6 +323,9 @@ namespace phylanx { namespace ir
         node_data(node_data const& d);
         node_data(node_data && d);
 
+        /// Return owned dense storage to the storage pool
+        ~node_data();
+
         template <typename U, typename U1 =
             typename std::enable_if<!std::is_same<T, U>::value>::type>
         explicit node_data(node_data<U> const& d)
@@ -307,6 +358,12 @@ namespace phylanx { namespace ir
         node_data& operator=(custom_storage3d_type && val);
 #endif
 
+        node_data& operator=(sparse_storage1d_type const& val);
+        node_data& operator=(sparse_storage1d_type && val);
+
+        node_data& operator=(sparse_storage2d_type const& val);
+        node_data& operator=(sparse_storage2d_type && val);
+
         // conversion helpers for Python bindings and AST parsing
         node_data& operator=(std::vector<T> const& val);
         node_data& operator=(std::vector<std::vector<T>> const& values);
@@ -403,6 +460,24 @@ namespace phylanx { namespace ir
         storage0d_type& scalar_non_ref();
         storage0d_type const& scalar_non_ref() const;
 
+        /// Access the compressed storage of sparse node data
+        sparse_storage2d_type& sparse_matrix();
+        sparse_storage2d_type const& sparse_matrix() const;
+
+        sparse_storage1d_type& sparse_vector();
+        sparse_storage1d_type const& sparse_vector() const;
+
+        /// Return whether the underlying data is stored in compressed format
+        bool is_sparse() const;
+
+        /// Return the number of explicitly stored (non-zero) elements
+        std::size_t nonzeros() const;
+
+        /// Return a new instance of node_data holding the data in dense
+        /// format, this refers to (or moves) the data if it is dense already
+        node_data<T> to_dense() const&;
+        node_data<T> to_dense() &&;
+
         /// Extract the dimensionality of the underlying data array.
         std::size_t num_dimensions() const;
 
@@ -455,6 +530,10 @@ namespace phylanx { namespace ir
         void serialize(hpx::serialization::output_archive& ar, unsigned);
 
         storage_type data_;
+
+        // owner of the memory custom storage refers to, if not owned by
+        // another node_data instance (e.g. a mapped file)
+        std::shared_ptr<void const> keep_alive_;
         /// \endcond
     };
 
@@ -480,6 +559,10 @@ namespace phylanx { namespace ir
         node_data<std::uint8_t> const& lhs, node_data<std::uint8_t> const& rhs);
     PHYLANX_EXPORT bool operator==(
         node_data<std::int64_t> const& lhs, node_data<std::int64_t> const& rhs);
+    PHYLANX_EXPORT bool operator==(
+        node_data<float> const& lhs, node_data<float> const& rhs);
+    PHYLANX_EXPORT bool operator==(
+        node_data<std::int32_t> const& lhs, node_data<std::int32_t> const& rhs);
 
     template <typename T>
     bool operator!=(node_data<T> const& lhs, node_data<T> const& rhs)
@@ -491,6 +574,9 @@ namespace phylanx { namespace ir
     PHYLANX_EXPORT bool allclose(node_data<double> const& lhs,
         node_data<double> const& rhs, double rtol = 1e-5, double atol = 1e-8,
         bool equal_nan = false);
+    PHYLANX_EXPORT bool allclose(node_data<float> const& lhs,
+        node_data<float> const& rhs, double rtol = 1e-5, double atol = 1e-8,
+        bool equal_nan = false);
 
     inline bool allclose(node_data<std::uint8_t> const& lhs,
         node_data<std::uint8_t> const& rhs, double rtol = 0, double atol = 0,
@@ -506,6 +592,13 @@ namespace phylanx { namespace ir
         return lhs == rhs;
     }
 
+    inline bool allclose(node_data<std::int32_t> const& lhs,
+        node_data<std::int32_t> const& rhs, double rtol = 0, double atol = 0,
+        bool equal_nan = false)
+    {
+        return lhs == rhs;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<double> const& nd);
@@ -513,6 +606,10 @@ namespace phylanx { namespace ir
         std::ostream& out, node_data<std::uint8_t> const& nd);
     PHYLANX_EXPORT std::ostream& operator<<(
         std::ostream& out, node_data<std::int64_t> const& nd);
+    PHYLANX_EXPORT std::ostream& operator<<(
+        std::ostream& out, node_data<float> const& nd);
+    PHYLANX_EXPORT std::ostream& operator<<(
+        std::ostream& out, node_data<std::int32_t> const& nd);
 }}
 
 #endif
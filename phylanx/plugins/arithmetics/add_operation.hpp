@@ -35,6 +35,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             primitive_arguments_type const& operands,
             primitive_arguments_type const& args, eval_context ctx) const;
 
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& params,
+            eval_context ctx) const override;
+
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args, eval_context ctx) const;
+
     public:
         static match_pattern_type const match_data;
 
@@ -52,6 +60,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         void append_element(primitive_arguments_type& result,
             primitive_argument_type&& rhs) const;
+
+    public:
+        primitive_argument_type handle_sparse_operands(
+            primitive_argument_type&& op1, primitive_argument_type&& op2) const;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,7 @@
 #include <phylanx/plugins/arithmetics/cumprod.hpp>
 #include <phylanx/plugins/arithmetics/cumsum.hpp>
 #include <phylanx/plugins/arithmetics/div_operation.hpp>
+#include <phylanx/plugins/arithmetics/fused_elementwise_operation.hpp>
 #include <phylanx/plugins/arithmetics/generic_operation.hpp>
 #include <phylanx/plugins/arithmetics/generic_operation_bool.hpp>
 #include <phylanx/plugins/arithmetics/maximum.hpp>
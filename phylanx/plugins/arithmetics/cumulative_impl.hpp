@@ -9,6 +9,8 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/plugins/arithmetics/cumulative.hpp>
+#include <phylanx/util/parallel_scan.hpp>
+#include <phylanx/util/storage_pool.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -18,6 +20,7 @@
 #include <hpx/util/format.hpp>
 #include <hpx/util/optional.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -91,9 +94,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto v = value.vector();
-        blaze::DynamicVector<T> result(v.size());
+        auto result = util::storage_pool<T>::vector(v.size());
 
-        Op{}(v.begin(), v.end(), result.begin(), Op::template initial<T>());
+        util::parallel_inclusive_scan(v.begin(), v.end(), result.begin(),
+            Op::template initial<T>(), Op{});
 
         return primitive_argument_type{std::move(result)};
     }
@@ -108,17 +112,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto m = value.matrix();
-        blaze::DynamicVector<T> result(m.rows() * m.columns());
 
-        T init = Op::template initial<T>();
-        auto last = result.begin();
+        std::size_t const size = m.rows() * m.columns();
+        auto result = util::storage_pool<T>::vector(size);
 
-        for (std::size_t row = 0; row != m.rows(); ++row)
+        T const* first = m.data();
+        if (m.spacing() != m.columns())
         {
-            last = Op{}(m.begin(row), m.end(row), last, init);
-            init = *(last - 1);
+            // copy the padded rows into the flattened result, which is then
+            // scanned in place
+            util::for_each_scan_slice(m.rows(), m.columns(),
+                [&](std::size_t row)
+                {
+                    std::copy(m.begin(row), m.end(row),
+                        result.data() + row * m.columns());
+                });
+            first = result.data();
         }
 
+        util::parallel_inclusive_scan(first, first + size, result.data(),
+            Op::template initial<T>(), Op{});
+
         return primitive_argument_type{std::move(result)};
     }
 
@@ -131,16 +145,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto m = value.matrix();
-        blaze::DynamicMatrix<T> result(m.rows(), m.columns());
+        auto result = util::storage_pool<T>::matrix(m.rows(), m.columns());
 
-        T init = Op::template initial<T>();
-        for (std::size_t col = 0; col != m.columns(); ++col)
-        {
-            auto column = blaze::column(m, col);
-            auto result_column = blaze::column(result, col);
-
-            Op{}(column.begin(), column.end(), result_column.begin(), init);
-        }
+        util::scan_columns(1, m.rows(), m.columns(), Op::template initial<T>(),
+            Op{},
+            [&](std::size_t, std::size_t row) -> T const*
+            {
+                return m.data() + row * m.spacing();
+            },
+            [&](std::size_t, std::size_t row) -> T*
+            {
+                return result.data() + row * result.spacing();
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -154,13 +170,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto m = value.matrix();
-        blaze::DynamicMatrix<T> result(m.rows(), m.columns());
+        auto result = util::storage_pool<T>::matrix(m.rows(), m.columns());
 
-        T init = Op::template initial<T>();
-        for (std::size_t row = 0; row != m.rows(); ++row)
-        {
-            Op{}(m.begin(row), m.end(row), result.begin(row), init);
-        }
+        T const init = Op::template initial<T>();
+        util::for_each_scan_slice(m.rows(), m.columns(),
+            [&](std::size_t row)
+            {
+                Op{}(m.begin(row), m.end(row), result.begin(row), init);
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -209,21 +226,28 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto t = value.tensor();
-        blaze::DynamicVector<T> result(t.pages() * t.rows() * t.columns());
 
-        T init = Op::template initial<T>();
-        auto last = result.begin();
+        std::size_t const size = t.pages() * t.rows() * t.columns();
+        auto result = util::storage_pool<T>::vector(size);
 
-        for (std::size_t page = 0; page != t.pages(); ++page)
+        T const* first = t.data();
+        if (t.spacing() != t.columns())
         {
-            auto ps = blaze::pageslice(t, page);
-            for (std::size_t row = 0; row != t.rows(); ++row)
-            {
-                last = Op{}(ps.begin(row), ps.end(row), last, init);
-                init = *(last - 1);
-            }
+            // copy the padded rows into the flattened result, which is then
+            // scanned in place
+            util::for_each_scan_slice(t.pages() * t.rows(), t.columns(),
+                [&](std::size_t row)
+                {
+                    T const* src = t.data() + row * t.spacing();
+                    std::copy(src, src + t.columns(),
+                        result.data() + row * t.columns());
+                });
+            first = result.data();
         }
 
+        util::parallel_inclusive_scan(first, first + size, result.data(),
+            Op::template initial<T>(), Op{});
+
         return primitive_argument_type{std::move(result)};
     }
 
@@ -236,21 +260,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto t = value.tensor();
-
         blaze::DynamicTensor<T> result(t.pages(), t.rows(), t.columns());
-        T init = Op::template initial<T>();
-        for (std::size_t i = 0; i != t.rows(); ++i)
-        {
-            auto slice = blaze::rowslice(t, i);
-            auto result_slice = blaze::rowslice(result, i);
-            for (std::size_t j = 0; j != blaze::rows(slice); ++j)
-            {
-                auto row = blaze::row(slice, j);
-                auto result_row = blaze::row(result_slice, j);
 
-                Op{}(row.begin(), row.end(), result_row.begin(), init);
-            }
-        }
+        // the rows with the same index in all pages form independent
+        // matrices which are scanned along their columns
+        std::size_t const rows = t.rows();
+        util::scan_columns(rows, t.pages(), t.columns(),
+            Op::template initial<T>(), Op{},
+            [&](std::size_t row, std::size_t page) -> T const*
+            {
+                return t.data() + (page * rows + row) * t.spacing();
+            },
+            [&](std::size_t row, std::size_t page) -> T*
+            {
+                return result.data() + (page * rows + row) * result.spacing();
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -264,21 +288,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto t = value.tensor();
-
         blaze::DynamicTensor<T> result(t.pages(), t.rows(), t.columns());
-        T init = Op::template initial<T>();
-        for (std::size_t k = 0; k != t.pages(); ++k)
-        {
-            auto slice = blaze::pageslice(t, k);
-            auto result_slice = blaze::pageslice(result, k);
-            for (std::size_t j = 0; j != blaze::columns(slice); ++j)
-            {
-                auto col = blaze::column(slice, j);
-                auto result_col = blaze::column(result_slice, j);
 
-                Op{}(col.begin(), col.end(), result_col.begin(), init);
-            }
-        }
+        std::size_t const rows = t.rows();
+        util::scan_columns(t.pages(), rows, t.columns(),
+            Op::template initial<T>(), Op{},
+            [&](std::size_t page, std::size_t row) -> T const*
+            {
+                return t.data() + (page * rows + row) * t.spacing();
+            },
+            [&](std::size_t page, std::size_t row) -> T*
+            {
+                return result.data() + (page * rows + row) * result.spacing();
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -292,21 +314,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::move(ops[0]), name_, codename_);
 
         auto t = value.tensor();
-
         blaze::DynamicTensor<T> result(t.pages(), t.rows(), t.columns());
-        T init = Op::template initial<T>();
-        for (std::size_t k = 0; k != t.pages(); ++k)
-        {
-            auto slice = blaze::pageslice(t, k);
-            auto result_slice = blaze::pageslice(result, k);
-            for (std::size_t j = 0; j != blaze::rows(slice); ++j)
-            {
-                auto row = blaze::row(slice, j);
-                auto result_row = blaze::row(result_slice, j);
 
-                Op{}(row.begin(), row.end(), result_row.begin(), init);
-            }
-        }
+        // all rows of all pages are scanned independently
+        T const init = Op::template initial<T>();
+        util::for_each_scan_slice(t.pages() * t.rows(), t.columns(),
+            [&](std::size_t row)
+            {
+                T const* src = t.data() + row * t.spacing();
+                Op{}(src, src + t.columns(),
+                    result.data() + row * result.spacing(), init);
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -435,11 +453,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     return this_->template cumulative_helper<std::uint8_t>(
                         std::move(ops), std::move(axis));
 
+                case node_data_type_int32: HPX_FALLTHROUGH;
                 case node_data_type_int64:
                     return this_->template cumulative_helper<std::int64_t>(
                         std::move(ops), std::move(axis));
 
                 case node_data_type_unknown: HPX_FALLTHROUGH;
+                case node_data_type_float32: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->template cumulative_helper<double>(
                         std::move(ops), std::move(axis));
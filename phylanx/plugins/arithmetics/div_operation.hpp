@@ -35,6 +35,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         div_operation(primitive_arguments_type&& operands,
             std::string const& name, std::string const& codename);
+
+    public:
+        primitive_argument_type handle_sparse_operands(
+            primitive_argument_type&& op1, primitive_argument_type&& op2) const;
     };
 
     ///////////////////////////////////////////////////////////////////////////
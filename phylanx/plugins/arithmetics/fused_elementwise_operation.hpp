@@ -0,0 +1,123 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE_OPERATION_OCT_17_2019_1012AM)
+#define PHYLANX_PRIMITIVES_FUSED_ELEMENTWISE_OPERATION_OCT_17_2019_1012AM
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The __elementwise primitive evaluates a whole chain of elementwise
+    // operations (arithmetics, unary minus, a set of elementwise functions,
+    // and a final comparison) in one pass over the data, without
+    // materializing the intermediate results. It is normally created by the
+    // compiler (see phylanx.fuse_elementwise). Large arrays are processed
+    // concurrently (see phylanx.elementwise.threshold).
+    //
+    // The first operand is the program to run, represented as a string
+    // holding a sequence of space separated tokens in reverse polish
+    // notation: '$N' pushes the Nth leaf (the N+1st operand), '+', '-', '*',
+    // and '/' combine the two topmost values, 'neg' negates the topmost
+    // value, and 'absolute', 'square', 'sqrt', 'exp', 'log', 'sin', 'cos',
+    // and 'tanh' apply the function of the same name to the topmost value.
+    // The comparisons '<', '<=', '>', '>=', '==', and '!=' may be used as
+    // the last operation only, the result is then a boolean array. For
+    // instance, 'a * b + c < d' is represented as '$0 $1 * $2 + $3 <'.
+    class fused_elementwise_operation
+      : public primitive_component_base
+      , public std::enable_shared_from_this<fused_elementwise_operation>
+    {
+    public:
+        enum class opcode
+        {
+            load, add, sub, mul, div, neg,
+            absolute, square, sqrt, exp, log, sin, cos, tanh,
+            less, less_equal, greater, greater_equal, equal, not_equal
+        };
+
+        struct instruction
+        {
+            opcode code_;
+            std::size_t leaf_;      // leaf index, valid for opcode::load only
+        };
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static match_pattern_type const match_data;
+
+        fused_elementwise_operation() = default;
+
+        fused_elementwise_operation(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        void parse_program(std::string const& program);
+
+        hpx::future<primitive_argument_type> evaluate(
+            primitive_arguments_type&& leaves, eval_context ctx) const;
+
+        template <typename T>
+        primitive_argument_type evaluate_fused(
+            primitive_arguments_type&& leaves) const;
+
+        template <typename T, typename R>
+        primitive_argument_type run_fused(std::size_t numdims,
+            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes,
+            std::vector<ir::node_data<T>>&& leaves,
+            std::vector<T> const& scalars, std::size_t reuse) const;
+
+        primitive const& unfused_program() const;
+        primitive create_unfused_program() const;
+
+    private:
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        std::vector<instruction> program_;
+        std::size_t num_leaves_;
+        std::size_t max_depth_;
+        bool applies_functions_;    // the program uses elementwise functions
+        bool divides_;              // the program uses divisions
+        bool compares_;             // the last operation is a comparison
+
+        // the program as a tree of the primitives used without fusion, it
+        // is created on first use
+        mutable mutex_type mtx_;
+        mutable std::atomic<bool> has_unfused_{false};
+        mutable primitive unfused_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline primitive create_fused_elementwise_operation(
+        hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "__elementwise", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -45,6 +45,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         template <typename T>
         primitive_argument_type handle_numeric_operands_helper(
             primitive_arguments_type&& ops) const;
+        primitive_argument_type handle_sparse_operands(
+            primitive_argument_type&& op1, primitive_argument_type&& op2) const;
     };
 
     ///////////////////////////////////////////////////////////////////////////
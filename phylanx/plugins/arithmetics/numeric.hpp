@@ -43,6 +43,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             primitive_arguments_type const& operands,
             primitive_arguments_type const& args,
             eval_context ctx) const override;
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& params,
+            eval_context ctx) const override;
+
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const;
 
         template <typename T>
         using arg_type = ir::node_data<T>;
@@ -84,6 +92,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type numeric3d3d(args_type<T> && args) const;
 #endif
 
+        template <typename T>
+        ir::node_data<T> numeric_scalar(
+            arg_type<T>&& lhs, arg_type<T>&& rhs) const;
+        template <typename T>
+        ir::node_data<T> numeric_rows(arg_type<T>&& m, arg_type<T> const& x,
+            bool columns, bool matrix_lhs) const;
+
+        template <typename T>
+        primitive_argument_type numeric_broadcast(
+            primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
+        template <typename T>
+        primitive_argument_type numeric_broadcast(
+            primitive_arguments_type&& ops) const;
+
     protected:
         template <typename T>
         primitive_argument_type handle_numeric_operands_helper(
@@ -97,6 +119,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type handle_numeric_operands(
             primitive_arguments_type&& ops) const;
 
+        // Operations involving sparse operands are by default performed on
+        // dense copies of the data. Derived classes override this for
+        // operations that can produce a sparse result.
+        primitive_argument_type handle_sparse_operands(
+            primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
+
     protected:
         node_data_type dtype_;
     };
@@ -9,10 +9,13 @@
 #define PHYLANX_PRIMITIVES_NUMERIC_IMPL_OCT_31_2018_0138PM
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/broadcasting.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
 #include <phylanx/plugins/arithmetics/numeric.hpp>
+#include <phylanx/util/future_or_value.hpp>
+#include <phylanx/util/storage_pool.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/util.hpp>
@@ -107,7 +110,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             // Cannot reuse the memory if an operand is a reference
             if (rhs.is_ref())
             {
-                rhs = Op{}(lhs.vector(), rhs.vector());
+                rhs = util::pooled_vector<T>(
+                    Op{}(lhs.vector(), rhs.vector()));
             }
             else
             {
@@ -134,7 +138,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             {
                 if (result.is_ref())
                 {
-                    result = Op{}(result.vector(), curr.vector());
+                    result = util::pooled_vector<T>(
+                        Op{}(result.vector(), curr.vector()));
                     return std::move(result);
                 }
                 else
@@ -158,7 +163,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             // Cannot reuse the memory if an operand is a reference
             if (rhs.is_ref())
             {
-                rhs = Op{}(lhs.matrix(), rhs.matrix());
+                rhs = util::pooled_matrix<T>(
+                    Op{}(lhs.matrix(), rhs.matrix()));
             }
             else
             {
@@ -185,7 +191,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
             {
                 if (result.is_ref())
                 {
-                    result = Op{}(result.matrix(), curr.matrix());
+                    result = util::pooled_matrix<T>(
+                        Op{}(result.matrix(), curr.matrix()));
                 }
                 else
                 {
@@ -249,6 +256,294 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Return whether the operand x is broadcast along the rows of the
+        // matrix m, either as a row (a vector or a matrix with one row) or as
+        // a column (a matrix with one column).
+        template <typename T>
+        bool is_row_broadcast(ir::node_data<T> const& m,
+            ir::node_data<T> const& x, bool& columns)
+        {
+            if (m.num_dimensions() != 2)
+            {
+                return false;
+            }
+
+            auto const mdims = m.dimensions();
+            auto const xdims = x.dimensions();
+
+            columns = false;
+            if (x.num_dimensions() == 1)
+            {
+                return xdims[0] == mdims[1];
+            }
+
+            if (x.num_dimensions() == 2)
+            {
+                if (xdims[0] == 1 && xdims[1] == mdims[1])
+                {
+                    return true;
+                }
+
+                columns = true;
+                return xdims[1] == 1 && xdims[0] == mdims[0];
+            }
+
+            return false;
+        }
+
+        template <typename Op, typename Row, typename Vector>
+        void broadcast_row(
+            Row& dest, Row const& row, Vector const& v, bool row_lhs)
+        {
+            if (row_lhs)
+            {
+                dest = Op{}(row, v);
+            }
+            else
+            {
+                dest = Op{}(v, row);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A scalar combined with an array is applied through a uniform array of
+    // the same shape, which keeps the vectorized Blaze kernels in use.
+    template <typename Op, typename Derived>
+    template <typename T>
+    ir::node_data<T> numeric<Op, Derived>::numeric_scalar(
+        arg_type<T>&& lhs, arg_type<T>&& rhs) const
+    {
+        // Avoid overwriting references, avoid memory reallocation when
+        // possible
+        if (lhs.num_dimensions() == 0)
+        {
+            T const s = lhs.scalar();
+            switch (rhs.num_dimensions())
+            {
+            case 1:
+                {
+                    blaze::UniformVector<T> u(rhs.size(), s);
+                    if (rhs.is_ref())
+                    {
+                        rhs = util::pooled_vector<T>(Op{}(u, rhs.vector()));
+                    }
+                    else
+                    {
+                        rhs.vector() = Op{}(u, rhs.vector());
+                    }
+                    return std::move(rhs);
+                }
+
+            case 2:
+                {
+                    auto m = rhs.matrix();
+                    blaze::UniformMatrix<T> u(m.rows(), m.columns(), s);
+                    if (rhs.is_ref())
+                    {
+                        rhs = util::pooled_matrix<T>(Op{}(u, m));
+                    }
+                    else
+                    {
+                        m = Op{}(u, m);
+                    }
+                    return std::move(rhs);
+                }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            case 3:
+                {
+                    auto f = [s](T x) -> T { return Op{}(s, x); };
+                    if (rhs.is_ref())
+                    {
+                        rhs = blaze::map(rhs.tensor(), f);
+                    }
+                    else
+                    {
+                        rhs.tensor() = blaze::map(rhs.tensor(), f);
+                    }
+                    return std::move(rhs);
+                }
+#endif
+
+            default:
+                break;
+            }
+        }
+        else
+        {
+            T const s = rhs.scalar();
+            switch (lhs.num_dimensions())
+            {
+            case 1:
+                {
+                    blaze::UniformVector<T> u(lhs.size(), s);
+                    if (lhs.is_ref())
+                    {
+                        lhs = util::pooled_vector<T>(Op{}(lhs.vector(), u));
+                    }
+                    else
+                    {
+                        auto v = lhs.vector();
+                        Op{}.op_assign(v, u);
+                    }
+                    return std::move(lhs);
+                }
+
+            case 2:
+                {
+                    auto m = lhs.matrix();
+                    blaze::UniformMatrix<T> u(m.rows(), m.columns(), s);
+                    if (lhs.is_ref())
+                    {
+                        lhs = util::pooled_matrix<T>(Op{}(m, u));
+                    }
+                    else
+                    {
+                        Op{}.op_assign(m, u);
+                    }
+                    return std::move(lhs);
+                }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            case 3:
+                {
+                    auto f = [s](T x) -> T { return Op{}(x, s); };
+                    if (lhs.is_ref())
+                    {
+                        lhs = blaze::map(lhs.tensor(), f);
+                    }
+                    else
+                    {
+                        lhs.tensor() = blaze::map(lhs.tensor(), f);
+                    }
+                    return std::move(lhs);
+                }
+#endif
+
+            default:
+                break;
+            }
+        }
+
+        return broadcast_map<T>([](T x, T y) -> T { return Op{}(x, y); },
+            name_, codename_, lhs, rhs);
+    }
+
+    // A matrix combined with a row or a column is processed row by row, each
+    // row of the matrix is combined with either the row operand or a uniform
+    // vector holding the corresponding element of the column operand.
+    template <typename Op, typename Derived>
+    template <typename T>
+    ir::node_data<T> numeric<Op, Derived>::numeric_rows(arg_type<T>&& m,
+        arg_type<T> const& x, bool columns, bool matrix_lhs) const
+    {
+        using row_type =
+            blaze::CustomVector<T, blaze::unaligned, blaze::unpadded>;
+
+        auto mm = m.matrix();
+        std::size_t const rows = mm.rows();
+        std::size_t const cols = mm.columns();
+
+        // Cannot reuse the memory if the matrix operand is a reference
+        blaze::DynamicMatrix<T> result;
+        if (m.is_ref())
+        {
+            result = util::storage_pool<T>::matrix(rows, cols);
+        }
+
+        // the row operand is a vector or the first row of a matrix, the
+        // column operand is the first column of a matrix
+        T* xdata = nullptr;
+        std::size_t xspacing = 1;
+        if (x.num_dimensions() == 1)
+        {
+            xdata = x.vector().data();
+        }
+        else
+        {
+            auto xm = x.matrix();
+            xdata = xm.data();
+            xspacing = xm.spacing();
+        }
+
+        row_type const xrow(xdata, cols);
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            row_type const row(mm.data(i), cols);
+            row_type dest(m.is_ref() ? result.data(i) : mm.data(i), cols);
+
+            if (columns)
+            {
+                blaze::UniformVector<T> u(cols, xdata[i * xspacing]);
+                detail::broadcast_row<Op>(dest, row, u, matrix_lhs);
+            }
+            else
+            {
+                detail::broadcast_row<Op>(dest, row, xrow, matrix_lhs);
+            }
+        }
+
+        if (m.is_ref())
+        {
+            return ir::node_data<T>{std::move(result)};
+        }
+        return std::move(m);
+    }
+
+    // Scalars and rows or columns combined with matrices are handled by the
+    // Blaze kernels above. All other operands of different shapes are
+    // broadcast against each other without materializing the stretched
+    // operands.
+    template <typename Op, typename Derived>
+    template <typename T>
+    primitive_argument_type numeric<Op, Derived>::numeric_broadcast(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        auto lhs = extract_node_data<T>(std::move(op1), name_, codename_);
+        auto rhs = extract_node_data<T>(std::move(op2), name_, codename_);
+
+        if (lhs.num_dimensions() == 0 || rhs.num_dimensions() == 0)
+        {
+            return primitive_argument_type{
+                numeric_scalar<T>(std::move(lhs), std::move(rhs))};
+        }
+
+        bool columns = false;
+        if (detail::is_row_broadcast(lhs, rhs, columns))
+        {
+            return primitive_argument_type{
+                numeric_rows<T>(std::move(lhs), rhs, columns, true)};
+        }
+        if (detail::is_row_broadcast(rhs, lhs, columns))
+        {
+            return primitive_argument_type{
+                numeric_rows<T>(std::move(rhs), lhs, columns, false)};
+        }
+
+        return primitive_argument_type{broadcast_map<T>(
+            [](T x, T y) -> T { return Op{}(x, y); }, name_, codename_, lhs,
+            rhs)};
+    }
+
+    // more than two operands are combined pairwise from left to right
+    template <typename Op, typename Derived>
+    template <typename T>
+    primitive_argument_type numeric<Op, Derived>::numeric_broadcast(
+        primitive_arguments_type&& ops) const
+    {
+        primitive_argument_type result = std::move(ops[0]);
+        for (auto it = ops.begin() + 1; it != ops.end(); ++it)
+        {
+            result = handle_numeric_operands_helper<T>(
+                std::move(result), std::move(*it));
+        }
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Op, typename Derived>
     template <typename T>
@@ -269,15 +564,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 if (extract_numeric_value_dimensions(op1, name_, codename_) !=
                     extract_numeric_value_dimensions(op2, name_, codename_))
                 {
-                    auto sizes =
-                        extract_largest_dimensions(name_, codename_, op1, op2);
-
-                    auto lhs = extract_value_vector<T>(
-                        std::move(op1), sizes[0], name_, codename_);
-                    auto rhs = extract_value_vector<T>(
-                        std::move(op2), sizes[0], name_, codename_);
-
-                    return numeric1d1d<T>(std::move(lhs), std::move(rhs));
+                    return numeric_broadcast<T>(std::move(op1), std::move(op2));
                 }
 
                 return numeric1d1d<T>(
@@ -290,15 +577,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 if (extract_numeric_value_dimensions(op1, name_, codename_) !=
                     extract_numeric_value_dimensions(op2, name_, codename_))
                 {
-                    auto sizes =
-                        extract_largest_dimensions(name_, codename_, op1, op2);
-
-                    auto lhs = extract_value_matrix<T>(
-                        std::move(op1), sizes[0], sizes[1], name_, codename_);
-                    auto rhs = extract_value_matrix<T>(
-                        std::move(op2), sizes[0], sizes[1], name_, codename_);
-
-                    return numeric2d2d<T>(std::move(lhs), std::move(rhs));
+                    return numeric_broadcast<T>(std::move(op1), std::move(op2));
                 }
 
                 return numeric2d2d<T>(
@@ -312,15 +591,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 if (extract_numeric_value_dimensions(op1, name_, codename_) !=
                     extract_numeric_value_dimensions(op2, name_, codename_))
                 {
-                    auto sizes =
-                        extract_largest_dimensions(name_, codename_, op1, op2);
-
-                    auto lhs = extract_value_tensor<T>(std::move(op1), sizes[0],
-                        sizes[1], sizes[2], name_, codename_);
-                    auto rhs = extract_value_tensor<T>(std::move(op2), sizes[0],
-                        sizes[1], sizes[2], name_, codename_);
-
-                    return numeric3d3d<T>(std::move(lhs), std::move(rhs));
+                    return numeric_broadcast<T>(std::move(op1), std::move(op2));
                 }
 
                 return numeric3d3d<T>(
@@ -340,6 +611,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 name_, codename_));
     }
 
+    template <typename Op, typename Derived>
+    primitive_argument_type numeric<Op, Derived>::handle_sparse_operands(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        return derived().template handle_numeric_operands_helper<double>(
+            std::move(op1), std::move(op2));
+    }
+
     template <typename Op, typename Derived>
     primitive_argument_type numeric<Op, Derived>::handle_numeric_operands(
         primitive_argument_type&& op1, primitive_argument_type&& op2) const
@@ -350,6 +629,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             t = extract_common_type(op1, op2);
         }
 
+        if ((t == node_data_type_unknown || t == node_data_type_double) &&
+            (is_sparse_operand(op1) || is_sparse_operand(op2)))
+        {
+            return derived().handle_sparse_operands(
+                std::move(op1), std::move(op2));
+        }
+
         switch (t)
         {
         case node_data_type_bool:
@@ -362,6 +648,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(op1), std::move(op2));
 
+        case node_data_type_int32:
+            return derived()
+                .template handle_numeric_operands_helper<std::int32_t>(
+                    std::move(op1), std::move(op2));
+
+        case node_data_type_float32:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(op1), std::move(op2));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
@@ -383,6 +678,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
     numeric<Op, Derived>::handle_numeric_operands_helper(
         primitive_arguments_type&& ops) const
     {
+        auto const dims =
+            extract_numeric_value_dimensions(ops[0], name_, codename_);
+        for (auto const& op : ops)
+        {
+            if (extract_numeric_value_dimensions(op, name_, codename_) != dims)
+            {
+                return numeric_broadcast<T>(std::move(ops));
+            }
+        }
+
         auto sizes = extract_largest_dimensions(ops, name_, codename_);
         switch (extract_largest_dimension(ops, name_, codename_))
         {
@@ -476,6 +781,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 .template handle_numeric_operands_helper<std::int64_t>(
                     std::move(ops));
 
+        case node_data_type_int32:
+            return derived()
+                .template handle_numeric_operands_helper<std::int32_t>(
+                    std::move(ops));
+
+        case node_data_type_float32:
+            return derived().template handle_numeric_operands_helper<float>(
+                std::move(ops));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return derived().template handle_numeric_operands_helper<double>(
@@ -495,6 +809,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
     hpx::future<primitive_argument_type> numeric<Op, Derived>::eval(
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
+    {
+        return eval_fov(operands, args, std::move(ctx)).get_future();
+    }
+
+    template <typename Op, typename Derived>
+    util::future_or_value<primitive_argument_type>
+    numeric<Op, Derived>::eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        if (this->no_operands())
+        {
+            return eval_fov(params, noargs, std::move(ctx));
+        }
+        return eval_fov(this->operands(), params, std::move(ctx));
+    }
+
+    template <typename Op, typename Derived>
+    util::future_or_value<primitive_argument_type>
+    numeric<Op, Derived>::eval_fov(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
     {
         if (operands.size() < 2)
         {
@@ -523,17 +858,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
         auto this_ = this->shared_from_this();
         if (operands.size() == 2)
         {
-            // special case for 2 operands
-            return hpx::dataflow(hpx::launch::sync,
-                [this_ = std::move(this_)](
-                    hpx::future<primitive_argument_type>&& lhs,
-                    hpx::future<primitive_argument_type>&& rhs)
+            // special case for 2 operands, avoid creating intermediate
+            // futures if the operands are available already
+            return util::dataflow_or_value(
+                [this_ = std::move(this_)](primitive_argument_type&& lhs,
+                    primitive_argument_type&& rhs)
                 -> primitive_argument_type
                 {
-                    return this_->handle_numeric_operands(lhs.get(), rhs.get());
+                    return this_->handle_numeric_operands(
+                        std::move(lhs), std::move(rhs));
                 },
-                value_operand(operands[0], args, name_, codename_, ctx),
-                value_operand(operands[1], args, name_, codename_, ctx));
+                value_operand_fov(operands[0], args, name_, codename_, ctx),
+                value_operand_fov(operands[1], args, name_, codename_, ctx));
         }
 
         return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
@@ -35,6 +35,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
             primitive_arguments_type const& args,
             eval_context ctx) const override;
 
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& params,
+            eval_context ctx) const override;
+
+        util::future_or_value<primitive_argument_type> eval_fov(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const;
+
     public:
         comparison() = default;
 
@@ -48,21 +57,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type comparison0d(ir::node_data<T>&& lhs,
             ir::node_data<T>&& rhs, bool propagate_type) const;
 
+        template <typename T>
+        primitive_argument_type comparison_broadcast(ir::node_data<T>&& lhs,
+            ir::node_data<T>&& rhs, bool propagate_type) const;
+
         template <typename T>
         primitive_argument_type comparison1d1d(ir::node_data<T>&& lhs,
             ir::node_data<T>&& rhs, bool propagate_type) const;
         template <typename T>
         primitive_argument_type comparison1d(ir::node_data<T>&& lhs,
-            ir::node_data<T>&& rhs, bool propagate_type,
-            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const;
+            ir::node_data<T>&& rhs, bool propagate_type) const;
 
         template <typename T>
         primitive_argument_type comparison2d2d(ir::node_data<T>&& lhs,
             ir::node_data<T>&& rhs, bool propagate_type) const;
         template <typename T>
         primitive_argument_type comparison2d(ir::node_data<T>&& lhs,
-            ir::node_data<T>&& rhs, bool propagate_type,
-            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const;
+            ir::node_data<T>&& rhs, bool propagate_type) const;
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
         template <typename T>
@@ -70,8 +81,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ir::node_data<T>&& rhs, bool propagate_type) const;
         template <typename T>
         primitive_argument_type comparison3d(ir::node_data<T>&& lhs,
-            ir::node_data<T>&& rhs, bool propagate_type,
-            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const;
+            ir::node_data<T>&& rhs, bool propagate_type) const;
 #endif
 
         template <typename T>
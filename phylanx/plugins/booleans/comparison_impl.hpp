@@ -9,10 +9,12 @@
 #define PHYLANX_PRIMITIVES_COMPARISON_IMPL_SEP_02_2018_0443PM
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/broadcasting.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
 #include <phylanx/plugins/booleans/comparison.hpp>
+#include <phylanx/util/future_or_value.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -60,6 +62,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ir::node_data<std::uint8_t>{Op{}(lhs.scalar(), rhs.scalar())});
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Op>
+    template <typename T>
+    primitive_argument_type comparison<Op>::comparison_broadcast(
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
+        bool propagate_type) const
+    {
+        if (propagate_type)
+        {
+            return primitive_argument_type(broadcast_map<T>(
+                [](T x, T y) -> T { return Op{}(x, y) ? T(1) : T(0); },
+                name_, codename_, lhs, rhs));
+        }
+
+        return primitive_argument_type(broadcast_map<std::uint8_t>(
+            [](T x, T y) -> std::uint8_t { return Op{}(x, y); }, name_,
+            codename_, lhs, rhs));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Op>
     template <typename T>
@@ -104,29 +125,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template <typename Op>
     template <typename T>
     primitive_argument_type comparison<Op>::comparison1d(ir::node_data<T>&& lhs,
-        ir::node_data<T>&& rhs, bool propagate_type,
-        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const
+        ir::node_data<T>&& rhs, bool propagate_type) const
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicVector<T> lhs_data, rhs_data;
-
-            extract_value_vector(
-                lhs_data, std::move(lhs), sizes[0], name_, codename_);
-            extract_value_vector(
-                rhs_data, std::move(rhs), sizes[0], name_, codename_);
-
-            if (propagate_type)
-            {
-                return primitive_argument_type(ir::node_data<T>{
-                    blaze::map(lhs_data, rhs_data, [&](T x, T y) -> T {
-                        return Op{}(x, y) ? T(1) : T(0);
-                    })});
-            }
-
-            return primitive_argument_type(
-                ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                    [&](T x, T y) -> std::uint8_t { return Op{}(x, y); })});
+            return comparison_broadcast(
+                std::move(lhs), std::move(rhs), propagate_type);
         }
 
         return comparison1d1d(std::move(lhs), std::move(rhs), propagate_type);
@@ -176,29 +180,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template <typename Op>
     template <typename T>
     primitive_argument_type comparison<Op>::comparison2d(ir::node_data<T>&& lhs,
-        ir::node_data<T>&& rhs, bool propagate_type,
-        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const
+        ir::node_data<T>&& rhs, bool propagate_type) const
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicMatrix<T> lhs_data, rhs_data;
-
-            extract_value_matrix(
-                lhs_data, std::move(lhs), sizes[0], sizes[1], name_, codename_);
-            extract_value_matrix(
-                rhs_data, std::move(rhs), sizes[0], sizes[1], name_, codename_);
-
-            if (propagate_type)
-            {
-                return primitive_argument_type(ir::node_data<T>{
-                    blaze::map(lhs_data, rhs_data, [&](T x, T y) -> T {
-                        return Op{}(x, y) ? T(1) : T(0);
-                    })});
-            }
-
-            return primitive_argument_type(
-                ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                    [&](T x, T y) -> std::uint8_t { return Op{}(x, y); })});
+            return comparison_broadcast(
+                std::move(lhs), std::move(rhs), propagate_type);
         }
 
         return comparison2d2d(std::move(lhs), std::move(rhs), propagate_type);
@@ -249,29 +236,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template <typename Op>
     template <typename T>
     primitive_argument_type comparison<Op>::comparison3d(ir::node_data<T>&& lhs,
-        ir::node_data<T>&& rhs, bool propagate_type,
-        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const
+        ir::node_data<T>&& rhs, bool propagate_type) const
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicTensor<T> lhs_data, rhs_data;
-
-            extract_value_tensor(lhs_data, std::move(lhs), sizes[0], sizes[1],
-                sizes[2], name_, codename_);
-            extract_value_tensor(rhs_data, std::move(rhs), sizes[0], sizes[1],
-                sizes[2], name_, codename_);
-
-            if (propagate_type)
-            {
-                return primitive_argument_type(ir::node_data<T>{
-                    blaze::map(lhs_data, rhs_data, [&](T x, T y) -> T {
-                        return Op{}(x, y) ? T(1) : T(0);
-                    })});
-            }
-
-            return primitive_argument_type(
-                ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                    [&](T x, T y) -> std::uint8_t { return Op{}(x, y); })});
+            return comparison_broadcast(
+                std::move(lhs), std::move(rhs), propagate_type);
         }
 
         return comparison3d3d(std::move(lhs), std::move(rhs), propagate_type);
@@ -284,7 +254,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
         ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
         bool propagate_type) const
     {
-        auto sizes = extract_largest_dimensions(name_, codename_, lhs, rhs);
         switch (extract_largest_dimension(name_, codename_, lhs, rhs))
         {
         case 0:
@@ -292,16 +261,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         case 1:
             return comparison1d(
-                std::move(lhs), std::move(rhs), propagate_type, sizes);
+                std::move(lhs), std::move(rhs), propagate_type);
 
         case 2:
             return comparison2d(
-                std::move(lhs), std::move(rhs), propagate_type, sizes);
+                std::move(lhs), std::move(rhs), propagate_type);
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
         case 3:
             return comparison3d(
-                std::move(lhs), std::move(rhs), propagate_type, sizes);
+                std::move(lhs), std::move(rhs), propagate_type);
 #endif
         default:
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -539,6 +508,25 @@ namespace phylanx { namespace execution_tree { namespace primitives
     hpx::future<primitive_argument_type> comparison<Op>::eval(
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
+    {
+        return eval_fov(operands, args, std::move(ctx)).get_future();
+    }
+
+    template <typename Op>
+    util::future_or_value<primitive_argument_type> comparison<Op>::eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        if (this->no_operands())
+        {
+            return eval_fov(params, noargs, std::move(ctx));
+        }
+        return eval_fov(this->operands(), params, std::move(ctx));
+    }
+
+    template <typename Op>
+    util::future_or_value<primitive_argument_type> comparison<Op>::eval_fov(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
     {
         if (operands.size() < 2 || operands.size() > 3)
         {
@@ -562,7 +550,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         bool propagate_type = (operands.size() == 3 &&
             phylanx::execution_tree::extract_scalar_boolean_value(operands[2]));
 
-        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+        return util::dataflow_or_value(
             [this_ = std::move(this_), propagate_type](
                     primitive_argument_type&& op1,
                     primitive_argument_type&& op2)
@@ -571,9 +559,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return primitive_argument_type(
                     util::visit(visit_comparison{*this_, propagate_type},
                         std::move(op1.variant()), std::move(op2.variant())));
-            }),
-            value_operand(operands[0], args, name_, codename_, ctx),
-            value_operand(operands[1], args, name_, codename_, ctx));
+            },
+            value_operand_fov(operands[0], args, name_, codename_, ctx),
+            value_operand_fov(operands[1], args, name_, codename_, ctx));
     }
 }}}
 
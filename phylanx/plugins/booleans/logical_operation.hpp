@@ -49,21 +49,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type logical0d(
             ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
 
+        template <typename T>
+        primitive_argument_type logical_broadcast(
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
+
         template <typename T>
         primitive_argument_type logical1d1d(
             ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
         template <typename T>
         primitive_argument_type logical1d(
-            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
-            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const;
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
 
         template <typename T>
         primitive_argument_type logical2d2d(
             ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
         template <typename T>
         primitive_argument_type logical2d(
-            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
-            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const;
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
         template <typename T>
@@ -71,8 +73,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
         template <typename T>
         primitive_argument_type logical3d(
-            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
-            std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const;
+            ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
 #endif
         template <typename T>
         primitive_argument_type logical_all(
@@ -9,6 +9,7 @@
 #define PHYLANX_PRIMITIVES_LOGICAL_OPERATION_IMPL_SEP_02_2018_0703PM
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/broadcasting.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
@@ -224,6 +225,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ir::node_data<std::uint8_t>{Op{}(lhs.scalar(), rhs.scalar())});
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Op>
+    template <typename T>
+    primitive_argument_type logical_operation<Op>::logical_broadcast(
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const
+    {
+        return primitive_argument_type(broadcast_map<std::uint8_t>(
+            [](bool x, bool y) -> std::uint8_t { return Op{}(x, y); },
+            name_, codename_, lhs, rhs));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Op>
     template <typename T>
@@ -262,20 +274,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template <typename Op>
     template <typename T>
     primitive_argument_type logical_operation<Op>::logical1d(
-        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
-        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicVector<T> lhs_data, rhs_data;
-
-            extract_value_vector(
-                lhs_data, std::move(lhs), sizes[0], name_, codename_);
-            extract_value_vector(
-                rhs_data, std::move(rhs), sizes[0], name_, codename_);
-
-            return ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                [&](bool x, bool y) -> std::uint8_t { return Op{}(x, y); })};
+            return logical_broadcast(std::move(lhs), std::move(rhs));
         }
 
         return logical1d1d(std::move(lhs), std::move(rhs));
@@ -318,20 +321,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template <typename Op>
     template <typename T>
     primitive_argument_type logical_operation<Op>::logical2d(
-        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
-        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicMatrix<T> lhs_data, rhs_data;
-
-            extract_value_matrix(
-                lhs_data, std::move(lhs), sizes[0], sizes[1], name_, codename_);
-            extract_value_matrix(
-                rhs_data, std::move(rhs), sizes[0], sizes[1], name_, codename_);
-
-            return ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                [&](bool x, bool y) -> std::uint8_t { return Op{}(x, y); })};
+            return logical_broadcast(std::move(lhs), std::move(rhs));
         }
 
         return logical2d2d(std::move(lhs), std::move(rhs));
@@ -375,20 +369,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template <typename Op>
     template <typename T>
     primitive_argument_type logical_operation<Op>::logical3d(
-        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs,
-        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes) const
+        ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const
     {
         if (lhs.dimensions() != rhs.dimensions())
         {
-            blaze::DynamicTensor<T> lhs_data, rhs_data;
-
-            extract_value_tensor(lhs_data, std::move(lhs), sizes[0], sizes[1],
-                sizes[2], name_, codename_);
-            extract_value_tensor(rhs_data, std::move(rhs), sizes[0], sizes[1],
-                sizes[2], name_, codename_);
-
-            return ir::node_data<std::uint8_t>{blaze::map(lhs_data, rhs_data,
-                [&](bool x, bool y) -> std::uint8_t { return Op{}(x, y); })};
+            return logical_broadcast(std::move(lhs), std::move(rhs));
         }
 
         return logical3d3d(std::move(lhs), std::move(rhs));
@@ -401,21 +386,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type logical_operation<Op>::logical_all(
         ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const
     {
-        auto sizes = extract_largest_dimensions(name_, codename_, lhs, rhs);
         switch (extract_largest_dimension(name_, codename_, lhs, rhs))
         {
         case 0:
             return logical0d(std::move(lhs), std::move(rhs));
 
         case 1:
-            return logical1d(std::move(lhs), std::move(rhs), sizes);
+            return logical1d(std::move(lhs), std::move(rhs));
 
         case 2:
-            return logical2d(std::move(lhs), std::move(rhs), sizes);
+            return logical2d(std::move(lhs), std::move(rhs));
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
         case 3:
-            return logical3d(std::move(lhs), std::move(rhs), sizes);
+            return logical3d(std::move(lhs), std::move(rhs));
 #endif
         default:
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
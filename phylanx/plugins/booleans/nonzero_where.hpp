@@ -21,6 +21,11 @@
 
 namespace phylanx { namespace execution_tree { namespace primitives
 {
+    // Implements nonzero(cond) and where(cond, x, y). The compiler turns
+    // where(a < b, x, y) into __where_compare("__lt", a, b, x, y) if
+    // phylanx.fuse_elementwise is enabled, which evaluates the comparison
+    // while selecting the elements instead of creating the array holding
+    // the condition.
     class nonzero_where
       : public primitive_component_base
       , public std::enable_shared_from_this<nonzero_where>
@@ -33,6 +38,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     public:
         static std::vector<match_pattern_type> const match_data;
 
+        enum class comparison_kind
+        {
+            none, less, less_equal, greater, greater_equal, equal, not_equal
+        };
+
         nonzero_where() = default;
 
         nonzero_where(primitive_arguments_type&& operands,
@@ -46,25 +56,40 @@ namespace phylanx { namespace execution_tree { namespace primitives
         struct visit_nonzero;
         struct visit_where;
 
+        comparison_kind extract_comparison_kind() const;
+
         template <typename T>
         primitive_argument_type nonzero_elements(ir::node_data<T>&& op) const;
 
         template <typename R, typename T>
-        primitive_argument_type where_elements0d(ir::node_data<T>&& op,
-            primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
-        template <typename R, typename T>
-        primitive_argument_type where_elements1d(ir::node_data<T>&& op,
-            primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
-        template <typename R, typename T>
-        primitive_argument_type where_elements2d(ir::node_data<T>&& op,
+        primitive_argument_type where_elements(ir::node_data<T>&& op,
             primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
 
-        template <typename R, typename T>
-        primitive_argument_type where_elements(ir::node_data<T>&& op,
+        primitive_argument_type where_compare(primitive_argument_type&& a,
+            primitive_argument_type&& b, primitive_argument_type&& lhs,
+            primitive_argument_type&& rhs) const;
+
+        template <typename T>
+        primitive_argument_type where_compare_op(ir::node_data<T>&& a,
+            ir::node_data<T>&& b, primitive_argument_type&& lhs,
+            primitive_argument_type&& rhs) const;
+
+        template <typename Op, typename T>
+        primitive_argument_type where_compare_dispatch(ir::node_data<T>&& a,
+            ir::node_data<T>&& b, primitive_argument_type&& lhs,
+            primitive_argument_type&& rhs) const;
+
+        template <typename R, typename Op, typename T>
+        primitive_argument_type where_compare_elements(
+            ir::node_data<T> const& a, ir::node_data<T> const& b,
             primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
 
+        primitive_argument_type evaluate_comparison(
+            primitive_argument_type&& a, primitive_argument_type&& b) const;
+
         bool nonzero_;
         bool where_;
+        comparison_kind comparison_;    // __where_compare only
     };
 
     inline primitive create_nonzero(
@@ -84,6 +109,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return create_primitive_component(
             locality, "where", std::move(operands), name, codename);
     }
+
+    inline primitive create_where_compare(
+        hpx::id_type const& locality,
+        primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "__where_compare",
+            std::move(operands), name, codename);
+    }
 }}}
 
 #endif
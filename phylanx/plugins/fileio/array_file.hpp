@@ -0,0 +1,70 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_ARRAY_FILE_HPP)
+#define PHYLANX_PRIMITIVES_ARRAY_FILE_HPP
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+// Native array file format used by file_read and file_write for numeric and
+// boolean arrays. A file consists of a 64 byte header followed by the raw
+// array elements:
+//
+//     offset  size  contents
+//          0     8  magic, "PHYARRAY"
+//          8     4  version (1)
+//         12     4  byte order marker (0x01020304, native byte order)
+//         16     4  element type (0: bool, 1: int64, 2: float64,
+//                   3: float32, 4: int32)
+//         20     4  number of dimensions (0 to 3)
+//         24     8  pages (1 for less than three dimensions)
+//         32     8  rows (1 for less than two dimensions)
+//         40     8  columns (number of elements for vectors)
+//         48     8  spacing, i.e. the number of elements stored per row
+//         56     8  offset of the first element (64)
+//
+// The rows are stored with the padding used by Blaze, the padding elements
+// are zero. Arrays read from a file whose spacing and alignment satisfy the
+// requirements of Blaze on the reading machine reference the memory mapped
+// file directly instead of copying the data.
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        constexpr std::size_t array_file_header_size = 64;
+
+        // returns true if the given value can be stored as an array file
+        bool is_array_file_value(primitive_argument_type const& val);
+
+        // Read the array stored in the given file, returns false if the file
+        // does not exist or is not an array file. The memory mappings backing
+        // the returned arrays are kept alive until the process exits.
+        bool read_array_file(std::string const& filename,
+            primitive_argument_type& result, std::string const& name,
+            std::string const& codename);
+
+        // Write the given array to a file.
+        void write_array_file(std::string const& filename,
+            primitive_argument_type const& val, std::string const& name,
+            std::string const& codename);
+
+        // Write the given blocks of data to a file. The data is written to a
+        // temporary file first, which is then moved into place. This leaves
+        // the mappings of a previous version of the file intact.
+        void replace_file(std::string const& filename,
+            std::initializer_list<std::pair<char const*, std::size_t>> blocks,
+            std::string const& name, std::string const& codename);
+    }
+}}}
+
+#endif
@@ -14,16 +14,37 @@
 
 #include <hpx/lcos/future.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace phylanx { namespace execution_tree { namespace primitives
 {
+    /// \brief Read a dataset (or a hyperslab of it) from a HDF5 file
+    ///
+    /// file_read_hdf5 reads the selected part of the dataset into memory,
+    /// file_read_hdf5_blocks returns a list of primitives each of which
+    /// loads one block of rows of the dataset only once it is evaluated.
     class file_read_hdf5 : public primitive_component_base
     {
     public:
-        static match_pattern_type const match_data;
+        enum read_mode
+        {
+            read_mode_dataset,      // file_read_hdf5
+            read_mode_blocks        // file_read_hdf5_blocks
+        };
+
+        // selection along one dimension of the dataset
+        struct slab
+        {
+            std::size_t start;
+            std::size_t count;
+            std::size_t step;
+        };
+
+        static std::vector<match_pattern_type> const match_data;
 
         file_read_hdf5() = default;
 
@@ -34,6 +55,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
             primitive_arguments_type const& operands,
             primitive_arguments_type const& args,
             eval_context ctx) const override;
+
+    private:
+        slab extract_slab(primitive_argument_type&& val, std::size_t size,
+            char const* argname) const;
+
+        primitive_argument_type read_dataset(std::string const& filename,
+            std::string const& dataset, primitive_argument_type&& rows,
+            primitive_argument_type&& columns) const;
+
+        primitive_argument_type read_blocks(std::string const& filename,
+            std::string const& dataset, std::int64_t blocksize) const;
+
+    private:
+        read_mode mode_;
     };
 
     inline primitive create_file_read_hdf5(hpx::id_type const& locality,
@@ -43,6 +78,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return create_primitive_component(
             locality, "file_read_hdf5", std::move(operands), name, codename);
     }
+
+    inline primitive create_file_read_hdf5_blocks(
+        hpx::id_type const& locality, primitive_arguments_type&& operands,
+        std::string const& name = "", std::string const& codename = "")
+    {
+        return create_primitive_component(locality, "file_read_hdf5_blocks",
+            std::move(operands), name, codename);
+    }
 }}}
 
 #endif
@@ -83,10 +83,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return argminmax0d(numargs, extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return argminmax0d(numargs, extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return argminmax0d(numargs, extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -163,10 +165,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return argminmax1d(numargs, extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return argminmax1d(numargs, extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return argminmax1d(numargs, extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -329,10 +333,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return argminmax2d(numargs, extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return argminmax2d(numargs, extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return argminmax2d(numargs, extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -535,10 +541,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return argminmax3d(numargs, extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return argminmax3d(numargs, extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return argminmax3d(numargs, extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
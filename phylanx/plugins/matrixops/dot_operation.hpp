@@ -105,6 +105,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type dot_nd(
             primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
 
+        // dot product involving at least one sparse operand
+        primitive_argument_type dot_sparse(
+            primitive_argument_type&& lhs, primitive_argument_type&& rhs) const;
+
         template <typename T>
         primitive_argument_type dot0d(
             ir::node_data<T>&& lhs, ir::node_data<T>&& rhs) const;
@@ -12,6 +12,7 @@
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/dot_operation.hpp>
+#include <phylanx/util/blocked_gemm.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -195,7 +196,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the operands have incompatible number of dimensions"));
         }
         // lhs = blaze::trans(rhs.matrix()) * lhs.vector();
-        lhs = blaze::trans(blaze::trans(lhs.vector()) * rhs.matrix());
+        auto m = rhs.matrix();
+        if (util::use_blocked_gemv(blaze::trans(m), lhs.vector()))
+        {
+            lhs = util::blocked_gemv<T>(blaze::trans(m), lhs.vector());
+        }
+        else
+        {
+            lhs = blaze::trans(blaze::trans(lhs.vector()) * m);
+        }
         return primitive_argument_type{std::move(lhs)};
     }
 
@@ -287,7 +296,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the operands have incompatible number of dimensions"));
         }
 
-        rhs = lhs.matrix() * rhs.vector();
+        auto m = lhs.matrix();
+        if (util::use_blocked_gemv(m, rhs.vector()))
+        {
+            rhs = util::blocked_gemv<T>(m, rhs.vector());
+        }
+        else
+        {
+            rhs = m * rhs.vector();
+        }
         return primitive_argument_type{std::move(rhs)};
     }
 
@@ -303,6 +320,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     "the operands have incompatible number of dimensions"));
         }
         using T = blaze::ElementType_t<typename std::decay<Matrix1>::type>;
+        if (util::use_blocked_gemm(lhs, rhs))
+        {
+            return primitive_argument_type{util::blocked_gemm<T>(lhs, rhs)};
+        }
         blaze::DynamicMatrix<T> result = lhs * rhs;
         return primitive_argument_type{std::move(result)};
     }
@@ -152,6 +152,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
             distribution_parameters_type&& params) const;
 #endif
+
+    private:
+        // every evaluation draws its numbers from the next stream
+        mutable util::random_stream_sequence streams_;
     };
 
     inline primitive create_random(hpx::id_type const& locality,
@@ -0,0 +1,89 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_MATRIXOPS_SPARSE_OPERATIONS)
+#define PHYLANX_MATRIXOPS_SPARSE_OPERATIONS
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
+#include <phylanx/ir/node_data.hpp>
+
+#include <hpx/lcos/future.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    /// \brief Convert between dense and sparse (compressed) storage
+    /// \param a         The vector or matrix to convert
+    ///
+    /// sparse(a) stores the non-zero elements of the given vector or matrix
+    /// in compressed format, todense(a) converts sparse data back into its
+    /// dense representation, and issparse(a) returns whether its argument is
+    /// stored in compressed format.
+    class sparse_operations
+      : public primitive_component_base
+      , public std::enable_shared_from_this<sparse_operations>
+    {
+    public:
+        enum sparse_mode
+        {
+            sparse_mode_to_sparse,      // sparse
+            sparse_mode_to_dense,       // todense
+            sparse_mode_is_sparse       // issparse
+        };
+
+    protected:
+        hpx::future<primitive_argument_type> eval(
+            primitive_arguments_type const& operands,
+            primitive_arguments_type const& args,
+            eval_context ctx) const override;
+
+    public:
+        static std::vector<match_pattern_type> const match_data;
+
+        sparse_operations() = default;
+
+        sparse_operations(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename);
+
+    private:
+        primitive_argument_type to_sparse(primitive_argument_type&& arg) const;
+        primitive_argument_type to_dense(primitive_argument_type&& arg) const;
+
+    private:
+        sparse_mode mode_;
+    };
+
+    inline primitive create_sparse(hpx::id_type const& locality,
+        primitive_arguments_type&& operands, std::string const& name = "",
+        std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "sparse", std::move(operands), name, codename);
+    }
+
+    inline primitive create_todense(hpx::id_type const& locality,
+        primitive_arguments_type&& operands, std::string const& name = "",
+        std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "todense", std::move(operands), name, codename);
+    }
+
+    inline primitive create_issparse(hpx::id_type const& locality,
+        primitive_arguments_type&& operands, std::string const& name = "",
+        std::string const& codename = "")
+    {
+        return create_primitive_component(
+            locality, "issparse", std::move(operands), name, codename);
+    }
+}}}
+
+#endif
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -145,6 +146,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             ir::range&& axes, bool keepdims,
             primitive_argument_type&& initial) const;
 
+        // reduce compressed (sparse) data, operations that are not affected
+        // by zero elements are applied to the non-zero elements only
+        primitive_argument_type statisticsnd_sparse(
+            primitive_argument_type&& arg,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type&& initial, std::true_type) const;
+        primitive_argument_type statisticsnd_sparse(
+            primitive_argument_type&& arg,
+            hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+            primitive_argument_type&& initial, std::false_type) const;
+
     private:
         node_data_type dtype_;
     };
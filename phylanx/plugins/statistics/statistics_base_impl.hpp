@@ -11,6 +11,7 @@
 #include <phylanx/config.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/statistics/statistics_base.hpp>
+#include <phylanx/plugins/statistics/statistics_reduce.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
 
 #include <hpx/include/lcos.hpp>
@@ -25,6 +26,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -97,7 +99,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         auto v = arg.vector();
-        T result = op(v, initial_value);
+        T result = detail::reduce_chunked(op, initial_value, v.size(),
+            v.size(),
+            [&](Op<T>& chunk_op, std::size_t begin, std::size_t end,
+                Init value) -> Init
+            {
+                auto chunk = blaze::subvector(v, begin, end - begin);
+                return chunk_op(chunk, value);
+            });
 
         if (keepdims)
         {
@@ -118,7 +127,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         auto m = arg.matrix();
 
         Op<T> op{name_, codename_};
-        std::size_t size = 0;
+        std::size_t size = m.rows() * m.columns();
 
         Init result = Op<T>::initial();
         if (initial)
@@ -126,12 +135,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             result = *initial;
         }
 
-        for (std::size_t i = 0; i != m.rows(); ++i)
-        {
-            auto row = blaze::row(m, i);
-            result = op(row, result);
-            size += row.size();
-        }
+        result = detail::reduce_chunked(op, result, m.rows(), size,
+            [&](Op<T>& chunk_op, std::size_t begin, std::size_t end,
+                Init value) -> Init
+            {
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    auto row = blaze::row(m, i);
+                    value = chunk_op(row, value);
+                }
+                return value;
+            });
 
         if (keepdims)
         {
@@ -156,26 +170,30 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        // the columns are reduced in tiles streaming over the rows
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& col_op, std::size_t j, std::size_t begin,
+                          std::size_t size, Init value) -> Init
+        {
+            auto col = blaze::column(m, j);
+            auto segment = blaze::subvector(col, begin, size);
+            return col_op(segment, value);
+        };
+
         if (keepdims)
         {
             blaze::DynamicMatrix<T> result(1, m.columns());
-            for (std::size_t i = 0; i != m.columns(); ++i)
-            {
-                Op<T> op{name_, codename_};
-                auto col = blaze::column(m, i);
-                result(0, i) = op.finalize(op(col, initial_value), col.size());
-            }
+            detail::reduce_strided_sequences(op, initial_value, m.columns(),
+                m.rows(), reduce,
+                [&](std::size_t j, auto value) { result(0, j) = value; });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicVector<T> result(m.columns());
-        for (std::size_t i = 0; i != m.columns(); ++i)
-        {
-            Op<T> op{name_, codename_};
-            auto col = blaze::column(m, i);
-            result[i] = op.finalize(op(col, initial_value), col.size());
-        }
+        detail::reduce_strided_sequences(op, initial_value, m.columns(),
+            m.rows(), reduce,
+            [&](std::size_t j, auto value) { result[j] = value; });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -194,26 +212,26 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& row_op, std::size_t i, Init value) -> Init
+        {
+            auto row = blaze::row(m, i);
+            return row_op(row, value);
+        };
+
         if (keepdims)
         {
             blaze::DynamicMatrix<T> result(m.rows(), 1);
-            for (std::size_t i = 0; i != m.rows(); ++i)
-            {
-                Op<T> op{name_, codename_};
-                auto row = blaze::row(m, i);
-                result(i, 0) = op.finalize(op(row, initial_value), row.size());
-            }
+            detail::reduce_sequences(op, initial_value, m.rows(), m.columns(),
+                reduce,
+                [&](std::size_t i, auto value) { result(i, 0) = value; });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicVector<T> result(m.rows());
-        for (std::size_t i = 0; i != m.rows(); ++i)
-        {
-            Op<T> op{name_, codename_};
-            auto row = blaze::row(m, i);
-            result[i] = op.finalize(op(row, initial_value), row.size());
-        }
+        detail::reduce_sequences(op, initial_value, m.rows(), m.columns(),
+            reduce, [&](std::size_t i, auto value) { result[i] = value; });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -259,7 +277,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         Op<T> op{name_, codename_};
 
-        std::size_t size = 0;
+        std::size_t size = t.pages() * t.rows() * t.columns();
 
         Init result = Op<T>::initial();
         if (initial)
@@ -267,16 +285,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
             result = *initial;
         }
 
-        for (std::size_t k = 0; k != t.pages(); ++k)
-        {
-            auto page = blaze::pageslice(t, k);
-            for (std::size_t i = 0; i != t.rows(); ++i)
+        result = detail::reduce_chunked(op, result, t.pages() * t.rows(), size,
+            [&](Op<T>& chunk_op, std::size_t begin, std::size_t end,
+                Init value) -> Init
             {
-                auto row = blaze::row(page, i);
-                result = op(row, result);
-                size += row.size();
-            }
-        }
+                for (std::size_t k = begin; k != end; ++k)
+                {
+                    auto page = blaze::pageslice(t, k / t.rows());
+                    auto row = blaze::row(page, k % t.rows());
+                    value = chunk_op(row, value);
+                }
+                return value;
+            });
 
         if (keepdims)
         {
@@ -301,35 +321,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        // the sequences along the pages are reduced in tiles of neighboring
+        // columns streaming over the pages
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& seq_op, std::size_t k, std::size_t begin,
+                          std::size_t size, Init value) -> Init
+        {
+            auto slice = blaze::rowslice(t, k / t.columns());
+            auto row = blaze::row(slice, k % t.columns());
+            auto segment = blaze::subvector(row, begin, size);
+            return seq_op(segment, value);
+        };
+
+        std::size_t const count = t.rows() * t.columns();
         if (keepdims)
         {
             blaze::DynamicTensor<T> result(1, t.rows(), t.columns());
-            for (std::size_t i = 0; i != t.rows(); ++i)
-            {
-                auto slice = blaze::rowslice(t, i);
-                for (std::size_t j = 0; j != t.columns(); ++j)
-                {
-                    Op<T> op{name_, codename_};
-                    auto row = blaze::row(slice, j);
-                    result(0, i, j) =
-                        op.finalize(op(row, initial_value), row.size());
-                }
-            }
+            detail::reduce_strided_sequences(op, initial_value, count,
+                t.pages(), reduce, [&](std::size_t k, auto value) {
+                    result(0, k / t.columns(), k % t.columns()) = value;
+                });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicMatrix<T> result(t.rows(), t.columns());
-        for (std::size_t i = 0; i != t.rows(); ++i)
-        {
-            auto slice = blaze::rowslice(t, i);
-            for (std::size_t j = 0; j != t.columns(); ++j)
-            {
-                Op<T> op{name_, codename_};
-                auto row = blaze::row(slice, j);
-                result(i, j) = op.finalize(op(row, initial_value), row.size());
-            }
-        }
+        detail::reduce_strided_sequences(op, initial_value, count, t.pages(),
+            reduce, [&](std::size_t k, auto value) {
+                result(k / t.columns(), k % t.columns()) = value;
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -348,35 +368,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        // the columns of each page are reduced in tiles streaming over the
+        // rows
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& col_op, std::size_t k, std::size_t begin,
+                          std::size_t size, Init value) -> Init
+        {
+            auto slice = blaze::pageslice(t, k / t.columns());
+            auto col = blaze::column(slice, k % t.columns());
+            auto segment = blaze::subvector(col, begin, size);
+            return col_op(segment, value);
+        };
+
+        std::size_t const count = t.pages() * t.columns();
         if (keepdims)
         {
             blaze::DynamicTensor<T> result(t.pages(), 1, t.columns());
-            for (std::size_t k = 0; k != t.pages(); ++k)
-            {
-                auto slice = blaze::pageslice(t, k);
-                for (std::size_t j = 0; j != t.columns(); ++j)
-                {
-                    Op<T> op{name_, codename_};
-                    auto col = blaze::column(slice, j);
-                    result(k, 0, j) =
-                        op.finalize(op(col, initial_value), col.size());
-                }
-            }
+            detail::reduce_strided_sequences(op, initial_value, count,
+                t.rows(), reduce, [&](std::size_t k, auto value) {
+                    result(k / t.columns(), 0, k % t.columns()) = value;
+                });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicMatrix<T> result(t.pages(), t.columns());
-        for (std::size_t k = 0; k != t.pages(); ++k)
-        {
-            auto slice = blaze::pageslice(t, k);
-            for (std::size_t j = 0; j != t.columns(); ++j)
-            {
-                Op<T> op{name_, codename_};
-                auto col = blaze::column(slice, j);
-                result(k, j) = op.finalize(op(col, initial_value), col.size());
-            }
-        }
+        detail::reduce_strided_sequences(op, initial_value, count, t.rows(),
+            reduce, [&](std::size_t k, auto value) {
+                result(k / t.columns(), k % t.columns()) = value;
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -395,35 +415,31 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& row_op, std::size_t k, Init value) -> Init
+        {
+            auto slice = blaze::pageslice(t, k / t.rows());
+            auto row = blaze::row(slice, k % t.rows());
+            return row_op(row, value);
+        };
+
+        std::size_t const count = t.pages() * t.rows();
         if (keepdims)
         {
             blaze::DynamicTensor<T> result(t.pages(), t.rows(), 1);
-            for (std::size_t k = 0; k != t.pages(); ++k)
-            {
-                auto slice = blaze::pageslice(t, k);
-                for (std::size_t i = 0; i != t.rows(); ++i)
-                {
-                    Op<T> op{name_, codename_};
-                    auto row = blaze::row(slice, i);
-                    result(k, i, 0) =
-                        op.finalize(op(row, initial_value), row.size());
-                }
-            }
+            detail::reduce_sequences(op, initial_value, count, t.columns(),
+                reduce, [&](std::size_t k, auto value) {
+                    result(k / t.rows(), k % t.rows(), 0) = value;
+                });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicMatrix<T> result(t.pages(), t.rows());
-        for (std::size_t k = 0; k != t.pages(); ++k)
-        {
-            auto slice = blaze::pageslice(t, k);
-            for (std::size_t i = 0; i != t.rows(); ++i)
-            {
-                Op<T> op{name_, codename_};
-                auto row = blaze::row(slice, i);
-                result(k, i) = op.finalize(op(row, initial_value), row.size());
-            }
-        }
+        detail::reduce_sequences(op, initial_value, count, t.columns(),
+            reduce, [&](std::size_t k, auto value) {
+                result(k / t.rows(), k % t.rows()) = value;
+            });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -476,27 +492,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& slice_op, std::size_t k, Init value) -> Init
+        {
+            auto slice = blaze::ravel(blaze::columnslice(t, k));
+            return slice_op(slice, value);
+        };
+
+        std::size_t const length = t.pages() * t.rows();
         if (keepdims)
         {
             blaze::DynamicTensor<T> result(1, 1, t.columns());
-            for (std::size_t k = 0; k != t.columns(); ++k)
-            {
-                Op<T> op{name_, codename_};
-                auto slice = blaze::ravel(blaze::columnslice(t, k));
-                result(0, 0, k) =
-                    op.finalize(op(slice, initial_value), slice.size());
-            }
+            detail::reduce_sequences(op, initial_value, t.columns(), length,
+                reduce,
+                [&](std::size_t k, auto value) { result(0, 0, k) = value; });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicVector<T> result(t.columns());
-        for (std::size_t k = 0; k != t.columns(); ++k)
-        {
-            Op<T> op{name_, codename_};
-            auto slice = blaze::ravel(blaze::columnslice(t, k));
-            result[k] = op.finalize(op(slice, initial_value), slice.size());
-        }
+        detail::reduce_sequences(op, initial_value, t.columns(), length, reduce,
+            [&](std::size_t k, auto value) { result[k] = value; });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -515,27 +531,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& slice_op, std::size_t k, Init value) -> Init
+        {
+            auto slice = blaze::ravel(blaze::rowslice(t, k));
+            return slice_op(slice, value);
+        };
+
+        std::size_t const length = t.pages() * t.columns();
         if (keepdims)
         {
             blaze::DynamicTensor<T> result(1, t.rows(), 1);
-            for (std::size_t k = 0; k != t.rows(); ++k)
-            {
-                Op<T> op{name_, codename_};
-                auto slice = blaze::ravel(blaze::rowslice(t, k));
-                result(0, k, 0) =
-                    op.finalize(op(slice, initial_value), slice.size());
-            }
+            detail::reduce_sequences(op, initial_value, t.rows(), length,
+                reduce,
+                [&](std::size_t k, auto value) { result(0, k, 0) = value; });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicVector<T> result(t.rows());
-        for (std::size_t k = 0; k != t.rows(); ++k)
-        {
-            Op<T> op{name_, codename_};
-            auto slice = blaze::ravel(blaze::rowslice(t, k));
-            result[k] = op.finalize(op(slice, initial_value), slice.size());
-        }
+        detail::reduce_sequences(op, initial_value, t.rows(), length, reduce,
+            [&](std::size_t k, auto value) { result[k] = value; });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -554,27 +570,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
             initial_value = *initial;
         }
 
+        Op<T> op{name_, codename_};
+        auto reduce = [&](Op<T>& slice_op, std::size_t k, Init value) -> Init
+        {
+            auto slice = blaze::ravel(blaze::pageslice(t, k));
+            return slice_op(slice, value);
+        };
+
+        std::size_t const length = t.rows() * t.columns();
         if (keepdims)
         {
             blaze::DynamicTensor<T> result(t.pages(), 1, 1);
-            for (std::size_t k = 0; k != t.pages(); ++k)
-            {
-                Op<T> op{name_, codename_};
-                auto slice = blaze::ravel(blaze::pageslice(t, k));
-                result(k, 0, 0) =
-                    op.finalize(op(slice, initial_value), slice.size());
-            }
+            detail::reduce_sequences(op, initial_value, t.pages(), length,
+                reduce,
+                [&](std::size_t k, auto value) { result(k, 0, 0) = value; });
 
             return primitive_argument_type{std::move(result)};
         }
 
         blaze::DynamicVector<T> result(t.pages());
-        for (std::size_t k = 0; k != t.pages(); ++k)
-        {
-            Op<T> op{name_, codename_};
-            auto slice = blaze::ravel(blaze::pageslice(t, k));
-            result[k] = op.finalize(op(slice, initial_value), slice.size());
-        }
+        detail::reduce_sequences(op, initial_value, t.pages(), length, reduce,
+            [&](std::size_t k, auto value) { result[k] = value; });
 
         return primitive_argument_type{std::move(result)};
     }
@@ -648,6 +664,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis0, axis1, keepdims, std::move(initial));
 
+        case node_data_type_int32:
+            return statistics3d_slice(
+                extract_int32_value(std::move(arg), name_, codename_),
+                axis0, axis1, keepdims, std::move(initial));
+
+        case node_data_type_float32:
+            return statistics3d_slice(
+                extract_float32_value(std::move(arg), name_, codename_),
+                axis0, axis1, keepdims, std::move(initial));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return statistics3d_slice(
@@ -719,6 +745,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             t = extract_common_type(arg);
         }
 
+        if (t == node_data_type_double && is_sparse_operand(arg))
+        {
+            return statisticsnd_sparse(std::move(arg), axis, keepdims,
+                std::move(initial),
+                detail::ignores_zero_elements<Op<double>>{});
+        }
+
         switch (t)
         {
         case node_data_type_bool:
@@ -731,6 +764,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 axis, keepdims, std::move(initial));
 
+        case node_data_type_int32:
+            return statisticsnd(
+                extract_int32_value(std::move(arg), name_, codename_),
+                axis, keepdims, std::move(initial));
+
+        case node_data_type_float32:
+            return statisticsnd(
+                extract_float32_value(std::move(arg), name_, codename_),
+                axis, keepdims, std::move(initial));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return statisticsnd(
@@ -804,6 +847,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             t = extract_common_type(arg);
         }
 
+        if (t == node_data_type_double && is_sparse_operand(arg))
+        {
+            return statisticsnd_sparse(std::move(arg),
+                hpx::util::optional<std::int64_t>(), keepdims,
+                std::move(initial),
+                detail::ignores_zero_elements<Op<double>>{});
+        }
+
         switch (t)
         {
         case node_data_type_bool:
@@ -816,6 +867,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 keepdims, std::move(initial));
 
+        case node_data_type_int32:
+            return statisticsnd_flat(
+                extract_int32_value(std::move(arg), name_, codename_),
+                keepdims, std::move(initial));
+
+        case node_data_type_float32:
+            return statisticsnd_flat(
+                extract_float32_value(std::move(arg), name_, codename_),
+                keepdims, std::move(initial));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return statisticsnd_flat(
@@ -833,6 +894,160 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 "to be numeric data types"));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // operations that are not affected by zero elements expose a static
+        // member 'ignores_zero_elements'
+        template <typename Op, typename Enable = void>
+        struct ignores_zero_elements : std::false_type
+        {
+        };
+
+        template <typename Op>
+        struct ignores_zero_elements<Op,
+                typename std::enable_if<Op::ignores_zero_elements>::type>
+          : std::true_type
+        {
+        };
+    }
+
+    template <template <class T> class Op, typename Derived>
+    primitive_argument_type statistics<Op, Derived>::statisticsnd_sparse(
+        primitive_argument_type&& arg,
+        hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+        primitive_argument_type&& initial, std::true_type) const
+    {
+        // the data is only read, this avoids detaching it from other
+        // instances referring to it
+        ir::node_data<double> const& data =
+            util::get<ir::node_data<double>>(arg);
+
+        Op<double> op{name_, codename_};
+
+        double initial_value = Op<double>::initial();
+        if (valid(initial))
+        {
+            initial_value = extract_scalar_data<double>(
+                std::move(initial), name_, codename_);
+        }
+
+        if (data.num_dimensions() == 1)
+        {
+            if (axis && axis.value() != 0 && axis.value() != -1)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "statistics::statisticsnd_sparse",
+                    generate_error_message(
+                        "the statistics_operation primitive requires operand "
+                        "axis to be either 0 or -1 for vectors."));
+            }
+
+            auto const& v = data.sparse_vector();
+            double result = op.finalize(op(v, initial_value), v.size());
+
+            if (keepdims)
+            {
+                return primitive_argument_type{
+                    blaze::DynamicVector<double>(1, result)};
+            }
+            return primitive_argument_type{result};
+        }
+
+        auto const& m = data.sparse_matrix();
+
+        if (!axis)
+        {
+            double result = initial_value;
+            for (std::size_t i = 0; i != m.rows(); ++i)
+            {
+                auto row = blaze::row(m, i);
+                result = op(row, result);
+            }
+            result = op.finalize(result, m.rows() * m.columns());
+
+            if (keepdims)
+            {
+                return primitive_argument_type{
+                    blaze::DynamicMatrix<double>(1, 1, result)};
+            }
+            return primitive_argument_type{result};
+        }
+
+        switch (axis.value())
+        {
+        case -2: HPX_FALLTHROUGH;
+        case 0:
+            {
+                // the non-zero elements of each row are accumulated into the
+                // result of their column
+                blaze::DynamicVector<double> result(
+                    m.columns(), initial_value);
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    for (auto it = m.begin(i); it != m.end(i); ++it)
+                    {
+                        std::size_t j = it->index();
+                        result[j] = op(it->value(), result[j]);
+                    }
+                }
+                for (std::size_t j = 0; j != m.columns(); ++j)
+                {
+                    result[j] = op.finalize(result[j], m.rows());
+                }
+
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<double> r(1, m.columns());
+                    blaze::row(r, 0) = blaze::trans(result);
+                    return primitive_argument_type{std::move(r)};
+                }
+                return primitive_argument_type{std::move(result)};
+            }
+
+        case -1: HPX_FALLTHROUGH;
+        case 1:
+            {
+                blaze::DynamicVector<double> result(m.rows());
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    auto row = blaze::row(m, i);
+                    result[i] =
+                        op.finalize(op(row, initial_value), m.columns());
+                }
+
+                if (keepdims)
+                {
+                    blaze::DynamicMatrix<double> r(m.rows(), 1);
+                    blaze::column(r, 0) = result;
+                    return primitive_argument_type{std::move(r)};
+                }
+                return primitive_argument_type{std::move(result)};
+            }
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "statistics::statisticsnd_sparse",
+            generate_error_message(
+                "the statistics_operation primitive requires operand "
+                "axis to be between -2 and 1 for matrices."));
+    }
+
+    template <template <class T> class Op, typename Derived>
+    primitive_argument_type statistics<Op, Derived>::statisticsnd_sparse(
+        primitive_argument_type&& arg,
+        hpx::util::optional<std::int64_t> const& axis, bool keepdims,
+        primitive_argument_type&& initial, std::false_type) const
+    {
+        // all other operations are applied to the dense representation
+        return statisticsnd(
+            extract_numeric_value(std::move(arg), name_, codename_), axis,
+            keepdims, std::move(initial));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -0,0 +1,357 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_PRIMITIVES_STATISTICS_REDUCE_HPP)
+#define PHYLANX_PRIMITIVES_STATISTICS_REDUCE_HPP
+
+#include <phylanx/config.hpp>
+
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime/config_entry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Building blocks for the parallel reductions of the statistics primitives.
+//
+// Reductions over arrays holding at least phylanx.statistics.threshold
+// elements (default: 65536, zero disables parallel execution) are split
+// into chunks executed on separate HPX threads.
+//
+// Flat reductions (no axis) reduce each chunk with a separate instance of
+// the operation and merge the partial results afterwards. This requires
+// the operation to expose a member function
+//
+//     result_type combine(Op const& rhs, result_type lhs, result_type rhs)
+//
+// which merges the state of 'rhs' into '*this' and returns the combined
+// value of the two partial results. Operations without such a function
+// are evaluated sequentially.
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        inline std::size_t statistics_threshold()
+        {
+            static std::size_t const threshold = []() -> std::size_t {
+                try
+                {
+                    return std::stoull(hpx::get_config_entry(
+                        "phylanx.statistics.threshold", "65536"));
+                }
+                catch (std::exception const&)
+                {
+                    return 65536;
+                }
+            }();
+            return threshold;
+        }
+
+        // number of chunks to use for 'count' items comprising 'work'
+        // elements overall
+        inline std::size_t statistics_num_chunks(
+            std::size_t count, std::size_t work)
+        {
+            std::size_t const threshold = statistics_threshold();
+            if (count < 2 || threshold == 0 || work < threshold)
+            {
+                return 1;
+            }
+            return (std::min)(
+                count, std::size_t(hpx::get_os_thread_count()));
+        }
+
+        // invoke f(chunk, begin, end) for all chunks of [0, count), the
+        // first chunk is executed on the calling thread
+        template <typename F>
+        void run_statistics_chunks(
+            std::size_t num_chunks, std::size_t count, F const& f)
+        {
+            if (num_chunks < 2)
+            {
+                f(std::size_t(0), std::size_t(0), count);
+                return;
+            }
+
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+
+            std::vector<hpx::future<void>> chunks;
+            chunks.reserve(num_chunks - 1);
+            for (std::size_t c = 1; c != num_chunks; ++c)
+            {
+                std::size_t begin = (std::min)(c * chunk_size, count);
+                std::size_t end = (std::min)(begin + chunk_size, count);
+                chunks.push_back(hpx::async(
+                    [&f, c, begin, end]() { f(c, begin, end); }));
+            }
+
+            f(std::size_t(0), std::size_t(0), (std::min)(chunk_size, count));
+
+            hpx::wait_all(chunks);
+
+            // rethrow exceptions, if any
+            for (auto& chunk : chunks)
+            {
+                chunk.get();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Op, typename Init, typename Enable = void>
+        struct has_combine : std::false_type
+        {
+        };
+
+        template <typename Op, typename Init>
+        struct has_combine<Op, Init,
+            decltype(static_cast<void>(std::declval<Op&>().combine(
+                std::declval<Op const&>(), std::declval<Init>(),
+                std::declval<Init>())))> : std::true_type
+        {
+        };
+
+        // Reduce 'count' items comprising 'work' elements, f(op, begin, end,
+        // value) reduces the items [begin, end) with the given operation
+        template <typename Op, typename Init, typename F>
+        Init reduce_chunked(Op& op, Init initial, std::size_t count,
+            std::size_t work, F const& f, std::false_type)
+        {
+            return f(op, std::size_t(0), count, initial);
+        }
+
+        template <typename Op, typename Init, typename F>
+        Init reduce_chunked(Op& op, Init initial, std::size_t count,
+            std::size_t work, F const& f, std::true_type)
+        {
+            std::size_t const num_chunks = statistics_num_chunks(count, work);
+            if (num_chunks < 2)
+            {
+                return f(op, std::size_t(0), count, initial);
+            }
+
+            // the initial value is accounted for by the first chunk only
+            std::vector<Op> ops(num_chunks - 1, op);
+            std::vector<Init> values(num_chunks - 1, Init(Op::initial()));
+
+            Init value = initial;
+            run_statistics_chunks(num_chunks, count,
+                [&](std::size_t c, std::size_t begin, std::size_t end) {
+                    if (c == 0)
+                    {
+                        value = f(op, begin, end, value);
+                    }
+                    else
+                    {
+                        values[c - 1] =
+                            f(ops[c - 1], begin, end, values[c - 1]);
+                    }
+                });
+
+            for (std::size_t c = 0; c != num_chunks - 1; ++c)
+            {
+                value = op.combine(ops[c], value, values[c]);
+            }
+            return value;
+        }
+
+        template <typename Op, typename Init, typename F>
+        Init reduce_chunked(Op& op, Init initial, std::size_t count,
+            std::size_t work, F const& f)
+        {
+            return reduce_chunked(op, initial, count, work, f,
+                typename has_combine<Op, Init>::type{});
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Reduce 'count' independent contiguous sequences of 'length'
+        // elements each. reduce(op, i, value) applies the operation to the
+        // sequence with index i, the final result is handed to
+        // store(i, result).
+        template <typename Op, typename Init, typename Reduce, typename Store>
+        void reduce_sequences(Op const& op, Init initial, std::size_t count,
+            std::size_t length, Reduce const& reduce, Store const& store)
+        {
+            run_statistics_chunks(statistics_num_chunks(count, count * length),
+                count, [&](std::size_t, std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        Op local_op(op);
+                        store(i,
+                            local_op.finalize(
+                                reduce(local_op, i, initial), length));
+                    }
+                });
+        }
+
+        // tile sizes used for reductions along a non-contiguous dimension
+        constexpr std::size_t statistics_tile_outputs = 64;
+        constexpr std::size_t statistics_tile_length = 128;
+
+        // Reduce 'count' independent strided sequences of 'length' elements
+        // each, where the elements with the same position in neighboring
+        // sequences are adjacent in memory (e.g. the columns of a row-major
+        // matrix). reduce(op, i, start, size, value) applies the operation to
+        // the given part of the sequence with index i.
+        //
+        // The sequences are processed in tiles of neighboring sequences,
+        // which streams through the memory row by row instead of touching a
+        // new cache line for every element.
+        template <typename Op, typename Init, typename Reduce, typename Store>
+        void reduce_strided_sequences(Op const& op, Init initial,
+            std::size_t count, std::size_t length, Reduce const& reduce,
+            Store const& store)
+        {
+            std::size_t const num_blocks =
+                (count + statistics_tile_outputs - 1) / statistics_tile_outputs;
+
+            run_statistics_chunks(
+                statistics_num_chunks(num_blocks, count * length), num_blocks,
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    for (std::size_t b = begin; b != end; ++b)
+                    {
+                        std::size_t const first = b * statistics_tile_outputs;
+                        std::size_t const size = (std::min)(
+                            statistics_tile_outputs, count - first);
+
+                        std::vector<Op> ops(size, op);
+                        std::vector<Init> values(size, initial);
+
+                        for (std::size_t k = 0; k < length;
+                             k += statistics_tile_length)
+                        {
+                            std::size_t const n = (std::min)(
+                                statistics_tile_length, length - k);
+                            for (std::size_t i = 0; i != size; ++i)
+                            {
+                                values[i] =
+                                    reduce(ops[i], first + i, k, n, values[i]);
+                            }
+                        }
+
+                        for (std::size_t i = 0; i != size; ++i)
+                        {
+                            store(first + i,
+                                ops[i].finalize(values[i], length));
+                        }
+                    }
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Accumulate count, mean, and sum of squared deviations of a
+        // sequence of values, partial results are merged using the parallel
+        // algorithm of Chan et al., see
+        // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+        struct welford_accumulator
+        {
+            welford_accumulator()
+              : count_(0), mean_(0), m2_(0)
+            {}
+
+            void process_value(double val)
+            {
+                ++count_;
+                double delta = val - mean_;
+                mean_ += delta / count_;
+                m2_ += delta * (val - mean_);
+            }
+
+            // Blocks of values are processed in two passes over the block,
+            // which avoids the division per element of Welford's update.
+            template <typename Vector>
+            void process_values(Vector const& v)
+            {
+                std::size_t const n = v.size();
+                if (n == 0)
+                {
+                    return;
+                }
+
+                welford_accumulator block;
+                block.count_ = n;
+                block.mean_ = sum(v) / n;
+
+                // independent partial sums shorten the dependency chain
+                double m2[4] = {0.0, 0.0, 0.0, 0.0};
+                std::size_t j = 0;
+                for (auto it = v.begin(); it != v.end(); ++it, j = (j + 1) & 3)
+                {
+                    double delta = double(*it) - block.mean_;
+                    m2[j] += delta * delta;
+                }
+                block.m2_ = (m2[0] + m2[1]) + (m2[2] + m2[3]);
+
+                merge(block);
+            }
+
+            void merge(welford_accumulator const& rhs)
+            {
+                if (rhs.count_ == 0)
+                {
+                    return;
+                }
+                if (count_ == 0)
+                {
+                    *this = rhs;
+                    return;
+                }
+
+                double const count = double(count_ + rhs.count_);
+                double const delta = rhs.mean_ - mean_;
+
+                mean_ += delta * (rhs.count_ / count);
+                m2_ += rhs.m2_ +
+                    delta * delta * (count_ * (rhs.count_ / count));
+                count_ += rhs.count_;
+            }
+
+            std::size_t count_;
+            double mean_;
+            double m2_;
+
+        private:
+            template <typename Vector>
+            static double sum(Vector const& v)
+            {
+                return sum(v, std::is_floating_point<
+                    typename std::decay<decltype(*v.begin())>::type>{});
+            }
+
+            // floating point values are summed using Blaze's vectorized
+            // kernels
+            template <typename Vector>
+            static double sum(Vector const& v, std::true_type)
+            {
+                return double(blaze::sum(v));
+            }
+
+            // avoid overflows for small integral types
+            template <typename Vector>
+            static double sum(Vector const& v, std::false_type)
+            {
+                double result = 0.0;
+                for (auto it = v.begin(); it != v.end(); ++it)
+                {
+                    result += double(*it);
+                }
+                return result;
+            }
+        };
+    }
+}}}
+
+#endif
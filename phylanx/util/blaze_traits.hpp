@@ -79,6 +79,16 @@ namespace phylanx { namespace traits
     {
     };
 
+    template <>
+    struct is_scalar<std::int32_t> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_scalar<float> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool TF>
     struct is_vector<blaze::DynamicVector<T, TF>> : std::true_type
@@ -90,6 +100,11 @@ namespace phylanx { namespace traits
     {
     };
 
+    template <typename T, bool TF>
+    struct is_vector<blaze::UniformVector<T, TF>> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool SO>
     struct is_matrix<blaze::DynamicMatrix<T, SO>> : std::true_type
@@ -101,6 +116,11 @@ namespace phylanx { namespace traits
     {
     };
 
+    template <typename T, bool SO>
+    struct is_matrix<blaze::UniformMatrix<T, SO>> : std::true_type
+    {
+    };
+
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
@@ -0,0 +1,198 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_BLOCKED_GEMM_HPP)
+#define PHYLANX_UTIL_BLOCKED_GEMM_HPP
+
+#include <phylanx/config.hpp>
+
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parameters controlling the tiled matrix products, read from the
+    // configuration section [phylanx.dot] on first use:
+    //
+    //   phylanx.dot.tile_rows        rows of a result tile (default: 128)
+    //   phylanx.dot.tile_columns     columns of a result tile (default: 128)
+    //   phylanx.dot.tile_inner       length of the reduction blocks
+    //                                (default: 256)
+    //   phylanx.dot.gemm_threshold   minimal number of multiply-adds for
+    //                                a matrix-matrix product to be tiled
+    //                                (default: 2097152)
+    //   phylanx.dot.gemv_threshold   minimal number of multiply-adds for
+    //                                a matrix-vector product to be tiled
+    //                                (default: 262144)
+    //
+    // A threshold of zero disables the tiled implementation.
+    struct blocked_gemm_parameters
+    {
+        std::size_t tile_rows_;
+        std::size_t tile_columns_;
+        std::size_t tile_inner_;
+        std::size_t gemm_threshold_;
+        std::size_t gemv_threshold_;
+    };
+
+    PHYLANX_EXPORT blocked_gemm_parameters const& get_blocked_gemm_parameters();
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        inline bool use_blocked(std::size_t threshold, std::size_t work,
+            std::size_t tiles)
+        {
+            return threshold != 0 && work >= threshold && tiles > 1 &&
+                hpx::get_os_thread_count() > 1;
+        }
+
+        inline std::size_t num_tiles(std::size_t size, std::size_t tile)
+        {
+            return (size + tile - 1) / tile;
+        }
+
+        inline void wait_all_tiles(std::vector<hpx::future<void>>& tiles)
+        {
+            hpx::wait_all(tiles);
+
+            // rethrow exceptions, if any
+            for (auto& f : tiles)
+            {
+                f.get();
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return whether blocked_gemm would compute the product in parallel
+    template <typename MT1, bool SO1, typename MT2, bool SO2>
+    bool use_blocked_gemm(blaze::Matrix<MT1, SO1> const& lhs,
+        blaze::Matrix<MT2, SO2> const& rhs)
+    {
+        auto const& params = get_blocked_gemm_parameters();
+        return detail::use_blocked(params.gemm_threshold_,
+            (~lhs).rows() * (~lhs).columns() * (~rhs).columns(),
+            detail::num_tiles((~lhs).rows(), params.tile_rows_) *
+                detail::num_tiles((~rhs).columns(), params.tile_columns_));
+    }
+
+    // Compute lhs * rhs by splitting the result into tiles, each of which is
+    // computed by a separate HPX thread. The reduction dimension is processed
+    // in blocks to keep the operands of a tile resident in cache. The tiles
+    // themselves are evaluated serially, which prevents Blaze from spawning
+    // nested parallel work.
+    template <typename T, typename MT1, bool SO1, typename MT2, bool SO2>
+    blaze::DynamicMatrix<T> blocked_gemm(blaze::Matrix<MT1, SO1> const& lhs,
+        blaze::Matrix<MT2, SO2> const& rhs)
+    {
+        auto const& params = get_blocked_gemm_parameters();
+
+        std::size_t const rows = (~lhs).rows();
+        std::size_t const columns = (~rhs).columns();
+        std::size_t const inner = (~lhs).columns();
+
+        blaze::DynamicMatrix<T> result(rows, columns);
+
+        std::vector<hpx::future<void>> tiles;
+        tiles.reserve(detail::num_tiles(rows, params.tile_rows_) *
+            detail::num_tiles(columns, params.tile_columns_));
+
+        for (std::size_t i = 0; i < rows; i += params.tile_rows_)
+        {
+            std::size_t const m = (std::min)(params.tile_rows_, rows - i);
+            for (std::size_t j = 0; j < columns; j += params.tile_columns_)
+            {
+                std::size_t const n =
+                    (std::min)(params.tile_columns_, columns - j);
+
+                tiles.push_back(hpx::async(
+                    [&, i, j, m, n]()
+                    {
+                        auto c = blaze::submatrix(result, i, j, m, n);
+                        if (inner == 0)
+                        {
+                            c = T(0);
+                            return;
+                        }
+
+                        for (std::size_t k = 0; k < inner;
+                             k += params.tile_inner_)
+                        {
+                            std::size_t const l =
+                                (std::min)(params.tile_inner_, inner - k);
+
+                            auto a = blaze::submatrix(~lhs, i, k, m, l);
+                            auto b = blaze::submatrix(~rhs, k, j, l, n);
+                            if (k == 0)
+                            {
+                                c = blaze::serial(a * b);
+                            }
+                            else
+                            {
+                                c += blaze::serial(a * b);
+                            }
+                        }
+                    }));
+            }
+        }
+
+        detail::wait_all_tiles(tiles);
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return whether blocked_gemv would compute the product in parallel
+    template <typename MT, bool SO, typename VT>
+    bool use_blocked_gemv(blaze::Matrix<MT, SO> const& lhs,
+        blaze::Vector<VT, blaze::columnVector> const& rhs)
+    {
+        auto const& params = get_blocked_gemm_parameters();
+        return detail::use_blocked(params.gemv_threshold_,
+            (~lhs).rows() * (~lhs).columns(),
+            detail::num_tiles((~lhs).rows(), params.tile_rows_));
+    }
+
+    // Compute lhs * rhs by splitting the rows of the matrix into blocks, each
+    // of which is handled by a separate HPX thread.
+    template <typename T, typename MT, bool SO, typename VT>
+    blaze::DynamicVector<T> blocked_gemv(blaze::Matrix<MT, SO> const& lhs,
+        blaze::Vector<VT, blaze::columnVector> const& rhs)
+    {
+        auto const& params = get_blocked_gemm_parameters();
+
+        std::size_t const rows = (~lhs).rows();
+        std::size_t const columns = (~lhs).columns();
+
+        blaze::DynamicVector<T> result(rows);
+
+        std::vector<hpx::future<void>> tiles;
+        tiles.reserve(detail::num_tiles(rows, params.tile_rows_));
+
+        for (std::size_t i = 0; i < rows; i += params.tile_rows_)
+        {
+            std::size_t const m = (std::min)(params.tile_rows_, rows - i);
+            tiles.push_back(hpx::async(
+                [&, i, m]()
+                {
+                    blaze::subvector(result, i, m) = blaze::serial(
+                        blaze::submatrix(~lhs, i, 0, m, columns) * ~rhs);
+                }));
+        }
+
+        detail::wait_all_tiles(tiles);
+        return result;
+    }
+}}
+
+#endif
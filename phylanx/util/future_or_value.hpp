@@ -10,12 +10,15 @@
 #include <phylanx/util/variant.hpp>
 
 #include <hpx/async.hpp>
+#include <hpx/dataflow.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/traits/acquire_future.hpp>
 #include <hpx/traits/future_traits.hpp>
 #include <hpx/traits/is_future.hpp>
 #include <hpx/util/steady_clock.hpp>
+#include <hpx/util/unwrap.hpp>
 
+#include <exception>
 #include <type_traits>
 #include <utility>
 
@@ -64,7 +67,23 @@ namespace phylanx { namespace util
             return util::get<1>(data_).get();
         }
 
+        // Convert into a future, creates a ready future if this holds a value
+        hpx::future<T> get_future()
+        {
+            if (data_.index() == 0)
+            {
+                return hpx::make_ready_future(std::move(util::get<0>(data_)));
+            }
+            return std::move(util::get<1>(data_));
+        }
+
         ///////////////////////////////////////////////////////////////////////
+        // Return whether this holds a value (as opposed to a future)
+        bool has_value_only() const
+        {
+            return data_.index() == 0;
+        }
+
         bool is_ready() const
         {
             return data_.index() == 0 || util::get<1>(data_).is_ready();
@@ -174,6 +193,51 @@ namespace phylanx { namespace util
 
         phylanx::util::variant<T, hpx::future<T>> data_;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        inline bool all_ready()
+        {
+            return true;
+        }
+
+        template <typename T, typename... Ts>
+        bool all_ready(future_or_value<T> const& t, Ts const&... ts)
+        {
+            return t.is_ready() && all_ready(ts...);
+        }
+    }
+
+    // Invoke f with the values of the given arguments. If all arguments are
+    // ready, f is invoked synchronously and its result is returned without
+    // allocating a shared state. Otherwise the invocation is deferred until
+    // all arguments have become ready (similar to hpx::dataflow).
+    template <typename F, typename... Ts>
+    future_or_value<typename std::decay<decltype(
+        std::declval<F&>()(std::declval<Ts>()...))>::type>
+    dataflow_or_value(F&& f, future_or_value<Ts>&&... ts)
+    {
+        using result_type = typename std::decay<decltype(
+            std::declval<F&>()(std::declval<Ts>()...))>::type;
+
+        if (detail::all_ready(ts...))
+        {
+            try
+            {
+                return future_or_value<result_type>(f(ts.get()...));
+            }
+            catch (...)
+            {
+                return future_or_value<result_type>(
+                    hpx::make_exceptional_future<result_type>(
+                        std::current_exception()));
+            }
+        }
+
+        return future_or_value<result_type>(hpx::dataflow(hpx::launch::sync,
+            hpx::util::unwrapping(std::forward<F>(f)), ts.get_future()...));
+    }
 }}
 
 // define traits that make look this type like as if it was a future
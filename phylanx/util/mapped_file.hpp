@@ -0,0 +1,74 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_MAPPED_FILE_HPP)
+#define PHYLANX_UTIL_MAPPED_FILE_HPP
+
+#include <phylanx/config.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Read-only view of the contents of a file, mapped into memory. A
+    // mapping opened with copy_on_write set may be modified, the changes are
+    // private to the process and are never written back to the file.
+    class PHYLANX_EXPORT mapped_file
+    {
+    public:
+        mapped_file() noexcept;
+        explicit mapped_file(
+            std::string const& filename, bool copy_on_write = false);
+
+        mapped_file(mapped_file const&) = delete;
+        mapped_file(mapped_file&& rhs) noexcept;
+
+        mapped_file& operator=(mapped_file const&) = delete;
+        mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+        ~mapped_file();
+
+        // returns false if the file could not be opened or mapped
+        bool open(std::string const& filename, bool copy_on_write = false);
+        void close() noexcept;
+
+        bool is_open() const noexcept
+        {
+            return is_open_;
+        }
+
+        char const* data() const noexcept
+        {
+            return data_;
+        }
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        char const* begin() const noexcept
+        {
+            return data_;
+        }
+        char const* end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+    private:
+        char const* data_;
+        std::size_t size_;
+        bool is_open_;
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+        void* file_;
+        void* mapping_;
+#endif
+    };
+}}
+
+#endif
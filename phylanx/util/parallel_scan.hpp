@@ -0,0 +1,213 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_PARALLEL_SCAN_HPP)
+#define PHYLANX_UTIL_PARALLEL_SCAN_HPP
+
+#include <phylanx/config.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parameters controlling the parallel scan algorithms, read from the
+    // configuration section [phylanx.scan] on first use:
+    //
+    //   phylanx.scan.threshold         minimal number of elements for a
+    //                                  sequence to be scanned in parallel,
+    //                                  also the minimal overall number of
+    //                                  elements for independent rows or
+    //                                  columns to be scanned concurrently
+    //                                  (default: 65536)
+    //   phylanx.scan.chunk_size        minimal number of elements scanned
+    //                                  by one task (default: 16384)
+    //
+    // A threshold of zero disables the parallel algorithms.
+    struct parallel_scan_parameters
+    {
+        std::size_t threshold_;
+        std::size_t chunk_size_;
+    };
+
+    PHYLANX_EXPORT parallel_scan_parameters const&
+    get_parallel_scan_parameters();
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        inline bool use_parallel_scan(std::size_t size)
+        {
+            std::size_t const threshold =
+                get_parallel_scan_parameters().threshold_;
+            return threshold != 0 && size >= threshold &&
+                hpx::get_os_thread_count() > 1;
+        }
+
+        // number of chunks a sequence of the given size is split into
+        inline std::size_t scan_chunk_count(std::size_t size)
+        {
+            if (!use_parallel_scan(size))
+            {
+                return 1;
+            }
+
+            std::size_t const chunk_size =
+                (std::max)(get_parallel_scan_parameters().chunk_size_,
+                    std::size_t(1));
+            std::size_t const max_chunks = 4 * hpx::get_os_thread_count();
+
+            return (std::max)(std::size_t(1),
+                (std::min)(max_chunks, size / chunk_size));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Write the inclusive scan of [first, last) starting with init to dest,
+    // the input and output sequences may be the same. Large sequences are
+    // scanned in two passes: all chunks are scanned concurrently, then the
+    // accumulated value of all preceding chunks is applied to each chunk.
+    // The binary operation is required to be associative.
+    template <typename InIter, typename OutIter, typename T, typename Op>
+    OutIter parallel_inclusive_scan(
+        InIter first, InIter last, OutIter dest, T init, Op&& op)
+    {
+        std::size_t const size =
+            static_cast<std::size_t>(std::distance(first, last));
+
+        std::size_t num_chunks = detail::scan_chunk_count(size);
+        if (num_chunks == 1)
+        {
+            for (/**/; first != last; ++first, ++dest)
+            {
+                init = op(init, *first);
+                *dest = init;
+            }
+            return dest;
+        }
+
+        std::size_t const chunk_size = (size + num_chunks - 1) / num_chunks;
+        num_chunks = (size + chunk_size - 1) / chunk_size;
+
+        // the first pass leaves the last value of each chunk in totals
+        std::vector<T> totals(num_chunks);
+        hpx::parallel::for_loop(hpx::parallel::execution::par,
+            std::size_t(0), num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t const begin = chunk * chunk_size;
+                std::size_t const end = (std::min)(begin + chunk_size, size);
+
+                InIter in = first + begin;
+                OutIter out = dest + begin;
+
+                T value = chunk == 0 ? op(init, *in) : T(*in);
+                *out = value;
+                for (std::size_t i = begin + 1; i != end; ++i)
+                {
+                    value = op(value, *++in);
+                    *++out = value;
+                }
+                totals[chunk] = value;
+            });
+
+        // accumulate the totals of all preceding chunks
+        for (std::size_t chunk = 1; chunk != num_chunks; ++chunk)
+        {
+            totals[chunk] = op(totals[chunk - 1], totals[chunk]);
+        }
+
+        hpx::parallel::for_loop(hpx::parallel::execution::par,
+            std::size_t(1), num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t const begin = chunk * chunk_size;
+                std::size_t const end = (std::min)(begin + chunk_size, size);
+
+                T const offset = totals[chunk - 1];
+                OutIter out = dest + begin;
+                for (std::size_t i = begin; i != end; ++i, ++out)
+                {
+                    *out = op(offset, *out);
+                }
+            });
+
+        return dest + size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f(i) for all independent slices i in [0, count) of an array,
+    // concurrently if the overall number of elements is large enough. Each
+    // slice is expected to hold slice_size elements.
+    template <typename F>
+    void for_each_scan_slice(std::size_t count, std::size_t slice_size, F&& f)
+    {
+        if (count > 1 && detail::use_parallel_scan(count * slice_size))
+        {
+            hpx::parallel::for_loop(hpx::parallel::execution::par,
+                std::size_t(0), count, std::forward<F>(f));
+        }
+        else
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(i);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Scan along the columns of slices independent matrices of the given
+    // size. The row i of slice s is read from in(s, i) and written to
+    // out(s, i), both return pointers to the first element of the row. The
+    // columns are handled in blocks, keeping the innermost loop contiguous.
+    template <typename T, typename Op, typename In, typename Out>
+    void scan_columns(std::size_t slices, std::size_t rows,
+        std::size_t columns, T init, Op&& op, In&& in, Out&& out)
+    {
+        if (slices == 0 || rows == 0 || columns == 0)
+        {
+            return;
+        }
+
+        constexpr std::size_t block_size = 256;
+        std::size_t const blocks = (columns + block_size - 1) / block_size;
+
+        for_each_scan_slice(slices * blocks, rows * block_size,
+            [&](std::size_t n)
+            {
+                std::size_t const slice = n / blocks;
+                std::size_t const begin = (n % blocks) * block_size;
+                std::size_t const end = (std::min)(begin + block_size, columns);
+
+                T const* src = in(slice, 0);
+                T* dest = out(slice, 0);
+                for (std::size_t j = begin; j != end; ++j)
+                {
+                    dest[j] = op(init, src[j]);
+                }
+
+                for (std::size_t i = 1; i != rows; ++i)
+                {
+                    T const* prev = dest;
+                    src = in(slice, i);
+                    dest = out(slice, i);
+                    for (std::size_t j = begin; j != end; ++j)
+                    {
+                        dest[j] = op(prev[j], src[j]);
+                    }
+                }
+            });
+    }
+}}
+
+#endif
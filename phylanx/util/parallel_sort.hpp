@@ -0,0 +1,133 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_PARALLEL_SORT_HPP)
+#define PHYLANX_UTIL_PARALLEL_SORT_HPP
+
+#include <phylanx/config.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parameters controlling the parallel sorting algorithms, read from the
+    // configuration section [phylanx.sort] on first use:
+    //
+    //   phylanx.sort.threshold         minimal number of elements for a
+    //                                  sequence to be sorted in parallel
+    //                                  (default: 65536)
+    //   phylanx.sort.radix_threshold   minimal number of elements for an
+    //                                  int64 sequence to be radix sorted
+    //                                  (default: 65536)
+    //   phylanx.sort.slice_threshold   minimal overall number of elements
+    //                                  for the rows, columns, or pages of an
+    //                                  array to be sorted concurrently
+    //                                  (default: 32768)
+    //
+    // A threshold of zero disables the corresponding parallel algorithm.
+    struct parallel_sort_parameters
+    {
+        std::size_t sort_threshold_;
+        std::size_t radix_threshold_;
+        std::size_t slice_threshold_;
+    };
+
+    PHYLANX_EXPORT parallel_sort_parameters const&
+    get_parallel_sort_parameters();
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        inline bool use_parallel(std::size_t threshold, std::size_t size)
+        {
+            return threshold != 0 && size >= threshold &&
+                hpx::get_os_thread_count() > 1;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the given range, large ranges are sorted using all cores
+    template <typename Iter, typename Compare>
+    void parallel_sort(Iter first, Iter last, Compare&& comp)
+    {
+        if (detail::use_parallel(get_parallel_sort_parameters().sort_threshold_,
+                static_cast<std::size_t>(std::distance(first, last))))
+        {
+            hpx::parallel::sort(hpx::parallel::execution::par, first, last,
+                std::forward<Compare>(comp));
+        }
+        else
+        {
+            std::sort(first, last, std::forward<Compare>(comp));
+        }
+    }
+
+    template <typename Iter>
+    void parallel_sort(Iter first, Iter last)
+    {
+        parallel_sort(first, last, std::less<>());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort a contiguous sequence of values in ascending order. Sequences of
+    // 64 bit integers are sorted using a parallel LSD radix sort, which skips
+    // all digits shared by all values (e.g. the upper bytes of indices).
+    PHYLANX_EXPORT void radix_sort(std::int64_t* data, std::size_t size);
+
+    template <typename T>
+    void sort_values(T* data, std::size_t size)
+    {
+        parallel_sort(data, data + size);
+    }
+
+    inline void sort_values(std::int64_t* data, std::size_t size)
+    {
+        std::size_t threshold = get_parallel_sort_parameters().radix_threshold_;
+        if (threshold != 0 && size >= threshold)
+        {
+            radix_sort(data, size);
+        }
+        else
+        {
+            parallel_sort(data, data + size);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke f(i) for all slices i in [0, count) of an array, concurrently if
+    // the overall number of elements is large enough. Each slice is expected
+    // to hold slice_size elements.
+    template <typename F>
+    void for_each_slice(std::size_t count, std::size_t slice_size, F&& f)
+    {
+        if (count > 1 &&
+            detail::use_parallel(
+                get_parallel_sort_parameters().slice_threshold_,
+                count * slice_size))
+        {
+            hpx::parallel::for_loop(hpx::parallel::execution::par,
+                std::size_t(0), count, std::forward<F>(f));
+        }
+        else
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                f(i);
+            }
+        }
+    }
+}}
+
+#endif
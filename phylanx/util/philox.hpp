@@ -0,0 +1,132 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_PHILOX_HPP)
+#define PHYLANX_UTIL_PHILOX_HPP
+
+#include <phylanx/config.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Philox4x32-10 counter-based random number engine, see
+    //
+    //     J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw. Parallel
+    //     random numbers: as easy as 1, 2, 3. SC'11.
+    //
+    // Each block of four numbers is a keyed bijection of a 128 bit counter.
+    // The key selects an independent stream, the upper 64 bits of the counter
+    // select a subsequence of 2^66 numbers within that stream. Engines for
+    // different subsequences can therefore be created independently of each
+    // other (e.g. one per chunk of a large array) without any shared state.
+    //
+    // The engine satisfies the requirements of a UniformRandomBitGenerator
+    // and can be used with all standard distributions.
+    class philox4x32
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        static constexpr result_type(min)()
+        {
+            return 0;
+        }
+        static constexpr result_type(max)()
+        {
+            return (std::numeric_limits<result_type>::max)();
+        }
+
+        explicit philox4x32(
+            std::uint64_t key = 0, std::uint64_t subsequence = 0)
+          : key_{{std::uint32_t(key), std::uint32_t(key >> 32)}}
+          , counter_{{0, 0, std::uint32_t(subsequence),
+                std::uint32_t(subsequence >> 32)}}
+          , results_{}
+          , index_(4)
+        {}
+
+        result_type operator()()
+        {
+            if (index_ == 4)
+            {
+                results_ = generate(counter_, key_);
+                increment();
+                index_ = 0;
+            }
+            return results_[index_++];
+        }
+
+        // skip the next n numbers
+        void discard(std::uint64_t n)
+        {
+            while (n != 0 && index_ != 4)
+            {
+                ++index_;
+                --n;
+            }
+
+            std::uint64_t blocks = n / 4;
+            std::uint64_t position =
+                (std::uint64_t(counter_[1]) << 32 | counter_[0]) + blocks;
+            counter_[0] = std::uint32_t(position);
+            counter_[1] = std::uint32_t(position >> 32);
+
+            if (n % 4 != 0)
+            {
+                results_ = generate(counter_, key_);
+                increment();
+                index_ = std::size_t(n % 4);
+            }
+        }
+
+        // apply the ten rounds of the Philox bijection to the given counter
+        static std::array<std::uint32_t, 4> generate(
+            std::array<std::uint32_t, 4> counter,
+            std::array<std::uint32_t, 2> key)
+        {
+            for (int round = 0; round != 10; ++round)
+            {
+                std::uint64_t const p0 =
+                    std::uint64_t(0xD2511F53) * counter[0];
+                std::uint64_t const p1 =
+                    std::uint64_t(0xCD9E8D57) * counter[2];
+
+                counter = {{
+                    std::uint32_t(p1 >> 32) ^ counter[1] ^ key[0],
+                    std::uint32_t(p1),
+                    std::uint32_t(p0 >> 32) ^ counter[3] ^ key[1],
+                    std::uint32_t(p0)
+                }};
+
+                key[0] += 0x9E3779B9;
+                key[1] += 0xBB67AE85;
+            }
+            return counter;
+        }
+
+    private:
+        // the lower 64 bits of the counter hold the position within the
+        // subsequence
+        void increment()
+        {
+            if (++counter_[0] == 0)
+            {
+                ++counter_[1];
+            }
+        }
+
+        std::array<std::uint32_t, 2> key_;
+        std::array<std::uint32_t, 4> counter_;
+        std::array<std::uint32_t, 4> results_;
+        std::size_t index_;
+    };
+}}
+
+#endif
@@ -6,8 +6,10 @@
 
 #include <phylanx/config.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <random>
+#include <string>
 
 #if !defined(PHYLANX_PRIMITIVES_RANDOM_UTILS)
 #define PHYLANX_PRIMITIVES_RANDOM_UTILS
@@ -23,6 +25,39 @@ namespace phylanx { namespace util
     PHYLANX_EXPORT void set_seed(std::uint32_t seed);
 
     PHYLANX_EXPORT std::uint32_t get_seed();
+
+    // Return the key of a stream of the counter-based generator (see
+    // philox.hpp). The key is derived from the seed, the identity of the
+    // primitive requesting the stream and the number of streams it has
+    // requested before.
+    PHYLANX_EXPORT std::uint64_t random_stream_key(
+        std::uint32_t seed, std::uint64_t identity, std::uint64_t count);
+
+    // Return the identity of the primitive with the given name, this is a
+    // hash of the name that does not depend on the platform
+    PHYLANX_EXPORT std::uint64_t random_stream_identity(
+        std::string const& name);
+
+    // Every evaluation of a random primitive draws its numbers from a
+    // separate stream. The streams of a primitive are numbered consecutively
+    // starting at the last call to set_seed, which makes the generated
+    // numbers independent of the order in which primitives are evaluated.
+    class PHYLANX_EXPORT random_stream_sequence
+    {
+    public:
+        random_stream_sequence();
+        explicit random_stream_sequence(std::string const& name);
+
+        // Return the key of the next stream of this sequence
+        std::uint64_t next_key();
+
+    private:
+        std::uint64_t identity_;
+
+        // seed generation the count refers to (upper half), number of
+        // streams requested (lower half)
+        std::atomic<std::uint64_t> state_;
+    };
 }}
 
 #endif
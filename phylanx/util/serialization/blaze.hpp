@@ -84,6 +84,59 @@ namespace hpx { namespace serialization
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, bool TF>
+    void load(input_archive& archive, blaze::CompressedVector<T, TF>& target,
+        unsigned)
+    {
+        // De-serialize sparse vector
+        std::size_t count = 0UL;
+        std::size_t nonzeros = 0UL;
+        archive >> count >> nonzeros;
+
+        target.resize(count, false);
+        target.reserve(nonzeros);
+        for (std::size_t i = 0; i != nonzeros; ++i)
+        {
+            std::size_t index = 0UL;
+            T value = T();
+            archive >> index >> value;
+            target.append(index, value);
+        }
+    }
+
+    template <typename T, bool SO>
+    void load(input_archive& archive, blaze::CompressedMatrix<T, SO>& target,
+        unsigned)
+    {
+        // De-serialize sparse matrix, one row (or column) at a time
+        std::size_t rows = 0UL;
+        std::size_t columns = 0UL;
+        std::size_t nonzeros = 0UL;
+        archive >> rows >> columns >> nonzeros;
+
+        target.resize(rows, columns, false);
+        target.reserve(nonzeros);
+
+        std::size_t const outer = SO ? columns : rows;
+        for (std::size_t i = 0; i != outer; ++i)
+        {
+            std::size_t count = 0UL;
+            archive >> count;
+            for (std::size_t k = 0; k != count; ++k)
+            {
+                std::size_t index = 0UL;
+                T value = T();
+                archive >> index >> value;
+                if (SO)
+                    target.append(index, i, value);
+                else
+                    target.append(i, index, value);
+            }
+            target.finalize(i);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool AF, bool PF, bool TF, typename RT>
     void load(input_archive& archive,
@@ -166,6 +219,44 @@ namespace hpx { namespace serialization
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, bool TF>
+    void save(output_archive& archive,
+        blaze::CompressedVector<T, TF> const& target, unsigned)
+    {
+        // Serialize sparse vector, only non-zero elements are stored
+        std::size_t count = target.size();
+        std::size_t nonzeros = target.nonZeros();
+        archive << count << nonzeros;
+
+        for (auto it = target.begin(); it != target.end(); ++it)
+        {
+            archive << it->index() << it->value();
+        }
+    }
+
+    template <typename T, bool SO>
+    void save(output_archive& archive,
+        blaze::CompressedMatrix<T, SO> const& target, unsigned)
+    {
+        // Serialize sparse matrix, one row (or column) at a time
+        std::size_t rows = target.rows();
+        std::size_t columns = target.columns();
+        std::size_t nonzeros = target.nonZeros();
+        archive << rows << columns << nonzeros;
+
+        std::size_t const outer = SO ? columns : rows;
+        for (std::size_t i = 0; i != outer; ++i)
+        {
+            std::size_t count = target.nonZeros(i);
+            archive << count;
+            for (auto it = target.begin(i); it != target.end(i); ++it)
+            {
+                archive << it->index() << it->value();
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, bool AF, bool PF, bool TF, typename RT>
     void save(output_archive& archive,
@@ -231,6 +322,12 @@ namespace hpx { namespace serialization
     HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
         (template <typename T, bool SO>), (blaze::DynamicMatrix<T, SO>));
 
+    HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
+        (template <typename T, bool TF>), (blaze::CompressedVector<T, TF>));
+
+    HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
+        (template <typename T, bool SO>), (blaze::CompressedMatrix<T, SO>));
+
     HPX_SERIALIZATION_SPLIT_FREE_TEMPLATE(
         (template <typename T, bool AF, bool PF, bool TF, typename RT>),
         (blaze::CustomVector<T, AF, PF, TF, RT>));
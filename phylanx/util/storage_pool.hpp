@@ -0,0 +1,83 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_STORAGE_POOL_HPP)
+#define PHYLANX_UTIL_STORAGE_POOL_HPP
+
+#include <phylanx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Pool of dense Blaze containers, used to recycle the memory of
+    // temporaries instead of returning it to the system allocator.
+    //
+    // Released containers are kept in per-thread free lists, bucketed by
+    // the power of two size class of their capacity. Acquiring a container
+    // reuses a cached one of matching size class if available. As the free
+    // lists are local to the (worker-) thread the memory was released on,
+    // recycled memory usually stays within the NUMA domain it was first
+    // touched in.
+    //
+    // The memory held by the free lists is limited per thread and element
+    // type ('phylanx.storage_pool.max_bytes_per_thread', default: 16MB) and
+    // for the whole process ('phylanx.storage_pool.max_bytes', default:
+    // 128MB). Containers released beyond these limits are freed.
+    //
+    // Containers handed out by the pool have the requested size, but their
+    // elements are not initialized.
+    template <typename T>
+    class PHYLANX_EXPORT storage_pool
+    {
+    public:
+        using vector_type = blaze::DynamicVector<T>;
+        using matrix_type = blaze::DynamicMatrix<T>;
+
+        static vector_type vector(std::size_t size);
+        static matrix_type matrix(std::size_t rows, std::size_t columns);
+
+        static void release(vector_type&& v) noexcept;
+        static void release(matrix_type&& m) noexcept;
+
+        // free all containers cached by the calling thread
+        static void clear() noexcept;
+    };
+
+    // Create a container holding the result of the given Blaze expression,
+    // reusing pooled memory if possible.
+    template <typename T, typename VT, bool TF>
+    blaze::DynamicVector<T> pooled_vector(blaze::Vector<VT, TF> const& expr)
+    {
+        auto result = storage_pool<T>::vector((~expr).size());
+        result = ~expr;
+        return result;
+    }
+
+    template <typename T, typename MT, bool SO>
+    blaze::DynamicMatrix<T> pooled_matrix(blaze::Matrix<MT, SO> const& expr)
+    {
+        auto result =
+            storage_pool<T>::matrix((~expr).rows(), (~expr).columns());
+        result = ~expr;
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Performance counter sources, accumulated over all element types
+    PHYLANX_EXPORT std::int64_t storage_pool_hit_count(bool reset);
+    PHYLANX_EXPORT std::int64_t storage_pool_miss_count(bool reset);
+    PHYLANX_EXPORT std::int64_t storage_pool_release_count(bool reset);
+    PHYLANX_EXPORT std::int64_t storage_pool_discard_count(bool reset);
+
+    // Enable or disable pooling, returns the previous state
+    PHYLANX_EXPORT bool enable_storage_pool(bool enable);
+}}
+
+#endif
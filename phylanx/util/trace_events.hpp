@@ -0,0 +1,91 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(PHYLANX_UTIL_TRACE_EVENTS_HPP)
+#define PHYLANX_UTIL_TRACE_EVENTS_HPP
+
+#include <phylanx/config.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// Timeline of primitive evaluations. When enabled, every eval of a primitive
+// records an event holding the time it started and finished, the worker
+// thread it was started on, the name and codename of the primitive, and the
+// shapes of its arguments and of its result. The events are appended to a
+// buffer owned by the OS thread recording them, no locks are acquired on this
+// path. The collected events can be written as a Chrome trace (JSON) file,
+// which can be loaded into chrome://tracing or Perfetto.
+//
+// The shapes of the arguments are written as 'arguments' if they were taken
+// from the values passed to the eval. Primitives evaluating their operands
+// themselves report the shape of the value each operand produced most
+// recently instead (written as 'last_known_operand_shapes'), with concurrent
+// evaluations this is not necessarily the value consumed by this eval.
+//
+// Recording is disabled by default, it can be enabled by setting the
+// configuration entry 'phylanx.trace_events' to 1 or by calling
+// enable_trace_events().
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // the shape of one operand or of the result of an eval
+    struct trace_event_shape
+    {
+        // -1 if the value is not an array (e.g. a string or a list)
+        std::int8_t ndim_;
+        std::array<std::int64_t, PHYLANX_MAX_DIMENSIONS> dims_;
+    };
+
+    struct trace_event
+    {
+        static constexpr std::size_t max_arguments = 4;
+
+        std::uint64_t begin_;               // timestamps in nanoseconds
+        std::uint64_t end_;
+        std::uint32_t worker_;              // the worker the eval started on
+        std::uint32_t name_;                // see register_trace_event_name
+        std::uint32_t num_arguments_;       // the total number of arguments
+        bool has_result_;
+        bool last_known_arguments_;         // arguments_ are last known shapes
+        trace_event_shape result_;
+        std::array<trace_event_shape, max_arguments> arguments_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // return whether the recording of trace events is currently enabled
+    PHYLANX_EXPORT bool trace_events_enabled();
+
+    // enable or disable the recording of trace events
+    PHYLANX_EXPORT void enable_trace_events(bool enable = true);
+
+    // Return a (non-zero) identifier for the given pair of primitive name and
+    // codename. All calls for the same pair return the same identifier.
+    PHYLANX_EXPORT std::uint32_t register_trace_event_name(
+        std::string const& name, std::string const& codename);
+
+    // return the worker identifier to store in a trace event
+    PHYLANX_EXPORT std::uint32_t trace_event_worker();
+
+    // append the given event to the buffer of the calling OS thread
+    PHYLANX_EXPORT void record_trace_event(trace_event const& event);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Write all events recorded since the last flush in the Chrome trace
+    // event format and remove them from the buffers. Returns the number of
+    // written events. Events which are being recorded concurrently may or may
+    // not be included.
+    PHYLANX_EXPORT std::size_t write_trace_events(std::ostream& os);
+    PHYLANX_EXPORT std::size_t write_trace_events(std::string const& filename);
+
+    // discard all events recorded since the last flush
+    PHYLANX_EXPORT void clear_trace_events();
+}}
+
+#endif
@@ -7,7 +7,9 @@
 
 import re
 import ast
+import asyncio
 import inspect
+import concurrent.futures
 import numpy as np
 import phylanx.execution_tree
 from phylanx import PhylanxSession
@@ -356,6 +358,31 @@ def check_return(ir):
             check_return(s)
 
 
+class PhylanxFuture(concurrent.futures.Future):
+    """Result of an asynchronous invocation of a Phylanx function. This can
+       be used like any concurrent.futures.Future and can be awaited in a
+       coroutine."""
+
+    def __await__(self):
+        return asyncio.wrap_future(self).__await__()
+
+
+def wrap_future(future):
+    """Wrap the given phylanx.execution_tree.future into a PhylanxFuture"""
+
+    result = PhylanxFuture()
+    result.set_running_or_notify_cancel()
+
+    def done(f):
+        try:
+            result.set_result(f.result())
+        except Exception as e:
+            result.set_exception(e)
+
+    future.add_done_callback(done)
+    return result
+
+
 class PhySLFunction:
 
     functions = []
@@ -401,6 +428,7 @@ class PhySL:
             self.file_name = "<none>"
 
         self.performance = self.kwargs.get('performance', False)
+        self.share_arguments = self.kwargs.get('share_arguments', False)
         self.localities = self.kwargs.get('localities')
         self.__perfdata__ = (None, None, None)
 
@@ -499,7 +527,14 @@ class PhySL:
                     phylanx.execution_tree.enable_measurements(
                         PhySL.compiler_state, True)
 
-            result = phylanx.execution_tree.eval(
+            # arrays are passed by reference only if requested, the
+            # function may otherwise not modify the caller's data
+            if self.outer.share_arguments:
+                evaluate = phylanx.execution_tree.eval_shared
+            else:
+                evaluate = phylanx.execution_tree.eval
+
+            result = evaluate(
                 PhySL.compiler_state, self.outer.file_name, self.func_name,
                 *self.args)
 
@@ -514,6 +549,15 @@ class PhySL:
 
             return result
 
+        def async_eval(self):
+            """evaluate given compiled function using the bound arguments
+               without waiting for the evaluation to finish, returns a
+               PhylanxFuture"""
+
+            return wrap_future(phylanx.execution_tree.async_eval(
+                PhySL.compiler_state, self.outer.file_name, self.func_name,
+                *self.args))
+
         def code(self):
             """Expose the wrapped Phylanx primitive, either directly or
                with its arguments bound"""
@@ -564,6 +608,12 @@ class PhySL:
 
         return self.lazy(args).eval()
 
+    def async_call(self, args=()):
+        """Invoke this Phylanx function without waiting for it to finish,
+           pass along the given arguments, returns a PhylanxFuture"""
+
+        return self.lazy(args).async_eval()
+
 # #############################################################################
 # Transducer rules
 
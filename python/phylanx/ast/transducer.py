@@ -40,7 +40,8 @@ def Phylanx(__phylanx_arg=None, **kwargs):
                 'target',
                 'compiler_state',
                 'performance',
-                'localities'
+                'localities',
+                'share_arguments'
             ]
 
             self.backends_map = {'PhySL': PhySL, 'OpenSCoP': OpenSCoP}
@@ -148,6 +149,16 @@ def Phylanx(__phylanx_arg=None, **kwargs):
 
             return result
 
+        def async_call(self, *args):
+            """Invoke this decorator using the given arguments without
+               waiting for the invocation to finish, returns a future"""
+
+            if self.backend == 'OpenSCoP':
+                raise NotImplementedError(
+                    "OpenSCoP kernels are not yet callable.")
+
+            return self.backend.async_call(map(self.map_decorated, args))
+
         def generate_ast(self):
             return generate_phylanx_ast(self.__src__)
 
@@ -7,7 +7,9 @@
 
 #include <phylanx/phylanx.hpp>
 
+#include <hpx/include/async.hpp>
 #include <hpx/include/iostreams.hpp>
+#include <hpx/runtime/threads/run_as_os_thread.hpp>
 
 #include <bindings/binding_helpers.hpp>
 #include <bindings/type_casters.hpp>
@@ -60,9 +62,35 @@ namespace phylanx { namespace bindings
             });
     }
 
+    namespace detail
+    {
+        phylanx::execution_tree::primitive_argument_type expression_evaluator(
+            compiler_state& state, std::string const& file_name,
+            std::string const& xexpr_str, pybind11::args args,
+            bool share_arguments);
+    }
+
     phylanx::execution_tree::primitive_argument_type expression_evaluator(
         compiler_state& state, std::string const& file_name,
         std::string const& xexpr_str, pybind11::args args)
+    {
+        return detail::expression_evaluator(
+            state, file_name, xexpr_str, std::move(args), false);
+    }
+
+    phylanx::execution_tree::primitive_argument_type
+    shared_expression_evaluator(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::args args)
+    {
+        return detail::expression_evaluator(
+            state, file_name, xexpr_str, std::move(args), true);
+    }
+
+    phylanx::execution_tree::primitive_argument_type
+    detail::expression_evaluator(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::args args, bool share_arguments)
     {
         pybind11::gil_scoped_release release;       // release GIL
 
@@ -95,6 +123,12 @@ namespace phylanx { namespace bindings
 
                 {
                     pybind11::gil_scoped_acquire acquire;
+
+                    // The arguments are kept alive by the caller until the
+                    // evaluation has finished. Their data is copied unless
+                    // the caller asked for sharing it with the function.
+                    phylanx::bindings::zero_copy_scope zero_copy(
+                        share_arguments);
                     for (auto const& item : args)
                     {
                         using phylanx::execution_tree::primitive_argument_type;
@@ -106,6 +140,92 @@ namespace phylanx { namespace bindings
             });
     }
 
+    future_type async_expression_evaluator(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::args args)
+    {
+        // The arguments are copied as the caller may release them before the
+        // evaluation has finished. This is done while still holding the GIL.
+        phylanx::execution_tree::primitive_arguments_type fargs;
+        fargs.reserve(args.size());
+        for (auto const& item : args)
+        {
+            using phylanx::execution_tree::primitive_argument_type;
+            fargs.emplace_back(item.cast<primitive_argument_type>());
+        }
+
+        pybind11::gil_scoped_release release;       // release GIL
+
+        return hpx::threads::run_as_hpx_thread(
+            [&]() -> future_type
+            {
+                auto const& code_x =
+                    phylanx::execution_tree::compile(file_name, xexpr_str,
+                        xexpr_str, state.eval_snippets, state.eval_env);
+
+                if (state.enable_measurements)
+                {
+                    auto const& funcs = code_x.functions();
+                    if (!funcs.empty())
+                    {
+                        state.primitive_instances.push_back(
+                            phylanx::util::enable_measurements(
+                                funcs.front().name_));
+                    }
+                }
+
+                auto x = code_x.run(state.eval_ctx);
+
+                return hpx::async(
+                    [x = std::move(x), fargs = std::move(fargs),
+                        ctx = state.eval_ctx]() mutable
+                    ->  phylanx::execution_tree::primitive_argument_type
+                    {
+                        // Make sure None is printed as "None"
+                        phylanx::util::none_wrapper wrap_cout(hpx::cout);
+                        phylanx::util::none_wrapper wrap_debug(
+                            hpx::consolestream);
+
+                        return x(std::move(fargs), std::move(ctx));
+                    });
+            });
+    }
+
+    void add_done_callback(future_type const& f, pybind11::function callback)
+    {
+        // The callback is owned by the continuation, it is released while
+        // holding the GIL.
+        auto cb = new pybind11::function(std::move(callback));
+
+        pybind11::gil_scoped_release release;       // release GIL
+
+        hpx::threads::run_as_hpx_thread(
+            [&]()
+            {
+                f.then(hpx::launch::sync,
+                    [cb](future_type const& f)
+                    {
+                        // Python code must not block the HPX worker threads,
+                        // run it on a separate OS thread instead.
+                        hpx::threads::run_as_os_thread(
+                            [&]()
+                            {
+                                pybind11::gil_scoped_acquire acquire;
+                                try
+                                {
+                                    (*cb)(f);
+                                }
+                                catch (pybind11::error_already_set& e)
+                                {
+                                    e.restore();
+                                    PyErr_WriteUnraisable(cb->ptr());
+                                }
+                                delete cb;
+                            }).get();
+                    });
+            });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state, std::string const& file_name,
@@ -511,6 +631,12 @@ namespace phylanx { namespace bindings
                 case primitive_argument_type::float64_index:
                     return pybind11::dtype("float64");
 
+                case primitive_argument_type::float32_index:
+                    return pybind11::dtype("float32");
+
+                case primitive_argument_type::int32_index:
+                    return pybind11::dtype("int32");
+
                 case primitive_argument_type::primitive_index:
                     return pybind11::dtype("O");
 
@@ -192,6 +192,26 @@ namespace phylanx { namespace bindings
         compiler_state& state, std::string const& file_name,
         std::string const& xexpr_str, pybind11::args args);
 
+    // evaluate compiled expression, arrays passed as arguments are referenced
+    // in place (if possible), i.e. modifications applied to them by the
+    // evaluated function are visible to the caller
+    phylanx::execution_tree::primitive_argument_type
+    shared_expression_evaluator(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::args args);
+
+    // evaluate compiled expression without waiting for the result
+    using future_type =
+        hpx::shared_future<phylanx::execution_tree::primitive_argument_type>;
+
+    future_type async_expression_evaluator(compiler_state& state,
+        std::string const& file_name, std::string const& xexpr_str,
+        pybind11::args args);
+
+    // invoke the given Python callable with the future once it has become
+    // ready
+    void add_done_callback(future_type const& f, pybind11::function callback);
+
     // extract pre-compiled code for given function name
     phylanx::execution_tree::primitive code_for(
         phylanx::bindings::compiler_state& state,
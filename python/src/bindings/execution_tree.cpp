@@ -17,6 +17,7 @@
 #include <hpx/exception.hpp>
 #include <hpx/runtime/threads/run_as_hpx_thread.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -49,6 +50,46 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
         },
         "compile and evaluate a numerical expression in PhySL");
 
+    execution_tree.def("eval_shared",
+        phylanx::bindings::shared_expression_evaluator,
+        "compile and evaluate a numerical expression in PhySL, arrays passed "
+        "as arguments are referenced in place (if possible), modifications "
+        "applied to them are visible to the caller");
+
+    // asynchronous evaluation, the result is represented by a future
+    pybind11::class_<phylanx::bindings::future_type>(execution_tree, "future",
+        "type representing the (eventual) result of an asynchronous "
+        "evaluation")
+        .def("done",
+            [](phylanx::bindings::future_type const& f)
+            {
+                return f.is_ready();
+            },
+            "return whether the evaluation has finished")
+        .def("result",
+            [](phylanx::bindings::future_type const& f)
+            ->  phylanx::execution_tree::primitive_argument_type
+            {
+                {
+                    pybind11::gil_scoped_release release;   // release GIL
+                    if (!f.is_ready())
+                    {
+                        hpx::threads::run_as_hpx_thread([&]() { f.wait(); });
+                    }
+                }
+                return f.get();
+            },
+            "wait for the evaluation to finish and return its result (or "
+            "rethrow the exception it raised)")
+        .def("add_done_callback", phylanx::bindings::add_done_callback,
+            "invoke the given callable with this future once the evaluation "
+            "has finished");
+
+    execution_tree.def("async_eval",
+        phylanx::bindings::async_expression_evaluator,
+        "compile and evaluate a numerical expression in PhySL without "
+        "waiting for the evaluation to finish, returns a future");
+
     // expose functionalities needed for accessing performance data
     execution_tree.def("enable_measurements",
         phylanx::bindings::enable_measurements,
@@ -71,6 +112,118 @@ void phylanx::bindings::bind_execution_tree(pybind11::module m)
         "retrieve the Newick and DOT tree topologies for the given "
         "execution tree");
 
+    // expose scheduling policy control
+    execution_tree.def("set_scheduling_policy",
+        [](std::string const& name)
+        {
+            pybind11::gil_scoped_release release;       // release GIL
+            hpx::threads::run_as_hpx_thread([&]() {
+                phylanx::execution_tree::set_scheduling_policy(name);
+            });
+        },
+        "select the policy used to schedule the evaluation of primitives "
+        "('hysteresis', 'cost_model', 'sync', or 'async')");
+
+    execution_tree.def("get_scheduling_policy",
+        []() -> std::string
+        {
+            pybind11::gil_scoped_release release;       // release GIL
+            return hpx::threads::run_as_hpx_thread([]() {
+                return phylanx::execution_tree::get_scheduling_policy_name();
+            });
+        },
+        "return the name of the currently active scheduling policy");
+
+    execution_tree.def("enable_lightweight_primitives",
+        [](bool enable)
+        {
+            phylanx::execution_tree::enable_lightweight_primitives(enable);
+        },
+        "create primitives compiled for the local locality without "
+        "registering them with AGAS",
+        pybind11::arg("enable") = true);
+
+    // expose the timeline of primitive evaluations
+    execution_tree.def("enable_trace_events",
+        [](bool enable)
+        {
+            phylanx::util::enable_trace_events(enable);
+        },
+        "enable or disable recording the begin and end of all evaluations "
+        "of primitives",
+        pybind11::arg("enable") = true);
+
+    execution_tree.def("write_trace_events",
+        [](std::string const& filename) -> std::size_t
+        {
+            pybind11::gil_scoped_release release;       // release GIL
+            return hpx::threads::run_as_hpx_thread([&]() {
+                return phylanx::util::write_trace_events(filename);
+            });
+        },
+        "write the recorded evaluations of primitives to the given file in "
+        "the Chrome trace event format (JSON), returns the number of written "
+        "events");
+
+    // expose control over the persistent compilation cache
+    execution_tree.def("set_compile_cache_directory",
+        [](std::string const& dir)
+        {
+            phylanx::execution_tree::compiler::set_compile_cache_directory(dir);
+        },
+        "set the directory used to persistently cache compiled code (an "
+        "empty string disables the persistent cache)");
+
+    execution_tree.def("get_compile_cache_directory",
+        []() -> std::string
+        {
+            return phylanx::execution_tree::compiler::
+                get_compile_cache_directory();
+        },
+        "return the directory used to persistently cache compiled code");
+
+    execution_tree.def("set_compile_cache_capacity",
+        [](std::size_t capacity)
+        {
+            phylanx::execution_tree::compiler::set_compile_cache_capacity(
+                capacity);
+        },
+        "set the maximum number of compiled code snippets cached in memory");
+
+    execution_tree.def("clear_compile_cache",
+        []()
+        {
+            phylanx::execution_tree::compiler::clear_compile_cache();
+        },
+        "remove all entries from the in-memory compilation cache");
+
+    pybind11::class_<
+            phylanx::execution_tree::compiler::compile_cache_statistics>(
+            execution_tree, "compile_cache_statistics")
+        .def_readonly("memory_hits", &phylanx::execution_tree::compiler::
+                compile_cache_statistics::memory_hits_,
+            "number of compiled code snippets reused from memory")
+        .def_readonly("disk_hits", &phylanx::execution_tree::compiler::
+                compile_cache_statistics::disk_hits_,
+            "number of compiled code snippets loaded from the cache directory")
+        .def_readonly("misses", &phylanx::execution_tree::compiler::
+                compile_cache_statistics::misses_,
+            "number of code snippets that had to be compiled")
+        .def_readonly("evictions", &phylanx::execution_tree::compiler::
+                compile_cache_statistics::evictions_,
+            "number of compiled code snippets evicted from memory")
+        .def_readonly("size", &phylanx::execution_tree::compiler::
+                compile_cache_statistics::size_,
+            "number of compiled code snippets currently cached in memory");
+
+    execution_tree.def("get_compile_cache_statistics",
+        []()
+        {
+            return phylanx::execution_tree::compiler::
+                get_compile_cache_statistics();
+        },
+        "return the hit, miss, and eviction counts of the compilation cache");
+
     execution_tree.def("code_for", phylanx::bindings::code_for,
         "extract compiled code for given function");
 
@@ -43,6 +43,53 @@
 #define PHYLANX_PYBIND_DESCR_GETNAME() name
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace bindings
+{
+    // NumPy arrays converted while an (enabled) instance of this type is
+    // alive on the current thread are referenced in place instead of being
+    // copied, provided their layout is compatible with the custom storage
+    // types of node_data. The caller has to guarantee that the converted
+    // Python objects outlive all uses of the resulting node_data instances.
+    // Modifications applied to referenced arrays are visible to their owner.
+    class zero_copy_scope
+    {
+    public:
+        explicit zero_copy_scope(bool enable = true)
+          : enabled_(enable)
+        {
+            if (enabled_)
+            {
+                ++count();
+            }
+        }
+        ~zero_copy_scope()
+        {
+            if (enabled_)
+            {
+                --count();
+            }
+        }
+
+        zero_copy_scope(zero_copy_scope const&) = delete;
+        zero_copy_scope& operator=(zero_copy_scope const&) = delete;
+
+        static bool is_active()
+        {
+            return count() != 0;
+        }
+
+    private:
+        static int& count()
+        {
+            static thread_local int count_ = 0;
+            return count_;
+        }
+
+        bool enabled_;
+    };
+}}
+
 // older versions of pybind11 don't support variant-like types
 namespace pybind11 { namespace detail
 {
@@ -154,6 +201,39 @@ namespace pybind11 { namespace detail
         return false;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Determine whether the given array can be referenced by a node_data
+    // without copying its data. This requires a C-contiguous, aligned, and
+    // writeable array of the exact element type. Blaze additionally requires
+    // the data to be aligned and padded to its SIMD width, i.e. the length
+    // of the innermost dimension has to be a multiple of that width.
+    template <typename T, typename Result>
+    bool can_reference_array(array const& a)
+    {
+        if (!phylanx::bindings::zero_copy_scope::is_active() || a.size() == 0)
+        {
+            return false;
+        }
+
+        constexpr int required_flags = array::c_style |
+            detail::npy_api::NPY_ARRAY_ALIGNED_ |
+            detail::npy_api::NPY_ARRAY_WRITEABLE_;
+        if ((a.flags() & required_flags) != required_flags)
+        {
+            return false;
+        }
+
+        if (!detail::npy_api::get().PyArray_EquivTypes_(
+                a.dtype().ptr(), dtype::of<Result>().ptr()))
+        {
+            return false;
+        }
+
+        std::size_t columns = a.shape(a.ndim() - 1);
+        return blaze::checkAlignment(static_cast<T const*>(a.data())) &&
+            (columns % blaze::SIMDTrait<T>::size) == 0;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Casts a Blaze type to numpy array.  If given a base, the numpy array
     // references the src data, otherwise it'll make a copy.
@@ -384,8 +464,7 @@ namespace pybind11 { namespace detail
     {
         static bool call(handle src)
         {
-            return isinstance<array_t<double>>(src) ||
-                   isinstance<array_t<float>>(src);
+            return isinstance<array_t<double>>(src);
         }
     };
 
@@ -395,7 +474,6 @@ namespace pybind11 { namespace detail
         static bool call(handle src)
         {
             return isinstance<array_t<std::int64_t>>(src) ||
-                   isinstance<array_t<std::int32_t>>(src) ||
                    isinstance<array_t<std::int16_t>>(src) ||
                    isinstance<array_t<std::uint64_t>>(src) ||
                    isinstance<array_t<std::uint32_t>>(src) ||
@@ -470,6 +548,17 @@ namespace pybind11 { namespace detail
             auto dims = buf.ndim();
             if (dims != 1) return false;
 
+            // reference the array's data directly, if possible
+            if (buf.ptr() == src.ptr() &&
+                can_reference_array<T, result_type>(buf))
+            {
+                std::size_t size = buf.shape(0);
+                value = typename phylanx::ir::node_data<T>::
+                    custom_storage1d_type{
+                        static_cast<T*>(buf.mutable_data()), size, size};
+                return true;
+            }
+
             array_index_type t;
             bool fits = conformable<result_type>(buf, 1, t);
             if (!fits) return false;
@@ -514,6 +603,18 @@ namespace pybind11 { namespace detail
             auto dims = buf.ndim();
             if (dims != 2) return false;
 
+            // reference the array's data directly, if possible
+            if (buf.ptr() == src.ptr() &&
+                can_reference_array<T, result_type>(buf))
+            {
+                std::size_t rows = buf.shape(0);
+                std::size_t columns = buf.shape(1);
+                value = typename phylanx::ir::node_data<T>::
+                    custom_storage2d_type{static_cast<T*>(buf.mutable_data()),
+                        rows, columns, columns};
+                return true;
+            }
+
             array_index_type t;
             bool fits = conformable<result_type>(buf, 2, t);
             if (!fits) return false;
@@ -559,6 +660,19 @@ namespace pybind11 { namespace detail
             auto dims = buf.ndim();
             if (dims != 3) return false;
 
+            // reference the array's data directly, if possible
+            if (buf.ptr() == src.ptr() &&
+                can_reference_array<T, result_type>(buf))
+            {
+                std::size_t pages = buf.shape(0);
+                std::size_t rows = buf.shape(1);
+                std::size_t columns = buf.shape(2);
+                value = typename phylanx::ir::node_data<T>::
+                    custom_storage3d_type{static_cast<T*>(buf.mutable_data()),
+                        pages, rows, columns, columns};
+                return true;
+            }
+
             array_index_type ait;
             bool fits = conformable<result_type>(buf, 3, ait);
             if (!fits) return false;
@@ -805,6 +919,13 @@ namespace pybind11 { namespace detail
                 return result.release();
             }
 
+            if (src->is_sparse())
+            {
+                // sparse data is handed to Python as a dense array
+                phylanx::ir::node_data<T> dense = src->to_dense();
+                return cast_impl_move(&dense);
+            }
+
             switch (policy)
             {
             case return_value_policy::take_ownership:   HPX_FALLTHROUGH;
@@ -191,6 +191,9 @@ namespace phylanx { namespace execution_tree
 
         {
             pybind11::gil_scoped_acquire acquire;
+
+            // the arguments are copied, modifications applied by the
+            // evaluated expression are not visible to the caller
             for (auto const& item : args)
             {
                 using phylanx::execution_tree::primitive_argument_type;
@@ -1,12 +1,12 @@
-// Copyright (c) 2017-2018 Hartmut Kaiser
+// Copyright (c) 2017-2019 Hartmut Kaiser
 //
 // Distributed under the Boost Software License, Version 1.0. (See accompanying
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
-#include <phylanx/ast/generate_ast.hpp>
 #include <phylanx/ast/node.hpp>
 #include <phylanx/execution_tree/compile.hpp>
+#include <phylanx/execution_tree/compiler/compile_cache.hpp>
 #include <phylanx/execution_tree/compiler/compiler.hpp>
 #include <phylanx/execution_tree/compiler_component.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
@@ -108,8 +108,9 @@ namespace phylanx { namespace execution_tree
         std::string const& expr, compiler::function_list& snippets,
         compiler::environment& env, hpx::id_type const& default_locality)
     {
-        return compile(name, "<unknown>", ast::generate_ast(expr), snippets,
-            env, default_locality);
+        return compile(name, "<unknown>",
+            compiler::generate_ast_cached(expr), snippets, env,
+            default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -117,7 +118,8 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets, compiler::environment& env,
         hpx::id_type const& default_locality)
     {
-        return compile(name, func_name, ast::generate_ast(expr), snippets, env,
+        return compile(name, func_name,
+            compiler::generate_ast_cached(expr), snippets, env,
             default_locality);
     }
 
@@ -145,8 +147,8 @@ namespace phylanx { namespace execution_tree
         std::string const& expr, compiler::function_list& snippets,
         hpx::id_type const& default_locality)
     {
-        return compile(name, "<unknown>", ast::generate_ast(expr), snippets,
-            default_locality);
+        return compile(name, "<unknown>",
+            compiler::generate_ast_cached(expr), snippets, default_locality);
     }
 
     compiler::entry_point const& compile(std::string const& name,
@@ -160,8 +162,8 @@ namespace phylanx { namespace execution_tree
         std::string const& func_name, std::string const& expr,
         compiler::function_list& snippets, hpx::id_type const& default_locality)
     {
-        return compile(name, func_name, ast::generate_ast(expr), snippets,
-            default_locality);
+        return compile(name, func_name,
+            compiler::generate_ast_cached(expr), snippets, default_locality);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -178,8 +180,9 @@ namespace phylanx { namespace execution_tree
         compiler::function_list& snippets, compiler::environment& env,
         hpx::id_type const& default_locality)
     {
-        return compile("<unknown>", "<unknown>", ast::generate_ast(expr),
-            snippets, env, default_locality);
+        return compile("<unknown>", "<unknown>",
+            compiler::generate_ast_cached(expr), snippets, env,
+            default_locality);
     }
 
     compiler::entry_point const& compile(
@@ -193,8 +196,8 @@ namespace phylanx { namespace execution_tree
     compiler::entry_point const& compile(std::string const& expr,
         compiler::function_list& snippets, hpx::id_type const& default_locality)
     {
-        return compile("<unknown>", "<unknown>", ast::generate_ast(expr),
-            snippets, default_locality);
+        return compile("<unknown>", "<unknown>",
+            compiler::generate_ast_cached(expr), snippets, default_locality);
     }
 
     ///////////////////////////////////////////////////////////////////////////
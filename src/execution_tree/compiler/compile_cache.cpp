@@ -0,0 +1,458 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ast/generate_ast.hpp>
+#include <phylanx/ast/node.hpp>
+#include <phylanx/config/version.hpp>
+#include <phylanx/execution_tree/compile.hpp>
+#include <phylanx/execution_tree/compiler/compile_cache.hpp>
+#include <phylanx/util/serialization/ast.hpp>
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/config_entry.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree { namespace compiler
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // increment this whenever the on-disk format or the AST changes
+        constexpr std::uint64_t compile_cache_format_version = 1;
+
+        constexpr char const compile_cache_magic[] = "PHYLANX-AST";
+
+        // default number of ASTs kept in memory
+        constexpr std::size_t default_compile_cache_capacity = 1024;
+
+        ///////////////////////////////////////////////////////////////////////
+        // FNV-1a
+        constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ull;
+        constexpr std::uint64_t fnv_prime = 1099511628211ull;
+
+        inline std::uint64_t hash_bytes(
+            std::uint64_t hash, char const* data, std::size_t size)
+        {
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                hash ^= static_cast<unsigned char>(data[i]);
+                hash *= fnv_prime;
+            }
+            return hash;
+        }
+
+        inline std::uint64_t hash_string(
+            std::uint64_t hash, std::string const& s)
+        {
+            // include the length to separate consecutive strings
+            std::uint64_t size = s.size();
+            hash = hash_bytes(
+                hash, reinterpret_cast<char const*>(&size), sizeof(size));
+            return hash_bytes(hash, s.data(), s.size());
+        }
+
+        // The hash of the versions and of all known patterns is computed only
+        // once, invalidates all cache entries whenever primitives are added,
+        // removed, or change their signature.
+        std::uint64_t compile_cache_base_key()
+        {
+            static std::uint64_t const key = []()
+            {
+                std::uint64_t hash = fnv_offset_basis;
+                std::uint64_t versions[] = {
+                    compile_cache_format_version, PHYLANX_VERSION_FULL};
+                hash = hash_bytes(hash,
+                    reinterpret_cast<char const*>(versions), sizeof(versions));
+
+                for (auto const& p : get_all_known_patterns())
+                {
+                    hash = hash_string(hash, p.name_);
+                    for (auto const& pattern : p.data_.patterns_)
+                    {
+                        hash = hash_string(hash, pattern);
+                    }
+                }
+                return hash;
+            }();
+            return key;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The in-memory cache holds at most 'capacity_' entries, the least
+        // recently used entry is evicted first.
+        struct compile_cache
+        {
+            using mutex_type = hpx::lcos::local::spinlock;
+
+            struct entry
+            {
+                std::string source_;
+                std::vector<ast::expression> ast_;
+                std::list<std::uint64_t>::iterator lru_pos_;
+            };
+
+            compile_cache()
+              : directory_initialized_(false)
+              , capacity_(0)
+              , capacity_initialized_(false)
+              , memory_hits_(0)
+              , disk_hits_(0)
+              , misses_(0)
+              , evictions_(0)
+            {}
+
+            bool find(std::uint64_t key, std::string const& source,
+                std::vector<ast::expression>& ast)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                auto it = entries_.find(key);
+                if (it == entries_.end() || it->second.source_ != source)
+                {
+                    return false;
+                }
+                lru_.splice(lru_.begin(), lru_, it->second.lru_pos_);
+                ast = it->second.ast_;
+                return true;
+            }
+
+            void insert(std::uint64_t key, std::string const& source,
+                std::vector<ast::expression> const& ast)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                std::size_t capacity = capacity_locked();
+                if (capacity == 0)
+                {
+                    return;
+                }
+
+                auto it = entries_.find(key);
+                if (it != entries_.end())
+                {
+                    lru_.splice(lru_.begin(), lru_, it->second.lru_pos_);
+                    it->second.source_ = source;
+                    it->second.ast_ = ast;
+                    return;
+                }
+
+                lru_.push_front(key);
+                entries_.emplace(key, entry{source, ast, lru_.begin()});
+                evict_locked(capacity);
+            }
+
+            void clear()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                entries_.clear();
+                lru_.clear();
+            }
+
+            std::size_t capacity()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                return capacity_locked();
+            }
+
+            void capacity(std::size_t capacity)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                capacity_ = capacity;
+                capacity_initialized_ = true;
+                evict_locked(capacity);
+            }
+
+            std::size_t size()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                return entries_.size();
+            }
+
+            std::string directory()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (!directory_initialized_)
+                {
+                    directory_ = hpx::get_config_entry(
+                        "phylanx.compile_cache.directory", "");
+                    directory_initialized_ = true;
+                }
+                return directory_;
+            }
+
+            void directory(std::string const& dir)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                directory_ = dir;
+                directory_initialized_ = true;
+            }
+
+            std::size_t capacity_locked()
+            {
+                if (!capacity_initialized_)
+                {
+                    try
+                    {
+                        capacity_ = std::stoull(hpx::get_config_entry(
+                            "phylanx.compile_cache.max_entries",
+                            std::to_string(default_compile_cache_capacity)));
+                    }
+                    catch (std::exception const&)
+                    {
+                        capacity_ = default_compile_cache_capacity;
+                    }
+                    capacity_initialized_ = true;
+                }
+                return capacity_;
+            }
+
+            void evict_locked(std::size_t capacity)
+            {
+                while (entries_.size() > capacity)
+                {
+                    entries_.erase(lru_.back());
+                    lru_.pop_back();
+                    ++evictions_;
+                }
+            }
+
+            mutex_type mtx_;
+            std::unordered_map<std::uint64_t, entry> entries_;
+            std::list<std::uint64_t> lru_;      // most recently used first
+            std::string directory_;
+            bool directory_initialized_;
+            std::size_t capacity_;
+            bool capacity_initialized_;
+
+            std::atomic<std::size_t> memory_hits_;
+            std::atomic<std::size_t> disk_hits_;
+            std::atomic<std::size_t> misses_;
+            std::atomic<std::size_t> evictions_;
+        };
+
+        compile_cache& get_compile_cache()
+        {
+            static compile_cache cache;
+            return cache;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::string cache_file_name(
+            std::string const& directory, std::uint64_t key)
+        {
+            char buffer[17];
+            std::snprintf(buffer, sizeof(buffer), "%016llx",
+                static_cast<unsigned long long>(key));
+
+            boost::filesystem::path p(directory);
+            p /= std::string(buffer) + ".physl-ast";
+            return p.string();
+        }
+
+        template <typename T>
+        bool read_value(std::istream& is, T& value)
+        {
+            return bool(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        bool read_block(std::istream& is, std::vector<char>& data)
+        {
+            std::uint64_t size = 0;
+            if (!read_value(is, size))
+            {
+                return false;
+            }
+            data.resize(size);
+            return size == 0 || bool(is.read(data.data(), size));
+        }
+
+        template <typename T>
+        void write_value(std::ostream& os, T const& value)
+        {
+            os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+        }
+
+        template <typename Container>
+        void write_block(std::ostream& os, Container const& data)
+        {
+            write_value(os, std::uint64_t(data.size()));
+            os.write(data.data(), data.size());
+        }
+
+        // The file stores the source itself to protect against hash
+        // collisions. Any inconsistency is treated as a cache miss.
+        bool load_from_disk(std::string const& filename, std::uint64_t key,
+            std::string const& source, std::vector<ast::expression>& ast)
+        {
+            std::ifstream is(filename, std::ios::binary);
+            if (!is.is_open())
+            {
+                return false;
+            }
+
+            char magic[sizeof(compile_cache_magic)] = {0};
+            std::uint64_t stored_key = 0;
+            if (!is.read(magic, sizeof(magic)) ||
+                std::string(magic) != compile_cache_magic ||
+                !read_value(is, stored_key) || stored_key != key)
+            {
+                return false;
+            }
+
+            std::vector<char> data;
+            if (!read_block(is, data) ||
+                std::string(data.begin(), data.end()) != source ||
+                !read_block(is, data))
+            {
+                return false;
+            }
+
+            try
+            {
+                ast = util::unserialize<std::vector<ast::expression>>(data);
+            }
+            catch (...)
+            {
+                return false;
+            }
+            return true;
+        }
+
+        // Write the entry to a temporary file first and atomically move it
+        // into place afterwards, concurrent readers will never see partial
+        // entries.
+        void store_to_disk(std::string const& directory,
+            std::string const& filename, std::uint64_t key,
+            std::string const& source, std::vector<ast::expression> const& ast)
+        {
+            boost::system::error_code ec;
+            boost::filesystem::create_directories(directory, ec);
+            if (ec)
+            {
+                return;     // the cache is an optimization only
+            }
+
+            // the temporary file name must be unique across threads and
+            // processes storing the same entry concurrently
+            std::string tmpname = boost::filesystem::unique_path(
+                filename + ".%%%%-%%%%-%%%%-%%%%.tmp").string();
+            {
+                std::ofstream os(tmpname, std::ios::binary | std::ios::trunc);
+                if (!os.is_open())
+                {
+                    return;
+                }
+
+                os.write(compile_cache_magic, sizeof(compile_cache_magic));
+                write_value(os, key);
+                write_block(os, source);
+                write_block(os, util::serialize(ast));
+
+                if (!os)
+                {
+                    os.close();
+                    std::remove(tmpname.c_str());
+                    return;
+                }
+            }
+
+            boost::filesystem::rename(tmpname, filename, ec);
+            if (ec)
+            {
+                std::remove(tmpname.c_str());
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t compile_cache_key(std::string const& source)
+    {
+        return detail::hash_string(detail::compile_cache_base_key(), source);
+    }
+
+    std::vector<ast::expression> generate_ast_cached(std::string const& source)
+    {
+        auto& cache = detail::get_compile_cache();
+        std::uint64_t key = compile_cache_key(source);
+
+        std::vector<ast::expression> ast;
+        if (cache.find(key, source, ast))
+        {
+            ++cache.memory_hits_;
+            return ast;
+        }
+
+        std::string directory = cache.directory();
+        std::string filename;
+        if (!directory.empty())
+        {
+            filename = detail::cache_file_name(directory, key);
+            if (detail::load_from_disk(filename, key, source, ast))
+            {
+                ++cache.disk_hits_;
+                cache.insert(key, source, ast);
+                return ast;
+            }
+        }
+
+        ++cache.misses_;
+        ast = ast::generate_ast(source);
+
+        if (!directory.empty())
+        {
+            detail::store_to_disk(directory, filename, key, source, ast);
+        }
+        cache.insert(key, source, ast);
+
+        return ast;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_compile_cache_directory(std::string const& dir)
+    {
+        detail::get_compile_cache().directory(dir);
+    }
+
+    std::string get_compile_cache_directory()
+    {
+        return detail::get_compile_cache().directory();
+    }
+
+    void clear_compile_cache()
+    {
+        detail::get_compile_cache().clear();
+    }
+
+    void set_compile_cache_capacity(std::size_t capacity)
+    {
+        detail::get_compile_cache().capacity(capacity);
+    }
+
+    std::size_t get_compile_cache_capacity()
+    {
+        return detail::get_compile_cache().capacity();
+    }
+
+    compile_cache_statistics get_compile_cache_statistics()
+    {
+        auto& cache = detail::get_compile_cache();
+        return compile_cache_statistics{cache.memory_hits_.load(),
+            cache.disk_hits_.load(), cache.misses_.load(),
+            cache.evictions_.load(), cache.size()};
+    }
+}}}
@@ -26,6 +26,8 @@
 
 #include <hpx/include/naming.hpp>
 #include <hpx/include/util.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/get_num_localities.hpp>
 
 #include <boost/fusion/include/std_pair.hpp>
@@ -41,6 +43,8 @@
 #include <limits>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <utility>
@@ -48,30 +52,103 @@
 namespace phylanx { namespace execution_tree { namespace compiler
 {
     ///////////////////////////////////////////////////////////////////////
-    environment default_environment(pattern_list const& patterns_list,
-        hpx::id_type const& default_locality)
+    namespace detail
     {
-        environment result;
+        template <typename F>
+        void define_builtins(pattern_list const& patterns_list,
+            hpx::id_type const& default_locality, F&& define)
+        {
+            for (auto const& patterns : patterns_list)
+            {
+                auto const& p = patterns.data_;
+                if (!p.patterns_.empty())
+                {
+                    define(p.primitive_type_,
+                        builtin_function(p.create_primitive_, default_locality));
+
+                    if (p.supports_dtype_)
+                    {
+                        define(p.primitive_type_ + "__bool",
+                            builtin_function(
+                                p.create_primitive_, default_locality));
+                        define(p.primitive_type_ + "__int",
+                            builtin_function(
+                                p.create_primitive_, default_locality));
+                        define(p.primitive_type_ + "__int32",
+                            builtin_function(
+                                p.create_primitive_, default_locality));
+                        define(p.primitive_type_ + "__float",
+                            builtin_function(
+                                p.create_primitive_, default_locality));
+                        define(p.primitive_type_ + "__float32",
+                            builtin_function(
+                                p.create_primitive_, default_locality));
+                    }
+                }
+            }
+        }
 
-        for (auto const& patterns : patterns_list)
+        ///////////////////////////////////////////////////////////////////////
+        // The table of built-in functions depends only on the set of known
+        // patterns (fixed after startup) and on the target locality, thus it
+        // is created once per locality and shared afterwards.
+        struct builtins_cache
         {
-            auto const& p = patterns.data_;
-            if (!p.patterns_.empty())
+            using mutex_type = hpx::lcos::local::spinlock;
+
+            environment::builtins_type get(hpx::id_type const& locality)
             {
-                result.define(p.primitive_type_,
-                    builtin_function(p.create_primitive_, default_locality));
+                std::uint32_t locality_id = locality ?
+                    hpx::naming::get_locality_id_from_id(locality) :
+                    hpx::naming::invalid_locality_id;
 
-                if (p.supports_dtype_)
                 {
-                    result.define(p.primitive_type_ + "__bool",
-                        builtin_function(p.create_primitive_, default_locality));
-                    result.define(p.primitive_type_ + "__int",
-                        builtin_function(p.create_primitive_, default_locality));
-                    result.define(p.primitive_type_ + "__float",
-                        builtin_function(p.create_primitive_, default_locality));
+                    std::lock_guard<mutex_type> l(mtx_);
+                    auto it = builtins_.find(locality_id);
+                    if (it != builtins_.end())
+                    {
+                        return it->second;
+                    }
                 }
+
+                // create the table outside of the lock, concurrent threads
+                // might do the same, the first one to finish wins
+                auto builtins = std::make_shared<environment::map_type>();
+                define_builtins(get_all_known_patterns(), locality,
+                    [&](std::string const& name, builtin_function&& f)
+                    {
+                        (*builtins)[name] = compiled_function(std::move(f));
+                    });
+
+                std::lock_guard<mutex_type> l(mtx_);
+                return builtins_
+                    .emplace(locality_id,
+                        environment::builtins_type(std::move(builtins)))
+                    .first->second;
             }
+
+            mutex_type mtx_;
+            std::map<std::uint32_t, environment::builtins_type> builtins_;
+        };
+
+        builtins_cache& get_builtins_cache()
+        {
+            static builtins_cache cache;
+            return cache;
         }
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    environment default_environment(pattern_list const& patterns_list,
+        hpx::id_type const& default_locality)
+    {
+        environment result;
+
+        detail::define_builtins(patterns_list, default_locality,
+            [&](std::string const& name, builtin_function&& f)
+            {
+                result.define(name, std::move(f));
+            });
 
         return result;
     }
@@ -93,7 +170,8 @@ namespace phylanx { namespace execution_tree { namespace compiler
 
     environment default_environment(hpx::id_type const& default_locality)
     {
-        return default_environment(get_all_known_patterns(), default_locality);
+        return environment(
+            detail::get_builtins_cache().get(default_locality));
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -374,7 +452,9 @@ namespace phylanx { namespace execution_tree { namespace compiler
                     {
                         insert_pattern(result, pattern, p, "__bool");
                         insert_pattern(result, pattern, p, "__int");
+                        insert_pattern(result, pattern, p, "__int32");
                         insert_pattern(result, pattern, p, "__float");
+                        insert_pattern(result, pattern, p, "__float32");
                     }
                 }
             }
@@ -1325,6 +1405,296 @@ namespace phylanx { namespace execution_tree { namespace compiler
             return fullname;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Chains of elementwise operations can be compiled into a single
+        // __elementwise primitive evaluating all of the operations in one
+        // pass over the data (enabled with phylanx.fuse_elementwise=1).
+        static bool fuse_elementwise_operations()
+        {
+            static bool fuse_elementwise =
+                hpx::get_config_entry("phylanx.fuse_elementwise", "0") == "1";
+            return fuse_elementwise;
+        }
+
+        static char const* elementwise_token(ast::optoken op)
+        {
+            switch (op)
+            {
+            case ast::optoken::op_plus:   return " +";
+            case ast::optoken::op_minus:  return " -";
+            case ast::optoken::op_times:  return " *";
+            case ast::optoken::op_divide: return " /";
+            default:
+                break;
+            }
+            return nullptr;
+        }
+
+        static char const* comparison_token(ast::optoken op)
+        {
+            switch (op)
+            {
+            case ast::optoken::op_less:          return " <";
+            case ast::optoken::op_less_equal:    return " <=";
+            case ast::optoken::op_greater:       return " >";
+            case ast::optoken::op_greater_equal: return " >=";
+            case ast::optoken::op_equal:         return " ==";
+            case ast::optoken::op_not_equal:     return " !=";
+            default:
+                break;
+            }
+            return nullptr;
+        }
+
+        static char const* operation_token(ast::optoken op)
+        {
+            char const* token = elementwise_token(op);
+            return token != nullptr ? token : comparison_token(op);
+        }
+
+        // Return whether the given operand is an invocation of one of the
+        // built-in elementwise functions supported by __elementwise, the
+        // name of the function is used as its token in the program.
+        bool is_elementwise_function(ast::operand const& op) const
+        {
+            static char const* const functions[] = {
+                "absolute", "square", "sqrt", "exp", "log", "sin", "cos",
+                "tanh"
+            };
+
+            if (!ast::detail::is_function_call(op) ||
+                !ast::detail::function_attribute(op).empty())
+            {
+                return false;
+            }
+
+            std::string const name = ast::detail::function_name(op);
+            for (char const* function : functions)
+            {
+                if (name == function)
+                {
+                    return patterns_.find(name) != patterns_.end() &&
+                        ast::detail::function_arguments(op).size() == 1;
+                }
+            }
+            return false;
+        }
+
+        // Append the reverse polish representation of the given operand to
+        // 'program', everything that can't be fused is added to 'leaves'.
+        // Returns the number of fused operations.
+        std::size_t generate_elementwise_program(ast::operand const& op,
+            std::string& program, std::vector<ast::expression>& leaves)
+        {
+            if (op.index() == 2)            // unary_expr
+            {
+                ast::unary_expr const& ue = util::get<2>(op.get()).get();
+                if (ue.operator_ == ast::optoken::op_negative)
+                {
+                    std::size_t count = generate_elementwise_program(
+                        ue.operand_, program, leaves);
+                    program += " neg";
+                    return count + 1;
+                }
+            }
+            else if (op.index() == 1)       // primary_expr
+            {
+                ast::primary_expr const& pe = util::get<1>(op.get()).get();
+                if (pe.index() == 6)        // (expression)
+                {
+                    return generate_elementwise_program(
+                        util::get<6>(pe.get()).get(), program, leaves, false);
+                }
+
+                if (is_elementwise_function(op))
+                {
+                    std::size_t count = generate_elementwise_program(
+                        ast::detail::function_arguments(op)[0], program,
+                        leaves, false);
+                    program += " " + ast::detail::function_name(op);
+                    return count + 1;
+                }
+            }
+
+            program += " $" + std::to_string(leaves.size());
+            leaves.emplace_back(op);
+            return 0;
+        }
+
+        // A single comparison is fused only if its result is not consumed
+        // by another fused operation, i.e. at the top level of the fused
+        // expression ('allow_comparison').
+        std::size_t generate_elementwise_program(ast::expression const& expr,
+            std::string& program, std::vector<ast::expression>& leaves,
+            bool allow_comparison)
+        {
+            std::size_t comparisons = 0;
+            for (auto const& op : expr.rest)
+            {
+                if (elementwise_token(op.operator_) != nullptr)
+                {
+                    continue;
+                }
+
+                if (!allow_comparison ||
+                    comparison_token(op.operator_) == nullptr ||
+                    ++comparisons > 1)
+                {
+                    program += " $" + std::to_string(leaves.size());
+                    leaves.push_back(expr);
+                    return 0;
+                }
+            }
+
+            // the expression is flat, restore operator precedence (all
+            // operators are left-associative, comparisons have the lowest
+            // precedence)
+            std::size_t count =
+                generate_elementwise_program(expr.first, program, leaves);
+
+            std::vector<ast::optoken> ops;
+            for (auto const& op : expr.rest)
+            {
+                int precedence = ast::precedence_of(op.operator_);
+                while (!ops.empty() &&
+                    ast::precedence_of(ops.back()) >= precedence)
+                {
+                    program += operation_token(ops.back());
+                    ops.pop_back();
+                }
+                ops.push_back(op.operator_);
+
+                count += 1 +
+                    generate_elementwise_program(op.operand_, program, leaves);
+            }
+
+            while (!ops.empty())
+            {
+                program += operation_token(ops.back());
+                ops.pop_back();
+            }
+            return count;
+        }
+
+        bool handle_elementwise_fusion(ast::expression const& expr,
+            ast::tagged const& id, function& result)
+        {
+            if (expr.rest.empty() && expr.first.index() != 2 &&
+                !is_elementwise_function(expr.first))
+            {
+                return false;
+            }
+
+            static std::string const elementwise_("__elementwise");
+
+            compiled_function* cf = env_.find(elementwise_);
+            if (cf == nullptr)
+            {
+                return false;
+            }
+
+            // fusing a single operation does not pay off
+            std::string program;
+            std::vector<ast::expression> leaves;
+            if (generate_elementwise_program(expr, program, leaves, true) < 2)
+            {
+                return false;
+            }
+
+            std::list<function> args;
+            args.push_back(
+                literal_value(primitive_argument_type{program.substr(1)}));
+            for (auto const& leaf : leaves)
+            {
+                args.push_back(compile(name_, leaf, snippets_, env_,
+                    patterns_, default_locality_));
+            }
+
+            primitive_name_parts name_parts(elementwise_,
+                snippets_.sequence_numbers_[elementwise_]++, id.id, id.col,
+                snippets_.compile_id_ - 1,
+                get_locality_id(default_locality_));
+
+            result = (*cf)(std::move(args), std::move(name_parts), name_);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // where(a < b, x, y) is compiled into __where_compare("__lt", a, b,
+        // x, y), which evaluates the comparison while selecting the elements
+        // without materializing the condition (enabled together with
+        // phylanx.fuse_elementwise=1).
+        static char const* comparison_primitive(ast::optoken op)
+        {
+            switch (op)
+            {
+            case ast::optoken::op_less:          return "__lt";
+            case ast::optoken::op_less_equal:    return "__le";
+            case ast::optoken::op_greater:       return "__gt";
+            case ast::optoken::op_greater_equal: return "__ge";
+            case ast::optoken::op_equal:         return "__eq";
+            case ast::optoken::op_not_equal:     return "__ne";
+            default:
+                break;
+            }
+            return nullptr;
+        }
+
+        bool handle_where_fusion(ast::expression const& expr,
+            ast::tagged const& id, function& result)
+        {
+            std::vector<ast::expression> args =
+                ast::detail::function_arguments(expr);
+            if (args.size() != 3)
+            {
+                return false;
+            }
+
+            // the condition has to be a single comparison
+            ast::expression const& cond =
+                ast::detail::extract_expression(args[0]);
+            if (cond.rest.size() != 1)
+            {
+                return false;
+            }
+
+            char const* comparison =
+                comparison_primitive(cond.rest[0].operator_);
+            if (comparison == nullptr)
+            {
+                return false;
+            }
+
+            static std::string const where_compare_("__where_compare");
+
+            compiled_function* cf = env_.find(where_compare_);
+            if (cf == nullptr)
+            {
+                return false;
+            }
+
+            std::list<function> fargs;
+            fargs.push_back(literal_value(
+                primitive_argument_type{std::string(comparison)}));
+            fargs.push_back(compile(name_, ast::expression(cond.first),
+                snippets_, env_, patterns_, default_locality_));
+            fargs.push_back(
+                compile(name_, ast::expression(cond.rest[0].operand_),
+                    snippets_, env_, patterns_, default_locality_));
+            fargs.push_back(compile(name_, args[1], snippets_, env_,
+                patterns_, default_locality_));
+            fargs.push_back(compile(name_, args[2], snippets_, env_,
+                patterns_, default_locality_));
+
+            primitive_name_parts name_parts(where_compare_,
+                snippets_.sequence_numbers_[where_compare_]++, id.id, id.col,
+                snippets_.compile_id_ - 1,
+                get_locality_id(default_locality_));
+
+            result = (*cf)(std::move(fargs), std::move(name_parts), name_);
+            return true;
+        }
+
     public:
         function operator()(ast::expression const& expr)
         {
@@ -1404,6 +1774,30 @@ namespace phylanx { namespace execution_tree { namespace compiler
 //                         }
 //                     }
 
+                    // where(a < b, x, y) is fused into a single primitive,
+                    // if enabled
+                    if (function_name == "where" &&
+                        fuse_elementwise_operations())
+                    {
+                        function result;
+                        if (handle_where_fusion(expr, id, result))
+                        {
+                            return result;
+                        }
+                    }
+
+                    // elementwise functions applied to chains of elementwise
+                    // operations are fused as well, if enabled
+                    if (fuse_elementwise_operations() &&
+                        is_elementwise_function(expr.first))
+                    {
+                        function result;
+                        if (handle_elementwise_fusion(expr, id, result))
+                        {
+                            return result;
+                        }
+                    }
+
                     // handle all non-special functions
                     while (
                         cit != patterns_.end() && (*cit).first == function_name)
@@ -1427,6 +1821,17 @@ namespace phylanx { namespace execution_tree { namespace compiler
             }
             else
             {
+                // chains of elementwise arithmetic operations are fused into
+                // a single primitive, if enabled
+                if (fuse_elementwise_operations())
+                {
+                    function result;
+                    if (handle_elementwise_fusion(expr, id, result))
+                    {
+                        return result;
+                    }
+                }
+
                 // this should handle all remaining constructs (non-function calls)
                 for (auto const& pattern : patterns_)
                 {
@@ -57,7 +57,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type const& params, eval_context ctx) const
     {
         // access variable from execution context
-        auto const* target = ctx.get_var(target_name_);
+        auto const* target = ctx.get_var(target_name_, target_slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -99,7 +99,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type&& params, eval_context ctx)
     {
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, target_slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -122,7 +122,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type&& params, eval_context ctx)
     {
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, target_slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
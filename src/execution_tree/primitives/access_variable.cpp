@@ -68,11 +68,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    hpx::future<primitive_argument_type> access_variable::eval(
-        primitive_arguments_type const& params, eval_context ctx) const
+    primitive_argument_type const& access_variable::get_target(
+        eval_context& ctx) const
     {
         // access variable from execution context
-        auto const* target = ctx.get_var(target_name_);
+        auto const* target = ctx.get_var(target_name_, target_slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -82,6 +82,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                       "current execution environment",
                         target_name_)));
         }
+        return *target;
+    }
+
+    hpx::future<primitive_argument_type> access_variable::eval(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        auto const* target = &get_target(ctx);
 
         // handle slicing, we can replace the params with our slicing
         // parameters as variable evaluation can't depend on those anyways
@@ -166,6 +173,21 @@ namespace phylanx { namespace execution_tree { namespace primitives
             add_mode(std::move(ctx), eval_dont_wrap_functions));
     }
 
+    util::future_or_value<primitive_argument_type> access_variable::eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        if (operands_.size() > 1)
+        {
+            // slicing the variable requires evaluating the slicing parameters
+            return eval(params, std::move(ctx));
+        }
+
+        // no slicing parameters given, access variable directly
+        auto var = get_target(ctx);
+        return value_operand_fov(var, noargs, name_, codename_,
+            add_mode(std::move(ctx), eval_dont_wrap_functions));
+    }
+
     void access_variable::store(primitive_arguments_type&& vals,
         primitive_arguments_type&& params, eval_context ctx)
     {
@@ -178,7 +200,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, target_slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -213,7 +235,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_arguments_type&& params, eval_context ctx)
     {
         // access variable from execution context
-        auto* target = ctx.get_var(target_name_);
+        auto* target = ctx.get_var(target_name_, target_slot_);
         if (target == nullptr)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -22,16 +22,20 @@
 #include <hpx/include/components.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/include/sync.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/util/logging.hpp>
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <set>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <utility>
 
@@ -59,7 +63,9 @@ namespace phylanx { namespace execution_tree
             "phylanx::execution_tree::primitive",
             "std::vector<phylanx::ast::expression>",
             "phylanx::ir::range",
-            "phylanx::ir::dictionary"
+            "phylanx::ir::dictionary",
+            "phylanx::ir::node_data<float>",
+            "phylanx::ir::node_data<std::int32_t>"
         };
 
         char const* const get_primitive_argument_type_name(std::size_t index)
@@ -124,6 +130,53 @@ namespace phylanx { namespace execution_tree
                     return trace(func, this_, f.get());
                 });
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Evaluations of primitives living on this locality invoke the
+        // component directly instead of going through the eval actions. This
+        // can be disabled by setting 'phylanx.local_eval' to 0.
+        bool local_eval_enabled()
+        {
+            static bool enabled =
+                hpx::get_config_entry("phylanx.local_eval", "1") == "1";
+            return enabled;
+        }
+
+        // Invoke the given member of the local component, either directly or
+        // on a new thread, as decided by the current scheduling policy (this
+        // mirrors what is done for the eval actions).
+        template <typename F, typename Params>
+        hpx::future<primitive_argument_type> eval_local(primitive const& this_,
+            primitives::primitive_component const* p, hpx::launch policy,
+            F f, Params&& params, eval_context ctx)
+        {
+            if (policy == hpx::launch::sync)
+            {
+                return (p->*f)(std::forward<Params>(params), std::move(ctx));
+            }
+
+            // the copy of the client keeps the component alive until the
+            // scheduled evaluation has been run
+            return hpx::future<primitive_argument_type>(hpx::async(policy,
+                [this_, p, f](typename std::decay<Params>::type&& params,
+                    eval_context&& ctx)
+                {
+                    return (p->*f)(std::move(params), std::move(ctx));
+                },
+                std::forward<Params>(params), std::move(ctx)));
+        }
+
+        // The policy is given the size of the arguments of this invocation.
+        template <typename F, typename Params>
+        hpx::future<primitive_argument_type> eval_local(primitive const& this_,
+            primitives::primitive_component const* p, F f, Params&& params,
+            eval_context ctx)
+        {
+            hpx::launch policy =
+                p->select_direct_eval_execution(hpx::launch::async, params);
+            return eval_local(this_, p, policy, f,
+                std::forward<Params>(params), std::move(ctx));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -137,9 +190,65 @@ namespace phylanx { namespace execution_tree
         }
     }
 
+    primitive::primitive(std::shared_ptr<primitives::primitive_component> p)
+      : base_type(p->lightweight_id())
+      , local_(p.get())
+      , resolved_(true)
+      , lightweight_(std::move(p))
+    {
+    }
+
+    std::string primitive::registered_name() const
+    {
+        if (lightweight_)
+        {
+            return lightweight_->lightweight_name();
+        }
+        return this->base_type::registered_name();
+    }
+
+    primitives::primitive_component* primitive::local_component() const
+    {
+        if (resolved_.load(std::memory_order_acquire))
+        {
+            return local_.load(std::memory_order_relaxed);
+        }
+
+        // The component is kept alive by the credits held by a managed id,
+        // which is why the address is not cached for unmanaged ids. Note
+        // that primitive components are never migrated.
+        primitives::primitive_component* p = nullptr;
+        if (detail::local_eval_enabled() && this->base_type::valid())
+        {
+            hpx::id_type const& id = this->base_type::get_id();
+            if (id.get_management_type() != hpx::id_type::unmanaged &&
+                hpx::naming::get_locality_id_from_id(id) ==
+                    hpx::get_locality_id())
+            {
+                p = hpx::get_ptr<primitives::primitive_component>(
+                        hpx::launch::sync, id).get();
+            }
+        }
+
+        // concurrent resolutions store the same value
+        local_.store(p, std::memory_order_relaxed);
+        resolved_.store(true, std::memory_order_release);
+        return p;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> primitive::eval(
         primitive_arguments_type const& params, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::lazy_trace("eval", *this,
+                detail::eval_local(*this, p,
+                    &primitives::primitive_component::eval, params,
+                    std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::unwrap_result(this->base_type::get_id()), params,
@@ -149,6 +258,15 @@ namespace phylanx { namespace execution_tree
     hpx::future<primitive_argument_type> primitive::eval(
         primitive_arguments_type&& params, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::lazy_trace("eval", *this,
+                detail::eval_local(*this, p,
+                    &primitives::primitive_component::eval, std::move(params),
+                    std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::unwrap_result(this->base_type::get_id()), std::move(params),
@@ -159,6 +277,15 @@ namespace phylanx { namespace execution_tree
     hpx::future<primitive_argument_type> primitive::eval(
         primitive_argument_type && param, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::lazy_trace("eval", *this,
+                detail::eval_local(*this, p,
+                    &primitives::primitive_component::eval_single,
+                    std::move(param), std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::eval_single_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::unwrap_result(this->base_type::get_id()), std::move(param),
@@ -166,6 +293,42 @@ namespace phylanx { namespace execution_tree
         return detail::lazy_trace("eval", *this, std::move(f));
     }
 
+    util::future_or_value<primitive_argument_type> primitive::eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        // evaluations which are sent to a remote locality or which are
+        // scheduled on a new thread produce a future anyways
+        primitives::primitive_component const* p = local_component();
+        if (p == nullptr)
+        {
+            return eval(params, std::move(ctx));
+        }
+
+        // the scheduling decision is made (and counted) only once
+        hpx::launch policy =
+            p->select_direct_eval_execution(hpx::launch::async, params);
+        if (policy != hpx::launch::sync)
+        {
+            return detail::lazy_trace("eval", *this,
+                detail::eval_local(*this, p, policy,
+                    &primitives::primitive_component::eval, params,
+                    std::move(ctx)));
+        }
+
+        util::future_or_value<primitive_argument_type> result =
+            p->eval_fov(params, std::move(ctx));
+        if (!primitive::enable_tracing)
+        {
+            return result;
+        }
+
+        if (result.has_value_only())
+        {
+            return detail::trace("eval", *this, result.get());
+        }
+        return detail::lazy_trace("eval", *this, result.get_future());
+    }
+
     hpx::future<primitive_argument_type> primitive::eval(eval_context ctx) const
     {
         static primitive_arguments_type params;
@@ -175,6 +338,13 @@ namespace phylanx { namespace execution_tree
     primitive_argument_type primitive::eval(hpx::launch::sync_policy,
         primitive_arguments_type const& params, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::trace(
+                "eval", *this, p->eval(params, std::move(ctx)).get());
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::launch::sync, hpx::unwrap_result(this->base_type::get_id()),
@@ -184,6 +354,13 @@ namespace phylanx { namespace execution_tree
     primitive_argument_type primitive::eval(hpx::launch::sync_policy,
         primitive_arguments_type&& params, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::trace(
+                "eval", *this, p->eval(params, std::move(ctx)).get());
+        }
+
         using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::launch::sync, hpx::unwrap_result(this->base_type::get_id()),
@@ -194,6 +371,13 @@ namespace phylanx { namespace execution_tree
     primitive_argument_type primitive::eval(hpx::launch::sync_policy,
         primitive_argument_type && param, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::trace("eval", *this,
+                p->eval_single(std::move(param), std::move(ctx)).get());
+        }
+
         using action_type = primitives::primitive_component::eval_single_action;
         hpx::future<primitive_argument_type> f = hpx::async<action_type>(
             hpx::launch::sync, hpx::unwrap_result(this->base_type::get_id()),
@@ -204,8 +388,16 @@ namespace phylanx { namespace execution_tree
     primitive_argument_type primitive::eval(hpx::launch::sync_policy,
         eval_context ctx) const
     {
-        using action_type = primitives::primitive_component::eval_action;
         static primitive_arguments_type params;
+
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::trace(
+                "eval", *this, p->eval(params, std::move(ctx)).get());
+        }
+
+        using action_type = primitives::primitive_component::eval_action;
         hpx::future<primitive_argument_type> f = hpx::sync<action_type>(
             this->base_type::get_id(), std::move(params), std::move(ctx));
         return detail::trace("eval", *this, f.get());
@@ -214,6 +406,20 @@ namespace phylanx { namespace execution_tree
     hpx::future<void> primitive::store(primitive_arguments_type&& data,
         primitive_arguments_type&& params, eval_context ctx)
     {
+        primitives::primitive_component* p = local_component();
+        if (p != nullptr)
+        {
+            // the copy of the client keeps the component alive
+            return hpx::async(
+                [this_ = *this, p](primitive_arguments_type data,
+                    primitive_arguments_type params, eval_context ctx)
+                {
+                    p->store(std::move(data), std::move(params),
+                        std::move(ctx));
+                },
+                std::move(data), std::move(params), std::move(ctx));
+        }
+
         using action_type = primitives::primitive_component::store_action;
         return hpx::async<action_type>(this->base_type::get_id(),
             std::move(data), std::move(params), std::move(ctx));
@@ -222,6 +428,20 @@ namespace phylanx { namespace execution_tree
     hpx::future<void> primitive::store(primitive_argument_type&& data,
         primitive_arguments_type&& params, eval_context ctx)
     {
+        primitives::primitive_component* p = local_component();
+        if (p != nullptr)
+        {
+            // the copy of the client keeps the component alive
+            return hpx::async(
+                [this_ = *this, p](primitive_argument_type data,
+                    primitive_arguments_type params, eval_context ctx)
+                {
+                    p->store_single(std::move(data), std::move(params),
+                        std::move(ctx));
+                },
+                std::move(data), std::move(params), std::move(ctx));
+        }
+
         using action_type = primitives::primitive_component::store_single_action;
         return hpx::async<action_type>(this->base_type::get_id(),
             std::move(data), std::move(params), std::move(ctx));
@@ -231,6 +451,13 @@ namespace phylanx { namespace execution_tree
         primitive_arguments_type&& data, primitive_arguments_type&& params,
         eval_context ctx)
     {
+        primitives::primitive_component* p = local_component();
+        if (p != nullptr)
+        {
+            p->store(std::move(data), std::move(params), std::move(ctx));
+            return;
+        }
+
         using action_type = primitives::primitive_component::store_action;
         hpx::sync<action_type>(this->base_type::get_id(), std::move(data),
             std::move(params), std::move(ctx));
@@ -240,6 +467,13 @@ namespace phylanx { namespace execution_tree
         primitive_argument_type&& data, primitive_arguments_type&& params,
         eval_context ctx)
     {
+        primitives::primitive_component* p = local_component();
+        if (p != nullptr)
+        {
+            p->store_single(std::move(data), std::move(params), std::move(ctx));
+            return;
+        }
+
         using action_type = primitives::primitive_component::store_single_action;
         hpx::sync<action_type>(this->base_type::get_id(), std::move(data),
             std::move(params), std::move(ctx));
@@ -259,15 +493,24 @@ namespace phylanx { namespace execution_tree
     {
         // retrieve name of this node (the component can only retrieve
         // names of dependent nodes)
-        std::string this_name = this->base_type::registered_name();
+        std::string this_name = registered_name();
 
         // retrieve name of component instance
         using action_type = primitives::primitive_component::
             expression_topology_action;
 
-        hpx::future<topology> f =
-            hpx::async<action_type>(this->base_type::get_id(),
+        hpx::future<topology> f;
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            f = hpx::make_ready_future(p->expression_topology(
+                std::move(functions), std::move(resolve_children)));
+        }
+        else
+        {
+            f = hpx::async<action_type>(this->base_type::get_id(),
                 std::move(functions), std::move(resolve_children));
+        }
 
         return f.then(hpx::launch::sync,
             [this_name](hpx::future<topology> && f) mutable -> topology
@@ -303,6 +546,13 @@ namespace phylanx { namespace execution_tree
     bool primitive::bind(
         primitive_arguments_type const& params, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::trace(
+                "bind", *this, p->bind(params, std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::bind_action;
         return detail::trace("bind", *this,
             action_type()(this->base_type::get_id(), params, std::move(ctx)));
@@ -310,6 +560,13 @@ namespace phylanx { namespace execution_tree
     bool primitive::bind(
         primitive_arguments_type&& params, eval_context ctx) const
     {
+        primitives::primitive_component const* p = local_component();
+        if (p != nullptr)
+        {
+            return detail::trace(
+                "bind", *this, p->bind(params, std::move(ctx)));
+        }
+
         using action_type = primitives::primitive_component::bind_action;
         return detail::trace("bind", *this,
             action_type()(
@@ -437,6 +694,8 @@ namespace phylanx { namespace execution_tree
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 3: HPX_FALLTHROUGH;    // std::string
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 5: HPX_FALLTHROUGH;    // primitive
         case 6: HPX_FALLTHROUGH;    // std::vector<ast::expression>
         case 7: HPX_FALLTHROUGH;    // phylanx::ir::range
@@ -491,6 +750,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case 9:     // phylanx::ir::node_data<float>
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy()};
+                }
+                return primitive_argument_type{v};
+            }
+            break;
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            {
+                auto const& v = util::get<10>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy()};
+                }
+                return primitive_argument_type{v};
+            }
+            break;
+
         case 7:     // phylanx::ir::range
             {
                 auto const& args = util::get<7>(val);
@@ -566,6 +847,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v};
+                }
+                return primitive_argument_type{v.ref()};
+            }
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            {
+                auto const& v = util::get<10>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v};
+                }
+                return primitive_argument_type{v.ref()};
+            }
+            break;
+
         default:
             break;
         }
@@ -589,6 +892,8 @@ namespace phylanx { namespace execution_tree
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 3: HPX_FALLTHROUGH;    // std::string
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 5: HPX_FALLTHROUGH;    // primitive
         case 6: HPX_FALLTHROUGH;    // std::vector<ast::expression>
         case 7: HPX_FALLTHROUGH;    // phylanx::ir::range
@@ -653,6 +958,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            {
+                auto&& v = util::get<9>(std::move(val));
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy()};
+                }
+                return primitive_argument_type{std::move(v)};
+            }
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            {
+                auto&& v = util::get<10>(std::move(val));
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v.copy()};
+                }
+                return primitive_argument_type{std::move(v)};
+            }
+            break;
+
         case 7:     // phylanx::ir::range
             {
                 auto&& args = util::get<7>(std::move(val));
@@ -693,6 +1020,8 @@ namespace phylanx { namespace execution_tree
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 3: HPX_FALLTHROUGH;    // std::string
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 5: HPX_FALLTHROUGH;    // primitive
         case 6: HPX_FALLTHROUGH;    // std::vector<ast::expression>
         case 7: HPX_FALLTHROUGH;    // phylanx::ir::range
@@ -728,6 +1057,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return util::get<4>(val).is_ref();
 
+        case 9:     // phylanx::ir::node_data<float>
+            return util::get<9>(val).is_ref();
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return util::get<10>(val).is_ref();
+
         case 7:     // phylanx::ir::range
             return util::get<7>(val).is_ref();
 
@@ -763,6 +1098,8 @@ namespace phylanx { namespace execution_tree
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 3: HPX_FALLTHROUGH;    // std::string
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 7: HPX_FALLTHROUGH;    // phylanx::ir::range
         case 8:                     // phylanx::ir::dictionary
             return val;
@@ -830,6 +1167,28 @@ namespace phylanx { namespace execution_tree
             }
             break;
 
+        case 9:     // phylanx::ir::node_data<float>
+            {
+                auto const& v = util::get<9>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v};
+                }
+                return primitive_argument_type{v.ref()};
+            }
+            break;
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            {
+                auto const& v = util::get<10>(val);
+                if (v.is_ref())
+                {
+                    return primitive_argument_type{v};
+                }
+                return primitive_argument_type{v.ref()};
+            }
+            break;
+
         case 6:                     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -882,6 +1241,8 @@ namespace phylanx { namespace execution_tree
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 3: HPX_FALLTHROUGH;    // std::string
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 7: HPX_FALLTHROUGH;    // phylanx::ir::range
         case 8:                     // phylanx::ir::dictionary
             return std::move(val);
@@ -923,6 +1284,8 @@ namespace phylanx { namespace execution_tree
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 3: HPX_FALLTHROUGH;    // std::string
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 6: HPX_FALLTHROUGH;    // std::vector<ast::expression>
         case 8:                     // phylanx::ir::dictionary
             return true;
@@ -948,8 +1311,14 @@ namespace phylanx { namespace execution_tree
         case 2:     // ir::node_data<std::int64_t>
             return ir::node_data<double>{util::get<2>(val).ref()};
 
+        case 9:     // phylanx::ir::node_data<float>
+            return ir::node_data<double>{util::get<9>(val).ref()};
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return ir::node_data<double>{util::get<10>(val).ref()};
+
         case 4:     // phylanx::ir::node_data<double>
-            return util::get<4>(val).ref();
+            return util::get<4>(val).to_dense();
 
         case 6:     // std::vector<ast::expression>
             {
@@ -990,7 +1359,11 @@ namespace phylanx { namespace execution_tree
         switch (val.index())
         {
         case 4:     // phylanx::ir::node_data<double>
-            return util::get<4>(val).ref();
+            return util::get<4>(val).to_dense();
+
+        // single precision values are widened to double precision
+        case 9:     // phylanx::ir::node_data<float>
+            return ir::node_data<double>{util::get<9>(val).ref()};
 
         case 0: HPX_FALLTHROUGH;    // nil
         case 1: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::uint8_t>
@@ -1024,8 +1397,14 @@ namespace phylanx { namespace execution_tree
         case 2:     // ir::node_data<std::int64_t>
             return ir::node_data<double>{util::get<2>(std::move(val))};
 
+        case 9:     // phylanx::ir::node_data<float>
+            return ir::node_data<double>{util::get<9>(std::move(val))};
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return ir::node_data<double>{util::get<10>(std::move(val))};
+
         case 4:     // phylanx::ir::node_data<double>
-            return util::get<4>(std::move(val));
+            return util::get<4>(std::move(val)).to_dense();
 
         case 6:     // std::vector<ast::expression>
             {
@@ -1075,6 +1454,16 @@ namespace phylanx { namespace execution_tree
                 return double(util::get<2>(val)[0]);
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            if (util::get<9>(val).num_dimensions() == 0)
+                return double(util::get<9>(val)[0]);
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                return double(util::get<10>(val)[0]);
+            break;
+
         case 4:    // phylanx::ir::node_data<double>
             if (util::get<4>(val).num_dimensions() == 0)
                 return util::get<4>(val)[0];
@@ -1128,6 +1517,16 @@ namespace phylanx { namespace execution_tree
                 return double(util::get<2>(std::move(val))[0]);
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            if (util::get<9>(val).num_dimensions() == 0)
+                return double(util::get<9>(std::move(val))[0]);
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                return double(util::get<10>(std::move(val))[0]);
+            break;
+
         case 4:    // phylanx::ir::node_data<double>
             if (util::get<4>(val).num_dimensions() == 0)
                 return util::get<4>(std::move(val))[0];
@@ -1172,7 +1571,22 @@ namespace phylanx { namespace execution_tree
         switch (val.index())
         {
         case 4:     // phylanx::ir::node_data<double>
-            return util::get<4>(std::move(val));
+            {
+                auto& nd = util::get<4>(val);
+                if (nd.is_sparse())
+                {
+                    nd = std::move(nd).to_dense();
+                }
+                return std::move(nd);
+            }
+
+        // single precision values are widened to double precision, in place
+        case 9:     // phylanx::ir::node_data<float>
+            {
+                val = primitive_argument_type{
+                    ir::node_data<double>{util::get<9>(std::move(val))}};
+                return std::move(util::get<4>(val));
+            }
 
         case 0: HPX_FALLTHROUGH;    // nil
         case 1: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::uint8_t>
@@ -1202,6 +1616,8 @@ namespace phylanx { namespace execution_tree
         case 1: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::uint8_t>
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 6:                     // std::vector<ast::expression>
             return true;
 
@@ -1237,6 +1653,13 @@ namespace phylanx { namespace execution_tree
         return false;
     }
 
+    bool is_sparse_operand(primitive_argument_type const& val)
+    {
+        ir::node_data<double> const* nd =
+            util::get_if<ir::node_data<double>>(&val);
+        return nd != nullptr && nd->is_sparse();
+    }
+
     std::size_t extract_numeric_value_dimension(
         primitive_argument_type const& val, std::string const& name,
         std::string const& codename)
@@ -1252,6 +1675,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return util::get<4>(val).num_dimensions();
 
+        case 9:     // phylanx::ir::node_data<float>
+            return util::get<9>(val).num_dimensions();
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return util::get<10>(val).num_dimensions();
+
         case 6:     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -1300,6 +1729,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return util::get<4>(val).size();
 
+        case 9:     // phylanx::ir::node_data<float>
+            return util::get<9>(val).size();
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return util::get<10>(val).size();
+
         case 6:     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -1348,6 +1783,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return util::get<4>(val).dimensions();
 
+        case 9:     // phylanx::ir::node_data<float>
+            return util::get<9>(val).dimensions();
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return util::get<10>(val).dimensions();
+
         case 6:     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -1380,6 +1821,276 @@ namespace phylanx { namespace execution_tree
                 name, codename));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Extract a ir::node_data<T> from any numeric alternative, converting
+        // the element type if necessary.
+        template <typename T>
+        ir::node_data<T> extract_typed_numeric_value(
+            primitive_argument_type const& val, char const* func,
+            std::string const& name, std::string const& codename)
+        {
+            switch (val.index())
+            {
+            case 1:    // phylanx::ir::node_data<std::uint8_t>
+                return ir::node_data<T>{util::get<1>(val).ref()};
+
+            case 2:     // ir::node_data<std::int64_t>
+                return ir::node_data<T>{util::get<2>(val).ref()};
+
+            case 4:     // phylanx::ir::node_data<double>
+                return ir::node_data<T>{util::get<4>(val).ref()};
+
+            case 9:     // phylanx::ir::node_data<float>
+                return ir::node_data<T>{util::get<9>(val).ref()};
+
+            case 10:    // phylanx::ir::node_data<std::int32_t>
+                return ir::node_data<T>{util::get<10>(val).ref()};
+
+            case 6:     // std::vector<ast::expression>
+                {
+                    auto const& exprs = util::get<6>(val);
+                    if (exprs.size() == 1)
+                    {
+                        if (ast::detail::is_literal_value(exprs[0]))
+                        {
+                            return ir::node_data<T>{to_primitive_numeric_type(
+                                ast::detail::literal_value(exprs[0]))};
+                        }
+                    }
+                }
+                break;
+
+            case 0: HPX_FALLTHROUGH;    // nil
+            case 3: HPX_FALLTHROUGH;    // string
+            case 5: HPX_FALLTHROUGH;    // primitive
+            case 7: HPX_FALLTHROUGH;    // phylanx::ir::range
+            case 8: HPX_FALLTHROUGH;    // phylanx::ir::dictionary
+            default:
+                break;
+            }
+
+            std::string type(get_primitive_argument_type_name(val.index()));
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, func,
+                util::generate_error_message(
+                    "primitive_argument_type does not hold a numeric "
+                        "value type (type held: '" + type + "')",
+                    name, codename));
+        }
+
+        template <typename T>
+        ir::node_data<T> extract_typed_numeric_value(
+            primitive_argument_type&& val, char const* func,
+            std::string const& name, std::string const& codename)
+        {
+            switch (val.index())
+            {
+            case 1:    // phylanx::ir::node_data<std::uint8_t>
+                return ir::node_data<T>{util::get<1>(std::move(val))};
+
+            case 2:     // ir::node_data<std::int64_t>
+                return ir::node_data<T>{util::get<2>(std::move(val))};
+
+            case 4:     // phylanx::ir::node_data<double>
+                return ir::node_data<T>{util::get<4>(std::move(val))};
+
+            case 9:     // phylanx::ir::node_data<float>
+                return ir::node_data<T>{util::get<9>(std::move(val))};
+
+            case 10:    // phylanx::ir::node_data<std::int32_t>
+                return ir::node_data<T>{util::get<10>(std::move(val))};
+
+            case 6:     // std::vector<ast::expression>
+                {
+                    auto && exprs = util::get<6>(std::move(val));
+                    if (exprs.size() == 1)
+                    {
+                        if (ast::detail::is_literal_value(exprs[0]))
+                        {
+                            return ir::node_data<T>{to_primitive_numeric_type(
+                                ast::detail::literal_value(
+                                    std::move(exprs[0])))};
+                        }
+                    }
+                }
+                break;
+
+            case 0: HPX_FALLTHROUGH;    // nil
+            case 3: HPX_FALLTHROUGH;    // string
+            case 5: HPX_FALLTHROUGH;    // primitive
+            case 7: HPX_FALLTHROUGH;    // phylanx::ir::range
+            case 8: HPX_FALLTHROUGH;    // phylanx::ir::dictionary
+            default:
+                break;
+            }
+
+            std::string type(get_primitive_argument_type_name(val.index()));
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, func,
+                util::generate_error_message(
+                    "primitive_argument_type does not hold a numeric "
+                        "value type (type held: '" + type + "')",
+                    name, codename));
+        }
+
+        template <typename T, typename Arg>
+        T extract_typed_scalar_value(Arg&& val, char const* func,
+            std::string const& name, std::string const& codename)
+        {
+            ir::node_data<T> data = extract_typed_numeric_value<T>(
+                std::forward<Arg>(val), func, name, codename);
+            if (data.num_dimensions() != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter, func,
+                    util::generate_error_message(
+                        "primitive_argument_type does not hold a scalar "
+                            "value",
+                        name, codename));
+            }
+            return data[0];
+        }
+
+        template <typename T, std::size_t Index>
+        ir::node_data<T> const& extract_typed_value_strict(
+            primitive_argument_type const& val, char const* func,
+            std::string const& name, std::string const& codename)
+        {
+            if (val.index() != Index)
+            {
+                std::string type(
+                    get_primitive_argument_type_name(val.index()));
+                HPX_THROW_EXCEPTION(hpx::bad_parameter, func,
+                    util::generate_error_message(
+                        "primitive_argument_type does not hold a '" +
+                            std::string(get_primitive_argument_type_name(
+                                Index)) +
+                            "' value type (type held: '" + type + "')",
+                        name, codename));
+            }
+            return util::get<Index>(val);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ir::node_data<float> extract_float32_value(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return detail::extract_typed_numeric_value<float>(val,
+            "phylanx::execution_tree::extract_float32_value", name, codename);
+    }
+
+    ir::node_data<float> extract_float32_value(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        return detail::extract_typed_numeric_value<float>(std::move(val),
+            "phylanx::execution_tree::extract_float32_value", name, codename);
+    }
+
+    float extract_scalar_float32_value(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        return detail::extract_typed_scalar_value<float>(val,
+            "phylanx::execution_tree::extract_scalar_float32_value", name,
+            codename);
+    }
+
+    float extract_scalar_float32_value(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        return detail::extract_typed_scalar_value<float>(std::move(val),
+            "phylanx::execution_tree::extract_scalar_float32_value", name,
+            codename);
+    }
+
+    ir::node_data<float> extract_float32_value_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return detail::extract_typed_value_strict<float,
+                primitive_argument_type::float32_index>(val,
+            "phylanx::execution_tree::extract_float32_value_strict", name,
+            codename).ref();
+    }
+
+    ir::node_data<float>&& extract_float32_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        detail::extract_typed_value_strict<float,
+                primitive_argument_type::float32_index>(val,
+            "phylanx::execution_tree::extract_float32_value_strict", name,
+            codename);
+        return util::get<primitive_argument_type::float32_index>(
+            std::move(val));
+    }
+
+    bool is_float32_operand_strict(primitive_argument_type const& val)
+    {
+        return val.index() == primitive_argument_type::float32_index;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ir::node_data<std::int32_t> extract_int32_value(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return detail::extract_typed_numeric_value<std::int32_t>(val,
+            "phylanx::execution_tree::extract_int32_value", name, codename);
+    }
+
+    ir::node_data<std::int32_t> extract_int32_value(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        return detail::extract_typed_numeric_value<std::int32_t>(
+            std::move(val), "phylanx::execution_tree::extract_int32_value",
+            name, codename);
+    }
+
+    std::int32_t extract_scalar_int32_value(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename)
+    {
+        return detail::extract_typed_scalar_value<std::int32_t>(val,
+            "phylanx::execution_tree::extract_scalar_int32_value", name,
+            codename);
+    }
+
+    std::int32_t extract_scalar_int32_value(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename)
+    {
+        return detail::extract_typed_scalar_value<std::int32_t>(std::move(val),
+            "phylanx::execution_tree::extract_scalar_int32_value", name,
+            codename);
+    }
+
+    ir::node_data<std::int32_t> extract_int32_value_strict(
+        primitive_argument_type const& val, std::string const& name,
+        std::string const& codename)
+    {
+        return detail::extract_typed_value_strict<std::int32_t,
+                primitive_argument_type::int32_index>(val,
+            "phylanx::execution_tree::extract_int32_value_strict", name,
+            codename).ref();
+    }
+
+    ir::node_data<std::int32_t>&& extract_int32_value_strict(
+        primitive_argument_type&& val, std::string const& name,
+        std::string const& codename)
+    {
+        detail::extract_typed_value_strict<std::int32_t,
+                primitive_argument_type::int32_index>(val,
+            "phylanx::execution_tree::extract_int32_value_strict", name,
+            codename);
+        return util::get<primitive_argument_type::int32_index>(
+            std::move(val));
+    }
+
+    bool is_int32_operand_strict(primitive_argument_type const& val)
+    {
+        return val.index() == primitive_argument_type::int32_index;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool is_boolean_data_operand(primitive_argument_type const& val)
     {
@@ -1418,6 +2129,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return ir::node_data<std::int64_t>(util::get<4>(val).ref());
 
+        case 9:     // phylanx::ir::node_data<float>
+            return ir::node_data<std::int64_t>(util::get<9>(val).ref());
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return ir::node_data<std::int64_t>(util::get<10>(val).ref());
+
         case 6:     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -1465,6 +2182,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return ir::node_data<std::int64_t>(util::get<4>(std::move(val)));
 
+        case 9:     // phylanx::ir::node_data<float>
+            return ir::node_data<std::int64_t>(util::get<9>(std::move(val)));
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return ir::node_data<std::int64_t>(util::get<10>(std::move(val)));
+
         case 6:     // std::vector<ast::expression>
             {
                 auto && exprs = util::get<6>(std::move(val));
@@ -1518,6 +2241,16 @@ namespace phylanx { namespace execution_tree
                 return std::int64_t(util::get<4>(val)[0]);
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(val)[0]);
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<10>(val)[0]);
+            break;
+
         case 6:    // std::vector<ast::expression>
         {
             auto const& exprs = util::get<6>(val);
@@ -1572,6 +2305,16 @@ namespace phylanx { namespace execution_tree
                 return std::int64_t(util::get<4>(std::move(val))[0]);
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            if (util::get<9>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<9>(std::move(val))[0]);
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                return std::int64_t(util::get<10>(std::move(val))[0]);
+            break;
+
         case 6:    // std::vector<ast::expression>
         {
             auto&& exprs = util::get<6>(std::move(val));
@@ -1612,6 +2355,8 @@ namespace phylanx { namespace execution_tree
         case 1: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::uint8_t>
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 6:     // std::vector<ast::expression>
             return true;
 
@@ -1638,6 +2383,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<2>(val)[0];
             break;
 
+        case 10:    // ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                return util::get<10>(val)[0];
+            break;
+
         case 6:     // std::vector<ast::expression>
             {
                 auto && exprs = util::get<6>(std::move(val));
@@ -1683,6 +2433,11 @@ namespace phylanx { namespace execution_tree
                 return util::get<2>(std::move(val))[0];
             break;
 
+        case 10:    // ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                return util::get<10>(val)[0];
+            break;
+
         case 6:    // std::vector<ast::expression>
         {
             auto&& exprs = util::get<6>(std::move(val));
@@ -1727,6 +2482,10 @@ namespace phylanx { namespace execution_tree
         case 2:     // ir::node_data<std::int64_t>
             return util::get<2>(val).ref();
 
+        // 32 bit integers are widened to 64 bit integers
+        case 10:    // ir::node_data<std::int32_t>
+            return ir::node_data<std::int64_t>{util::get<10>(val).ref()};
+
         case 0: HPX_FALLTHROUGH;    // nil
         case 1: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::uint8_t>
         case 3: HPX_FALLTHROUGH;    // string
@@ -1757,6 +2516,14 @@ namespace phylanx { namespace execution_tree
         case 2:    // ir::node_data<std::int64_t>
             return util::get<2>(std::move(val));
 
+        // 32 bit integers are widened to 64 bit integers, in place
+        case 10:    // ir::node_data<std::int32_t>
+            {
+                val = primitive_argument_type{ir::node_data<std::int64_t>{
+                    util::get<10>(std::move(val))}};
+                return util::get<2>(std::move(val));
+            }
+
         case 0: HPX_FALLTHROUGH;    // nil
         case 1: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::uint8_t>
         case 3: HPX_FALLTHROUGH;    // string
@@ -1824,6 +2591,18 @@ namespace phylanx { namespace execution_tree
                     return std::int64_t(util::get<4>(val)[0]);
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            if (util::get<9>(val).num_dimensions() == 0)
+                if (util::get<9>(val)[0] > 0)
+                    return std::int64_t(util::get<9>(val)[0]);
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                if (util::get<10>(val)[0] > 0)
+                    return std::int64_t(util::get<10>(val)[0]);
+            break;
+
         case 6:    // std::vector<ast::expression>
         {
             auto const& exprs = util::get<6>(val);
@@ -1885,6 +2664,18 @@ namespace phylanx { namespace execution_tree
                     return std::int64_t(util::get<4>(val)[0]);
             break;
 
+        case 9:    // phylanx::ir::node_data<float>
+            if (util::get<9>(val).num_dimensions() == 0)
+                if (util::get<9>(val)[0] > 0)
+                    return std::int64_t(util::get<9>(val)[0]);
+            break;
+
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+            if (util::get<10>(val).num_dimensions() == 0)
+                if (util::get<10>(val)[0] > 0)
+                    return std::int64_t(util::get<10>(val)[0]);
+            break;
+
         case 6:    // std::vector<ast::expression>
         {
             auto const& exprs = util::get<6>(val);
@@ -2045,6 +2836,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return ir::node_data<std::uint8_t>{util::get<4>(val).ref()};
 
+        case 9:     // phylanx::ir::node_data<float>
+            return ir::node_data<std::uint8_t>{util::get<9>(val).ref()};
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return ir::node_data<std::uint8_t>{util::get<10>(val).ref()};
+
         case 6:     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -2121,6 +2918,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return ir::node_data<std::uint8_t>{util::get<4>(std::move(val))};
 
+        case 9:     // phylanx::ir::node_data<float>
+            return ir::node_data<std::uint8_t>{util::get<9>(std::move(val))};
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return ir::node_data<std::uint8_t>{util::get<10>(std::move(val))};
+
         case 6:     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -2202,6 +3005,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return bool(util::get<4>(val));
 
+        case 9:     // phylanx::ir::node_data<float>
+            return bool(util::get<9>(val));
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return bool(util::get<10>(val));
+
         case 6:     // std::vector<ast::expression>
             {
                 auto const& exprs = util::get<6>(val);
@@ -2254,6 +3063,12 @@ namespace phylanx { namespace execution_tree
         case 4:     // phylanx::ir::node_data<double>
             return bool(util::get<4>(std::move(val)));
 
+        case 9:     // phylanx::ir::node_data<float>
+            return bool(util::get<9>(std::move(val)));
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return bool(util::get<10>(std::move(val)));
+
         case 6:     // std::vector<ast::expression>
             {
                 auto && exprs = util::get<6>(std::move(val));
@@ -2297,6 +3112,8 @@ namespace phylanx { namespace execution_tree
         case 1: HPX_FALLTHROUGH;    // phylanx::ir::node_data<std::uint8_t>
         case 2: HPX_FALLTHROUGH;    // ir::node_data<std::int64_t>
         case 4: HPX_FALLTHROUGH;    // phylanx::ir::node_data<double>
+        case 9: HPX_FALLTHROUGH;    // phylanx::ir::node_data<float>
+        case 10: HPX_FALLTHROUGH;   // phylanx::ir::node_data<std::int32_t>
         case 6: HPX_FALLTHROUGH;    // std::vector<ast::expression>
         case 7:                     // phylanx::ir::range
             return true;
@@ -3240,6 +4057,64 @@ namespace phylanx { namespace execution_tree
         return hpx::make_ready_future(std::move(val));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        util::future_or_value<primitive_argument_type> value_operand_fov(
+            primitive_argument_type const& val,
+            primitive_arguments_type const& args,
+            std::string const& name, std::string const& codename,
+            eval_context ctx)
+        {
+            primitive const* p = util::get_if<primitive>(&val);
+            if (p != nullptr)
+            {
+                util::future_or_value<primitive_argument_type> f =
+                    p->eval_fov(args, std::move(ctx));
+                if (f.has_value_only())
+                {
+                    return extract_value(f.get(), name, codename);
+                }
+
+                hpx::future<primitive_argument_type> fut = f.get_future();
+                if (fut.is_ready() && !fut.has_exception())
+                {
+                    return extract_value(fut.get(), name, codename);
+                }
+
+                return fut.then(hpx::launch::sync,
+                    [&](hpx::future<primitive_argument_type> && f)
+                    {
+                        return extract_value(f.get(), name, codename);
+                    });
+            }
+
+            if (valid(val))
+            {
+                return extract_ref_value(val, name, codename);
+            }
+            return val;
+        }
+    }
+
+    util::future_or_value<primitive_argument_type> value_operand_fov(
+        primitive_argument_type const& val,
+        primitive_arguments_type const& args, std::string const& name,
+        std::string const& codename, eval_context ctx)
+    {
+        return detail::value_operand_fov(
+            val, args, name, codename, std::move(ctx));
+    }
+
+    util::future_or_value<primitive_argument_type> value_operand_fov(
+        primitive_argument_type const& val,
+        primitive_arguments_type&& args, std::string const& name,
+        std::string const& codename, eval_context ctx)
+    {
+        return detail::value_operand_fov(
+            val, args, name, codename, std::move(ctx));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     primitive_argument_type value_operand_sync(
         primitive_argument_type const& val,
@@ -3815,6 +4690,32 @@ namespace phylanx { namespace execution_tree
             extract_numeric_value(val, name, codename));
     }
 
+    util::future_or_value<ir::node_data<double>> numeric_operand_fov(
+        primitive_argument_type const& val,
+        primitive_arguments_type const& args, std::string const& name,
+        std::string const& codename, eval_context ctx)
+    {
+        primitive const* p = util::get_if<primitive>(&val);
+        if (p != nullptr)
+        {
+            util::future_or_value<primitive_argument_type> f =
+                p->eval_fov(args, std::move(ctx));
+            if (f.has_value_only())
+            {
+                return extract_numeric_value(f.get(), name, codename);
+            }
+
+            return f.get_future().then(hpx::launch::sync,
+                [&](hpx::future<primitive_argument_type> && f)
+                {
+                    return extract_numeric_value(f.get(), name, codename);
+                });
+        }
+
+        HPX_ASSERT(valid(val));
+        return extract_numeric_value(val, name, codename);
+    }
+
     hpx::future<ir::node_data<double>> numeric_operand(
         primitive_argument_type const& val, primitive_arguments_type&& args,
         std::string const& name, std::string const& codename, eval_context ctx)
@@ -3914,6 +4815,60 @@ namespace phylanx { namespace execution_tree
         return extract_numeric_value(val, name, codename);
     }
 
+    hpx::future<ir::node_data<float>> float32_operand(
+        primitive_argument_type const& val,
+        primitive_arguments_type const& args, std::string const& name,
+        std::string const& codename, eval_context ctx)
+    {
+        primitive const* p = util::get_if<primitive>(&val);
+        if (p != nullptr)
+        {
+            hpx::future<primitive_argument_type> f =
+                p->eval(args, std::move(ctx));
+            if (f.is_ready())
+            {
+                return hpx::make_ready_future(
+                    extract_float32_value(f.get(), name, codename));
+            }
+
+            return f.then(hpx::launch::sync,
+                [name, codename](hpx::future<primitive_argument_type> && f)
+                {
+                    return extract_float32_value(f.get(), name, codename);
+                });
+        }
+
+        HPX_ASSERT(valid(val));
+        return hpx::make_ready_future(extract_float32_value(val, name, codename));
+    }
+
+    hpx::future<ir::node_data<std::int32_t>> int32_operand(
+        primitive_argument_type const& val,
+        primitive_arguments_type const& args, std::string const& name,
+        std::string const& codename, eval_context ctx)
+    {
+        primitive const* p = util::get_if<primitive>(&val);
+        if (p != nullptr)
+        {
+            hpx::future<primitive_argument_type> f =
+                p->eval(args, std::move(ctx));
+            if (f.is_ready())
+            {
+                return hpx::make_ready_future(
+                    extract_int32_value(f.get(), name, codename));
+            }
+
+            return f.then(hpx::launch::sync,
+                [name, codename](hpx::future<primitive_argument_type> && f)
+                {
+                    return extract_int32_value(f.get(), name, codename);
+                });
+        }
+
+        HPX_ASSERT(valid(val));
+        return hpx::make_ready_future(extract_int32_value(val, name, codename));
+    }
+
     hpx::future<double> scalar_numeric_operand(
         primitive_argument_type const& val,
         primitive_arguments_type const& args, std::string const& name,
@@ -4555,6 +5510,14 @@ namespace phylanx { namespace execution_tree
             ast::detail::to_string{os}(util::get<4>(val));
             return os;
 
+        case 9:     // phylanx::ir::node_data<float>
+            ast::detail::to_string{os}(util::get<9>(val));
+            return os;
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            ast::detail::to_string{os}(util::get<10>(val));
+            return os;
+
         case 5:
             ast::detail::to_string{os}(util::get<5>(val));
             return os;
@@ -4671,6 +5634,16 @@ namespace std {
             return phylanx::execution_tree::hash_node_data_zero_dim_value(
                 phylanx::util::get<4>(val));
         }
+        case 9:    // phylanx::ir::node_data<float>
+        {
+            return phylanx::execution_tree::hash_node_data_zero_dim_value(
+                phylanx::util::get<9>(val));
+        }
+        case 10:   // phylanx::ir::node_data<std::int32_t>
+        {
+            return phylanx::execution_tree::hash_node_data_zero_dim_value(
+                phylanx::util::get<10>(val));
+        }
         case 0:    // ast::nil
             HPX_FALLTHROUGH;
 
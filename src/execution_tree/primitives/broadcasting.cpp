@@ -0,0 +1,83 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/broadcasting.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+
+#include <hpx/throw_exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+namespace phylanx { namespace execution_tree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr std::size_t broadcast_shape::max_dimensions;
+
+    namespace detail
+    {
+        // format a shape the way NumPy does, e.g. '(3,2)' or '(4,)'
+        std::string format_broadcast_shape(broadcast_shape const& shape)
+        {
+            std::string result("(");
+
+            std::size_t const first =
+                broadcast_shape::max_dimensions - shape.numdims_;
+            for (std::size_t i = first; i != broadcast_shape::max_dimensions;
+                 ++i)
+            {
+                if (i != first)
+                {
+                    result += ",";
+                }
+                result += std::to_string(shape.dims_[i]);
+            }
+
+            if (shape.numdims_ == 1)
+            {
+                result += ",";
+            }
+            return result + ")";
+        }
+    }
+
+    broadcast_shape broadcast_shapes(broadcast_shape const& lhs,
+        broadcast_shape const& rhs, std::string const& name,
+        std::string const& codename)
+    {
+        broadcast_shape result{(std::max)(lhs.numdims_, rhs.numdims_), {}};
+
+        for (std::size_t i = 0; i != broadcast_shape::max_dimensions; ++i)
+        {
+            std::size_t const lhs_dim = lhs.dims_[i];
+            std::size_t const rhs_dim = rhs.dims_[i];
+
+            // dimensions are compatible if they are equal or one of them is
+            // one
+            if (lhs_dim == rhs_dim || rhs_dim == 1)
+            {
+                result.dims_[i] = lhs_dim;
+            }
+            else if (lhs_dim == 1)
+            {
+                result.dims_[i] = rhs_dim;
+            }
+            else
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::broadcast_shapes",
+                    util::generate_error_message(
+                        "operands could not be broadcast together with "
+                            "shapes " +
+                            detail::format_broadcast_shape(lhs) + " " +
+                            detail::format_broadcast_shape(rhs),
+                        name, codename));
+            }
+        }
+        return result;
+    }
+}}
@@ -86,9 +86,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive* p = util::get_if<primitive>(&operands_[0]);
         if (p != nullptr)
         {
-            hpx::error_code ec(hpx::lightweight);
-            target_ = hpx::get_ptr<primitive_component>(
-                hpx::launch::sync, p->get_id(), ec);
+            target_ = p->lightweight_component();
+            if (!target_)
+            {
+                hpx::error_code ec(hpx::lightweight);
+                target_ = hpx::get_ptr<primitive_component>(
+                    hpx::launch::sync, p->get_id(), ec);
+            }
         }
     }
 
@@ -120,8 +124,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     }
 
                     // store the variable in the evaluation context
-                    auto& result = ctx.set_var(
-                        this_->target_name_, std::move(var));
+                    auto& result = ctx.set_var(this_->target_name_,
+                        std::move(var), this_->target_slot_);
 
                     // return a reference to this variable
                     return extract_ref_value(result, this_->name_,
@@ -142,7 +146,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // store the variable in the evaluation context
-        auto& result = ctx.set_var(target_name_, std::move(var));
+        auto& result =
+            ctx.set_var(target_name_, std::move(var), target_slot_);
 
         // return a reference to this variable
         return hpx::make_ready_future(
@@ -17,6 +17,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,10 +32,18 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_bool;
         }
+        else if (spec == "int32")
+        {
+            result = node_data_type_int32;
+        }
         else if (spec.find("int") == 0)
         {
             result = node_data_type_int64;
         }
+        else if (spec == "float32")
+        {
+            result = node_data_type_float32;
+        }
         else if (spec.find("float") == 0)
         {
             result = node_data_type_double;
@@ -66,10 +75,18 @@ namespace phylanx { namespace execution_tree
         {
             result = node_data_type_double;
         }
+        else if (is_float32_operand_strict(arg))
+        {
+            result = node_data_type_float32;
+        }
         else if (is_integer_operand_strict(arg))
         {
             result = node_data_type_int64;
         }
+        else if (is_int32_operand_strict(arg))
+        {
+            result = node_data_type_int32;
+        }
         else if (is_boolean_operand_strict(arg))
         {
             result = node_data_type_bool;
@@ -78,30 +95,114 @@ namespace phylanx { namespace execution_tree
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    node_data_type extract_common_type(
-        primitive_arguments_type const& args)
+    // The common type is the one with the smallest node_data_type value, i.e.
+    // double wins over everything else, 64 bit integers win over 32 bit
+    // integers, and so on. Single precision can't represent all integer
+    // values exactly, it is promoted to double precision when combined with
+    // any integral array (as numpy does).
+    node_data_type promote_common_type(node_data_type lhs, node_data_type rhs)
     {
-        node_data_type result = node_data_type_unknown;
-        for (auto const& arg : args)
+        if ((lhs == node_data_type_float32 &&
+                (rhs == node_data_type_int64 || rhs == node_data_type_int32)) ||
+            (rhs == node_data_type_float32 &&
+                (lhs == node_data_type_int64 || lhs == node_data_type_int32)))
         {
-            if (is_numeric_operand_strict(arg))
+            return node_data_type_double;
+        }
+        return (std::min)(lhs, rhs);
+    }
+
+    namespace detail
+    {
+        // bool < integral < floating point
+        int type_kind(node_data_type type)
+        {
+            switch (type)
             {
-                result = node_data_type_double;
+            case node_data_type_double: HPX_FALLTHROUGH;
+            case node_data_type_float32:
+                return 2;
+
+            case node_data_type_int64: HPX_FALLTHROUGH;
+            case node_data_type_int32:
+                return 1;
+
+            default:
                 break;
             }
-            else if (is_integer_operand_strict(arg) &&
-                (result == node_data_type_unknown ||
-                    result == node_data_type_bool))
+            return 0;
+        }
+    }
+
+    node_data_type promote_common_type_scalar(
+        node_data_type array, node_data_type scalar)
+    {
+        if (array == node_data_type_unknown)
+        {
+            return scalar;
+        }
+        if (scalar == node_data_type_unknown ||
+            detail::type_kind(scalar) <= detail::type_kind(array))
+        {
+            return array;
+        }
+        return promote_common_type(array, scalar);
+    }
+
+    namespace detail
+    {
+        // Scalars are all 0-d values, except for 64 bit integers that can't
+        // be represented by a 32 bit integer (their value matters, as in
+        // NumPy).
+        bool is_scalar_value(
+            primitive_argument_type const& arg, node_data_type type)
+        {
+            if (extract_numeric_value_dimension(arg) != 0)
             {
-                result = node_data_type_int64;
+                return false;
             }
-            else if (is_boolean_operand_strict(arg) &&
-                result == node_data_type_unknown)
+            if (type == node_data_type_int64)
             {
-                result = node_data_type_bool;
+                std::int64_t value = util::get<2>(arg).scalar();
+                return value >= (std::numeric_limits<std::int32_t>::min)() &&
+                    value <= (std::numeric_limits<std::int32_t>::max)();
             }
+            return true;
         }
-        return result;
+
+        void common_type::add(primitive_argument_type const& arg)
+        {
+            node_data_type type = extract_common_type(arg);
+            if (type == node_data_type_unknown)
+            {
+                return;
+            }
+
+            if (is_scalar_value(arg, type))
+            {
+                scalar_ = promote_common_type(scalar_, type);
+            }
+            else
+            {
+                array_ = promote_common_type(array_, type);
+            }
+        }
+
+        node_data_type common_type::get() const
+        {
+            return promote_common_type_scalar(array_, scalar_);
+        }
+    }
+
+    node_data_type extract_common_type(
+        primitive_arguments_type const& args)
+    {
+        detail::common_type result;
+        for (auto const& arg : args)
+        {
+            result.add(arg);
+        }
+        return result.get();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -332,6 +433,12 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_scalar<std::uint8_t>(primitive_argument_type const& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_scalar<std::int32_t>(primitive_argument_type const& val,
+        std::string const& name, std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double>
     extract_value_scalar<double>(primitive_argument_type&& val,
@@ -342,4 +449,10 @@ namespace phylanx { namespace execution_tree
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     extract_value_scalar<std::uint8_t>(primitive_argument_type&& val,
         std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_scalar<float>(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_scalar<std::int32_t>(primitive_argument_type&& val,
+        std::string const& name, std::string const& codename);
 }}
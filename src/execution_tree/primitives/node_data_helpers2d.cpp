@@ -250,6 +250,14 @@ namespace phylanx { namespace execution_tree
     extract_value_matrix<std::uint8_t>(primitive_argument_type const& val,
         std::size_t rows, std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_matrix<float>(primitive_argument_type const& val,
+        std::size_t rows, std::size_t columns, std::string const& name,
+        std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_matrix<std::int32_t>(primitive_argument_type const& val,
+        std::size_t rows, std::size_t columns, std::string const& name,
+        std::string const& codename);
 
     template PHYLANX_EXPORT ir::node_data<double> extract_value_matrix<double>(
         primitive_argument_type&& val, std::size_t rows, std::size_t columns,
@@ -262,4 +270,12 @@ namespace phylanx { namespace execution_tree
     extract_value_matrix<std::uint8_t>(primitive_argument_type&& val,
         std::size_t rows, std::size_t columns, std::string const& name,
         std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<float>
+    extract_value_matrix<float>(primitive_argument_type&& val,
+        std::size_t rows, std::size_t columns, std::string const& name,
+        std::string const& codename);
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    extract_value_matrix<std::int32_t>(primitive_argument_type&& val,
+        std::size_t rows, std::size_t columns, std::string const& name,
+        std::string const& codename);
 }}
@@ -7,9 +7,11 @@
 #include <phylanx/execution_tree/primitives/primitive_argument_type.hpp>
 
 #include <hpx/include/serialization.hpp>
+#include <hpx/runtime/serialization/deque.hpp>
 #include <hpx/util/internal_allocator.hpp>
 
 #include <cstdint>
+#include <vector>
 
 namespace phylanx { namespace execution_tree
 {
@@ -45,13 +47,19 @@ namespace phylanx { namespace execution_tree
     void variable_frame::serialize(
         hpx::serialization::output_archive& ar, unsigned)
     {
-        ar & variables_;
+        ar & names_ & values_;
     }
 
     void variable_frame::serialize(
         hpx::serialization::input_archive& ar, unsigned)
     {
-        ar & variables_;
+        ar & names_ & values_;
+
+        names_mask_ = 0;
+        for (auto const& name : names_)
+        {
+            names_mask_ |= name_bit(name);
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -7,15 +7,19 @@
 #include <phylanx/execution_tree/compile.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component.hpp>
+#include <phylanx/util/trace_events.hpp>
 
 #include <hpx/include/actions.hpp>
 #include <hpx/include/components.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/runtime/components/server/create_component.hpp>
+#include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/naming_fwd.hpp>
 #include <hpx/runtime/launch_policy.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
@@ -86,6 +90,84 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////
+    primitive_component::~primitive_component()
+    {
+        // remove the name of a lightweight instance which was made globally
+        // visible, the name belongs to the promoted instance as that may
+        // outlive the lightweight one
+        if (!promoted_name_.empty())
+        {
+            hpx::error_code ec(hpx::lightweight);
+            hpx::agas::unregister_name(
+                hpx::launch::sync, promoted_name_, ec);
+        }
+    }
+
+    std::shared_ptr<primitive_component>
+    primitive_component::create_lightweight(std::string const& type,
+        primitive_arguments_type&& operands, std::string const& name,
+        std::string const& codename, bool register_with_agas)
+    {
+        auto result = std::make_shared<primitive_component>(
+            type, std::move(operands), name, codename);
+
+        result->self_ = result;
+        if (register_with_agas)
+        {
+            result->lightweight_name_ = name;
+        }
+
+        // the id is assigned by the first client asking for it
+        primitive_component const* this_ = result.get();
+        result->lightweight_id_ = hpx::async(hpx::launch::deferred,
+            [this_]() { return this_->promote_lightweight(); });
+
+        return result;
+    }
+
+    std::shared_ptr<primitive_component>
+    primitive_component::create_lightweight(std::string const& type,
+        primitive_arguments_type&& operands, eval_context ctx,
+        std::string const& name, std::string const& codename,
+        bool register_with_agas)
+    {
+        auto result = create_lightweight(
+            type, std::move(operands), name, codename, register_with_agas);
+        result->primitive_->set_eval_context(std::move(ctx));
+        return result;
+    }
+
+    // A lightweight instance is made globally visible by creating a regular
+    // component sharing the same primitive. The global id of that component
+    // is managed, i.e. the primitive stays alive as long as there are
+    // references to it on any locality, even after all local references to
+    // the lightweight instance have gone out of scope. The name is registered
+    // using an unmanaged id, otherwise it would keep the promoted instance
+    // alive until the name is removed by that instance itself.
+    hpx::id_type primitive_component::promote_lightweight() const
+    {
+        hpx::id_type id(
+            hpx::components::server::create<phylanx_primitive_component_type>(
+                primitive_, lightweight_name_),
+            hpx::id_type::managed);
+        if (!lightweight_name_.empty())
+        {
+            hpx::agas::register_name(hpx::launch::sync, lightweight_name_,
+                hpx::id_type(id.get_gid(), hpx::id_type::unmanaged));
+        }
+        return id;
+    }
+
+    primitive primitive_component::this_client() const
+    {
+        if (lightweight_id_.valid())
+        {
+            return primitive{self_.lock()};
+        }
+        return primitive{this->get_id()};
+    }
+
     /////////////////////////////////////////////////////////////////////////
     std::shared_ptr<primitive_component_base>
     primitive_component::create_primitive(std::string const& type,
@@ -116,9 +198,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             // return a client referring to this component as the evaluation
             // result
-            primitive this_{this->get_id()};
             return hpx::make_ready_future(
-                primitive_argument_type{std::move(this_)});
+                primitive_argument_type{this_client()});
         }
         return primitive_->do_eval(params, ctx);
     }
@@ -131,13 +212,26 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             // return a client referring to this component as the evaluation
             // result
-            primitive this_{this->get_id()};
             return hpx::make_ready_future(
-                primitive_argument_type{std::move(this_)});
+                primitive_argument_type{this_client()});
         }
         return primitive_->do_eval(std::move(param), ctx);
     }
 
+    util::future_or_value<primitive_argument_type>
+    primitive_component::eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        if ((ctx.mode_ & eval_dont_evaluate_partials) &&
+            primitive_->operands_.empty())
+        {
+            // return a client referring to this component as the evaluation
+            // result
+            return primitive_argument_type{this_client()};
+        }
+        return primitive_->do_eval_fov(params, std::move(ctx));
+    }
+
     // store_action
     void primitive_component::store(primitive_arguments_type&& args,
         primitive_arguments_type&& params, eval_context ctx)
@@ -183,11 +277,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return primitive_->get_direct_execution(reset);
     }
 
+    std::int64_t primitive_component::get_eval_decisions(
+        eval_mode mode, bool reset) const
+    {
+        return primitive_->get_eval_decisions(mode, reset);
+    }
+
     void primitive_component::enable_measurements()
     {
         primitive_->enable_measurements();
     }
 
+    util::trace_event_shape primitive_component::get_last_result_shape() const
+    {
+        return primitive_->last_result_shape();
+    }
+
     hpx::launch primitive_component::select_direct_execution(
         primitive_component::eval_action, hpx::launch policy,
         hpx::naming::address_type lva)
@@ -203,15 +308,68 @@ namespace phylanx { namespace execution_tree { namespace primitives
         auto this_ = hpx::get_lva<primitive_component>::call(lva);
         return this_->primitive_->select_direct_eval_execution(policy);
     }
+
+    hpx::launch primitive_component::select_direct_eval_execution(
+        hpx::launch policy) const
+    {
+        return primitive_->select_direct_eval_execution(policy);
+    }
+
+    hpx::launch primitive_component::select_direct_eval_execution(
+        hpx::launch policy, primitive_arguments_type const& params) const
+    {
+        return primitive_->select_direct_eval_execution(policy, params);
+    }
+
+    hpx::launch primitive_component::select_direct_eval_execution(
+        hpx::launch policy, primitive_argument_type const& param) const
+    {
+        return primitive_->select_direct_eval_execution(policy, param);
+    }
 }}}
 
 namespace phylanx { namespace execution_tree
 {
+    namespace detail
+    {
+        std::atomic<bool>& lightweight_primitives_flag()
+        {
+            static std::atomic<bool> enabled(hpx::get_config_entry(
+                "phylanx.lightweight_primitives", "0") == "1");
+            return enabled;
+        }
+
+        bool create_lightweight(hpx::id_type const& locality)
+        {
+            return lightweight_primitives_enabled() &&
+                locality == hpx::find_here();
+        }
+    }
+
+    bool lightweight_primitives_enabled()
+    {
+        return detail::lightweight_primitives_flag().load(
+            std::memory_order_relaxed);
+    }
+
+    void enable_lightweight_primitives(bool enable)
+    {
+        detail::lightweight_primitives_flag().store(enable);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     primitive create_primitive_component(hpx::id_type const& locality,
         std::string const& type, primitive_arguments_type&& operands,
         std::string const& name, std::string const& codename,
         bool register_with_agas)
     {
+        if (detail::create_lightweight(locality))
+        {
+            return primitive{primitives::primitive_component::
+                create_lightweight(type, std::move(operands), name,
+                    codename, register_with_agas)};
+        }
+
         return primitive{
             hpx::new_<primitives::primitive_component>(
                 locality, type, std::move(operands), name, codename),
@@ -223,6 +381,13 @@ namespace phylanx { namespace execution_tree
         eval_context ctx, std::string const& name, std::string const& codename,
         bool register_with_agas)
     {
+        if (detail::create_lightweight(locality))
+        {
+            return primitive{primitives::primitive_component::
+                create_lightweight(type, std::move(operands), std::move(ctx),
+                    name, codename, register_with_agas)};
+        }
+
         return primitive{
             hpx::new_<primitives::primitive_component>(locality, type,
                 std::move(operands), std::move(ctx), name, codename),
@@ -237,6 +402,13 @@ namespace phylanx { namespace execution_tree
         primitive_arguments_type operands;
         operands.emplace_back(std::move(operand));
 
+        if (detail::create_lightweight(locality))
+        {
+            return primitive{primitives::primitive_component::
+                create_lightweight(type, std::move(operands), name,
+                    codename, register_with_agas)};
+        }
+
         return primitive{
             hpx::new_<primitives::primitive_component>(
                 locality, type, std::move(operands), name, codename),
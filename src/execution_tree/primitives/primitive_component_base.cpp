@@ -6,8 +6,11 @@
 #include <phylanx/config.hpp>
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component_base.hpp>
-#include <phylanx/util/scoped_timer.hpp>
+#include <phylanx/execution_tree/primitives/scheduling_policy.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/trace_events.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/util.hpp>
@@ -15,9 +18,13 @@
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/runtime/naming_fwd.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <set>
 #include <string>
 #include <type_traits>
@@ -40,26 +47,27 @@ namespace phylanx { namespace execution_tree { namespace primitives
       , eval_duration_(0ll)
       , execute_directly_(eval_direct ? 1 : -1)
       , measurements_enabled_(false)
+      , operands_size_(0ll)
+      , last_result_size_(0ll)
+      , eval_decisions_{{0ll}, {0ll}, {0ll}, {0ll}}
+      , cost_model_(nullptr)
+      , trace_name_(0)
+      , last_result_ndim_(-1)
     {
+        for (auto& dim : last_result_dims_)
+        {
+            dim.store(0, std::memory_order_relaxed);
+        }
+
 #if defined(HPX_HAVE_APEX)
         eval_name_ = name_ + "::eval";
 #endif
-    }
-
-    namespace detail
-    {
-        template <typename T>
-        struct keep_alive
+        // literal operands contribute to the amount of processed data for
+        // every invocation
+        for (auto const& operand : operands_)
         {
-            template <typename T_>
-            keep_alive(T_ && t)
-              : t_(std::forward<T_>(t))
-            {}
-
-            void operator()() const {}
-
-            T t_;
-        };
+            operands_size_ += estimate_data_size(operand);
+        }
     }
 
     std::string primitive_component_base::extract_function_name(
@@ -85,13 +93,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return name_parts.primitive;
     }
 
-    template <typename T>
-    detail::keep_alive<typename std::decay<T>::type> keep_alive(T && t)
-    {
-        return detail::keep_alive<typename std::decay<T>::type>(
-            std::forward<T>(t));
-    }
-
     hpx::future<primitive_argument_type> primitive_component_base::do_eval(
         primitive_arguments_type const& params,
         eval_context ctx) const
@@ -101,27 +102,24 @@ namespace phylanx { namespace execution_tree { namespace primitives
 #endif
 
         // perform measurements only when needed
-        bool enable_timer = measurements_enabled_ || (execute_directly_ == -1);
+        bool enable_timer = measurements_enabled_ ||
+            execute_directly_.load(std::memory_order_relaxed) == -1 ||
+            get_scheduling_policy().needs_measurements() ||
+            util::trace_events_enabled();
 
-        util::scoped_timer<std::int64_t> timer(eval_duration_, enable_timer);
-        if (enable_timer)
+        if (!enable_timer)
         {
-            ++eval_count_;
+            return this->eval(params, std::move(ctx));
         }
 
-        auto f = this->eval(params, std::move(ctx));
+        eval_count_.fetch_add(1, std::memory_order_relaxed);
 
-        if (enable_timer && !f.is_ready())
-        {
-            using shared_state_ptr =
-                typename hpx::traits::detail::shared_state_ptr_for<
-                    decltype(f)>::type;
-            shared_state_ptr const& state =
-                hpx::traits::future_access<decltype(f)>::get_shared_state(f);
-
-            state->set_on_completed(keep_alive(std::move(timer)));
-        }
+        std::int64_t input_size = estimate_input_size(params);
+        util::trace_event event = begin_trace_event(params);
+        std::uint64_t started_at = hpx::util::high_resolution_clock::now();
 
+        auto f = this->eval(params, std::move(ctx));
+        finalize_eval(f, started_at, input_size, event);
         return f;
     }
 
@@ -133,30 +131,333 @@ namespace phylanx { namespace execution_tree { namespace primitives
 #endif
 
         // perform measurements only when needed
-        bool enable_timer = measurements_enabled_ || (execute_directly_ == -1);
+        bool enable_timer = measurements_enabled_ ||
+            execute_directly_.load(std::memory_order_relaxed) == -1 ||
+            get_scheduling_policy().needs_measurements() ||
+            util::trace_events_enabled();
 
-        util::scoped_timer<std::int64_t> timer(eval_duration_, enable_timer);
-        if (enable_timer)
+        if (!enable_timer)
         {
-            ++eval_count_;
+            return this->eval(std::move(param), std::move(ctx));
         }
 
+        eval_count_.fetch_add(1, std::memory_order_relaxed);
+
+        std::int64_t input_size = estimate_input_size(param);
+        util::trace_event event = begin_trace_event(param);
+        std::uint64_t started_at = hpx::util::high_resolution_clock::now();
+
         auto f = this->eval(std::move(param), std::move(ctx));
+        finalize_eval(f, started_at, input_size, event);
+        return f;
+    }
 
-        if (enable_timer && !f.is_ready())
+    util::future_or_value<primitive_argument_type>
+    primitive_component_base::do_eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+#if defined(HPX_HAVE_APEX)
+        hpx::util::annotate_function annotate(eval_name_.c_str());
+#endif
+
+        // perform measurements only when needed
+        bool enable_timer = measurements_enabled_ ||
+            execute_directly_.load(std::memory_order_relaxed) == -1 ||
+            get_scheduling_policy().needs_measurements() ||
+            util::trace_events_enabled();
+
+        if (!enable_timer)
         {
-            using shared_state_ptr =
-                typename hpx::traits::detail::shared_state_ptr_for<
-                    decltype(f)>::type;
-            shared_state_ptr const& state =
-                hpx::traits::future_access<decltype(f)>::get_shared_state(f);
+            return this->eval_fov(params, std::move(ctx));
+        }
+
+        eval_count_.fetch_add(1, std::memory_order_relaxed);
 
-            state->set_on_completed(keep_alive(std::move(timer)));
+        std::int64_t input_size = estimate_input_size(params);
+        util::trace_event event = begin_trace_event(params);
+        std::uint64_t started_at = hpx::util::high_resolution_clock::now();
+
+        auto result = this->eval_fov(params, std::move(ctx));
+        if (result.has_value_only())
+        {
+            primitive_argument_type val = result.get();
+            record_eval(started_at, input_size, &val, event);
+            return val;
         }
 
+        auto f = result.get_future();
+        finalize_eval(f, started_at, input_size, event);
         return f;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t primitive_component_base::estimate_input_size(
+        primitive_arguments_type const& params) const
+    {
+        // The size of the result of the previous invocation is used as a
+        // proxy for the size of the data produced by the operands.
+        std::int64_t input_size =
+            operands_size_ + last_result_size_.load(std::memory_order_relaxed);
+        for (auto const& param : params)
+        {
+            input_size += estimate_data_size(param);
+        }
+        return input_size;
+    }
+
+    std::int64_t primitive_component_base::estimate_input_size(
+        primitive_argument_type const& param) const
+    {
+        return operands_size_ +
+            last_result_size_.load(std::memory_order_relaxed) +
+            estimate_data_size(param);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename T>
+        util::trace_event_shape get_trace_event_shape(
+            ir::node_data<T> const& data)
+        {
+            util::trace_event_shape shape{};
+            shape.ndim_ = std::int8_t(data.num_dimensions());
+
+            auto dims = data.dimensions();
+            for (std::int8_t i = 0; i != shape.ndim_; ++i)
+            {
+                shape.dims_[i] = std::int64_t(dims[i]);
+            }
+            return shape;
+        }
+
+        util::trace_event_shape get_trace_event_shape(
+            primitive_argument_type const& val)
+        {
+            switch (val.index())
+            {
+            case 1:     // phylanx::ir::node_data<std::uint8_t>
+                return get_trace_event_shape(util::get<1>(val));
+
+            case 2:     // phylanx::ir::node_data<std::int64_t>
+                return get_trace_event_shape(util::get<2>(val));
+
+            case 4:     // phylanx::ir::node_data<double>
+                return get_trace_event_shape(util::get<4>(val));
+
+            case 9:     // phylanx::ir::node_data<float>
+                return get_trace_event_shape(util::get<9>(val));
+
+            case 10:    // phylanx::ir::node_data<std::int32_t>
+                return get_trace_event_shape(util::get<10>(val));
+
+            default:
+                break;
+            }
+
+            util::trace_event_shape shape{};
+            shape.ndim_ = -1;
+            return shape;
+        }
+
+        // Operands referring to a primitive are reported with the shape of
+        // the value that primitive produced most recently.
+        util::trace_event_shape get_operand_shape(
+            primitive_argument_type const& operand)
+        {
+            primitive const* p = util::get_if<primitive>(&operand);
+            if (p == nullptr)
+            {
+                return get_trace_event_shape(operand);
+            }
+
+            primitive_component const* component = p->local_component();
+            if (component != nullptr)
+            {
+                return component->get_last_result_shape();
+            }
+
+            util::trace_event_shape shape{};
+            shape.ndim_ = -1;
+            return shape;
+        }
+    }
+
+    std::uint32_t primitive_component_base::trace_name() const
+    {
+        // concurrent registrations of the same name return the same value
+        std::uint32_t name = trace_name_.load(std::memory_order_relaxed);
+        if (name == 0)
+        {
+            name = util::register_trace_event_name(name_, codename_);
+            trace_name_.store(name, std::memory_order_relaxed);
+        }
+        return name;
+    }
+
+    util::trace_event primitive_component_base::begin_trace_event(
+        primitive_arguments_type const& params) const
+    {
+        util::trace_event event{};
+        if (!util::trace_events_enabled())
+        {
+            return event;
+        }
+
+        event.worker_ = util::trace_event_worker();
+        event.name_ = trace_name();
+
+        // primitives without operands operate on the arguments directly, the
+        // (last known) shapes of the operands are determined once the eval
+        // has finished
+        if (operands().empty())
+        {
+            event.num_arguments_ = std::uint32_t(params.size());
+
+            std::size_t const count = (std::min)(
+                params.size(), std::size_t(util::trace_event::max_arguments));
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                event.arguments_[i] = detail::get_trace_event_shape(params[i]);
+            }
+        }
+        return event;
+    }
+
+    util::trace_event primitive_component_base::begin_trace_event(
+        primitive_argument_type const& param) const
+    {
+        util::trace_event event{};
+        if (!util::trace_events_enabled())
+        {
+            return event;
+        }
+
+        event.worker_ = util::trace_event_worker();
+        event.name_ = trace_name();
+
+        if (operands().empty())
+        {
+            event.num_arguments_ = 1;
+            event.arguments_[0] = detail::get_trace_event_shape(param);
+        }
+        return event;
+    }
+
+    void primitive_component_base::finalize_eval(
+        hpx::future<primitive_argument_type>& f, std::uint64_t started_at,
+        std::int64_t input_size, util::trace_event const& event) const
+    {
+        using shared_state_ptr =
+            typename hpx::traits::detail::shared_state_ptr_for<
+                hpx::future<primitive_argument_type>>::type;
+        shared_state_ptr const& state = hpx::traits::future_access<
+            hpx::future<primitive_argument_type>>::get_shared_state(f);
+
+        auto record = [this, started_at, input_size, state = state.get(),
+            event]() mutable
+        {
+            hpx::error_code ec(hpx::lightweight);
+            primitive_argument_type const* result = state->get_result(ec);
+            this->record_eval(
+                started_at, input_size, ec ? nullptr : result, event);
+        };
+
+        if (f.is_ready())
+        {
+            record();
+        }
+        else
+        {
+            state->set_on_completed(std::move(record));
+        }
+    }
+
+    void primitive_component_base::record_eval(std::uint64_t started_at,
+        std::int64_t input_size, primitive_argument_type const* result,
+        util::trace_event& event) const
+    {
+        std::uint64_t finished_at = hpx::util::high_resolution_clock::now();
+        std::int64_t duration = finished_at - started_at;
+
+        if (event.name_ != 0)
+        {
+            event.begin_ = started_at;
+            event.end_ = finished_at;
+
+            // All operands have been evaluated at this point. The shapes of
+            // the values they produced most recently are reported, those are
+            // not necessarily the values consumed by this eval.
+            primitive_arguments_type const& operands = this->operands();
+            if (!operands.empty())
+            {
+                event.last_known_arguments_ = true;
+                event.num_arguments_ = std::uint32_t(operands.size());
+
+                std::size_t const count = (std::min)(operands.size(),
+                    std::size_t(util::trace_event::max_arguments));
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    event.arguments_[i] =
+                        detail::get_operand_shape(operands[i]);
+                }
+            }
+
+            if (result != nullptr)
+            {
+                event.has_result_ = true;
+                event.result_ = detail::get_trace_event_shape(*result);
+
+                for (std::int8_t i = 0; i < event.result_.ndim_; ++i)
+                {
+                    last_result_dims_[i].store(
+                        event.result_.dims_[i], std::memory_order_relaxed);
+                }
+                last_result_ndim_.store(
+                    event.result_.ndim_, std::memory_order_relaxed);
+            }
+            util::record_trace_event(event);
+        }
+
+        eval_duration_.fetch_add(duration, std::memory_order_relaxed);
+
+        if (result != nullptr)
+        {
+            last_result_size_.store(
+                estimate_data_size(*result), std::memory_order_relaxed);
+        }
+
+        // the cost models are only maintained for the policies using them
+        if (get_scheduling_policy().needs_measurements())
+        {
+            type_cost_model()->add_sample(input_size, duration);
+        }
+    }
+
+    cost_model* primitive_component_base::type_cost_model() const
+    {
+        cost_model* model = cost_model_.load(std::memory_order_acquire);
+        if (model == nullptr)
+        {
+            // concurrent lookups yield the same model
+            model = &get_cost_model(extract_function_name(name_));
+            cost_model_.store(model, std::memory_order_release);
+        }
+        return model;
+    }
+
+    util::trace_event_shape primitive_component_base::last_result_shape() const
+    {
+        util::trace_event_shape shape{};
+        shape.ndim_ = last_result_ndim_.load(std::memory_order_relaxed);
+        for (std::int8_t i = 0; i < shape.ndim_; ++i)
+        {
+            shape.dims_[i] = last_result_dims_[i].load(
+                std::memory_order_relaxed);
+        }
+        return shape;
+    }
+
     // eval_action
     hpx::future<primitive_argument_type> primitive_component_base::eval(
         primitive_arguments_type const& params, eval_context ctx) const
@@ -176,6 +477,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return this->eval(params, std::move(ctx));
     }
 
+    util::future_or_value<primitive_argument_type>
+    primitive_component_base::eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        return this->eval(params, std::move(ctx));
+    }
+
     hpx::future<primitive_argument_type> primitive_component_base::eval(
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
@@ -272,19 +580,39 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return util::generate_error_message(msg, name_, codename_);
     }
 
+    namespace detail
+    {
+        std::int64_t get_and_reset_counter(
+            std::atomic<std::int64_t>& value, bool reset)
+        {
+            if (reset)
+            {
+                return value.exchange(0, std::memory_order_relaxed);
+            }
+            return value.load(std::memory_order_relaxed);
+        }
+    }
+
     std::int64_t primitive_component_base::get_eval_count(bool reset) const
     {
-        return hpx::util::get_and_reset_value(eval_count_, reset);
+        return detail::get_and_reset_counter(eval_count_, reset);
     }
 
     std::int64_t primitive_component_base::get_eval_duration(bool reset) const
     {
-        return hpx::util::get_and_reset_value(eval_duration_, reset);
+        return detail::get_and_reset_counter(eval_duration_, reset);
     }
 
     std::int64_t primitive_component_base::get_direct_execution(bool reset) const
     {
-        return hpx::util::get_and_reset_value(execute_directly_, reset);
+        return detail::get_and_reset_counter(execute_directly_, reset);
+    }
+
+    std::int64_t primitive_component_base::get_eval_decisions(
+        eval_mode mode, bool reset) const
+    {
+        return detail::get_and_reset_counter(
+            eval_decisions_[static_cast<int>(mode) + 1], reset);
     }
 
     void primitive_component_base::enable_measurements()
@@ -301,44 +629,30 @@ namespace phylanx { namespace execution_tree { namespace primitives
         return sync_execution;
     }
 
-    // get eval count from command line
-    std::int64_t primitive_component_base::get_ec_threshold()
+    hpx::launch primitive_component_base::select_direct_eval_execution(
+        hpx::launch policy) const
     {
-        static std::int64_t ec_threshold = std::stol(
-            hpx::get_config_entry("phylanx.eval_count_threshold", "5"));
-        return ec_threshold;
+        // invoked through the eval actions, the arguments are not known
+        return select_direct_eval_execution_impl(
+            policy, estimate_input_size(noargs));
     }
 
-    // get execution time upper threshold from command line
-    std::int64_t primitive_component_base::get_exec_upper_threshold()
+    hpx::launch primitive_component_base::select_direct_eval_execution(
+        hpx::launch policy, primitive_arguments_type const& params) const
     {
-        static std::int64_t exec_upper_threshold =
-            std::stol(hpx::get_config_entry(
-                "phylanx.exec_time_upper_threshold",
-/* What's going on here?  Well, direct actions cause problems on POWER8
- * with Clang 5.0. That's because the call stack gets too deep.  Changing
- * this threshold to 0 will disable direct actions on that platform.
- * There is also a github issue #584 that explains this in detail. */
-#if defined(__POWERPC__) && defined(__clang_version__)
-                "0"
-#else
-                "500000"
-#endif
-                ));
-        return exec_upper_threshold;
+        return select_direct_eval_execution_impl(
+            policy, estimate_input_size(params));
     }
 
-    // get execution time lower threshold from command line
-    std::int64_t primitive_component_base::get_exec_lower_threshold()
+    hpx::launch primitive_component_base::select_direct_eval_execution(
+        hpx::launch policy, primitive_argument_type const& param) const
     {
-        static std::int64_t exec_lower_threshold =
-            std::stol(hpx::get_config_entry(
-                "phylanx.exec_time_lower_threshold", "350000"));
-        return exec_lower_threshold;
+        return select_direct_eval_execution_impl(
+            policy, estimate_input_size(param));
     }
 
-    hpx::launch primitive_component_base::select_direct_eval_execution(
-        hpx::launch policy) const
+    hpx::launch primitive_component_base::select_direct_eval_execution_impl(
+        hpx::launch policy, std::int64_t input_size) const
     {
         // always run this on an HPX thread
         if (hpx::threads::get_self_ptr() == nullptr)
@@ -352,35 +666,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return hpx::launch::sync;
         }
 
-        if ((eval_count_ != 0 && measurements_enabled_) ||
-            (eval_count_ > get_ec_threshold()))
-        {
-            // check whether execution status needs to be changed (with some
-            // hysteresis)
-            std::int64_t exec_time = (eval_duration_ / eval_count_);
-            if (exec_time > get_exec_upper_threshold())
-            {
-                execute_directly_ = 0;
-            }
-            else if (exec_time < get_exec_lower_threshold())
-            {
-                execute_directly_ = 1;
-            }
-            else
-            {
-                execute_directly_ = -1;
-            }
-        }
+        scheduling_policy const& scheduling = get_scheduling_policy();
 
-        if (execute_directly_ == 1)
-        {
-            return hpx::launch::sync;
-        }
-        else if (execute_directly_ == 0)
-        {
-            return hpx::launch::async;
-        }
+        scheduling_data data{
+            static_cast<eval_mode>(
+                execute_directly_.load(std::memory_order_relaxed)),
+            eval_count_.load(std::memory_order_relaxed),
+            eval_duration_.load(std::memory_order_relaxed), input_size,
+            measurements_enabled_,
+            scheduling.needs_measurements() ? type_cost_model() : nullptr};
+
+        eval_mode mode = scheduling.select(data);
+
+        execute_directly_.store(
+            static_cast<std::int64_t>(mode), std::memory_order_relaxed);
+        eval_decisions_[static_cast<int>(mode) + 1].fetch_add(
+            1, std::memory_order_relaxed);
 
-        return policy;
+        return to_launch_policy(mode, policy);
     }
 }}}
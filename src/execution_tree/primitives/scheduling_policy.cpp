@@ -0,0 +1,487 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/execution_tree/primitives/scheduling_policy.hpp>
+#include <phylanx/ir/ranges.hpp>
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace execution_tree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::launch to_launch_policy(eval_mode mode, hpx::launch policy)
+    {
+        switch (mode)
+        {
+        case eval_mode::async:
+            return hpx::launch::async;
+
+        case eval_mode::sync:
+            return hpx::launch::sync;
+
+        case eval_mode::fork:
+            return hpx::launch::fork;
+
+        case eval_mode::undecided: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return policy;
+    }
+
+    char const* get_eval_mode_name(eval_mode mode)
+    {
+        switch (mode)
+        {
+        case eval_mode::async:
+            return "async";
+
+        case eval_mode::sync:
+            return "sync";
+
+        case eval_mode::fork:
+            return "fork";
+
+        case eval_mode::undecided: HPX_FALLTHROUGH;
+        default:
+            break;
+        }
+        return "undecided";
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t estimate_data_size(primitive_argument_type const& val)
+    {
+        switch (val.index())
+        {
+        case 1:     // phylanx::ir::node_data<std::uint8_t>
+            return util::get<1>(val).size();
+
+        case 2:     // phylanx::ir::node_data<std::int64_t>
+            return util::get<2>(val).size();
+
+        case 4:     // phylanx::ir::node_data<double>
+            return util::get<4>(val).size();
+
+        case 9:     // phylanx::ir::node_data<float>
+            return util::get<9>(val).size();
+
+        case 10:    // phylanx::ir::node_data<std::int32_t>
+            return util::get<10>(val).size();
+
+        case 7:     // phylanx::ir::range
+            {
+                auto const& r = util::get<7>(val);
+                if (!r.is_args())
+                {
+                    return r.size();
+                }
+
+                std::int64_t size = 0;
+                for (auto const& elem : r)
+                {
+                    size += estimate_data_size(elem);
+                }
+                return size;
+            }
+
+        default:
+            break;
+        }
+        return 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    cost_model::cost_model(double decay)
+      : decay_(decay)
+      , weight_(0.0)
+      , sum_n_(0.0)
+      , sum_t_(0.0)
+      , sum_nn_(0.0)
+      , sum_nt_(0.0)
+      , samples_(0)
+    {}
+
+    namespace detail
+    {
+        // decay the given sum and add the new value, concurrent updates may
+        // overwrite each other
+        void decay_and_add(std::atomic<double>& sum, double decay, double value)
+        {
+            sum.store(sum.load(std::memory_order_relaxed) * decay + value,
+                std::memory_order_relaxed);
+        }
+    }
+
+    void cost_model::add_sample(std::int64_t size, std::int64_t duration)
+    {
+        double n = double(size);
+        double t = double(duration);
+
+        detail::decay_and_add(weight_, decay_, 1.0);
+        detail::decay_and_add(sum_n_, decay_, n);
+        detail::decay_and_add(sum_t_, decay_, t);
+        detail::decay_and_add(sum_nn_, decay_, n * n);
+        detail::decay_and_add(sum_nt_, decay_, n * t);
+        samples_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    double cost_model::predict(std::int64_t size) const
+    {
+        double weight = weight_.load(std::memory_order_relaxed);
+        if (weight == 0.0)
+        {
+            return 0.0;
+        }
+
+        double sum_n = sum_n_.load(std::memory_order_relaxed);
+        double sum_t = sum_t_.load(std::memory_order_relaxed);
+        double sum_nn = sum_nn_.load(std::memory_order_relaxed);
+        double sum_nt = sum_nt_.load(std::memory_order_relaxed);
+
+        // weighted least squares fit of t = overhead + n * cost_per_element,
+        // fall back to the mean eval time if all samples had the same size
+        double denom = weight * sum_nn - sum_n * sum_n;
+        double cost_per_element = 0.0;
+        if (denom > 1e-9 * weight * sum_nn)
+        {
+            cost_per_element = (weight * sum_nt - sum_n * sum_t) / denom;
+        }
+
+        // processing more data never makes things faster
+        cost_per_element = (std::max)(cost_per_element, 0.0);
+
+        double overhead = (sum_t - cost_per_element * sum_n) / weight;
+        return (std::max)(overhead + cost_per_element * double(size), 0.0);
+    }
+
+    std::int64_t cost_model::samples() const
+    {
+        return samples_.load(std::memory_order_relaxed);
+    }
+
+    void cost_model::reset()
+    {
+        weight_.store(0.0, std::memory_order_relaxed);
+        sum_n_.store(0.0, std::memory_order_relaxed);
+        sum_t_.store(0.0, std::memory_order_relaxed);
+        sum_nn_.store(0.0, std::memory_order_relaxed);
+        sum_nt_.store(0.0, std::memory_order_relaxed);
+        samples_.store(0, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        struct cost_models
+        {
+            using mutex_type = hpx::lcos::local::spinlock;
+
+            mutex_type mtx_;
+            std::map<std::string, std::unique_ptr<cost_model>> models_;
+        };
+
+        cost_models& get_cost_models()
+        {
+            static cost_models models;
+            return models;
+        }
+    }
+
+    cost_model& get_cost_model(std::string const& primitive_type)
+    {
+        auto& models = detail::get_cost_models();
+
+        std::lock_guard<detail::cost_models::mutex_type> l(models.mtx_);
+
+        auto it = models.models_.find(primitive_type);
+        if (it == models.models_.end())
+        {
+            it = models.models_
+                     .emplace(primitive_type,
+                         std::unique_ptr<cost_model>(new cost_model))
+                     .first;
+        }
+        return *it->second;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // get eval count from command line
+        std::int64_t get_ec_threshold()
+        {
+            static std::int64_t ec_threshold = std::stol(
+                hpx::get_config_entry("phylanx.eval_count_threshold", "5"));
+            return ec_threshold;
+        }
+
+        // get execution time upper threshold from command line
+        std::int64_t get_exec_upper_threshold()
+        {
+            static std::int64_t exec_upper_threshold =
+                std::stol(hpx::get_config_entry(
+                    "phylanx.exec_time_upper_threshold",
+/* What's going on here?  Well, direct actions cause problems on POWER8
+ * with Clang 5.0. That's because the call stack gets too deep.  Changing
+ * this threshold to 0 will disable direct actions on that platform.
+ * There is also a github issue #584 that explains this in detail. */
+#if defined(__POWERPC__) && defined(__clang_version__)
+                    "0"
+#else
+                    "500000"
+#endif
+                    ));
+            return exec_upper_threshold;
+        }
+
+        // get execution time lower threshold from command line
+        std::int64_t get_exec_lower_threshold()
+        {
+            static std::int64_t exec_lower_threshold =
+                std::stol(hpx::get_config_entry(
+                    "phylanx.exec_time_lower_threshold", "350000"));
+            return exec_lower_threshold;
+        }
+
+        // get execution time above which evaluations are forked
+        std::int64_t get_exec_fork_threshold()
+        {
+            static std::int64_t exec_fork_threshold =
+                std::stol(hpx::get_config_entry(
+                    "phylanx.exec_time_fork_threshold", "5000000"));
+            return exec_fork_threshold;
+        }
+
+        // get number of samples a cost model needs before it is used
+        std::int64_t get_cost_model_min_samples()
+        {
+            static std::int64_t min_samples = std::stol(hpx::get_config_entry(
+                "phylanx.cost_model_min_samples", "5"));
+            return min_samples;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Decide based on the average eval time of the primitive instance
+        // (with some hysteresis), this is the default policy.
+        struct hysteresis_policy : scheduling_policy
+        {
+            eval_mode select(scheduling_data const& data) const override
+            {
+                if ((data.eval_count != 0 && data.measurements_enabled) ||
+                    (data.eval_count > get_ec_threshold()))
+                {
+                    std::int64_t exec_time =
+                        data.eval_duration / data.eval_count;
+                    if (exec_time > get_exec_upper_threshold())
+                    {
+                        return eval_mode::async;
+                    }
+                    else if (exec_time < get_exec_lower_threshold())
+                    {
+                        return eval_mode::sync;
+                    }
+                    return eval_mode::undecided;
+                }
+                return data.current_mode;
+            }
+        };
+
+        // Decide based on the eval time predicted by the cost model of the
+        // primitive type for the current input size. Small evaluations are
+        // run inline, large ones are forked to expose parallelism as early as
+        // possible.
+        struct cost_model_policy : hysteresis_policy
+        {
+            eval_mode select(scheduling_data const& data) const override
+            {
+                if (data.model == nullptr ||
+                    data.model->samples() < get_cost_model_min_samples())
+                {
+                    return this->hysteresis_policy::select(data);
+                }
+
+                double exec_time = data.model->predict(data.input_size);
+                if (exec_time < double(get_exec_lower_threshold()))
+                {
+                    return eval_mode::sync;
+                }
+                else if (exec_time > double(get_exec_fork_threshold()))
+                {
+                    return eval_mode::fork;
+                }
+                else if (exec_time > double(get_exec_upper_threshold()))
+                {
+                    return eval_mode::async;
+                }
+                return eval_mode::undecided;
+            }
+
+            bool needs_measurements() const override
+            {
+                return true;
+            }
+        };
+
+        // Always use the same execution mode
+        struct fixed_policy : scheduling_policy
+        {
+            explicit fixed_policy(eval_mode mode)
+              : mode_(mode)
+            {}
+
+            eval_mode select(scheduling_data const&) const override
+            {
+                return mode_;
+            }
+
+            eval_mode mode_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct scheduling_policies
+        {
+            using mutex_type = hpx::lcos::local::spinlock;
+
+            scheduling_policies()
+              : current_(nullptr)
+            {
+                policies_["hysteresis"] =
+                    std::make_shared<hysteresis_policy>();
+                policies_["cost_model"] =
+                    std::make_shared<cost_model_policy>();
+                policies_["sync"] =
+                    std::make_shared<fixed_policy>(eval_mode::sync);
+                policies_["async"] =
+                    std::make_shared<fixed_policy>(eval_mode::async);
+
+                current_name_ = hpx::get_config_entry(
+                    "phylanx.scheduling_policy", "hysteresis");
+
+                auto it = policies_.find(current_name_);
+                if (it == policies_.end())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::scheduling_policies",
+                        "unknown scheduling policy specified by "
+                            "phylanx.scheduling_policy: " + current_name_);
+                }
+                current_ = it->second.get();
+            }
+
+            mutex_type mtx_;
+            std::map<std::string, std::shared_ptr<scheduling_policy>>
+                policies_;
+
+            // policies that were replaced are kept alive as they might still
+            // be in use
+            std::vector<std::shared_ptr<scheduling_policy>> retired_;
+
+            std::string current_name_;
+            std::atomic<scheduling_policy const*> current_;
+        };
+
+        scheduling_policies& get_scheduling_policies()
+        {
+            static scheduling_policies policies;
+            return policies;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_scheduling_policy(std::string const& name,
+        std::shared_ptr<scheduling_policy> policy)
+    {
+        if (!policy)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::register_scheduling_policy",
+                "attempting to register an empty scheduling policy: " + name);
+        }
+
+        auto& policies = detail::get_scheduling_policies();
+
+        std::lock_guard<detail::scheduling_policies::mutex_type> l(
+            policies.mtx_);
+
+        auto& entry = policies.policies_[name];
+        if (entry)
+        {
+            policies.retired_.push_back(entry);
+        }
+        entry = std::move(policy);
+
+        if (policies.current_name_ == name)
+        {
+            policies.current_ = entry.get();
+        }
+    }
+
+    void set_scheduling_policy(std::string const& name)
+    {
+        auto& policies = detail::get_scheduling_policies();
+
+        std::lock_guard<detail::scheduling_policies::mutex_type> l(
+            policies.mtx_);
+
+        auto it = policies.policies_.find(name);
+        if (it == policies.policies_.end())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::set_scheduling_policy",
+                "unknown scheduling policy: " + name);
+        }
+
+        policies.current_name_ = name;
+        policies.current_ = it->second.get();
+    }
+
+    std::string get_scheduling_policy_name()
+    {
+        auto& policies = detail::get_scheduling_policies();
+
+        std::lock_guard<detail::scheduling_policies::mutex_type> l(
+            policies.mtx_);
+        return policies.current_name_;
+    }
+
+    std::vector<std::string> list_scheduling_policies()
+    {
+        auto& policies = detail::get_scheduling_policies();
+
+        std::lock_guard<detail::scheduling_policies::mutex_type> l(
+            policies.mtx_);
+
+        std::vector<std::string> result;
+        result.reserve(policies.policies_.size());
+        for (auto const& p : policies.policies_)
+        {
+            result.push_back(p.first);
+        }
+        return result;
+    }
+
+    scheduling_policy const& get_scheduling_policy()
+    {
+        return *detail::get_scheduling_policies().current_.load(
+            std::memory_order_acquire);
+    }
+}}
@@ -11,6 +11,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/ir/ranges.hpp>
 #include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/slicing_helpers.hpp>
 
 #include <hpx/util/assert.hpp>
 
@@ -21,8 +22,179 @@
 #include <utility>
 #include <vector>
 
+#include <blaze/Math.h>
+
 namespace phylanx { namespace execution_tree
 {
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // basic slicing indices are nil, a single integer, or a list of up
+        // to three integers (or nil)
+        bool is_basic_slicing_index(primitive_argument_type const& indices,
+            std::string const& name, std::string const& codename)
+        {
+            if (!valid(indices))
+            {
+                return true;
+            }
+
+            if (is_list_operand_strict(indices))
+            {
+                ir::range const& list = util::get<7>(indices);
+                if (list.is_xrange())
+                {
+                    return true;
+                }
+
+                for (auto const& index : list)
+                {
+                    if (valid(index) &&
+                        !(is_integer_operand_strict(index) &&
+                            extract_numeric_value_dimension(
+                                index, name, codename) == 0))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            return is_integer_operand_strict(indices) &&
+                extract_numeric_value_dimension(indices, name, codename) == 0;
+        }
+
+        // extract the consecutive range of elements described by the given
+        // indices, returns false if the indices describe anything else
+        bool extract_sparse_range(primitive_argument_type const& indices,
+            std::size_t size, ir::slicing_indices& range,
+            std::string const& name, std::string const& codename)
+        {
+            if (!is_basic_slicing_index(indices, name, codename))
+            {
+                return false;
+            }
+
+            range = util::slicing_helpers::extract_slicing(
+                indices, size, name, codename);
+
+            if (range.single_value())
+            {
+                return range.start() >= 0 &&
+                    range.start() < std::int64_t(size);
+            }
+
+            return range.step() == 1 && range.start() >= 0 &&
+                range.start() < range.stop() &&
+                range.stop() <= std::int64_t(size);
+        }
+
+        // slicing compressed data with consecutive ranges of indices keeps
+        // the data compressed, an invalid result is returned for all other
+        // slicing operations (those are performed on dense data)
+        primitive_argument_type slice_sparse(
+            ir::node_data<double> const& data,
+            primitive_argument_type const& indices, std::string const& name,
+            std::string const& codename)
+        {
+            using sparse_vector_type =
+                ir::node_data<double>::sparse_storage1d_type;
+            using sparse_matrix_type =
+                ir::node_data<double>::sparse_storage2d_type;
+
+            ir::slicing_indices range;
+            if (data.num_dimensions() == 1)
+            {
+                auto const& v = data.sparse_vector();
+                if (!extract_sparse_range(indices, v.size(), range, name,
+                        codename))
+                {
+                    return primitive_argument_type{};
+                }
+
+                if (range.single_value())
+                {
+                    return primitive_argument_type{double(v[range.start()])};
+                }
+
+                return primitive_argument_type{
+                    ir::node_data<double>{sparse_vector_type(blaze::subvector(
+                        v, range.start(), range.stop() - range.start()))}};
+            }
+
+            auto const& m = data.sparse_matrix();
+            if (!extract_sparse_range(indices, m.rows(), range, name, codename))
+            {
+                return primitive_argument_type{};
+            }
+
+            if (range.single_value())
+            {
+                return primitive_argument_type{
+                    ir::node_data<double>{sparse_vector_type(
+                        blaze::trans(blaze::row(m, range.start())))}};
+            }
+
+            return primitive_argument_type{
+                ir::node_data<double>{sparse_matrix_type(
+                    blaze::submatrix(m, range.start(), 0,
+                        range.stop() - range.start(), m.columns()))}};
+        }
+
+        primitive_argument_type slice_sparse(
+            ir::node_data<double> const& data,
+            primitive_argument_type const& rows,
+            primitive_argument_type const& columns, std::string const& name,
+            std::string const& codename)
+        {
+            using sparse_vector_type =
+                ir::node_data<double>::sparse_storage1d_type;
+            using sparse_matrix_type =
+                ir::node_data<double>::sparse_storage2d_type;
+
+            if (data.num_dimensions() != 2)
+            {
+                return primitive_argument_type{};
+            }
+
+            auto const& m = data.sparse_matrix();
+
+            ir::slicing_indices r, c;
+            if (!extract_sparse_range(rows, m.rows(), r, name, codename) ||
+                !extract_sparse_range(
+                    columns, m.columns(), c, name, codename))
+            {
+                return primitive_argument_type{};
+            }
+
+            if (r.single_value() && c.single_value())
+            {
+                return primitive_argument_type{double(m(r.start(), c.start()))};
+            }
+
+            if (r.single_value())
+            {
+                return primitive_argument_type{
+                    ir::node_data<double>{sparse_vector_type(
+                        blaze::trans(blaze::subvector(blaze::row(m, r.start()),
+                            c.start(), c.stop() - c.start())))}};
+            }
+
+            if (c.single_value())
+            {
+                return primitive_argument_type{
+                    ir::node_data<double>{sparse_vector_type(
+                        blaze::subvector(blaze::column(m, c.start()),
+                            r.start(), r.stop() - r.start()))}};
+            }
+
+            return primitive_argument_type{
+                ir::node_data<double>{sparse_matrix_type(
+                    blaze::submatrix(m, r.start(), c.start(),
+                        r.stop() - r.start(), c.stop() - c.start()))}};
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // return a slice of the given primitive_argument_type instance
     primitive_argument_type slice(primitive_argument_type const& data,
@@ -35,6 +207,16 @@ namespace phylanx { namespace execution_tree
                 extract_integer_value_strict(data, name, codename), indices,
                 name, codename)};
         }
+        if (is_sparse_operand(data))
+        {
+            auto result = detail::slice_sparse(
+                util::get<ir::node_data<double>>(data), indices, name,
+                codename);
+            if (valid(result))
+            {
+                return result;
+            }
+        }
         if (is_numeric_operand_strict(data))
         {
             return primitive_argument_type{slice_extract(
@@ -47,6 +229,18 @@ namespace phylanx { namespace execution_tree
                 extract_boolean_value_strict(data, name, codename), indices,
                 name, codename)};
         }
+        if (is_float32_operand_strict(data))
+        {
+            return primitive_argument_type{slice_extract(
+                extract_float32_value_strict(data, name, codename), indices,
+                name, codename)};
+        }
+        if (is_int32_operand_strict(data))
+        {
+            return primitive_argument_type{slice_extract(
+                extract_int32_value_strict(data, name, codename), indices,
+                name, codename)};
+        }
         if (is_list_operand_strict(data))
         {
             return slice_list(extract_list_value_strict(data, name, codename),
@@ -76,6 +270,16 @@ namespace phylanx { namespace execution_tree
                 extract_integer_value_strict(data, name, codename),
                 rows, columns, name, codename)};
         }
+        if (is_sparse_operand(data))
+        {
+            auto result = detail::slice_sparse(
+                util::get<ir::node_data<double>>(data), rows, columns, name,
+                codename);
+            if (valid(result))
+            {
+                return result;
+            }
+        }
         if (is_numeric_operand_strict(data))
         {
             return primitive_argument_type{slice_extract(
@@ -88,6 +292,18 @@ namespace phylanx { namespace execution_tree
                 extract_boolean_value_strict(data, name, codename),
                 rows, columns, name, codename)};
         }
+        if (is_float32_operand_strict(data))
+        {
+            return primitive_argument_type{slice_extract(
+                extract_float32_value_strict(data, name, codename),
+                rows, columns, name, codename)};
+        }
+        if (is_int32_operand_strict(data))
+        {
+            return primitive_argument_type{slice_extract(
+                extract_int32_value_strict(data, name, codename),
+                rows, columns, name, codename)};
+        }
 
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::execution_tree::slice",
@@ -121,6 +337,18 @@ namespace phylanx { namespace execution_tree
                 extract_boolean_value_strict(data, name, codename),
                 pages, rows, columns, name, codename)};
         }
+        if (is_float32_operand_strict(data))
+        {
+            return primitive_argument_type{slice_extract(
+                extract_float32_value_strict(data, name, codename),
+                pages, rows, columns, name, codename)};
+        }
+        if (is_int32_operand_strict(data))
+        {
+            return primitive_argument_type{slice_extract(
+                extract_int32_value_strict(data, name, codename),
+                pages, rows, columns, name, codename)};
+        }
 
         HPX_THROW_EXCEPTION(hpx::invalid_status,
             "phylanx::execution_tree::slice",
@@ -150,6 +150,16 @@ namespace phylanx { namespace execution_tree
         execution_tree::primitive_argument_type const& indices,
         std::string const& name, std::string const& codename);
 
+    template PHYLANX_EXPORT ir::node_data<float>
+    slice_extract<float>(ir::node_data<float> const& data,
+        execution_tree::primitive_argument_type const& indices,
+        std::string const& name, std::string const& codename);
+
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    slice_extract<std::int32_t>(ir::node_data<std::int32_t> const& data,
+        execution_tree::primitive_argument_type const& indices,
+        std::string const& name, std::string const& codename);
+
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     slice_extract<std::uint8_t>(ir::node_data<std::uint8_t> const& data,
         execution_tree::primitive_argument_type const& rows,
@@ -168,6 +178,18 @@ namespace phylanx { namespace execution_tree
         execution_tree::primitive_argument_type const& columns,
         std::string const& name, std::string const& codename);
 
+    template PHYLANX_EXPORT ir::node_data<float>
+    slice_extract<float>(ir::node_data<float> const& data,
+        execution_tree::primitive_argument_type const& rows,
+        execution_tree::primitive_argument_type const& columns,
+        std::string const& name, std::string const& codename);
+
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    slice_extract<std::int32_t>(ir::node_data<std::int32_t> const& data,
+        execution_tree::primitive_argument_type const& rows,
+        execution_tree::primitive_argument_type const& columns,
+        std::string const& name, std::string const& codename);
+
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
     template PHYLANX_EXPORT ir::node_data<std::uint8_t>
     slice_extract<std::uint8_t>(ir::node_data<std::uint8_t> const& data,
@@ -189,6 +211,20 @@ namespace phylanx { namespace execution_tree
         execution_tree::primitive_argument_type const& rows,
         execution_tree::primitive_argument_type const& columns,
         std::string const& name, std::string const& codename);
+
+    template PHYLANX_EXPORT ir::node_data<float>
+    slice_extract<float>(ir::node_data<float> const& data,
+        execution_tree::primitive_argument_type const& pages,
+        execution_tree::primitive_argument_type const& rows,
+        execution_tree::primitive_argument_type const& columns,
+        std::string const& name, std::string const& codename);
+
+    template PHYLANX_EXPORT ir::node_data<std::int32_t>
+    slice_extract<std::int32_t>(ir::node_data<std::int32_t> const& data,
+        execution_tree::primitive_argument_type const& pages,
+        execution_tree::primitive_argument_type const& rows,
+        execution_tree::primitive_argument_type const& columns,
+        std::string const& name, std::string const& codename);
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
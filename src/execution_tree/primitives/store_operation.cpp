@@ -9,6 +9,7 @@
 #include <phylanx/ast/detail/is_literal_value.hpp>
 #include <phylanx/execution_tree/primitives/store_operation.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/future_or_value.hpp>
 #include <phylanx/util/slicing_helpers.hpp>
 
 #include <hpx/include/lcos.hpp>
@@ -66,6 +67,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> store_operation::eval(
         primitive_arguments_type const& args, eval_context ctx) const
+    {
+        return eval_fov(args, std::move(ctx)).get_future();
+    }
+
+    util::future_or_value<primitive_argument_type> store_operation::eval_fov(
+        primitive_arguments_type const& args, eval_context ctx) const
     {
         if (operands_.size() != 2)
         {
@@ -107,24 +114,26 @@ namespace phylanx { namespace execution_tree { namespace primitives
             }
         }
 
-        auto f = value_operand(operands_[1], params, name_, codename_, ctx);
-        return f.then(hpx::launch::sync,
+        auto val =
+            value_operand_fov(operands_[1], params, name_, codename_, ctx);
+        return util::dataflow_or_value(
             [
                 this_ = std::move(this_),
                 lhs = extract_ref_value(operands_[0], name_, codename_),
                 args = std::move(params),
                 ctx = std::move(ctx)
             ]
-            (hpx::future<primitive_argument_type>&& val) mutable
+            (primitive_argument_type&& val) mutable
             ->  primitive_argument_type
             {
                 auto p = primitive_operand(
                     std::move(lhs), this_->name_, this_->codename_);
 
-                p.store(hpx::launch::sync, val.get(), std::move(args),
+                p.store(hpx::launch::sync, std::move(val), std::move(args),
                     std::move(ctx));
                 return primitive_argument_type{};
-            });
+            },
+            std::move(val));
     }
 
     hpx::future<primitive_argument_type> store_operation::eval(
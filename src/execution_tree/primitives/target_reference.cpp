@@ -50,9 +50,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive* p = util::get_if<primitive>(&operands_[0]);
         if (p != nullptr)
         {
-            hpx::error_code ec(hpx::lightweight);
-            target_ = hpx::get_ptr<primitive_component>(
-                hpx::launch::sync, p->get_id(), ec);
+            target_ = p->lightweight_component();
+            if (!target_)
+            {
+                hpx::error_code ec(hpx::lightweight);
+                target_ = hpx::get_ptr<primitive_component>(
+                    hpx::launch::sync, p->get_id(), ec);
+            }
         }
     }
 
@@ -73,6 +73,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     //////////////////////////////////////////////////////////////////////////
     hpx::future<primitive_argument_type> variable::eval(
         primitive_arguments_type const& args, eval_context ctx) const
+    {
+        return eval_fov(args, std::move(ctx)).get_future();
+    }
+
+    util::future_or_value<primitive_argument_type> variable::eval_fov(
+        primitive_arguments_type const& args, eval_context ctx) const
     {
         if (!value_set_ && !valid(bound_value_))
         {
@@ -93,25 +99,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
             if (args.size() == 2)
             {
                 // handle row/column-slicing
-                return hpx::make_ready_future(
-                    slice(target, args[0], args[1], name_, codename_));
+                return slice(target, args[0], args[1], name_, codename_);
             }
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
             if (args.size() > 2)
             {
                 // handle page/row/column-slicing
-                return hpx::make_ready_future(
-                    slice(target, args[0], args[1], args[2], name_, codename_));
+                return slice(
+                    target, args[0], args[1], args[2], name_, codename_);
             }
 #endif
             // handle row-slicing
-            return hpx::make_ready_future(
-                slice(target, args[0], name_, codename_));
+            return slice(target, args[0], name_, codename_);
         }
 
-        return hpx::make_ready_future(
-            extract_ref_value(target, name_, codename_));
+        return extract_ref_value(target, name_, codename_);
     }
 
     hpx::future<primitive_argument_type> variable::eval(
@@ -9,6 +9,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/util/serialization/blaze.hpp>
 #include <phylanx/util/serialization/variant.hpp>
+#include <phylanx/util/storage_pool.hpp>
 
 #include <hpx/exception.hpp>
 #include <hpx/include/serialization.hpp>
@@ -22,6 +23,7 @@
 #include <cstdint>
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -207,6 +209,16 @@ namespace phylanx { namespace ir
         increment_move_construction_count();
     }
 
+    template <typename T>
+    node_data<T>::node_data(custom_storage1d_type const& values,
+            std::shared_ptr<void const> keep_alive)
+      : data_(custom_storage1d_type{
+            const_cast<T*>(values.data()), values.size(), values.spacing()})
+      , keep_alive_(std::move(keep_alive))
+    {
+        increment_move_construction_count();
+    }
+
     // Create node data for a 2-dimensional value
     template <typename T>
     node_data<T>::node_data(storage2d_type const& values)
@@ -237,6 +249,16 @@ namespace phylanx { namespace ir
         increment_move_construction_count();
     }
 
+    template <typename T>
+    node_data<T>::node_data(custom_storage2d_type const& values,
+            std::shared_ptr<void const> keep_alive)
+      : data_(custom_storage2d_type{const_cast<T*>(values.data()),
+            values.rows(), values.columns(), values.spacing()})
+      , keep_alive_(std::move(keep_alive))
+    {
+        increment_move_construction_count();
+    }
+
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
     // Create node data for a 3-dimensional value
     template <typename T>
@@ -267,8 +289,47 @@ namespace phylanx { namespace ir
     {
         increment_move_construction_count();
     }
+
+    template <typename T>
+    node_data<T>::node_data(custom_storage3d_type const& values,
+            std::shared_ptr<void const> keep_alive)
+      : data_(custom_storage3d_type{const_cast<T*>(values.data()),
+            values.pages(), values.rows(), values.columns(), values.spacing()})
+      , keep_alive_(std::move(keep_alive))
+    {
+        increment_move_construction_count();
+    }
 #endif
 
+    // Create node data for a sparse 1- or 2-dimensional value
+    template <typename T>
+    node_data<T>::node_data(sparse_storage1d_type const& values)
+      : data_(std::make_shared<sparse_storage1d_type>(values))
+    {
+        increment_copy_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage1d_type&& values)
+      : data_(std::make_shared<sparse_storage1d_type>(std::move(values)))
+    {
+        increment_move_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type const& values)
+      : data_(std::make_shared<sparse_storage2d_type>(values))
+    {
+        increment_copy_construction_count();
+    }
+
+    template <typename T>
+    node_data<T>::node_data(sparse_storage2d_type&& values)
+      : data_(std::make_shared<sparse_storage2d_type>(std::move(values)))
+    {
+        increment_move_construction_count();
+    }
+
     // conversion helpers for Python bindings and AST parsing
     template <typename T>
     node_data<T>::node_data(std::vector<T> const& values)
@@ -330,8 +391,8 @@ namespace phylanx { namespace ir
     {
         switch (d.data_.index())
         {
-        case storage0d: HPX_FALLTHROUGH;
-        case storage1d: HPX_FALLTHROUGH;
+        case storage0d:         HPX_FALLTHROUGH;
+        case storage1d:         HPX_FALLTHROUGH;
         case storage2d:
             {
                 increment_copy_construction_count();
@@ -339,6 +400,22 @@ namespace phylanx { namespace ir
             }
             break;
 
+        case sparse_storage1d:
+            {
+                increment_copy_construction_count();
+                return std::make_shared<sparse_storage1d_type>(
+                    d.sparse_vector());
+            }
+            break;
+
+        case sparse_storage2d:
+            {
+                increment_copy_construction_count();
+                return std::make_shared<sparse_storage2d_type>(
+                    d.sparse_matrix());
+            }
+            break;
+
         case custom_storage0d:
             {
                 increment_move_construction_count();
@@ -393,16 +470,39 @@ namespace phylanx { namespace ir
     template <typename T>
     node_data<T>::node_data(node_data const& d)
       : data_(init_data_from(d))
+      , keep_alive_(d.keep_alive_)
     {
     }
 
     template <typename T>
     node_data<T>::node_data(node_data&& d)
       : data_(std::move(d.data_))
+      , keep_alive_(std::move(d.keep_alive_))
     {
         increment_move_construction_count();
     }
 
+    template <typename T>
+    node_data<T>::~node_data()
+    {
+        // recycle the memory of temporaries
+        switch (data_.index())
+        {
+        case storage1d:
+            util::storage_pool<T>::release(
+                std::move(util::get<storage1d>(data_)));
+            break;
+
+        case storage2d:
+            util::storage_pool<T>::release(
+                std::move(util::get<storage2d>(data_)));
+            break;
+
+        default:
+            break;
+        }
+    }
+
     template <typename T>
     node_data<T>& node_data<T>::operator=(storage0d_type val)
     {
@@ -528,6 +628,38 @@ namespace phylanx { namespace ir
     }
 #endif
 
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage1d_type const& val)
+    {
+        increment_copy_assignment_count();
+        data_ = std::make_shared<sparse_storage1d_type>(val);
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage1d_type && val)
+    {
+        increment_move_assignment_count();
+        data_ = std::make_shared<sparse_storage1d_type>(std::move(val));
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type const& val)
+    {
+        increment_copy_assignment_count();
+        data_ = std::make_shared<sparse_storage2d_type>(val);
+        return *this;
+    }
+
+    template <typename T>
+    node_data<T>& node_data<T>::operator=(sparse_storage2d_type && val)
+    {
+        increment_move_assignment_count();
+        data_ = std::make_shared<sparse_storage2d_type>(std::move(val));
+        return *this;
+    }
+
     // conversion helpers for Python bindings and AST parsing
     template <typename T>
     node_data<T>& node_data<T>::operator=(std::vector<T> const& values)
@@ -592,8 +724,8 @@ namespace phylanx { namespace ir
     {
         switch (d.data_.index())
         {
-        case storage0d: HPX_FALLTHROUGH;
-        case storage1d: HPX_FALLTHROUGH;
+        case storage0d:         HPX_FALLTHROUGH;
+        case storage1d:         HPX_FALLTHROUGH;
         case storage2d:
             {
                 increment_copy_assignment_count();
@@ -601,6 +733,22 @@ namespace phylanx { namespace ir
             }
             break;
 
+        case sparse_storage1d:
+            {
+                increment_copy_assignment_count();
+                return std::make_shared<sparse_storage1d_type>(
+                    d.sparse_vector());
+            }
+            break;
+
+        case sparse_storage2d:
+            {
+                increment_copy_assignment_count();
+                return std::make_shared<sparse_storage2d_type>(
+                    d.sparse_matrix());
+            }
+            break;
+
         case custom_storage0d:
             {
                 increment_move_assignment_count();
@@ -658,6 +806,7 @@ namespace phylanx { namespace ir
         if (this != &d)
         {
             data_ = copy_data_from(d);
+            keep_alive_ = d.keep_alive_;
         }
         return *this;
     }
@@ -669,6 +818,7 @@ namespace phylanx { namespace ir
         {
             increment_move_assignment_count();
             data_ = std::move(d.data_);
+            keep_alive_ = std::move(d.keep_alive_);
         }
         return *this;
     }
@@ -708,6 +858,14 @@ namespace phylanx { namespace ir
             break;
 #endif
 
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::operator[]()",
+                "node_data object holds sparse data that does not support "
+                "mutable element access");
+            break;
+
         default:
             break;
         }
@@ -740,6 +898,14 @@ namespace phylanx { namespace ir
             return tensor()(indicies[0], indicies[1], indicies[2]);
 #endif
 
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::operator[]()",
+                "node_data object holds sparse data that does not support "
+                "mutable element access");
+            break;
+
         default:
             break;
         }
@@ -767,6 +933,14 @@ namespace phylanx { namespace ir
         case custom_storage2d:
             return matrix()(index1, index2);
 
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::at()",
+                "node_data object holds sparse data that does not support "
+                "mutable element access");
+            break;
+
         default:
             break;
         }
@@ -798,6 +972,14 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return tensor()(index1, index2, index3);
 
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::at()",
+                "node_data object holds sparse data that does not support "
+                "mutable element access");
+            break;
+
         default:
             break;
         }
@@ -842,6 +1024,17 @@ namespace phylanx { namespace ir
             break;
 #endif
 
+        case sparse_storage1d:
+            return sparse_vector()[index];
+
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                std::size_t idx_m = index / m.columns();
+                std::size_t idx_n = index % m.columns();
+                return m(idx_m, idx_n);
+            }
+
         default:
             break;
         }
@@ -874,6 +1067,12 @@ namespace phylanx { namespace ir
             return tensor()(indicies[0], indicies[1], indicies[2]);
 #endif
 
+        case sparse_storage1d:
+            return sparse_vector()[indicies[0]];
+
+        case sparse_storage2d:
+            return sparse_matrix()(indicies[0], indicies[1]);
+
         default:
             break;
         }
@@ -901,6 +1100,12 @@ namespace phylanx { namespace ir
         case custom_storage2d:
             return matrix()(index1, index2);
 
+        case sparse_storage1d:
+            return sparse_vector()[index1];
+
+        case sparse_storage2d:
+            return sparse_matrix()(index1, index2);
+
         default:
             break;
         }
@@ -932,6 +1137,12 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return tensor()(index1, index2, index3);
 
+        case sparse_storage1d:
+            return sparse_vector()[index1];
+
+        case sparse_storage2d:
+            return sparse_matrix()(index1, index2);
+
         default:
             break;
         }
@@ -971,6 +1182,15 @@ namespace phylanx { namespace ir
             }
 #endif
 
+        case sparse_storage1d:
+            return sparse_vector().size();
+
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                return m.rows() * m.columns();
+            }
+
         default:
             break;
         }
@@ -1752,6 +1972,157 @@ namespace phylanx { namespace ir
         return *s;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type& node_data<T>::sparse_matrix()
+    {
+        shared_sparse_storage2d_type* m =
+            util::get_if<shared_sparse_storage2d_type>(&data_);
+        if (m == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_matrix()",
+                "node_data object does not hold a sparse matrix");
+        }
+
+        // the data is about to be modified, detach from other instances
+        // referring to it
+        if (m->use_count() != 1)
+        {
+            *m = std::make_shared<sparse_storage2d_type>(**m);
+        }
+        return **m;
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage2d_type const&
+    node_data<T>::sparse_matrix() const
+    {
+        shared_sparse_storage2d_type const* m =
+            util::get_if<shared_sparse_storage2d_type>(&data_);
+        if (m == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_matrix()",
+                "node_data object does not hold a sparse matrix");
+        }
+        return **m;
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type& node_data<T>::sparse_vector()
+    {
+        shared_sparse_storage1d_type* v =
+            util::get_if<shared_sparse_storage1d_type>(&data_);
+        if (v == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_vector()",
+                "node_data object does not hold a sparse vector");
+        }
+
+        // the data is about to be modified, detach from other instances
+        // referring to it
+        if (v->use_count() != 1)
+        {
+            *v = std::make_shared<sparse_storage1d_type>(**v);
+        }
+        return **v;
+    }
+
+    template <typename T>
+    typename node_data<T>::sparse_storage1d_type const&
+    node_data<T>::sparse_vector() const
+    {
+        shared_sparse_storage1d_type const* v =
+            util::get_if<shared_sparse_storage1d_type>(&data_);
+        if (v == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::sparse_vector()",
+                "node_data object does not hold a sparse vector");
+        }
+        return **v;
+    }
+
+    template <typename T>
+    bool node_data<T>::is_sparse() const
+    {
+        return data_.index() == sparse_storage1d ||
+            data_.index() == sparse_storage2d;
+    }
+
+    template <typename T>
+    std::size_t node_data<T>::nonzeros() const
+    {
+        switch (data_.index())
+        {
+        case storage0d:         HPX_FALLTHROUGH;
+        case custom_storage0d:
+            return scalar() != T(0) ? 1 : 0;
+
+        case storage1d:         HPX_FALLTHROUGH;
+        case custom_storage1d:
+            return vector().nonZeros();
+
+        case storage2d:         HPX_FALLTHROUGH;
+        case custom_storage2d:
+            return matrix().nonZeros();
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+        case storage3d:         HPX_FALLTHROUGH;
+        case custom_storage3d:
+            return tensor().nonZeros();
+#endif
+        case sparse_storage1d:
+            return sparse_vector().nonZeros();
+
+        case sparse_storage2d:
+            return sparse_matrix().nonZeros();
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::invalid_status,
+            "phylanx::ir::node_data<T>::nonzeros()",
+            "node_data object holds unsupported data type");
+    }
+
+    template <typename T>
+    node_data<T> node_data<T>::to_dense() const&
+    {
+        switch (data_.index())
+        {
+        case sparse_storage1d:
+            return node_data<T>{storage1d_type(sparse_vector())};
+
+        case sparse_storage2d:
+            return node_data<T>{storage2d_type(sparse_matrix())};
+
+        default:
+            break;
+        }
+        return ref();
+    }
+
+    template <typename T>
+    node_data<T> node_data<T>::to_dense() &&
+    {
+        switch (data_.index())
+        {
+        case sparse_storage1d:
+            return node_data<T>{storage1d_type(sparse_vector())};
+
+        case sparse_storage2d:
+            return node_data<T>{storage2d_type(sparse_matrix())};
+
+        default:
+            break;
+        }
+        return std::move(*this);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// Extract the dimensionality of the underlying data array.
     template <typename T>
@@ -1776,6 +2147,12 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return 3;
 #endif
+        case sparse_storage1d:
+            return 1;
+
+        case sparse_storage2d:
+            return 2;
+
         default:
             break;
         }
@@ -1814,6 +2191,15 @@ namespace phylanx { namespace ir
                 return dimensions_type{t.pages(), t.rows(), t.columns()};
             }
 #endif
+        case sparse_storage1d:
+            return dimensions_type{sparse_vector().size()};
+
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                return dimensions_type{m.rows(), m.columns()};
+            }
+
         default:
             break;
         }
@@ -1892,6 +2278,40 @@ namespace phylanx { namespace ir
                 }
             }
 #endif
+        case sparse_storage1d:
+            {
+                switch (dim)
+                {
+                case 0:
+                    return sparse_vector().size();
+
+                default:
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::ir::node_data<T>::dimension()",
+                        "unknown dimension requested");
+                    break;
+                }
+            }
+
+        case sparse_storage2d:
+            {
+                auto const& m = sparse_matrix();
+                switch (dim)
+                {
+                case 0:
+                    return m.rows();
+
+                case 1:
+                    return m.columns();
+
+                default:
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::ir::node_data<T>::dimension()",
+                        "unknown dimension requested");
+                    break;
+                }
+            }
+
         default:
             break;
         }
@@ -1928,6 +2348,15 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return *this;
 #endif
+        // compressed storage is shared, it is copied on modification
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            {
+                node_data<T> result;
+                result.data_ = data_;
+                return result;
+            }
+
         default:
             break;
         }
@@ -1963,6 +2392,15 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return *this;
 #endif
+        // compressed storage is shared, it is copied on modification
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            {
+                node_data<T> result;
+                result.data_ = data_;
+                return result;
+            }
+
         default:
             break;
         }
@@ -2015,6 +2453,10 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return node_data<T>{tensor_copy()};
 #endif
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            return *this;
+
         default:
             break;
         }
@@ -2048,6 +2490,10 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return true;
 #endif
+        case sparse_storage1d:  HPX_FALLTHROUGH;
+        case sparse_storage2d:
+            return false;
+
         default:
             break;
         }
@@ -2070,6 +2516,12 @@ namespace phylanx { namespace ir
                 return std::vector<T>(v.begin(), v.end());
             }
 
+        case sparse_storage1d:
+            {
+                storage1d_type v(sparse_vector());
+                return std::vector<T>(v.begin(), v.end());
+            }
+
         case storage0d:         HPX_FALLTHROUGH;
         case storage2d:         HPX_FALLTHROUGH;
         case custom_storage0d:  HPX_FALLTHROUGH;
@@ -2104,6 +2556,17 @@ namespace phylanx { namespace ir
                 return result;
             }
 
+        case sparse_storage2d:
+            {
+                storage2d_type m(sparse_matrix());
+                std::vector<std::vector<T>> result(m.rows());
+                for (std::size_t i = 0; i != m.rows(); ++i)
+                {
+                    result[i].assign(m.begin(i), m.end(i));
+                }
+                return result;
+            }
+
         case storage0d:         HPX_FALLTHROUGH;
         case storage1d:         HPX_FALLTHROUGH;
         case custom_storage0d:  HPX_FALLTHROUGH;
@@ -2170,6 +2633,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return lhs.to_dense() == rhs.to_dense();
+        }
+
         switch (lhs.index())
         {
         case node_data<double>::storage0d:          HPX_FALLTHROUGH;
@@ -2207,6 +2675,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return lhs.to_dense() == rhs.to_dense();
+        }
+
         switch (lhs.index())
         {
         case node_data<std::uint8_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2244,6 +2717,11 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return lhs.to_dense() == rhs.to_dense();
+        }
+
         switch (lhs.index())
         {
         case node_data<std::int64_t>::storage0d:          HPX_FALLTHROUGH;
@@ -2298,6 +2776,12 @@ namespace phylanx { namespace ir
             return false;
         }
 
+        if (lhs.is_sparse() || rhs.is_sparse())
+        {
+            return allclose(lhs.to_dense(), rhs.to_dense(), rtol, atol,
+                equal_nan);
+        }
+
         auto isclose = detail::isclose{atol, rtol, equal_nan};
 
         switch (lhs.index())
@@ -2419,6 +2903,11 @@ namespace phylanx { namespace ir
                 }
                 break;
 #endif
+            case node_data<double>::sparse_storage1d: HPX_FALLTHROUGH;
+            case node_data<double>::sparse_storage2d:
+                out << nd.to_dense();
+                break;
+
             default:
                 throw std::runtime_error("invalid dimensionality: " +
                     std::to_string(nd.num_dimensions()));
@@ -2474,6 +2963,11 @@ namespace phylanx { namespace ir
                 }
                 break;
 #endif
+            case node_data<std::int64_t>::sparse_storage1d: HPX_FALLTHROUGH;
+            case node_data<std::int64_t>::sparse_storage2d:
+                out << nd.to_dense();
+                break;
+
             default:
                 throw std::runtime_error("invalid dimensionality: " +
                     std::to_string(nd.num_dimensions()));
@@ -2531,6 +3025,11 @@ namespace phylanx { namespace ir
                 }
                 break;
 #endif
+            case node_data<std::uint8_t>::sparse_storage1d: HPX_FALLTHROUGH;
+            case node_data<std::uint8_t>::sparse_storage2d:
+                out << nd.to_dense();
+                break;
+
             default:
                 throw std::runtime_error("invalid dimensionality: " +
                     std::to_string(nd.num_dimensions()));
@@ -2549,6 +3048,140 @@ namespace phylanx { namespace ir
         return out;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // float and std::int32_t share the generic implementations below
+    namespace detail
+    {
+        template <typename T>
+        bool equal(node_data<T> const& lhs, node_data<T> const& rhs)
+        {
+            if (lhs.num_dimensions() != rhs.num_dimensions() ||
+                lhs.dimensions() != rhs.dimensions())
+            {
+                return false;
+            }
+
+            if (lhs.is_sparse() || rhs.is_sparse())
+            {
+                return lhs.to_dense() == rhs.to_dense();
+            }
+
+            switch (lhs.index())
+            {
+            case node_data<T>::storage0d:          HPX_FALLTHROUGH;
+            case node_data<T>::custom_storage0d:
+                return lhs.scalar() == rhs.scalar();
+
+            case node_data<T>::storage1d:          HPX_FALLTHROUGH;
+            case node_data<T>::custom_storage1d:
+                return lhs.vector() == rhs.vector();
+
+            case node_data<T>::storage2d:          HPX_FALLTHROUGH;
+            case node_data<T>::custom_storage2d:
+                return lhs.matrix() == rhs.matrix();
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            case node_data<T>::storage3d:          HPX_FALLTHROUGH;
+            case node_data<T>::custom_storage3d:
+                return lhs.tensor() == rhs.tensor();
+#endif
+            default:
+                break;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::invalid_status,
+                "phylanx::ir::node_data<T>::operator==()",
+                "node_data object holds unsupported data type");
+        }
+
+        template <typename T>
+        std::ostream& print(std::ostream& out, node_data<T> const& nd)
+        {
+            auto f = [&]()
+            {
+                switch (nd.index())
+                {
+                case node_data<T>::storage0d:          HPX_FALLTHROUGH;
+                case node_data<T>::custom_storage0d:
+                    out << nd.scalar();
+                    break;
+
+                case node_data<T>::storage1d:          HPX_FALLTHROUGH;
+                case node_data<T>::custom_storage1d:
+                    detail::print_array<T>(out, nd.vector(), nd.size());
+                    break;
+
+                case node_data<T>::storage2d:          HPX_FALLTHROUGH;
+                case node_data<T>::custom_storage2d:
+                    {
+                        auto m = nd.matrix();
+                        detail::print_matrix<T>(out, m, m.rows(), m.columns());
+                    }
+                    break;
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+                case node_data<T>::storage3d:          HPX_FALLTHROUGH;
+                case node_data<T>::custom_storage3d:
+                    {
+                        auto t = nd.tensor();
+                        detail::print_tensor<T>(
+                            out, t, t.pages(), t.rows(), t.columns());
+                    }
+                    break;
+#endif
+                case node_data<T>::sparse_storage1d: HPX_FALLTHROUGH;
+                case node_data<T>::sparse_storage2d:
+                    out << nd.to_dense();
+                    break;
+
+                default:
+                    throw std::runtime_error("invalid dimensionality: " +
+                        std::to_string(nd.num_dimensions()));
+                }
+            };
+
+            if (hpx::threads::get_self_ptr() != nullptr)
+            {
+                hpx::util::ignore_all_while_checking ignore;
+                hpx::threads::run_as_os_thread(f).get();
+            }
+            else
+            {
+                f();
+            }
+            return out;
+        }
+    }
+
+    bool operator==(node_data<float> const& lhs, node_data<float> const& rhs)
+    {
+        return detail::equal(lhs, rhs);
+    }
+
+    bool operator==(
+        node_data<std::int32_t> const& lhs, node_data<std::int32_t> const& rhs)
+    {
+        return detail::equal(lhs, rhs);
+    }
+
+    bool allclose(node_data<float> const& lhs, node_data<float> const& rhs,
+        double rtol, double atol, bool equal_nan)
+    {
+        return allclose(node_data<double>{lhs}, node_data<double>{rhs}, rtol,
+            atol, equal_nan);
+    }
+
+    std::ostream& operator<<(std::ostream& out, node_data<float> const& nd)
+    {
+        return detail::print(out, nd);
+    }
+
+    std::ostream& operator<<(
+        std::ostream& out, node_data<std::int32_t> const& nd)
+    {
+        return detail::print(out, nd);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     node_data<T>::operator bool() const
@@ -2572,6 +3205,12 @@ namespace phylanx { namespace ir
         case custom_storage3d:
             return tensor().nonZeros() != 0;
 #endif
+        case sparse_storage1d:
+            return sparse_vector().nonZeros() != 0;
+
+        case sparse_storage2d:
+            return sparse_matrix().nonZeros() != 0;
+
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<double>::operator bool",
@@ -2623,6 +3262,14 @@ namespace phylanx { namespace ir
             ar << util::get<custom_storage3d>(data_);
             break;
 #endif
+        case sparse_storage1d:
+            ar << *util::get<sparse_storage1d>(data_);
+            break;
+
+        case sparse_storage2d:
+            ar << *util::get<sparse_storage2d>(data_);
+            break;
+
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
@@ -2676,6 +3323,22 @@ namespace phylanx { namespace ir
             }
             break;
 #endif
+        case sparse_storage1d:
+            {
+                auto v = std::make_shared<sparse_storage1d_type>();
+                ar >> *v;
+                data_ = std::move(v);
+            }
+            break;
+
+        case sparse_storage2d:
+            {
+                auto m = std::make_shared<sparse_storage2d_type>();
+                ar >> *m;
+                data_ = std::move(m);
+            }
+            break;
+
         default:
             HPX_THROW_EXCEPTION(hpx::invalid_status,
                 "node_data<T>::serialize",
@@ -2687,3 +3350,5 @@ namespace phylanx { namespace ir
 template class PHYLANX_EXPORT phylanx::ir::node_data<double>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::uint8_t>;
 template class PHYLANX_EXPORT phylanx::ir::node_data<std::int64_t>;
+template class PHYLANX_EXPORT phylanx::ir::node_data<float>;
+template class PHYLANX_EXPORT phylanx::ir::node_data<std::int32_t>;
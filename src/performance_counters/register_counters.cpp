@@ -8,7 +8,9 @@
 #include <phylanx/execution_tree/compile.hpp>
 #include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/execution_tree/primitives/primitive_component.hpp>
+#include <phylanx/execution_tree/primitives/scheduling_policy.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/util/storage_pool.hpp>
 
 #include <hpx/include/agas.hpp>
 #include <hpx/include/components.hpp>
@@ -67,20 +69,32 @@ namespace phylanx { namespace performance_counters
     public:
         primitive_counter()
           : first_init_(false)
-          , duration_counter_(false)
+          , counter_type_(eval_count_counter)
+          , decision_(execution_tree::eval_mode::undecided)
         {}
 
         primitive_counter(hpx::performance_counters::counter_info const& info)
           : hpx::performance_counters::base_performance_counter<
                 primitive_counter>(info)
           , first_init_(false)
-          , duration_counter_(false)
+          , counter_type_(eval_count_counter)
+          , decision_(execution_tree::eval_mode::undecided)
         {
             hpx::performance_counters::counter_path_elements paths;
             hpx::performance_counters::get_counter_path_elements(
                 info.fullname_, paths);
-            duration_counter_ =
-                paths.countername_.find("time") != std::string::npos;
+
+            std::string const& name = paths.countername_;
+            if (name.find("time") != std::string::npos)
+            {
+                counter_type_ = eval_duration_counter;
+            }
+            else if (name.find("count/eval_") != std::string::npos)
+            {
+                counter_type_ = eval_decisions_counter;
+                decision_ = extract_eval_mode(
+                    name.substr(name.find("count/eval_") + 11));
+            }
         }
 
         // Produce the counter value
@@ -106,14 +120,7 @@ namespace phylanx { namespace performance_counters
             // Extract the values from instances_
             for (auto const& instance : instances_)
             {
-                if (duration_counter_)
-                {
-                    result.push_back(instance->get_eval_duration(reset));
-                }
-                else
-                {
-                    result.push_back(instance->get_eval_count(reset));
-                }
+                result.push_back(get_value(*instance, reset));
             }
 
             value.values_ = std::move(result);
@@ -149,14 +156,7 @@ namespace phylanx { namespace performance_counters
                 // Consider the reset flag
                 if (reset)
                 {
-                    if (duration_counter_)
-                    {
-                        instance->get_eval_duration(true);
-                    }
-                    else
-                    {
-                        instance->get_eval_count(true);
-                    }
+                    get_value(*instance, true);
                 }
                 instances_sorted[instance_info.sequence_number] = instance;
             }
@@ -176,9 +176,55 @@ namespace phylanx { namespace performance_counters
         using base_primitive_ptr = std::shared_ptr<
             phylanx::execution_tree::primitives::primitive_component>;
 
+        enum counter_type
+        {
+            eval_count_counter,         // .../count/eval
+            eval_duration_counter,      // .../time/eval
+            eval_decisions_counter      // .../count/eval_<mode>
+        };
+
+        static execution_tree::eval_mode extract_eval_mode(
+            std::string const& name)
+        {
+            if (name == "sync")
+            {
+                return execution_tree::eval_mode::sync;
+            }
+            if (name == "async")
+            {
+                return execution_tree::eval_mode::async;
+            }
+            if (name == "fork")
+            {
+                return execution_tree::eval_mode::fork;
+            }
+            return execution_tree::eval_mode::undecided;
+        }
+
+        std::int64_t get_value(
+            phylanx::execution_tree::primitives::primitive_component const&
+                instance,
+            bool reset) const
+        {
+            switch (counter_type_)
+            {
+            case eval_duration_counter:
+                return instance.get_eval_duration(reset);
+
+            case eval_decisions_counter:
+                return instance.get_eval_decisions(decision_, reset);
+
+            case eval_count_counter: HPX_FALLTHROUGH;
+            default:
+                break;
+            }
+            return instance.get_eval_count(reset);
+        }
+
         std::vector<base_primitive_ptr> instances_;
         std::atomic<bool> first_init_;
-        bool duration_counter_;
+        counter_type counter_type_;
+        execution_tree::eval_mode decision_;
     };
 
     hpx::naming::gid_type primitive_counter_creator(
@@ -426,6 +472,29 @@ namespace phylanx { namespace performance_counters
             "returns the current value of the move-assignment count of "
                 "any node_data<double>");
 
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/storage_pool/count/hits",
+            &util::storage_pool_hit_count,
+            "returns the number of temporaries whose storage was served from "
+                "the storage pool");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/storage_pool/count/misses",
+            &util::storage_pool_miss_count,
+            "returns the number of temporaries whose storage had to be "
+                "allocated as the storage pool had no matching entry");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/storage_pool/count/releases",
+            &util::storage_pool_release_count,
+            "returns the number of containers returned to the storage pool");
+
+        hpx::performance_counters::install_counter_type(
+            "/phylanx/storage_pool/count/discards",
+            &util::storage_pool_discard_count,
+            "returns the number of containers freed as the storage pool "
+                "was full");
+
         // Iterate and register a time and count performance counter per each
         // primitive
         namespace et = phylanx::execution_tree;
@@ -459,11 +528,26 @@ namespace phylanx { namespace performance_counters
             hpx::performance_counters::install_counter_type(
                 "/phylanx/primitives/" + name + "/eval_direct",
                 hpx::performance_counters::counter_raw_values,
-                "returns a list whose elements contain whether "
-                    "the eval function for the " + name + " primitive "
-                    "was executed directly",
+                "returns a list whose elements contain how the eval "
+                    "function for each " + name + " primitive was "
+                    "scheduled last time (-1: as requested, 0: async, "
+                    "1: directly, 2: fork)",
                 &direct_execution_counter_creator,
                 &hpx::performance_counters::locality_counter_discoverer);
+
+            // Register the scheduling decision performance counters
+            for (char const* mode : {"sync", "async", "fork", "default"})
+            {
+                hpx::performance_counters::install_counter_type(
+                    "/phylanx/primitives/" + name + "/count/eval_" + mode,
+                    hpx::performance_counters::counter_raw_values,
+                    "returns a list whose elements contain the number of "
+                        "times the scheduling policy decided to run the eval "
+                        "function of each " + name + " primitive using the '" +
+                        mode + "' execution mode",
+                    &primitive_counter_creator,
+                    &hpx::performance_counters::locality_counter_discoverer);
+            }
         }
     }
 }}
@@ -133,6 +133,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
     hpx::future<primitive_argument_type> add_operation::eval(
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args, eval_context ctx) const
+    {
+        return eval_fov(operands, args, std::move(ctx)).get_future();
+    }
+
+    util::future_or_value<primitive_argument_type> add_operation::eval_fov(
+        primitive_arguments_type const& params, eval_context ctx) const
+    {
+        if (this->no_operands())
+        {
+            return eval_fov(params, noargs, std::move(ctx));
+        }
+        return eval_fov(this->operands(), params, std::move(ctx));
+    }
+
+    util::future_or_value<primitive_argument_type> add_operation::eval_fov(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
     {
         if (operands.size() < 2)
         {
@@ -161,24 +178,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
         auto this_ = this->shared_from_this();
         if (operands.size() == 2)
         {
-            // special case for 2 operands
-            return hpx::dataflow(hpx::launch::sync,
-                [this_ = std::move(this_)](
-                    hpx::future<primitive_argument_type>&& lhs,
-                    hpx::future<primitive_argument_type>&& rhs)
+            // special case for 2 operands, avoid creating intermediate
+            // futures if the operands are available already
+            return util::dataflow_or_value(
+                [this_ = std::move(this_)](primitive_argument_type&& lhs,
+                    primitive_argument_type&& rhs)
                 -> primitive_argument_type
                 {
-                    auto && lhs_val = lhs.get();
-                    if (is_list_operand_strict(lhs_val))
+                    if (is_list_operand_strict(lhs))
                     {
                         return this_->handle_list_operands(
-                            std::move(lhs_val), rhs.get());
+                            std::move(lhs), std::move(rhs));
                     }
                     return this_->handle_numeric_operands(
-                        std::move(lhs_val), rhs.get());
+                        std::move(lhs), std::move(rhs));
                 },
-                value_operand(operands[0], args, name_, codename_, ctx),
-                value_operand(operands[1], args, name_, codename_, ctx));
+                value_operand_fov(operands[0], args, name_, codename_, ctx),
+                value_operand_fov(operands[1], args, name_, codename_, ctx));
         }
 
         return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
@@ -195,4 +211,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 operands, functional::value_operand{}, args,
                 name_, codename_, std::move(ctx)));
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type add_operation::handle_sparse_operands(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        // The sum of two sparse arrays of the same shape is stored in
+        // compressed format, everything else is performed on dense data
+        if (is_sparse_operand(op1) && is_sparse_operand(op2))
+        {
+            auto lhs = util::get<ir::node_data<double>>(std::move(op1));
+            auto const& rhs = util::get<ir::node_data<double>>(op2);
+
+            if (lhs.dimensions() == rhs.dimensions())
+            {
+                if (lhs.num_dimensions() == 1)
+                {
+                    lhs.sparse_vector() += rhs.sparse_vector();
+                }
+                else
+                {
+                    lhs.sparse_matrix() += rhs.sparse_matrix();
+                }
+                return primitive_argument_type{std::move(lhs)};
+            }
+
+            op1 = primitive_argument_type{std::move(lhs)};
+        }
+
+        return this->base_type::handle_sparse_operands(
+            std::move(op1), std::move(op2));
+    }
 }}}
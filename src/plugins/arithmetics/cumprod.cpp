@@ -56,6 +56,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return T(1);
             }
 
+            template <typename T>
+            T operator()(T lhs, T rhs) const
+            {
+                return T(lhs * rhs);
+            }
+
             template <typename InIter, typename OutIter, typename T>
             OutIter operator()(
                 InIter begin, InIter end, OutIter dest, T init) const
@@ -94,4 +94,32 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::string const& name, std::string const& codename)
       : base_type(std::move(operands), name, codename)
     {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type div_operation::handle_sparse_operands(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        // dividing a sparse array by a scalar keeps the result in compressed
+        // format, everything else is performed on dense data
+        if (is_sparse_operand(op1) && !is_sparse_operand(op2) &&
+            extract_numeric_value_dimension(op2, name_, codename_) == 0)
+        {
+            auto lhs = util::get<ir::node_data<double>>(std::move(op1));
+            double rhs = extract_scalar_numeric_value(
+                std::move(op2), name_, codename_);
+
+            if (lhs.num_dimensions() == 1)
+            {
+                lhs.sparse_vector() /= rhs;
+            }
+            else
+            {
+                lhs.sparse_matrix() /= rhs;
+            }
+            return primitive_argument_type{std::move(lhs)};
+        }
+
+        return this->base_type::handle_sparse_operands(
+            std::move(op1), std::move(op2));
+    }
 }}}
@@ -0,0 +1,999 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
+#include <phylanx/execution_tree/primitives/primitive_component.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/arithmetics/fused_elementwise_operation.hpp>
+#include <phylanx/util/storage_pool.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    match_pattern_type const fused_elementwise_operation::match_data =
+    {
+        match_pattern_type{"__elementwise",
+            std::vector<std::string>{"__elementwise(_1, __2)"},
+            &create_fused_elementwise_operation,
+            &create_primitive<fused_elementwise_operation>, R"(
+            program, x0
+            Args:
+
+                 program (string): the sequence of elementwise operations to
+                    apply, in reverse polish notation ('$N' refers to the Nth
+                    argument in x0, '+', '-', '*', '/', 'neg', 'absolute',
+                    'square', 'sqrt', 'exp', 'log', 'sin', 'cos', and 'tanh'
+                    are the supported operations, one of '<', '<=', '>',
+                    '>=', '==', and '!=' may be used as the last operation)
+                *x0 (number list): the arguments the operations are applied to
+
+            Returns:
+
+            The result of applying all operations in a single pass over the
+            arguments (this primitive is normally generated by the compiler
+            for chains of elementwise operations).)"
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    fused_elementwise_operation::fused_elementwise_operation(
+            primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , num_leaves_(0)
+      , max_depth_(0)
+      , applies_functions_(false)
+      , divides_(false)
+      , compares_(false)
+    {
+        if (operands_.size() < 2 || !is_string_operand_strict(operands_[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise_operation::fused_elementwise_operation",
+                generate_error_message(
+                    "the __elementwise primitive requires a program (string) "
+                    "and at least one argument"));
+        }
+
+        parse_program(extract_string_value_strict(
+            std::move(operands_[0]), name_, codename_));
+
+        // from here on the operands are the leaves of the program only
+        operands_.erase(operands_.begin());
+
+        if (operands_.size() != num_leaves_)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise_operation::fused_elementwise_operation",
+                generate_error_message(
+                    "the number of arguments does not match the number of "
+                    "values referenced by the program"));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the operations supported in programs
+        struct elementwise_operation
+        {
+            char const* token_;
+            fused_elementwise_operation::opcode code_;
+            std::size_t arity_;
+        };
+
+        using opcode = fused_elementwise_operation::opcode;
+
+        elementwise_operation const elementwise_operations[] =
+        {
+            {"+", opcode::add, 2}, {"-", opcode::sub, 2},
+            {"*", opcode::mul, 2}, {"/", opcode::div, 2},
+            {"neg", opcode::neg, 1},
+            {"absolute", opcode::absolute, 1}, {"square", opcode::square, 1},
+            {"sqrt", opcode::sqrt, 1}, {"exp", opcode::exp, 1},
+            {"log", opcode::log, 1}, {"sin", opcode::sin, 1},
+            {"cos", opcode::cos, 1}, {"tanh", opcode::tanh, 1},
+            {"<", opcode::less, 2}, {"<=", opcode::less_equal, 2},
+            {">", opcode::greater, 2}, {">=", opcode::greater_equal, 2},
+            {"==", opcode::equal, 2}, {"!=", opcode::not_equal, 2}
+        };
+
+        bool is_function(opcode code)
+        {
+            return code >= opcode::absolute && code < opcode::less;
+        }
+
+        bool is_comparison(opcode code)
+        {
+            return code >= opcode::less;
+        }
+    }
+
+    void fused_elementwise_operation::parse_program(std::string const& program)
+    {
+        std::istringstream strm(program);
+        std::vector<bool> seen;
+        std::size_t depth = 0;
+
+        std::string token;
+        while (strm >> token)
+        {
+            // a comparison has to be the last operation
+            if (compares_)
+            {
+                depth = std::size_t(-1);
+                break;
+            }
+
+            instruction instr{opcode::load, 0};
+            if (token[0] == '$')
+            {
+                instr.leaf_ = std::stoul(token.substr(1));
+                if (instr.leaf_ >= seen.size())
+                {
+                    seen.resize(instr.leaf_ + 1, false);
+                }
+                if (seen[instr.leaf_])
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "fused_elementwise_operation::parse_program",
+                        generate_error_message(
+                            "each argument can be referenced only once: " +
+                                program));
+                }
+                seen[instr.leaf_] = true;
+                max_depth_ = (std::max)(max_depth_, ++depth);
+            }
+            else
+            {
+                auto it = std::find_if(
+                    std::begin(detail::elementwise_operations),
+                    std::end(detail::elementwise_operations),
+                    [&](detail::elementwise_operation const& op)
+                    {
+                        return token == op.token_;
+                    });
+
+                if (it == std::end(detail::elementwise_operations))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "fused_elementwise_operation::parse_program",
+                        generate_error_message(
+                            "unknown operation '" + token + "' in program: " +
+                                program));
+                }
+
+                if (depth < it->arity_)
+                {
+                    depth = std::size_t(-1);
+                    break;
+                }
+                depth -= it->arity_ - 1;
+
+                instr.code_ = it->code_;
+                applies_functions_ =
+                    applies_functions_ || detail::is_function(instr.code_);
+                divides_ = divides_ || instr.code_ == opcode::div;
+                compares_ = detail::is_comparison(instr.code_);
+            }
+            program_.push_back(instr);
+        }
+
+        if (depth != 1 ||
+            std::find(seen.begin(), seen.end(), false) != seen.end())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise_operation::parse_program",
+                generate_error_message("malformed program: " + program));
+        }
+
+        num_leaves_ = seen.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // number of elements processed by each step of the program at a time,
+        // the temporaries for one block of all stack levels stay in the L1
+        constexpr std::size_t elementwise_block_size = 256;
+
+        // minimal number of elements processed by one task if the program is
+        // run concurrently
+        constexpr std::size_t elementwise_chunk_size = 16384;
+
+        // minimal number of elements for a program to be run concurrently,
+        // zero disables the concurrent execution
+        std::size_t elementwise_threshold()
+        {
+            static std::size_t const threshold = []() -> std::size_t {
+                try
+                {
+                    return std::stoull(hpx::get_config_entry(
+                        "phylanx.elementwise.threshold", "65536"));
+                }
+                catch (std::exception const&)
+                {
+                    return 65536;
+                }
+            }();
+            return threshold;
+        }
+
+        template <typename T, typename F>
+        void apply_unary(T* arg, std::size_t n, F&& f)
+        {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                arg[i] = f(arg[i]);
+            }
+        }
+
+        template <typename T, typename F>
+        void apply_binary(T* lhs, T const* rhs, std::size_t n, F&& f)
+        {
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                lhs[i] = f(lhs[i], rhs[i]);
+            }
+        }
+
+        // Run the given program over 'count' consecutive elements. Leaves
+        // referring to a scalar are represented by a nullptr in 'ptrs'.
+        template <typename T, typename R>
+        void run_elementwise_program(
+            std::vector<fused_elementwise_operation::instruction> const&
+                program,
+            R* result, std::size_t count, std::vector<T const*> const& ptrs,
+            std::vector<T> const& scalars, T* stack)
+        {
+            using opcode = fused_elementwise_operation::opcode;
+            constexpr std::size_t block = elementwise_block_size;
+
+            for (std::size_t base = 0; base < count; base += block)
+            {
+                std::size_t const n = (std::min)(block, count - base);
+                T* top = stack;
+
+                for (auto const& instr : program)
+                {
+                    if (instr.code_ == opcode::load)
+                    {
+                        T const* src = ptrs[instr.leaf_];
+                        if (src == nullptr)
+                        {
+                            std::fill(top, top + n, scalars[instr.leaf_]);
+                        }
+                        else
+                        {
+                            std::copy(src + base, src + base + n, top);
+                        }
+                        top += block;
+                        continue;
+                    }
+
+                    T* arg = top - block;
+                    switch (instr.code_)
+                    {
+                    case opcode::neg:
+                        apply_unary(arg, n, [](T x) -> T { return -x; });
+                        continue;
+
+                    case opcode::absolute:
+                        apply_unary(
+                            arg, n, [](T x) -> T { return T(std::abs(x)); });
+                        continue;
+
+                    case opcode::square:
+                        apply_unary(arg, n, [](T x) -> T { return x * x; });
+                        continue;
+
+                    case opcode::sqrt:
+                        apply_unary(
+                            arg, n, [](T x) -> T { return T(std::sqrt(x)); });
+                        continue;
+
+                    case opcode::exp:
+                        apply_unary(
+                            arg, n, [](T x) -> T { return T(std::exp(x)); });
+                        continue;
+
+                    case opcode::log:
+                        apply_unary(
+                            arg, n, [](T x) -> T { return T(std::log(x)); });
+                        continue;
+
+                    case opcode::sin:
+                        apply_unary(
+                            arg, n, [](T x) -> T { return T(std::sin(x)); });
+                        continue;
+
+                    case opcode::cos:
+                        apply_unary(
+                            arg, n, [](T x) -> T { return T(std::cos(x)); });
+                        continue;
+
+                    case opcode::tanh:
+                        apply_unary(
+                            arg, n, [](T x) -> T { return T(std::tanh(x)); });
+                        continue;
+
+                    default:
+                        break;
+                    }
+
+                    // all remaining operations combine the two topmost values
+                    top -= block;
+                    T* lhs = top - block;
+                    switch (instr.code_)
+                    {
+                    case opcode::add:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x + y; });
+                        break;
+
+                    case opcode::sub:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x - y; });
+                        break;
+
+                    case opcode::mul:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x * y; });
+                        break;
+
+                    case opcode::div:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x / y; });
+                        break;
+
+                    case opcode::less:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x < y ? 1 : 0; });
+                        break;
+
+                    case opcode::less_equal:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x <= y ? 1 : 0; });
+                        break;
+
+                    case opcode::greater:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x > y ? 1 : 0; });
+                        break;
+
+                    case opcode::greater_equal:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x >= y ? 1 : 0; });
+                        break;
+
+                    case opcode::equal:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x == y ? 1 : 0; });
+                        break;
+
+                    case opcode::not_equal:
+                        apply_binary(lhs, top, n,
+                            [](T x, T y) -> T { return x != y ? 1 : 0; });
+                        break;
+
+                    default:
+                        HPX_ASSERT(false);
+                        break;
+                    }
+                }
+
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    result[base + i] = R(stack[i]);
+                }
+            }
+        }
+
+        // Run the given program over all elements of an array of 'rows'
+        // rows holding 'columns' elements each. Row r of the result starts
+        // at result + r * result_spacing, row r of leaf i starts at
+        // data[i] + r * spacing[i] (leaves referring to a scalar are
+        // represented by a nullptr). Large arrays are split into chunks
+        // which are processed concurrently, each chunk uses its own stack.
+        template <typename T, typename R>
+        void run_elementwise_program(
+            std::vector<fused_elementwise_operation::instruction> const&
+                program,
+            std::size_t max_depth, R* result, std::size_t result_spacing,
+            std::size_t rows, std::size_t columns,
+            std::vector<T const*> const& data,
+            std::vector<std::size_t> const& spacing,
+            std::vector<T> const& scalars)
+        {
+            // process the elements [begin, end) of the rows [first, last)
+            auto run = [&](std::size_t first, std::size_t last,
+                std::size_t begin, std::size_t end)
+            {
+                std::vector<T> stack(max_depth * elementwise_block_size);
+                std::vector<T const*> ptrs(data.size(), nullptr);
+                for (std::size_t row = first; row != last; ++row)
+                {
+                    for (std::size_t i = 0; i != data.size(); ++i)
+                    {
+                        if (data[i] != nullptr)
+                        {
+                            ptrs[i] = data[i] + row * spacing[i] + begin;
+                        }
+                    }
+                    run_elementwise_program(program,
+                        result + row * result_spacing + begin, end - begin,
+                        ptrs, scalars, stack.data());
+                }
+            };
+
+            std::size_t const size = rows * columns;
+            std::size_t const threshold = elementwise_threshold();
+            if (threshold == 0 || size < threshold ||
+                hpx::get_os_thread_count() == 1)
+            {
+                run(0, rows, 0, columns);
+                return;
+            }
+
+            if (columns >= elementwise_chunk_size)
+            {
+                // long rows are split into several chunks
+                std::size_t const chunks =
+                    (columns + elementwise_chunk_size - 1) /
+                    elementwise_chunk_size;
+
+                hpx::parallel::for_loop(hpx::parallel::execution::par,
+                    std::size_t(0), rows * chunks,
+                    [&](std::size_t n)
+                    {
+                        std::size_t const row = n / chunks;
+                        std::size_t const begin =
+                            (n % chunks) * elementwise_chunk_size;
+                        run(row, row + 1, begin,
+                            (std::min)(begin + elementwise_chunk_size,
+                                columns));
+                    });
+            }
+            else
+            {
+                // short rows are combined into chunks
+                std::size_t const height =
+                    (elementwise_chunk_size + columns - 1) / columns;
+                std::size_t const chunks = (rows + height - 1) / height;
+
+                hpx::parallel::for_loop(hpx::parallel::execution::par,
+                    std::size_t(0), chunks,
+                    [&](std::size_t n)
+                    {
+                        std::size_t const first = n * height;
+                        run(first, (std::min)(first + height, rows), 0,
+                            columns);
+                    });
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Allocate the storage for the result, the memory of the argument
+        // 'reuse' (if any) is reused if the result has the same type.
+        template <typename T, typename R>
+        struct elementwise_result
+        {
+            static typename ir::node_data<R>::storage1d_type vector(
+                std::vector<ir::node_data<T>>&, std::size_t,
+                std::size_t size)
+            {
+                return util::storage_pool<R>::vector(size);
+            }
+
+            static typename ir::node_data<R>::storage2d_type matrix(
+                std::vector<ir::node_data<T>>&, std::size_t,
+                std::size_t rows, std::size_t columns)
+            {
+                return util::storage_pool<R>::matrix(rows, columns);
+            }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            static typename ir::node_data<R>::storage3d_type tensor(
+                std::vector<ir::node_data<T>>&, std::size_t,
+                std::size_t pages, std::size_t rows, std::size_t columns)
+            {
+                return typename ir::node_data<R>::storage3d_type(
+                    pages, rows, columns);
+            }
+#endif
+        };
+
+        template <typename T>
+        struct elementwise_result<T, T>
+        {
+            static typename ir::node_data<T>::storage1d_type vector(
+                std::vector<ir::node_data<T>>& leaves, std::size_t reuse,
+                std::size_t size)
+            {
+                if (reuse != std::size_t(-1))
+                {
+                    return std::move(leaves[reuse]).vector_copy();
+                }
+                return util::storage_pool<T>::vector(size);
+            }
+
+            static typename ir::node_data<T>::storage2d_type matrix(
+                std::vector<ir::node_data<T>>& leaves, std::size_t reuse,
+                std::size_t rows, std::size_t columns)
+            {
+                if (reuse != std::size_t(-1))
+                {
+                    return std::move(leaves[reuse]).matrix_copy();
+                }
+                return util::storage_pool<T>::matrix(rows, columns);
+            }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            static typename ir::node_data<T>::storage3d_type tensor(
+                std::vector<ir::node_data<T>>& leaves, std::size_t reuse,
+                std::size_t pages, std::size_t rows, std::size_t columns)
+            {
+                if (reuse != std::size_t(-1))
+                {
+                    return std::move(leaves[reuse]).tensor_copy();
+                }
+                return typename ir::node_data<T>::storage3d_type(
+                    pages, rows, columns);
+            }
+#endif
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    primitive_argument_type fused_elementwise_operation::evaluate_fused(
+        primitive_arguments_type&& args) const
+    {
+        std::size_t const numdims =
+            extract_largest_dimension(args, name_, codename_);
+        auto const sizes = extract_largest_dimensions(args, name_, codename_);
+
+        // convert all arguments to the common type, scalars stay scalars,
+        // everything else is broadcast to the shape of the result
+        std::vector<ir::node_data<T>> leaves;
+        leaves.reserve(args.size());
+
+        std::vector<T> scalars(args.size(), T(0));
+        std::vector<bool> is_scalar(args.size(), false);
+
+        for (std::size_t i = 0; i != args.size(); ++i)
+        {
+            if (extract_numeric_value_dimension(args[i], name_, codename_) == 0)
+            {
+                is_scalar[i] = true;
+                scalars[i] = extract_value_scalar<T>(
+                    std::move(args[i]), name_, codename_).scalar();
+                leaves.emplace_back();
+                continue;
+            }
+
+            switch (numdims)
+            {
+            case 1:
+                leaves.emplace_back(extract_value_vector<T>(
+                    std::move(args[i]), sizes[0], name_, codename_));
+                break;
+
+            case 2:
+                leaves.emplace_back(extract_value_matrix<T>(
+                    std::move(args[i]), sizes[0], sizes[1], name_, codename_));
+                break;
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            case 3:
+                leaves.emplace_back(extract_value_tensor<T>(std::move(args[i]),
+                    sizes[0], sizes[1], sizes[2], name_, codename_));
+                break;
+#endif
+            default:
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "fused_elementwise_operation::evaluate_fused",
+                    generate_error_message(
+                        "operand has unsupported number of dimensions"));
+            }
+        }
+
+        // the result of a comparison is a boolean array
+        if (compares_)
+        {
+            return run_fused<T, std::uint8_t>(numdims, sizes,
+                std::move(leaves), scalars, std::size_t(-1));
+        }
+
+        // reuse the memory of the first argument we're allowed to overwrite,
+        // all reads of a block happen before the result is written to it
+        std::size_t reuse = std::size_t(-1);
+        for (std::size_t i = 0; i != leaves.size(); ++i)
+        {
+            if (!is_scalar[i] && !leaves[i].is_ref())
+            {
+                reuse = i;
+                break;
+            }
+        }
+
+        return run_fused<T, T>(
+            numdims, sizes, std::move(leaves), scalars, reuse);
+    }
+
+    template <typename T, typename R>
+    primitive_argument_type fused_elementwise_operation::run_fused(
+        std::size_t numdims,
+        std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& sizes,
+        std::vector<ir::node_data<T>>&& leaves,
+        std::vector<T> const& scalars, std::size_t reuse) const
+    {
+        using result_type = detail::elementwise_result<T, R>;
+
+        // Leaves referring to a scalar are represented by an empty node_data.
+        // The data of the leaves is located before the result is allocated,
+        // the storage of a reused leaf is moved into the result, i.e. it
+        // stays at the same location.
+        std::vector<T const*> data(leaves.size(), nullptr);
+        std::vector<std::size_t> spacing(leaves.size(), 0);
+
+        switch (numdims)
+        {
+        case 0:
+            {
+                std::vector<T> stack(
+                    max_depth_ * detail::elementwise_block_size);
+                R result = R(0);
+                detail::run_elementwise_program(
+                    program_, &result, 1, data, scalars, stack.data());
+                return primitive_argument_type{ir::node_data<R>{result}};
+            }
+
+        case 1:
+            {
+                for (std::size_t i = 0; i != leaves.size(); ++i)
+                {
+                    if (leaves[i].num_dimensions() != 0)
+                    {
+                        data[i] = leaves[i].vector().data();
+                    }
+                }
+
+                typename ir::node_data<R>::storage1d_type result =
+                    result_type::vector(leaves, reuse, sizes[0]);
+
+                detail::run_elementwise_program(program_, max_depth_,
+                    result.data(), sizes[0], 1, sizes[0], data, spacing,
+                    scalars);
+                return primitive_argument_type{
+                    ir::node_data<R>{std::move(result)}};
+            }
+
+        case 2:
+            {
+                // rows are padded, the program is run row by row
+                for (std::size_t i = 0; i != leaves.size(); ++i)
+                {
+                    if (leaves[i].num_dimensions() != 0)
+                    {
+                        auto m = leaves[i].matrix();
+                        data[i] = m.data();
+                        spacing[i] = m.spacing();
+                    }
+                }
+
+                typename ir::node_data<R>::storage2d_type result =
+                    result_type::matrix(leaves, reuse, sizes[0], sizes[1]);
+
+                detail::run_elementwise_program(program_, max_depth_,
+                    result.data(), result.spacing(), sizes[0], sizes[1],
+                    data, spacing, scalars);
+                return primitive_argument_type{
+                    ir::node_data<R>{std::move(result)}};
+            }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+        case 3:
+            {
+                // the rows of all pages are laid out one after the other,
+                // each of them is padded
+                for (std::size_t i = 0; i != leaves.size(); ++i)
+                {
+                    if (leaves[i].num_dimensions() != 0)
+                    {
+                        auto t = leaves[i].tensor();
+                        data[i] = t.data();
+                        spacing[i] = t.spacing();
+                    }
+                }
+
+                typename ir::node_data<R>::storage3d_type result =
+                    result_type::tensor(
+                        leaves, reuse, sizes[0], sizes[1], sizes[2]);
+
+                detail::run_elementwise_program(program_, max_depth_,
+                    result.data(), result.spacing(), sizes[0] * sizes[1],
+                    sizes[2], data, spacing, scalars);
+                return primitive_argument_type{
+                    ir::node_data<R>{std::move(result)}};
+            }
+#endif
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "fused_elementwise_operation::run_fused",
+            generate_error_message(
+                "operand has unsupported number of dimensions"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Return whether the program divides two integer values, based on
+        // the types of the given leaves.
+        bool divides_integers(
+            std::vector<fused_elementwise_operation::instruction> const&
+                program,
+            primitive_arguments_type const& leaves)
+        {
+            std::vector<bool> integral;
+            for (auto const& instr : program)
+            {
+                if (instr.code_ == opcode::load)
+                {
+                    node_data_type const t =
+                        extract_common_type(leaves[instr.leaf_]);
+                    integral.push_back(t == node_data_type_int64 ||
+                        t == node_data_type_int32);
+                }
+                else if (is_function(instr.code_))
+                {
+                    integral.back() = false;
+                }
+                else if (instr.code_ != opcode::neg)
+                {
+                    bool const rhs = integral.back();
+                    integral.pop_back();
+                    if (instr.code_ == opcode::div && rhs && integral.back())
+                    {
+                        return true;
+                    }
+                    integral.back() = integral.back() && rhs;
+                }
+            }
+            return false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Arguments not supported by the fused kernel (booleans, lists, mixed
+    // types, etc.) are handled by evaluating the program as a tree of the
+    // primitives that would have been used without fusion. This guarantees
+    // identical semantics. The leaves of the tree access the arguments the
+    // tree is evaluated with.
+    primitive const& fused_elementwise_operation::unfused_program() const
+    {
+        if (!has_unfused_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!has_unfused_.load(std::memory_order_relaxed))
+            {
+                unfused_ = create_unfused_program();
+                has_unfused_.store(true, std::memory_order_release);
+            }
+        }
+        return unfused_;
+    }
+
+    primitive fused_elementwise_operation::create_unfused_program() const
+    {
+        // the comparison primitives live in a different plugin, they are
+        // created by name as all other primitives
+        static char const* const comparisons[] = {
+            "__lt", "__le", "__gt", "__ge", "__eq", "__ne"
+        };
+
+        std::vector<primitive> stack;
+        stack.reserve(max_depth_);
+
+        for (auto const& instr : program_)
+        {
+            primitive_arguments_type ops;
+            std::string type;
+            std::string name = name_;
+
+            if (instr.code_ == opcode::load)
+            {
+                ops.emplace_back(ir::node_data<std::int64_t>{
+                    static_cast<std::int64_t>(instr.leaf_)});
+                type = "access-argument";
+            }
+            else
+            {
+                auto it = std::find_if(
+                    std::begin(detail::elementwise_operations),
+                    std::end(detail::elementwise_operations),
+                    [&](detail::elementwise_operation const& op)
+                    {
+                        return op.code_ == instr.code_;
+                    });
+                HPX_ASSERT(it != std::end(detail::elementwise_operations));
+
+                ops.reserve(it->arity_);
+                for (std::size_t i = stack.size() - it->arity_;
+                     i != stack.size(); ++i)
+                {
+                    ops.emplace_back(std::move(stack[i]));
+                }
+                stack.resize(stack.size() - it->arity_);
+
+                switch (instr.code_)
+                {
+                case opcode::add:
+                    type = "__add";
+                    break;
+
+                case opcode::sub:
+                    type = "__sub";
+                    break;
+
+                case opcode::mul:
+                    type = "__mul";
+                    break;
+
+                case opcode::div:
+                    type = "__div";
+                    break;
+
+                case opcode::neg:
+                    type = "__minus";
+                    break;
+
+                default:
+                    if (detail::is_function(instr.code_))
+                    {
+                        // the generic operations derive the function from
+                        // their name
+                        type = name = it->token_;
+                    }
+                    else
+                    {
+                        type = comparisons[std::size_t(instr.code_) -
+                            std::size_t(opcode::less)];
+                    }
+                    break;
+                }
+            }
+
+            stack.emplace_back(primitive_component::create_lightweight(
+                type, std::move(ops), name, codename_, false));
+        }
+
+        HPX_ASSERT(stack.size() == 1);
+        return std::move(stack.back());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> fused_elementwise_operation::evaluate(
+        primitive_arguments_type&& leaves, eval_context ctx) const
+    {
+        // the fused kernel handles floating point and integer values only
+        for (auto const& leaf : leaves)
+        {
+            if (!is_numeric_operand_strict(leaf) &&
+                !is_float32_operand_strict(leaf) &&
+                !is_integer_operand_strict(leaf) &&
+                !is_int32_operand_strict(leaf))
+            {
+                return unfused_program().eval(
+                    std::move(leaves), std::move(ctx));
+            }
+        }
+
+        // The elementwise functions always produce float64 values and
+        // comparisons of 32 bit values are left to the comparison primitives.
+        node_data_type const type = extract_common_type(leaves);
+        bool fuse = !applies_functions_ || type == node_data_type_double;
+        if (fuse && compares_)
+        {
+            for (auto const& leaf : leaves)
+            {
+                node_data_type const t = extract_common_type(leaf);
+                if (t == node_data_type_float32 || t == node_data_type_int32)
+                {
+                    fuse = false;
+                    break;
+                }
+            }
+        }
+
+        // integer divisions must not be evaluated as floating point divisions
+        if (fuse && divides_ &&
+            (type == node_data_type_double || type == node_data_type_float32))
+        {
+            fuse = !detail::divides_integers(program_, leaves);
+        }
+
+        if (!fuse)
+        {
+            return unfused_program().eval(std::move(leaves), std::move(ctx));
+        }
+
+        switch (type)
+        {
+        case node_data_type_float32:
+            return hpx::make_ready_future(
+                evaluate_fused<float>(std::move(leaves)));
+
+        case node_data_type_int64:
+            return hpx::make_ready_future(
+                evaluate_fused<std::int64_t>(std::move(leaves)));
+
+        case node_data_type_int32:
+            return hpx::make_ready_future(
+                evaluate_fused<std::int32_t>(std::move(leaves)));
+
+        default:
+            break;
+        }
+        return hpx::make_ready_future(
+            evaluate_fused<double>(std::move(leaves)));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> fused_elementwise_operation::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != num_leaves_)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "fused_elementwise_operation::eval",
+                generate_error_message(
+                    "the number of arguments does not match the number of "
+                    "values referenced by the program"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+            [this_ = std::move(this_), ctx](primitive_arguments_type&& leaves)
+            ->  hpx::future<primitive_argument_type>
+            {
+                return this_->evaluate(std::move(leaves), ctx);
+            }),
+            detail::map_operands(
+                operands, functional::value_operand{}, args,
+                name_, codename_, ctx));
+    }
+}}}
@@ -158,10 +158,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic0d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -186,10 +188,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic1d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -214,10 +218,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic2d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -243,10 +249,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic3d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
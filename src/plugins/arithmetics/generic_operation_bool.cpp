@@ -114,10 +114,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic0d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -141,10 +143,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic1d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -168,10 +172,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic2d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
@@ -196,10 +202,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         switch (t)
         {
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return generic3d_bool(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
         case node_data_type_bool:
         case node_data_type_unknown:
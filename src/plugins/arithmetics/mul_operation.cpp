@@ -164,6 +164,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template primitive_argument_type
     mul_operation::handle_numeric_operands_helper<double>(
         primitive_arguments_type&& ops) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<float>(
+        primitive_arguments_type&& ops) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<std::int32_t>(
+        primitive_arguments_type&& ops) const;
 
     template <typename T>
     primitive_argument_type mul_operation::handle_numeric_operands_helper(
@@ -182,4 +188,79 @@ namespace phylanx { namespace execution_tree { namespace primitives
     template primitive_argument_type
     mul_operation::handle_numeric_operands_helper<double>(
         primitive_argument_type&& op1, primitive_argument_type&& op2) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<float>(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const;
+    template primitive_argument_type
+    mul_operation::handle_numeric_operands_helper<std::int32_t>(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type mul_operation::handle_sparse_operands(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        // element-wise multiplication is commutative, make sure the sparse
+        // operand is always the first one
+        if (!is_sparse_operand(op1))
+        {
+            std::swap(op1, op2);
+        }
+
+        auto lhs = util::get<ir::node_data<double>>(std::move(op1));
+
+        // multiplying with a scalar or with an array of the same shape never
+        // introduces new non-zero elements, the result stays sparse
+        if (!is_sparse_operand(op2))
+        {
+            auto rhs = extract_numeric_value(std::move(op2), name_, codename_);
+            if (rhs.num_dimensions() == 0)
+            {
+                if (lhs.num_dimensions() == 1)
+                {
+                    lhs.sparse_vector() *= rhs.scalar();
+                }
+                else
+                {
+                    lhs.sparse_matrix() *= rhs.scalar();
+                }
+                return primitive_argument_type{std::move(lhs)};
+            }
+
+            if (lhs.dimensions() == rhs.dimensions())
+            {
+                // read only access, avoids detaching shared sparse data
+                auto const& clhs = lhs;
+                if (lhs.num_dimensions() == 1)
+                {
+                    return primitive_argument_type{ir::node_data<double>{
+                        ir::node_data<double>::sparse_storage1d_type(
+                            clhs.sparse_vector() * rhs.vector())}};
+                }
+                return primitive_argument_type{ir::node_data<double>{
+                    ir::node_data<double>::sparse_storage2d_type(
+                        clhs.sparse_matrix() % rhs.matrix())}};
+            }
+
+            op2 = primitive_argument_type{std::move(rhs)};
+        }
+        else
+        {
+            auto const& rhs = util::get<ir::node_data<double>>(op2);
+            if (lhs.dimensions() == rhs.dimensions())
+            {
+                if (lhs.num_dimensions() == 1)
+                {
+                    auto const& clhs = lhs;
+                    return primitive_argument_type{ir::node_data<double>{
+                        ir::node_data<double>::sparse_storage1d_type(
+                            clhs.sparse_vector() * rhs.sparse_vector())}};
+                }
+                lhs.sparse_matrix() %= rhs.sparse_matrix();
+                return primitive_argument_type{std::move(lhs)};
+            }
+        }
+
+        return this->base_type::handle_sparse_operands(
+            primitive_argument_type{std::move(lhs)}, std::move(op2));
+    }
 }}}
@@ -60,4 +60,35 @@ namespace phylanx { namespace execution_tree { namespace primitives
             std::string const& name, std::string const& codename)
       : base_type(std::move(operands), name, codename)
     {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type sub_operation::handle_sparse_operands(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        // The difference of two sparse arrays of the same shape is stored in
+        // compressed format, everything else is performed on dense data
+        if (is_sparse_operand(op1) && is_sparse_operand(op2))
+        {
+            auto lhs = util::get<ir::node_data<double>>(std::move(op1));
+            auto const& rhs = util::get<ir::node_data<double>>(op2);
+
+            if (lhs.dimensions() == rhs.dimensions())
+            {
+                if (lhs.num_dimensions() == 1)
+                {
+                    lhs.sparse_vector() -= rhs.sparse_vector();
+                }
+                else
+                {
+                    lhs.sparse_matrix() -= rhs.sparse_matrix();
+                }
+                return primitive_argument_type{std::move(lhs)};
+            }
+
+            op1 = primitive_argument_type{std::move(lhs)};
+        }
+
+        return this->base_type::handle_sparse_operands(
+            std::move(op1), std::move(op2));
+    }
 }}}
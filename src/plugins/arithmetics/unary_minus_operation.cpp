@@ -117,6 +117,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg0d(extract_value_scalar<std::int64_t>(
                 std::move(op), name_, codename_));
 
+        case node_data_type_int32:
+            return neg0d(extract_value_scalar<std::int32_t>(
+                std::move(op), name_, codename_));
+
+        case node_data_type_float32:
+            return neg0d(
+                extract_value_scalar<float>(std::move(op), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg0d(
@@ -151,6 +159,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg1d(extract_value_vector<std::int64_t>(
                 std::move(op), sizes[0], name_, codename_));
 
+        case node_data_type_int32:
+            return neg1d(extract_value_vector<std::int32_t>(
+                std::move(op), sizes[0], name_, codename_));
+
+        case node_data_type_float32:
+            return neg1d(extract_value_vector<float>(
+                std::move(op), sizes[0], name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg1d(extract_value_vector<double>(
@@ -185,6 +201,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return neg2d(extract_value_matrix<std::int64_t>(
                 std::move(op), sizes[0], sizes[1], name_, codename_));
 
+        case node_data_type_int32:
+            return neg2d(extract_value_matrix<std::int32_t>(
+                std::move(op), sizes[0], sizes[1], name_, codename_));
+
+        case node_data_type_float32:
+            return neg2d(extract_value_matrix<float>(
+                std::move(op), sizes[0], sizes[1], name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return neg2d(extract_value_matrix<double>(
@@ -37,6 +37,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(logical_unary_not_operation_plugin,
     phylanx::execution_tree::primitives::unary_not_operation::match_data[1]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(where_plugin,
     phylanx::execution_tree::primitives::nonzero_where::match_data[1]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(where_compare_plugin,
+    phylanx::execution_tree::primitives::nonzero_where::match_data[2]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(xor_operation_plugin,
     phylanx::execution_tree::primitives::xor_operation::match_data[0]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(logical_xor_operation_plugin,
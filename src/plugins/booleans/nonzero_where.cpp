@@ -4,9 +4,18 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/broadcasting.hpp>
 #include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/booleans/equal.hpp>
+#include <phylanx/plugins/booleans/greater.hpp>
+#include <phylanx/plugins/booleans/greater_equal.hpp>
+#include <phylanx/plugins/booleans/less.hpp>
+#include <phylanx/plugins/booleans/less_equal.hpp>
 #include <phylanx/plugins/booleans/nonzero_where.hpp>
+#include <phylanx/plugins/booleans/not_equal.hpp>
+#include <phylanx/util/parallel_scan.hpp>
+#include <phylanx/util/storage_pool.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -14,9 +23,10 @@
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 
-#include <array>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -35,12 +45,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             arg
             Args:
 
-                arg (vector or matrix) : a vector or matrix
+                arg (vector, matrix, or tensor) : a vector, matrix, or tensor
 
             Returns:
 
-            A 1D array containing the indices of the elements of `arg` that are
-            non-zero.
+            A list of 1D arrays (one for each dimension of `arg`) containing
+            the indices of the elements of `arg` that are non-zero.
             )"
         },
 
@@ -74,12 +84,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
       : primitive_component_base(std::move(operands), name, codename)
       , nonzero_(false)
       , where_(false)
+      , comparison_(comparison_kind::none)
     {
         auto func_name = compiler::extract_primitive_name(name_);
         if (func_name == "nonzero")
         {
             nonzero_ = true;
         }
+        else if (func_name == "__where_compare")
+        {
+            where_ = true;
+            comparison_ = extract_comparison_kind();
+
+            // from here on the operands are the arguments of the comparison
+            // and the values to select from only
+            operands_.erase(operands_.begin());
+        }
         else
         {
             HPX_ASSERT(func_name == "where");
@@ -87,364 +107,284 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
     }
 
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename T>
-    primitive_argument_type nonzero_where::nonzero_elements(
-        ir::node_data<T> && op) const
+    nonzero_where::comparison_kind nonzero_where::extract_comparison_kind()
+        const
     {
-        using storage1d_type =
-            typename ir::node_data<std::int64_t>::storage1d_type;
-
-        std::size_t dims = op.num_dimensions();
-        switch (dims)
+        if (operands_.size() != 5 || !is_string_operand_strict(operands_[0]))
         {
-        case 0:
-            {
-                storage1d_type indices(
-                    op.scalar() != T(0) ? 1 : 0, std::int64_t(0));
-
-                primitive_arguments_type result;
-                result.reserve(1);
-                result.emplace_back(std::move(indices));
-                return primitive_argument_type{std::move(result)};
-            }
-
-        case 1:
-            {
-                auto v = op.vector();
-                storage1d_type indices(v.size());
-                std::size_t count = 0;
-                for (std::size_t i = 0; i != v.size(); ++i)
-                {
-                    if (v[i] != T(0))
-                    {
-                        indices[count++] = std::int64_t(i);
-                    }
-                }
-                indices.resize(count);
-                indices.shrinkToFit();
-
-                primitive_arguments_type result;
-                result.reserve(1);
-                result.emplace_back(std::move(indices));
-                return primitive_argument_type{std::move(result)};
-            }
-
-        case 2:
-            {
-                auto m = op.matrix();
-                storage1d_type indices_row(op.size());
-                storage1d_type indices_column(op.size());
-                std::size_t count = 0;
-
-                for (std::size_t i = 0; i != m.rows(); ++i)
-                {
-                    for (std::size_t j = 0; j != m.columns(); ++j)
-                    {
-                        if (m(i, j) != T(0))
-                        {
-                            indices_row[count] = std::int64_t(i);
-                            indices_column[count++] = std::int64_t(j);
-                        }
-                    }
-                }
-
-                indices_row.resize(count);
-                indices_row.shrinkToFit();
-
-                indices_column.resize(count);
-                indices_column.shrinkToFit();
-
-                primitive_arguments_type result;
-                result.reserve(2);
-                result.emplace_back(std::move(indices_row));
-                result.emplace_back(std::move(indices_column));
-                return primitive_argument_type{std::move(result)};
-            }
-
-        default:
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "nonzero::eval",
+                "nonzero_where::extract_comparison_kind",
                 util::generate_error_message(
-                    "operand has unsupported number of dimensions",
+                    "the __where_compare primitive requires a comparison "
+                    "(string) and exactly four arguments",
                     name_, codename_));
         }
-    }
 
-    struct nonzero_where::visit_nonzero
-    {
-        template <typename T>
-        primitive_argument_type operator()(T&& op) const
+        std::string const comparison =
+            extract_string_value_strict(operands_[0], name_, codename_);
+        if (comparison == "__lt")
         {
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "nonzero_where::visit_nonzero::operator()",
-                util::generate_error_message(
-                    "operand has unsupported type",
-                    that_.name_, that_.codename_));
+            return comparison_kind::less;
         }
-
-        template <typename T>
-        primitive_argument_type operator()(ir::node_data<T>&& op) const
+        if (comparison == "__le")
         {
-            return that_.nonzero_elements(std::move(op));
+            return comparison_kind::less_equal;
+        }
+        if (comparison == "__gt")
+        {
+            return comparison_kind::greater;
+        }
+        if (comparison == "__ge")
+        {
+            return comparison_kind::greater_equal;
+        }
+        if (comparison == "__eq")
+        {
+            return comparison_kind::equal;
+        }
+        if (comparison == "__ne")
+        {
+            return comparison_kind::not_equal;
         }
 
-        nonzero_where const& that_;
-    };
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "nonzero_where::extract_comparison_kind",
+            util::generate_error_message(
+                "unknown comparison: " + comparison, name_, codename_));
+    }
 
     ///////////////////////////////////////////////////////////////////////////
-    // where condition is zero dimensional
-    template <typename R, typename T>
-    primitive_argument_type nonzero_where::where_elements0d(
-        ir::node_data<T>&& op, primitive_argument_type&& lhs,
-        primitive_argument_type&& rhs) const
+    namespace detail
     {
-        switch (extract_largest_dimension(name_, codename_, lhs, rhs))
+        // Invoke f(row, first, last) for the parts of all rows covered by
+        // the range [begin, end) of the flattened elements of an array made
+        // of rows holding the given number of columns each.
+        template <typename F>
+        void for_each_row_segment(std::size_t begin, std::size_t end,
+            std::size_t columns, F&& f)
         {
-        case 0:
-            return primitive_argument_type{extract_value_scalar<R>(
-                op.scalar() ? std::move(lhs) : std::move(rhs),
-                name_, codename_)};
-
-        case 1:
+            std::size_t row = begin / columns;
+            std::size_t column = begin % columns;
+            while (begin != end)
             {
-                std::size_t size =
-                    extract_largest_dimensions(name_, codename_, lhs, rhs)[0];
-                return primitive_argument_type{extract_value_vector<R>(
-                    op.scalar() ? std::move(lhs) : std::move(rhs),
-                    size, name_, codename_)};
-            }
+                std::size_t const last =
+                    (std::min)(columns, column + (end - begin));
+                f(row, column, last);
 
-        case 2:
-            {
-                std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> sizes =
-                    extract_largest_dimensions(name_, codename_, lhs, rhs);
-                return primitive_argument_type{extract_value_matrix<R>(
-                    op.scalar() ? std::move(lhs) : std::move(rhs),
-                    sizes[0], sizes[1], name_, codename_)};
+                begin += last - column;
+                column = 0;
+                ++row;
             }
-
-        default:
-            break;
         }
 
-        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "nonzero_where::where_elements0d",
-            util::generate_error_message(
-                "operands have unsupported number of dimensions",
-                name_, codename_));
-    }
-
-    // where condition is one dimensional
-    template <typename R, typename T>
-    primitive_argument_type nonzero_where::where_elements1d(
-        ir::node_data<T>&& op, primitive_argument_type&& lhs,
-        primitive_argument_type&& rhs) const
-    {
-        auto sizes = extract_largest_dimensions(name_, codename_, op, lhs, rhs);
-        switch (extract_largest_dimension(name_, codename_, lhs, rhs))
+        // The loop is free of branches, which allows for the comparisons
+        // to be vectorized.
+        template <typename T>
+        std::size_t count_nonzero(T const* first, T const* last)
         {
-        case 0:
+            std::size_t count = 0;
+            for (/**/; first != last; ++first)
             {
-                auto rhs_val = extract_value_scalar<R>(
-                    std::move(rhs), name_, codename_);
+                count += std::size_t(*first != T(0));
+            }
+            return count;
+        }
 
-                return primitive_argument_type{
-                    extract_value_vector<R>(std::move(lhs),
-                        [&](T val, std::size_t index)
+        // Collect the indices of the non-zero elements of an array of the
+        // given number of dimensions, made of pages * rows rows holding
+        // the given number of columns each, row r starting at
+        // data + r * spacing. The elements are split into chunks which are
+        // handled in two passes: the first pass counts the non-zero elements
+        // of each chunk, the exclusive scan of those counts gives the offset
+        // of the indices of each chunk in the (exactly sized) result, and the
+        // second pass writes the indices.
+        template <typename T>
+        primitive_argument_type nonzero_indices(T const* data,
+            std::size_t numdims, std::size_t pages, std::size_t rows,
+            std::size_t columns, std::size_t spacing)
+        {
+            std::size_t const size = pages * rows * columns;
+
+            std::size_t num_chunks = util::detail::scan_chunk_count(size);
+            std::size_t const chunk_size =
+                (std::max)((size + num_chunks - 1) / num_chunks,
+                    std::size_t(1));
+            num_chunks = (size + chunk_size - 1) / chunk_size;
+
+            // offsets[chunk + 1] receives the count of chunk
+            std::vector<std::size_t> offsets(num_chunks + 1, 0);
+            util::for_each_scan_slice(num_chunks, chunk_size,
+                [&](std::size_t chunk)
+                {
+                    std::size_t const begin = chunk * chunk_size;
+                    std::size_t const end =
+                        (std::min)(begin + chunk_size, size);
+
+                    std::size_t count = 0;
+                    for_each_row_segment(begin, end, columns,
+                        [&](std::size_t row, std::size_t first,
+                            std::size_t last)
                         {
-                            return op[index] ? val : rhs_val.scalar();
-                        },
-                        sizes[0], name_, codename_)};
-            }
+                            T const* p = data + row * spacing;
+                            count += count_nonzero(p + first, p + last);
+                        });
+                    offsets[chunk + 1] = count;
+                });
 
-        case 1:
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            using storage1d_type =
+                typename ir::node_data<std::int64_t>::storage1d_type;
+
+            std::vector<storage1d_type> indices;
+            indices.reserve(numdims);
+            for (std::size_t i = 0; i != numdims; ++i)
             {
-                std::size_t op_size = op.size();
-                if (op_size != sizes[0] && op_size != 1)
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "nonzero_where::where_elements1d",
-                        util::generate_error_message(
-                            "operands could not be broadcast together with the "
-                            "given shapes",
-                            name_, codename_));
-
-                auto rhs_val = extract_value_vector<R>(
-                    std::move(rhs), sizes[0], name_, codename_);
-                auto rhs_vector = rhs_val.vector();
-
-                return primitive_argument_type{
-                    extract_value_vector<R>(std::move(lhs),
-                        [&](T val, std::size_t index)
-                        {
-                            return op[index] ? val : rhs_vector[index];
-                        },
-                        sizes[0], name_, codename_)};
+                indices.emplace_back(
+                    util::storage_pool<std::int64_t>::vector(offsets.back()));
             }
 
-        case 2:
-            {
-                std::size_t op_size = op.size();
-                if (op_size != sizes[1] && op_size != 1)
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "nonzero_where::where_elements1d",
-                        util::generate_error_message(
-                            "operands could not be broadcast together with the "
-                            "given shapes",
-                            name_, codename_));
-
-                auto rhs_val = extract_value_matrix<R>(
-                    std::move(rhs), sizes[0], sizes[1], name_, codename_);
-                auto rhs_matrix = rhs_val.matrix();
-
-                auto op_val = extract_value_vector<R>(
-                    std::move(op), sizes[1], name_, codename_);
-
-                return primitive_argument_type{
-                    extract_value_matrix<R>(std::move(lhs),
-                        [&](T val, std::size_t row, std::size_t column)
+            std::int64_t* page_indices =
+                numdims == 3 ? indices[0].data() : nullptr;
+            std::int64_t* row_indices =
+                numdims >= 2 ? indices[numdims - 2].data() : nullptr;
+            std::int64_t* column_indices = indices[numdims - 1].data();
+
+            util::for_each_scan_slice(num_chunks, chunk_size,
+                [&](std::size_t chunk)
+                {
+                    std::size_t const begin = chunk * chunk_size;
+                    std::size_t const end =
+                        (std::min)(begin + chunk_size, size);
+
+                    std::size_t pos = offsets[chunk];
+                    for_each_row_segment(begin, end, columns,
+                        [&](std::size_t row, std::size_t first,
+                            std::size_t last)
                         {
-                            return op_val[column] ?
-                                val : rhs_matrix(row, column);
-                        },
-                        sizes[0], sizes[1], name_, codename_)};
+                            T const* p = data + row * spacing;
+                            for (std::size_t j = first; j != last; ++j)
+                            {
+                                if (p[j] == T(0))
+                                {
+                                    continue;
+                                }
+
+                                if (page_indices != nullptr)
+                                {
+                                    page_indices[pos] =
+                                        std::int64_t(row / rows);
+                                }
+                                if (row_indices != nullptr)
+                                {
+                                    row_indices[pos] =
+                                        std::int64_t(row % rows);
+                                }
+                                column_indices[pos++] = std::int64_t(j);
+                            }
+                        });
+                });
+
+            primitive_arguments_type result;
+            result.reserve(numdims);
+            for (auto&& index : indices)
+            {
+                result.emplace_back(
+                    ir::node_data<std::int64_t>{std::move(index)});
             }
-
-        default:
-            break;
+            return primitive_argument_type{std::move(result)};
         }
-
-        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "nonzero_where::where_elements1d",
-            util::generate_error_message(
-                "operands have unsupported number of dimensions",
-                name_, codename_));
     }
 
-    // where condition is two dimensional
-    template <typename R, typename T>
-    primitive_argument_type nonzero_where::where_elements2d(
-        ir::node_data<T>&& op, primitive_argument_type&& lhs,
-        primitive_argument_type&& rhs) const
+    template <typename T>
+    primitive_argument_type nonzero_where::nonzero_elements(
+        ir::node_data<T> && op) const
     {
-        auto sizes = extract_largest_dimensions(name_, codename_, op, lhs, rhs);
-        switch (extract_largest_dimension(name_, codename_, lhs, rhs))
+        ir::node_data<T> const& arg = op;
+
+        switch (arg.num_dimensions())
         {
         case 0:
             {
-                auto rhs_val = extract_value_scalar<R>(
-                    std::move(rhs), name_, codename_);
+                using storage1d_type =
+                    typename ir::node_data<std::int64_t>::storage1d_type;
 
-                return primitive_argument_type{
-                    extract_value_matrix<R>(std::move(lhs),
-                        [&](T val, std::size_t row, std::size_t column)
-                        {
-                            return op.at(row, column) ? val : rhs_val.scalar();
-                        },
-                        sizes[0], sizes[1], name_, codename_)};
+                storage1d_type indices(
+                    arg.scalar() != T(0) ? 1 : 0, std::int64_t(0));
+
+                primitive_arguments_type result;
+                result.reserve(1);
+                result.emplace_back(std::move(indices));
+                return primitive_argument_type{std::move(result)};
             }
 
         case 1:
             {
-                std::size_t op_column_size = op.matrix().columns();
-                if (op_column_size != sizes[1] && op_column_size != 1)
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "nonzero_where::where_elements2d",
-                        util::generate_error_message(
-                            "operands could not be broadcast together with the "
-                            "given shapes",
-                            name_, codename_));
-
-                auto rhs_val = extract_value_vector<R>(
-                    std::move(rhs), sizes[1], name_, codename_);
-                auto rhs_vector = rhs_val.vector();
-
-                auto op_val = extract_value_matrix<R>(
-                    std::move(op), sizes[0], sizes[1], name_, codename_);
-
-                return primitive_argument_type{
-                    extract_value_matrix<R>(std::move(lhs),
-                        [&](T val, std::size_t row, std::size_t column)
-                        {
-                            return op_val.at(row, column) ?
-                                val : rhs_vector[column];
-                        },
-                        sizes[0], sizes[1], name_, codename_)};
+                auto v = arg.vector();
+                return detail::nonzero_indices(
+                    v.data(), 1, 1, 1, v.size(), v.size());
             }
 
         case 2:
             {
-                std::size_t op_row_size = op.matrix().rows();
-                std::size_t op_column_size = op.matrix().columns();
-                if ((op_column_size != sizes[1] && sizes[1] != 1 &&
-                        op_column_size != 1) ||
-                    (op_row_size != sizes[0] && sizes[0] != 1 &&
-                        op_row_size != 1))
-                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                        "nonzero_where::where_elements2d",
-                        util::generate_error_message(
-                            "operands could not be broadcast "
-                            "together with the given shapes",
-                            name_, codename_));
-
-                auto rhs_val = extract_value_matrix<R>(
-                    std::move(rhs), sizes[0], sizes[1], name_, codename_);
-                auto rhs_matrix = rhs_val.matrix();
-
-                auto op_val = extract_value_matrix<R>(
-                    std::move(op), sizes[0], sizes[1], name_, codename_);
-
-                return primitive_argument_type{
-                    extract_value_matrix<R>(std::move(lhs),
-                        [&](T val, std::size_t row, std::size_t column)
-                        {
-                            return op_val.at(row, column) ?
-                                val : rhs_matrix(row, column);
-                        },
-                        sizes[0], sizes[1], name_, codename_)};
+                auto m = arg.matrix();
+                return detail::nonzero_indices(
+                    m.data(), 2, 1, m.rows(), m.columns(), m.spacing());
+            }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+        case 3:
+            {
+                auto t = arg.tensor();
+                return detail::nonzero_indices(t.data(), 3, t.pages(),
+                    t.rows(), t.columns(), t.spacing());
             }
+#endif
 
         default:
             break;
         }
 
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "nonzero_where::where_elements2d",
+            "nonzero::eval",
             util::generate_error_message(
-                "operands have unsupported number of dimensions",
+                "operand has unsupported number of dimensions",
                 name_, codename_));
     }
 
-    template <typename R, typename T>
-    primitive_argument_type nonzero_where::where_elements(ir::node_data<T>&& op,
-        primitive_argument_type&& lhs, primitive_argument_type&& rhs) const
+    struct nonzero_where::visit_nonzero
     {
-        using storage2d_type = typename ir::node_data<R>::storage2d_type;
-
-        std::size_t dims = op.num_dimensions();
-        switch (dims)
+        template <typename T>
+        primitive_argument_type operator()(T&& op) const
         {
-        case 0:
-            return where_elements0d<R>(
-                std::move(op), std::move(lhs), std::move(rhs));
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "nonzero_where::visit_nonzero::operator()",
+                util::generate_error_message(
+                    "operand has unsupported type",
+                    that_.name_, that_.codename_));
+        }
 
-        case 1:
-            return where_elements1d<R>(
-                std::move(op), std::move(lhs), std::move(rhs));
+        template <typename T>
+        primitive_argument_type operator()(ir::node_data<T>&& op) const
+        {
+            return that_.nonzero_elements(std::move(op));
+        }
 
-        case 2:
-            return where_elements2d<R>(
-                std::move(op), std::move(lhs), std::move(rhs));
+        nonzero_where const& that_;
+    };
 
-        default:
-            break;
-        }
+    ///////////////////////////////////////////////////////////////////////////
+    // the condition and both operands are broadcast against each other
+    template <typename R, typename T>
+    primitive_argument_type nonzero_where::where_elements(ir::node_data<T>&& op,
+        primitive_argument_type&& lhs, primitive_argument_type&& rhs) const
+    {
+        auto lhs_val = extract_node_data<R>(std::move(lhs), name_, codename_);
+        auto rhs_val = extract_node_data<R>(std::move(rhs), name_, codename_);
 
-        HPX_THROW_EXCEPTION(hpx::bad_parameter,
-            "nonzero_where::where_elements",
-            util::generate_error_message(
-                "operands have unsupported number of dimensions",
-                name_, codename_));
+        return primitive_argument_type{broadcast_map<R>(
+            [](T cond, R x, R y) -> R { return cond ? x : y; }, name_,
+            codename_, op, lhs_val, rhs_val)};
     }
 
     struct nonzero_where::visit_where
@@ -468,10 +408,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return that_.where_elements<std::uint8_t>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
 
+            case node_data_type_int32: HPX_FALLTHROUGH;
             case node_data_type_int64:
                 return that_.where_elements<std::int64_t>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
 
+            case node_data_type_float32: HPX_FALLTHROUGH;
             case node_data_type_double:
                 return that_.where_elements<double>(
                     std::move(op), std::move(lhs_), std::move(rhs_));
@@ -492,10 +434,204 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type&& rhs_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // the comparison is evaluated while selecting the elements, the
+    // arguments of the comparison and both operands are broadcast against
+    // each other
+    template <typename R, typename Op, typename T>
+    primitive_argument_type nonzero_where::where_compare_elements(
+        ir::node_data<T> const& a, ir::node_data<T> const& b,
+        primitive_argument_type&& lhs, primitive_argument_type&& rhs) const
+    {
+        auto lhs_val = extract_node_data<R>(std::move(lhs), name_, codename_);
+        auto rhs_val = extract_node_data<R>(std::move(rhs), name_, codename_);
+
+        return primitive_argument_type{broadcast_map<R>(
+            [](T x, T y, R l, R r) -> R { return Op{}(x, y) ? l : r; },
+            name_, codename_, a, b, lhs_val, rhs_val)};
+    }
+
+    template <typename Op, typename T>
+    primitive_argument_type nonzero_where::where_compare_dispatch(
+        ir::node_data<T>&& a, ir::node_data<T>&& b,
+        primitive_argument_type&& lhs, primitive_argument_type&& rhs) const
+    {
+        switch (extract_common_type(lhs, rhs))
+        {
+        case node_data_type_bool:
+            return where_compare_elements<std::uint8_t, Op>(
+                a, b, std::move(lhs), std::move(rhs));
+
+        case node_data_type_int32: HPX_FALLTHROUGH;
+        case node_data_type_int64:
+            return where_compare_elements<std::int64_t, Op>(
+                a, b, std::move(lhs), std::move(rhs));
+
+        case node_data_type_float32: HPX_FALLTHROUGH;
+        case node_data_type_double:
+            return where_compare_elements<double, Op>(
+                a, b, std::move(lhs), std::move(rhs));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "nonzero_where::where_compare_dispatch",
+            util::generate_error_message(
+                "operand has unsupported type", name_, codename_));
+    }
+
+    template <typename T>
+    primitive_argument_type nonzero_where::where_compare_op(
+        ir::node_data<T>&& a, ir::node_data<T>&& b,
+        primitive_argument_type&& lhs, primitive_argument_type&& rhs) const
+    {
+        switch (comparison_)
+        {
+        case comparison_kind::less:
+            return where_compare_dispatch<std::less<T>>(
+                std::move(a), std::move(b), std::move(lhs), std::move(rhs));
+
+        case comparison_kind::less_equal:
+            return where_compare_dispatch<std::less_equal<T>>(
+                std::move(a), std::move(b), std::move(lhs), std::move(rhs));
+
+        case comparison_kind::greater:
+            return where_compare_dispatch<std::greater<T>>(
+                std::move(a), std::move(b), std::move(lhs), std::move(rhs));
+
+        case comparison_kind::greater_equal:
+            return where_compare_dispatch<std::greater_equal<T>>(
+                std::move(a), std::move(b), std::move(lhs), std::move(rhs));
+
+        case comparison_kind::equal:
+            return where_compare_dispatch<std::equal_to<T>>(
+                std::move(a), std::move(b), std::move(lhs), std::move(rhs));
+
+        case comparison_kind::not_equal:
+            return where_compare_dispatch<std::not_equal_to<T>>(
+                std::move(a), std::move(b), std::move(lhs), std::move(rhs));
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "nonzero_where::where_compare_op",
+            util::generate_error_message(
+                "unknown comparison", name_, codename_));
+    }
+
+    // Evaluate the comparison using the primitive that would have been used
+    // without fusion. This guarantees identical semantics for all argument
+    // types not supported by the fused kernel (booleans, strings, etc.).
+    primitive_argument_type nonzero_where::evaluate_comparison(
+        primitive_argument_type&& a, primitive_argument_type&& b) const
+    {
+        primitive_arguments_type ops;
+        ops.reserve(2);
+        ops.emplace_back(std::move(a));
+        ops.emplace_back(std::move(b));
+
+        std::shared_ptr<primitive_component_base> p;
+        switch (comparison_)
+        {
+        case comparison_kind::less:
+            p = create_primitive<less>(std::move(ops), name_, codename_);
+            break;
+
+        case comparison_kind::less_equal:
+            p = create_primitive<less_equal>(
+                std::move(ops), name_, codename_);
+            break;
+
+        case comparison_kind::greater:
+            p = create_primitive<greater>(std::move(ops), name_, codename_);
+            break;
+
+        case comparison_kind::greater_equal:
+            p = create_primitive<greater_equal>(
+                std::move(ops), name_, codename_);
+            break;
+
+        case comparison_kind::equal:
+            p = create_primitive<equal>(std::move(ops), name_, codename_);
+            break;
+
+        default:
+            HPX_ASSERT(comparison_ == comparison_kind::not_equal);
+            p = create_primitive<not_equal>(std::move(ops), name_, codename_);
+            break;
+        }
+
+        return p->eval(noargs, eval_context{}).get();
+    }
+
+    // the fused kernel handles floating point and integer values only
+    primitive_argument_type nonzero_where::where_compare(
+        primitive_argument_type&& a, primitive_argument_type&& b,
+        primitive_argument_type&& lhs, primitive_argument_type&& rhs) const
+    {
+        if ((is_numeric_operand_strict(a) || is_integer_operand_strict(a)) &&
+            (is_numeric_operand_strict(b) || is_integer_operand_strict(b)))
+        {
+            if (extract_common_type(a, b) == node_data_type_int64)
+            {
+                return where_compare_op(
+                    extract_integer_value_strict(
+                        std::move(a), name_, codename_),
+                    extract_integer_value_strict(
+                        std::move(b), name_, codename_),
+                    std::move(lhs), std::move(rhs));
+            }
+
+            return where_compare_op(
+                extract_numeric_value(std::move(a), name_, codename_),
+                extract_numeric_value(std::move(b), name_, codename_),
+                std::move(lhs), std::move(rhs));
+        }
+
+        primitive_argument_type cond =
+            evaluate_comparison(std::move(a), std::move(b));
+        return util::visit(visit_where{*this, std::move(lhs), std::move(rhs)},
+            std::move(cond.variant()));
+    }
+
     hpx::future<primitive_argument_type> nonzero_where::eval(
         primitive_arguments_type const& operands,
         primitive_arguments_type const& args) const
     {
+        if (comparison_ != comparison_kind::none)
+        {
+            if (operands.size() != 4 || !valid(operands[0]) ||
+                !valid(operands[1]) || !valid(operands[2]) ||
+                !valid(operands[3]))
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "nonzero_where::eval",
+                    util::generate_error_message(
+                        "the __where_compare primitive requires exactly four "
+                        "valid operands",
+                        name_, codename_));
+            }
+
+            auto this_ = this->shared_from_this();
+            return hpx::dataflow(hpx::launch::sync, hpx::util::unwrapping(
+                [this_ = std::move(this_)](primitive_argument_type&& a,
+                    primitive_argument_type&& b, primitive_argument_type&& lhs,
+                    primitive_argument_type&& rhs)
+                -> primitive_argument_type
+                {
+                    return this_->where_compare(std::move(a), std::move(b),
+                        std::move(lhs), std::move(rhs));
+                }),
+                value_operand(operands[0], args, name_, codename_),
+                value_operand(operands[1], args, name_, codename_),
+                value_operand(operands[2], args, name_, codename_),
+                value_operand(operands[3], args, name_, codename_));
+        }
+
         if (nonzero_ && operands.size() != 1)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -0,0 +1,552 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/fileio/array_file.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/mapped_file.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <blaze/Math.h>
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+#include <blaze_tensor/Math.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        char const array_file_magic[8] = {
+            'P', 'H', 'Y', 'A', 'R', 'R', 'A', 'Y'};
+
+        constexpr std::uint32_t array_file_version = 1;
+        constexpr std::uint32_t array_file_byte_order = 0x01020304;
+
+        struct array_file_header
+        {
+            char magic_[8];
+            std::uint32_t version_;
+            std::uint32_t byte_order_;
+            std::uint32_t type_;
+            std::uint32_t num_dimensions_;
+            std::uint64_t pages_;
+            std::uint64_t rows_;
+            std::uint64_t columns_;
+            std::uint64_t spacing_;
+            std::uint64_t offset_;
+        };
+
+        static_assert(sizeof(array_file_header) == array_file_header_size,
+            "the array file header must have the documented size");
+
+        // element type codes stored in the header
+        template <typename T>
+        struct array_file_type;
+
+        template <>
+        struct array_file_type<std::uint8_t>
+        {
+            static constexpr std::uint32_t value = 0;
+        };
+
+        template <>
+        struct array_file_type<std::int64_t>
+        {
+            static constexpr std::uint32_t value = 1;
+        };
+
+        template <>
+        struct array_file_type<double>
+        {
+            static constexpr std::uint32_t value = 2;
+        };
+
+        template <>
+        struct array_file_type<float>
+        {
+            static constexpr std::uint32_t value = 3;
+        };
+
+        template <>
+        struct array_file_type<std::int32_t>
+        {
+            static constexpr std::uint32_t value = 4;
+        };
+
+        bool is_array_file_header(char const* data, std::size_t size)
+        {
+            return size >= array_file_header_size &&
+                std::memcmp(data, array_file_magic,
+                    sizeof(array_file_magic)) == 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Arrays referencing a mapped file share the ownership of the
+        // mapping, which is released once the last of those arrays goes
+        // away. A mapping is reused as long as it is alive and the file was
+        // not modified in between.
+        struct mapped_array_file
+        {
+            std::weak_ptr<util::mapped_file> file_;
+            std::uintmax_t size_;
+            std::time_t last_write_time_;
+        };
+
+        struct mapped_array_files
+        {
+            std::mutex mtx_;
+            std::map<std::string, mapped_array_file> files_;
+
+            // the mapping of the given file must not be reused
+            void retire(std::string const& filename)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                files_.erase(filename);
+            }
+        };
+
+        mapped_array_files& get_mapped_array_files()
+        {
+            static mapped_array_files files;
+            return files;
+        }
+
+        std::shared_ptr<util::mapped_file> map_array_file(
+            std::string const& filename)
+        {
+            boost::system::error_code ec;
+            std::uintmax_t size = boost::filesystem::file_size(filename, ec);
+            if (ec || size < array_file_header_size)
+            {
+                return nullptr;
+            }
+            std::time_t last_write_time =
+                boost::filesystem::last_write_time(filename, ec);
+            if (ec)
+            {
+                return nullptr;
+            }
+
+            auto& files = get_mapped_array_files();
+            std::lock_guard<std::mutex> l(files.mtx_);
+
+            auto it = files.files_.find(filename);
+            if (it != files.files_.end() && it->second.size_ == size &&
+                it->second.last_write_time_ == last_write_time)
+            {
+                std::shared_ptr<util::mapped_file> file =
+                    it->second.file_.lock();
+                if (file)
+                {
+                    return file;
+                }
+            }
+
+            // the pages of the mapping are copied on write, this keeps
+            // primitives that modify their arguments in place from failing
+            auto file = std::make_shared<util::mapped_file>();
+            if (!file->open(filename, true) ||
+                !is_array_file_header(file->data(), file->size()))
+            {
+                return nullptr;
+            }
+
+            if (it != files.files_.end())
+            {
+                it->second = mapped_array_file{file, size, last_write_time};
+            }
+            else
+            {
+                files.files_.emplace(filename,
+                    mapped_array_file{file, size, last_write_time});
+            }
+            return file;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        bool is_zero_copy(T const* data, std::size_t spacing)
+        {
+            return blaze::checkAlignment(data) &&
+                (spacing % blaze::SIMDTrait<T>::size) == 0;
+        }
+
+        // multiply the given extents, returns false on overflow
+        bool checked_multiply(std::uint64_t& result,
+            std::initializer_list<std::uint64_t> values)
+        {
+            result = 1;
+            for (std::uint64_t v : values)
+            {
+                if (v != 0 &&
+                    result > (std::numeric_limits<std::uint64_t>::max)() / v)
+                {
+                    return false;
+                }
+                result *= v;
+            }
+            return true;
+        }
+
+        template <typename T>
+        primitive_argument_type make_array(
+            std::shared_ptr<util::mapped_file> const& file,
+            array_file_header const& header, std::string const& filename,
+            std::string const& name, std::string const& codename)
+        {
+            std::uint64_t count = 0;
+            if (!checked_multiply(
+                    count, {header.pages_, header.rows_, header.spacing_}) ||
+                header.offset_ < array_file_header_size ||
+                header.offset_ > file->size() ||
+                header.offset_ % alignof(T) != 0 ||
+                header.spacing_ < header.columns_ ||
+                (file->size() - header.offset_) / sizeof(T) < count)
+            {
+                throw std::runtime_error(util::generate_error_message(
+                    "inconsistent array file header: " + filename, name,
+                    codename));
+            }
+
+            T* data = reinterpret_cast<T*>(
+                const_cast<char*>(file->data()) + header.offset_);
+
+            switch (header.num_dimensions_)
+            {
+            case 0:
+                return primitive_argument_type{ir::node_data<T>(*data)};
+
+            case 1:
+                if (is_zero_copy(data, header.spacing_))
+                {
+                    return primitive_argument_type{ir::node_data<T>{
+                        typename ir::node_data<T>::custom_storage1d_type(
+                            data, header.columns_, header.spacing_),
+                        file}};
+                }
+                return primitive_argument_type{
+                    ir::node_data<T>{blaze::DynamicVector<T>(
+                        blaze::CustomVector<T, blaze::unaligned,
+                            blaze::unpadded>(data, header.columns_))}};
+
+            case 2:
+                if (is_zero_copy(data, header.spacing_))
+                {
+                    return primitive_argument_type{ir::node_data<T>{
+                        typename ir::node_data<T>::custom_storage2d_type(
+                            data, header.rows_, header.columns_,
+                            header.spacing_),
+                        file}};
+                }
+                return primitive_argument_type{
+                    ir::node_data<T>{blaze::DynamicMatrix<T>(
+                        blaze::CustomMatrix<T, blaze::unaligned,
+                            blaze::unpadded>(data, header.rows_,
+                            header.columns_, header.spacing_))}};
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            case 3:
+                if (is_zero_copy(data, header.spacing_))
+                {
+                    return primitive_argument_type{ir::node_data<T>{
+                        typename ir::node_data<T>::custom_storage3d_type(
+                            data, header.pages_, header.rows_,
+                            header.columns_, header.spacing_),
+                        file}};
+                }
+                return primitive_argument_type{
+                    ir::node_data<T>{blaze::DynamicTensor<T>(
+                        blaze::CustomTensor<T, blaze::unaligned,
+                            blaze::unpadded>(data, header.pages_,
+                            header.rows_, header.columns_,
+                            header.spacing_))}};
+#endif
+
+            default:
+                break;
+            }
+
+            throw std::runtime_error(util::generate_error_message(
+                "unsupported number of dimensions in array file: " + filename,
+                name, codename));
+        }
+
+        bool read_array_file(std::string const& filename,
+            primitive_argument_type& result, std::string const& name,
+            std::string const& codename)
+        {
+            std::shared_ptr<util::mapped_file> file = map_array_file(filename);
+            if (!file)
+            {
+                return false;
+            }
+
+            array_file_header header;
+            std::memcpy(&header, file->data(), sizeof(header));
+
+            if (header.version_ != array_file_version ||
+                header.byte_order_ != array_file_byte_order)
+            {
+                throw std::runtime_error(util::generate_error_message(
+                    "unsupported version or byte order of array file: " +
+                        filename,
+                    name, codename));
+            }
+
+            switch (header.type_)
+            {
+            case array_file_type<std::uint8_t>::value:
+                result = make_array<std::uint8_t>(
+                    file, header, filename, name, codename);
+                return true;
+
+            case array_file_type<std::int64_t>::value:
+                result = make_array<std::int64_t>(
+                    file, header, filename, name, codename);
+                return true;
+
+            case array_file_type<double>::value:
+                result = make_array<double>(
+                    file, header, filename, name, codename);
+                return true;
+
+            case array_file_type<float>::value:
+                result = make_array<float>(
+                    file, header, filename, name, codename);
+                return true;
+
+            case array_file_type<std::int32_t>::value:
+                result = make_array<std::int32_t>(
+                    file, header, filename, name, codename);
+                return true;
+
+            default:
+                break;
+            }
+
+            throw std::runtime_error(util::generate_error_message(
+                "unsupported element type in array file: " + filename, name,
+                codename));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool is_array_file_value(primitive_argument_type const& val)
+        {
+            switch (val.index())
+            {
+            case 1:     // phylanx::ir::node_data<std::uint8_t>
+                return !util::get<1>(val).is_sparse();
+
+            case 2:     // phylanx::ir::node_data<std::int64_t>
+                return !util::get<2>(val).is_sparse();
+
+            case 4:     // phylanx::ir::node_data<double>
+                return !util::get<4>(val).is_sparse();
+
+            case 9:     // phylanx::ir::node_data<float>
+                return !util::get<9>(val).is_sparse();
+
+            case 10:    // phylanx::ir::node_data<std::int32_t>
+                return !util::get<10>(val).is_sparse();
+
+            default:
+                break;
+            }
+            return false;
+        }
+
+        // The elements are written directly from the (padded) storage of
+        // the array, using a single write operation.
+        template <typename T>
+        void write_array(std::string const& filename,
+            ir::node_data<T> const& data, std::string const& name,
+            std::string const& codename)
+        {
+            array_file_header header;
+            std::memcpy(
+                header.magic_, array_file_magic, sizeof(array_file_magic));
+            header.version_ = array_file_version;
+            header.byte_order_ = array_file_byte_order;
+            header.type_ = array_file_type<T>::value;
+            header.num_dimensions_ =
+                static_cast<std::uint32_t>(data.num_dimensions());
+            header.pages_ = 1;
+            header.rows_ = 1;
+            header.columns_ = 1;
+            header.spacing_ = 1;
+            header.offset_ = array_file_header_size;
+
+            T scalar{};
+            T const* values = &scalar;
+
+            switch (data.num_dimensions())
+            {
+            case 0:
+                scalar = data.scalar();
+                break;
+
+            case 1:
+                {
+                    auto v = data.vector();
+                    header.columns_ = v.size();
+                    header.spacing_ = v.spacing();
+                    values = v.data();
+                }
+                break;
+
+            case 2:
+                {
+                    auto m = data.matrix();
+                    header.rows_ = m.rows();
+                    header.columns_ = m.columns();
+                    header.spacing_ = m.spacing();
+                    values = m.data();
+                }
+                break;
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+            case 3:
+                {
+                    auto t = data.tensor();
+                    header.pages_ = t.pages();
+                    header.rows_ = t.rows();
+                    header.columns_ = t.columns();
+                    header.spacing_ = t.spacing();
+                    values = t.data();
+                }
+                break;
+#endif
+
+            default:
+                throw std::runtime_error(util::generate_error_message(
+                    "unsupported number of dimensions for array file: " +
+                        filename,
+                    name, codename));
+            }
+
+            std::uint64_t size = 0;
+            if (!checked_multiply(size,
+                    {header.pages_, header.rows_, header.spacing_,
+                        sizeof(T)}) ||
+                size > (std::numeric_limits<std::size_t>::max)())
+            {
+                throw std::runtime_error(util::generate_error_message(
+                    "array is too large to be stored as an array file: " +
+                        filename,
+                    name, codename));
+            }
+
+            replace_file(filename,
+                {{reinterpret_cast<char const*>(&header), sizeof(header)},
+                    {reinterpret_cast<char const*>(values),
+                        static_cast<std::size_t>(size)}},
+                name, codename);
+        }
+
+        void write_array_file(std::string const& filename,
+            primitive_argument_type const& val, std::string const& name,
+            std::string const& codename)
+        {
+            switch (val.index())
+            {
+            case 1:     // phylanx::ir::node_data<std::uint8_t>
+                write_array(filename, util::get<1>(val), name, codename);
+                return;
+
+            case 2:     // phylanx::ir::node_data<std::int64_t>
+                write_array(filename, util::get<2>(val), name, codename);
+                return;
+
+            case 4:     // phylanx::ir::node_data<double>
+                write_array(filename, util::get<4>(val), name, codename);
+                return;
+
+            case 9:     // phylanx::ir::node_data<float>
+                write_array(filename, util::get<9>(val), name, codename);
+                return;
+
+            case 10:    // phylanx::ir::node_data<std::int32_t>
+                write_array(filename, util::get<10>(val), name, codename);
+                return;
+
+            default:
+                break;
+            }
+
+            throw std::runtime_error(util::generate_error_message(
+                "the given value can't be stored as an array file: " +
+                    filename,
+                name, codename));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void replace_file(std::string const& filename,
+            std::initializer_list<std::pair<char const*, std::size_t>> blocks,
+            std::string const& name, std::string const& codename)
+        {
+            // the temporary file name must be unique across threads and
+            // processes writing the same file concurrently
+            std::string tmpname =
+                boost::filesystem::unique_path(
+                    filename + ".%%%%-%%%%-%%%%-%%%%.tmp").string();
+            {
+                std::ofstream outfile(tmpname.c_str(),
+                    std::ios::binary | std::ios::out | std::ios::trunc);
+                if (!outfile.is_open())
+                {
+                    throw std::runtime_error(util::generate_error_message(
+                        "couldn't open file: " + tmpname, name, codename));
+                }
+
+                for (auto const& block : blocks)
+                {
+                    if (!outfile.write(block.first, block.second))
+                    {
+                        outfile.close();
+                        std::remove(tmpname.c_str());
+                        throw std::runtime_error(
+                            util::generate_error_message(
+                                "couldn't write expected number of bytes "
+                                "to file: " + filename,
+                                name, codename));
+                    }
+                }
+            }
+
+            get_mapped_array_files().retire(filename);
+
+            boost::system::error_code ec;
+            boost::filesystem::rename(tmpname, filename, ec);
+            if (ec)
+            {
+                std::remove(tmpname.c_str());
+                throw std::runtime_error(util::generate_error_message(
+                    "couldn't replace file: " + filename + " (" +
+                        ec.message() + ")",
+                    name, codename));
+            }
+        }
+    }
+}}}
@@ -5,6 +5,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/fileio/array_file.hpp>
 #include <phylanx/plugins/fileio/file_read.hpp>
 #include <phylanx/util/serialization/ast.hpp>
 #include <phylanx/util/serialization/execution_tree.hpp>
@@ -40,7 +41,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
             Returns:
 
-            An object deserialized from the data in fname.)")
+            An object deserialized from the data in fname. Arrays stored in
+            the native array format are memory mapped, their data is paged in
+            lazily on first access.)")
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -80,6 +83,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
             [filename = std::move(filename), this_ = std::move(this_)]()
             ->  primitive_argument_type
             {
+                primitive_argument_type val;
+                if (detail::read_array_file(
+                        filename, val, this_->name_, this_->codename_))
+                {
+                    return val;
+                }
+
                 std::ifstream infile(filename.c_str(),
                     std::ios::binary | std::ios::in | std::ios::ate);
 
@@ -104,7 +114,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                 // assume data in file is result of a serialized
                 // primitive_argument_type
-                primitive_argument_type val;
                 phylanx::util::unserialize(data, val);
 
                 return val;
@@ -1,32 +1,41 @@
 //  Copyright (c) 2017 Alireza Kheirkhahan
+//  Copyright (c) 2019 Hartmut Kaiser
 //
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/node_data_helpers.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/fileio/file_read_csv.hpp>
+#include <phylanx/util/generate_error_message.hpp>
+#include <phylanx/util/mapped_file.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
+#include <hpx/include/runtime.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/throw_exception.hpp>
-#include <hpx/runtime/threads/run_as_os_thread.hpp>
+#include <hpx/util/assert.hpp>
 
-#include <boost/spirit/include/qi_char.hpp>
-#include <boost/spirit/include/qi_list.hpp>
-#include <boost/spirit/include/qi_lit.hpp>
+#include <boost/spirit/include/qi_numeric.hpp>
 #include <boost/spirit/include/qi_parse.hpp>
 #include <boost/spirit/include/qi_real.hpp>
 
+#include <algorithm>
 #include <cstddef>
-#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <blaze/Math.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace phylanx { namespace execution_tree { namespace primitives
 {
@@ -34,17 +43,36 @@ namespace phylanx { namespace execution_tree { namespace primitives
     match_pattern_type const file_read_csv::match_data =
     {
         hpx::util::make_tuple("file_read_csv",
-            std::vector<std::string>{"file_read_csv(_1)"},
+            std::vector<std::string>{
+                "file_read_csv(_1, __arg(_2_columns, nil), "
+                    "__arg(_3_dtype, nil), __arg(_4_delimiter, \",\"), "
+                    "__arg(_5_rows, nil), __arg(_6_sparse, false))"
+            },
             &create_file_read_csv, &create_primitive<file_read_csv>,
-            R"(fname
+            R"(fname, columns, dtype, delimiter, rows, sparse
             Args:
 
                 fname (string) : file name
+                columns (optional, int or list of ints) : indices of the
+                    columns to read, negative indices count from the last
+                    column (default: read all columns)
+                dtype (optional, string) : the element type of the
+                    returned array (default: 'float64')
+                delimiter (optional, string) : the character separating
+                    the values in a line (default: ',')
+                rows (optional, list of two ints) : the half-open range
+                    [start, stop) of data rows to read (default: read all
+                    rows)
+                sparse (optional, boolean) : store only the non-zero values
+                    in a compressed matrix, requires the dtype 'float64'
+                    (default: false)
 
             Returns:
 
             Returns a matrix representation of the contents of a
-            csv file.)"
+            csv file. The first line is skipped if it does not consist of
+            numbers only (header). Compressed data is always returned as a
+            matrix.)"
             )
     };
 
@@ -55,114 +83,715 @@ namespace phylanx { namespace execution_tree { namespace primitives
       : primitive_component_base(std::move(operands), name, codename)
     {}
 
-    // read data from given file and return content
-    hpx::future<primitive_argument_type> file_read_csv::eval(
-        primitive_arguments_type const& operands,
-        primitive_arguments_type const& args, eval_context ctx) const
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
     {
-        if (operands.size() != 1)
+        // minimal amount of data each of the parsing tasks will work on
+        constexpr std::size_t min_chunk_size = 1024 * 1024;
+
+        struct csv_options
         {
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "phylanx::execution_tree::primitives::file_read_csv::eval",
-                generate_error_message(
-                    "the file_read_csv primitive requires exactly one "
-                        "literal argument"));
+            csv_options()
+              : delimiter(',')
+              , row_begin(0)
+              , row_end((std::numeric_limits<std::size_t>::max)())
+              , dtype(node_data_type_double)
+              , sparse(false)
+            {}
+
+            char delimiter;
+            std::vector<std::int64_t> columns;      // empty: all columns
+            std::size_t row_begin;
+            std::size_t row_end;
+            node_data_type dtype;
+            bool sparse;                            // compressed result
+        };
+
+        // part of the file containing complete lines only
+        struct csv_chunk
+        {
+            char const* begin;
+            char const* end;
+            std::size_t rows;           // number of data rows in this chunk
+            std::size_t first_row;      // index of the first row
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        inline char const* find_line_end(char const* first, char const* last)
+        {
+            void const* p = std::memchr(first, '\n', last - first);
+            return p != nullptr ? static_cast<char const*>(p) : last;
         }
 
-        if (!valid(operands[0]))
+        inline char const* next_line(char const* line_end, char const* last)
         {
-            HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "phylanx::execution_tree::primitives::file_read_csv::eval",
-                generate_error_message(
-                    "the file_read_csv primitive requires that the given "
-                        "operand is valid"));
+            return line_end == last ? last : line_end + 1;
         }
 
-        std::string filename = string_operand_sync(
-            operands[0], args, name_, codename_, std::move(ctx));
+        // remove trailing whitespace (including '\r' of CRLF line endings)
+        inline char const* trim_line(
+            char const* first, char const* last, char delimiter)
+        {
+            while (last != first &&
+                (last[-1] == '\r' ||
+                    (last[-1] == ' ' && delimiter != ' ') ||
+                    (last[-1] == '\t' && delimiter != '\t')))
+            {
+                --last;
+            }
+            return last;
+        }
 
-        auto this_ = this->shared_from_this();
-        return hpx::threads::run_as_os_thread(
-            [filename = std::move(filename), this_ = std::move(this_)]()
-            ->  primitive_argument_type
+        inline char const* skip_blanks(
+            char const* first, char const* last, char delimiter)
+        {
+            while (first != last &&
+                ((*first == ' ' && delimiter != ' ') ||
+                    (*first == '\t' && delimiter != '\t')))
             {
-                std::ifstream infile(filename.c_str(), std::ios::in);
+                ++first;
+            }
+            return first;
+        }
+
+        inline bool is_blank_line(char const* first, char const* last)
+        {
+            return std::all_of(first, last, [](char c) {
+                return c == ' ' || c == '\t' || c == '\r';
+            });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        bool parse_value(char const*& first, char const* last, T& value,
+            std::true_type)
+        {
+            namespace qi = boost::spirit::qi;
+            return qi::parse(first, last, qi::real_parser<T>(), value);
+        }
+
+        template <typename T>
+        bool parse_value(char const*& first, char const* last, T& value,
+            std::false_type)
+        {
+            namespace qi = boost::spirit::qi;
+            return qi::parse(first, last, qi::int_parser<T>(), value);
+        }
+
+        inline bool parse_value(char const*& first, char const* last,
+            std::uint8_t& value, std::false_type)
+        {
+            double d = 0.0;
+            if (!parse_value(first, last, d, std::true_type{}))
+            {
+                return false;
+            }
+            value = (d != 0.0) ? 1 : 0;
+            return true;
+        }
+
+        template <typename T>
+        bool parse_value(char const*& first, char const* last, T& value)
+        {
+            return parse_value(first, last, value,
+                typename std::is_floating_point<T>::type{});
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Parse all values of the given line, storing the values of the
+        // selected columns into the given row. Return the number of values
+        // found in the line, or zero if the line is not well formed.
+        template <typename T>
+        std::size_t parse_line(char const* first, char const* last,
+            char delimiter, std::vector<std::ptrdiff_t> const& column_map,
+            T* row)
+        {
+            last = trim_line(first, last, delimiter);
+
+            std::size_t col = 0;
+            while (true)
+            {
+                first = skip_blanks(first, last, delimiter);
+
+                T value;
+                if (!parse_value(first, last, value))
+                {
+                    return 0;
+                }
+
+                if (row != nullptr)
+                {
+                    if (col >= column_map.size())
+                    {
+                        return 0;
+                    }
+                    if (column_map[col] >= 0)
+                    {
+                        row[column_map[col]] = value;
+                    }
+                }
+                ++col;
 
-                if (!infile.is_open())
+                first = skip_blanks(first, last, delimiter);
+                if (first == last)
+                {
+                    break;
+                }
+                if (*first != delimiter)
                 {
-                    throw std::runtime_error(this_->generate_error_message(
-                        "couldn't open file: " + filename));
+                    return 0;
                 }
+                ++first;
+            }
+            return col;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Split the given data into chunks of complete lines
+        inline std::vector<csv_chunk> split_into_chunks(
+            char const* first, char const* last)
+        {
+            std::size_t size = last - first;
+            std::size_t num_chunks = (std::max)(std::size_t(1),
+                (std::min)(size / min_chunk_size,
+                    std::size_t(4 * hpx::get_os_thread_count())));
+            std::size_t chunk_size = size / num_chunks;
 
-                std::string line;
-                bool header_parsed = false;
-                std::vector<double> matrix_array, current_line;
-                std::size_t n_rows = 0, n_cols = 0;
-                std::size_t before_readln = 0, after_readln = 0;
+            std::vector<csv_chunk> chunks;
+            chunks.reserve(num_chunks);
 
-                while (std::getline(infile, line))
+            char const* begin = first;
+            for (std::size_t i = 0; i != num_chunks && begin != last; ++i)
+            {
+                char const* end = last;
+                if (i != num_chunks - 1 &&
+                    std::size_t(last - begin) > chunk_size)
                 {
-                    before_readln = matrix_array.size();
+                    end = next_line(
+                        find_line_end(begin + chunk_size, last), last);
+                }
+                chunks.push_back(csv_chunk{begin, end, 0, 0});
+                begin = end;
+            }
+            return chunks;
+        }
 
-                    auto begin_local = line.begin();
-                    if (boost::spirit::qi::parse(begin_local, line.end(),
-                            boost::spirit::qi::double_ % ',', current_line))
+        inline std::size_t count_rows(char const* first, char const* last)
+        {
+            std::size_t rows = 0;
+            while (first != last)
+            {
+                char const* line_end = find_line_end(first, last);
+                if (!is_blank_line(first, line_end))
+                {
+                    ++rows;
+                }
+                first = next_line(line_end, last);
+            }
+            return rows;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        void parse_chunk(csv_chunk const& chunk, csv_options const& options,
+            std::vector<std::ptrdiff_t> const& column_map,
+            blaze::DynamicMatrix<T>& result, std::string const& filename,
+            std::string const& name, std::string const& codename)
+        {
+            std::size_t row = chunk.first_row;
+            char const* first = chunk.begin;
+            while (first != chunk.end && row < options.row_end)
+            {
+                char const* line_end = find_line_end(first, chunk.end);
+                if (!is_blank_line(first, line_end))
+                {
+                    if (row >= options.row_begin)
                     {
-                        if (begin_local == line.end() || header_parsed)
+                        T* data = result.data(row - options.row_begin);
+                        if (parse_line(first, line_end, options.delimiter,
+                                column_map, data) != column_map.size())
                         {
-                            header_parsed = true;
+                            throw std::runtime_error(
+                                util::generate_error_message(
+                                    "wrong data format, different number "
+                                    "of element in this row " +
+                                        filename + ':' + std::to_string(row),
+                                    name, codename));
+                        }
+                    }
+                    ++row;
+                }
+                first = next_line(line_end, chunk.end);
+            }
+        }
 
-                            matrix_array.insert(matrix_array.end(),
-                                current_line.begin(), current_line.end());
+        // Parse the requested rows of the given chunk into compressed storage,
+        // only the non-zero values are kept
+        inline blaze::CompressedMatrix<double> parse_chunk_sparse(
+            csv_chunk const& chunk, csv_options const& options,
+            std::vector<std::ptrdiff_t> const& column_map,
+            std::size_t columns, std::string const& filename,
+            std::string const& name, std::string const& codename)
+        {
+            std::size_t row_begin =
+                (std::max)(chunk.first_row, options.row_begin);
+            std::size_t row_end =
+                (std::min)(chunk.first_row + chunk.rows, options.row_end);
 
-                            after_readln = matrix_array.size();
-                            if (n_rows == 0)
-                            {
-                                n_cols = matrix_array.size();
-                            }
-                            else if (n_cols != (after_readln - before_readln))
+            blaze::CompressedMatrix<double> result(
+                row_end - row_begin, columns);
+            std::vector<double> values(columns);
+
+            std::size_t row = chunk.first_row;
+            char const* first = chunk.begin;
+            while (first != chunk.end && row < row_end)
+            {
+                char const* line_end = find_line_end(first, chunk.end);
+                if (!is_blank_line(first, line_end))
+                {
+                    if (row >= row_begin)
+                    {
+                        if (parse_line(first, line_end, options.delimiter,
+                                column_map, values.data()) !=
+                            column_map.size())
+                        {
+                            throw std::runtime_error(
+                                util::generate_error_message(
+                                    "wrong data format, different number "
+                                    "of element in this row " +
+                                        filename + ':' + std::to_string(row),
+                                    name, codename));
+                        }
+
+                        std::size_t nonzeros = result.nonZeros() +
+                            std::count_if(values.begin(), values.end(),
+                                [](double v) { return v != 0.0; });
+                        if (result.capacity() < nonzeros)
+                        {
+                            result.reserve(2 * nonzeros);
+                        }
+
+                        std::size_t i = row - row_begin;
+                        for (std::size_t j = 0; j != columns; ++j)
+                        {
+                            if (values[j] != 0.0)
                             {
-                                throw std::runtime_error(
-                                    this_->generate_error_message(
-                                        "wrong data format, different number "
-                                        "of element in this row " + filename +
-                                        ':' + std::to_string(n_rows)));
+                                result.append(i, j, values[j]);
                             }
-                            n_rows++;
                         }
-                        current_line.clear();
+                        result.finalize(i);
                     }
-                    else
+                    ++row;
+                }
+                first = next_line(line_end, chunk.end);
+            }
+            return result;
+        }
+
+        // Parse the chunks concurrently into compressed storage and combine
+        // the partial results
+        inline primitive_argument_type read_csv_sparse(
+            std::vector<csv_chunk> const& chunks, csv_options const& options,
+            std::vector<std::ptrdiff_t> const& column_map,
+            std::size_t columns, std::string const& filename,
+            std::string const& name, std::string const& codename)
+        {
+            std::vector<hpx::future<blaze::CompressedMatrix<double>>> parsed;
+            parsed.reserve(chunks.size());
+            for (auto const& chunk : chunks)
+            {
+                // skip chunks that don't contain any of the requested rows
+                if (chunk.first_row + chunk.rows <= options.row_begin ||
+                    chunk.first_row >= options.row_end)
+                {
+                    continue;
+                }
+
+                parsed.push_back(hpx::async([&, chunk]() {
+                    return parse_chunk_sparse(chunk, options, column_map,
+                        columns, filename, name, codename);
+                }));
+            }
+            hpx::wait_all(parsed);
+
+            std::vector<blaze::CompressedMatrix<double>> parts;
+            parts.reserve(parsed.size());
+
+            std::size_t nonzeros = 0;
+            for (auto& f : parsed)
+            {
+                parts.push_back(f.get());
+                nonzeros += parts.back().nonZeros();
+            }
+
+            blaze::CompressedMatrix<double> result(
+                options.row_end - options.row_begin, columns);
+            result.reserve(nonzeros);
+
+            std::size_t i = 0;
+            for (auto const& part : parts)
+            {
+                for (std::size_t k = 0; k != part.rows(); ++k, ++i)
+                {
+                    for (auto it = part.begin(k); it != part.end(k); ++it)
                     {
-                        throw std::runtime_error(
-                            this_->generate_error_message("wrong data format " +
-                                filename + ':' + std::to_string(n_rows)));
+                        result.append(i, it->index(), it->value());
                     }
+                    result.finalize(i);
                 }
+            }
+            HPX_ASSERT(i == result.rows());
+
+            return primitive_argument_type{
+                ir::node_data<double>{std::move(result)}};
+        }
 
-                if (n_rows == 1)
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        primitive_argument_type read_csv(std::string const& filename,
+            csv_options const& options, std::string const& name,
+            std::string const& codename)
+        {
+            util::mapped_file file(filename);
+            if (!file.is_open())
+            {
+                throw std::runtime_error(util::generate_error_message(
+                    "couldn't open file: " + filename, name, codename));
+            }
+
+            char const* first = file.begin();
+            char const* last = file.end();
+
+            // skip leading blank lines
+            char const* line_end = first;
+            while (first != last)
+            {
+                line_end = find_line_end(first, last);
+                if (!is_blank_line(first, line_end))
                 {
-                    if (n_cols == 1)
+                    break;
+                }
+                first = next_line(line_end, last);
+            }
+
+            // the first line is a header if it does not consist of numbers
+            std::vector<std::ptrdiff_t> column_map;
+            std::size_t n_cols = 0;
+            if (first != last)
+            {
+                n_cols = parse_line<double>(
+                    first, line_end, options.delimiter, column_map, nullptr);
+                if (n_cols == 0)
+                {
+                    first = next_line(line_end, last);
+                    line_end = find_line_end(first, last);
+                    n_cols = parse_line<double>(first, line_end,
+                        options.delimiter, column_map, nullptr);
+                    if (n_cols == 0 && !is_blank_line(first, line_end))
                     {
-                        // scalar value
-                        return primitive_argument_type{
-                            ir::node_data<double>{matrix_array[0]}};
+                        throw std::runtime_error(util::generate_error_message(
+                            "wrong data format " + filename + ":0", name,
+                            codename));
                     }
+                }
+            }
 
-                    // vector
-                    blaze::DynamicVector<double> vector(n_cols,
-                        matrix_array.data());
+            // map the columns of the file onto the columns of the result
+            column_map.resize(n_cols, options.columns.empty() ? 0 : -1);
+            std::size_t n_result_cols = n_cols;
+            if (options.columns.empty())
+            {
+                for (std::size_t i = 0; i != n_cols; ++i)
+                {
+                    column_map[i] = i;
+                }
+            }
+            else
+            {
+                n_result_cols = options.columns.size();
+                for (std::size_t i = 0; i != n_result_cols; ++i)
+                {
+                    std::int64_t col = options.columns[i];
+                    if (col < 0)
+                    {
+                        col += n_cols;
+                    }
+                    if (col < 0 || col >= std::int64_t(n_cols))
+                    {
+                        throw std::runtime_error(util::generate_error_message(
+                            "column index out of bounds: " +
+                                std::to_string(options.columns[i]),
+                            name, codename));
+                    }
+                    if (column_map[col] != -1)
+                    {
+                        throw std::runtime_error(util::generate_error_message(
+                            "column selected more than once: " +
+                                std::to_string(options.columns[i]),
+                            name, codename));
+                    }
+                    column_map[col] = i;
+                }
+            }
 
-                    return primitive_argument_type{
-                        ir::node_data<double>{std::move(vector)}};
+            // count the rows in each of the chunks concurrently
+            std::vector<csv_chunk> chunks = split_into_chunks(first, last);
+            {
+                std::vector<hpx::future<void>> counted;
+                counted.reserve(chunks.size());
+                for (auto& chunk : chunks)
+                {
+                    counted.push_back(hpx::async([&chunk]() {
+                        chunk.rows = count_rows(chunk.begin, chunk.end);
+                    }));
                 }
+                hpx::wait_all(counted);
+            }
+
+            std::size_t n_rows = 0;
+            for (auto& chunk : chunks)
+            {
+                chunk.first_row = n_rows;
+                n_rows += chunk.rows;
+            }
+
+            std::size_t row_begin = (std::min)(options.row_begin, n_rows);
+            std::size_t row_end = (std::min)(options.row_end, n_rows);
+            if (row_end < row_begin)
+            {
+                row_end = row_begin;
+            }
 
-                // matrix
-                blaze::DynamicMatrix<double> matrix(
-                    n_rows, n_cols, matrix_array.data());
+            csv_options opts = options;
+            opts.row_begin = row_begin;
+            opts.row_end = row_end;
 
+            if (options.sparse)
+            {
+                return read_csv_sparse(chunks, opts, column_map,
+                    n_result_cols, filename, name, codename);
+            }
+
+            // parse the chunks concurrently, directly into the result
+            blaze::DynamicMatrix<T> result(
+                row_end - row_begin, n_result_cols);
+
+            std::vector<hpx::future<void>> parsed;
+            parsed.reserve(chunks.size());
+            for (auto const& chunk : chunks)
+            {
+                // skip chunks that don't contain any of the requested rows
+                if (chunk.first_row + chunk.rows <= row_begin ||
+                    chunk.first_row >= row_end)
+                {
+                    continue;
+                }
+
+                parsed.push_back(hpx::async([&, chunk]() {
+                    parse_chunk(chunk, opts, column_map, result, filename,
+                        name, codename);
+                }));
+            }
+            hpx::wait_all(parsed);
+
+            // rethrow exceptions, if any
+            for (auto& f : parsed)
+            {
+                f.get();
+            }
+
+            if (result.rows() == 1)
+            {
+                if (result.columns() == 1)
+                {
+                    // scalar value
+                    return primitive_argument_type{
+                        ir::node_data<T>{result(0, 0)}};
+                }
+
+                // vector
                 return primitive_argument_type{
-                    ir::node_data<double>{std::move(matrix)}};
+                    ir::node_data<T>{blaze::DynamicVector<T>(
+                        blaze::trans(blaze::row(result, 0)))}};
+            }
+
+            // matrix
+            return primitive_argument_type{ir::node_data<T>{std::move(result)}};
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // read data from given file and return content
+    hpx::future<primitive_argument_type> file_read_csv::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.empty() || operands.size() > 6)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_csv::eval",
+                generate_error_message(
+                    "the file_read_csv primitive requires between one and "
+                        "six arguments"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_csv::eval",
+                generate_error_message(
+                    "the file_read_csv primitive requires that the given "
+                        "operand is valid"));
+        }
+
+        std::string filename =
+            string_operand_sync(operands[0], args, name_, codename_, ctx);
+
+        detail::csv_options options;
+
+        // columns
+        if (operands.size() > 1 && valid(operands[1]))
+        {
+            auto columns =
+                value_operand_sync(operands[1], args, name_, codename_, ctx);
+            if (valid(columns))
+            {
+                if (is_list_operand_strict(columns))
+                {
+                    for (auto const& col : extract_list_value_strict(
+                             std::move(columns), name_, codename_))
+                    {
+                        options.columns.push_back(
+                            extract_scalar_integer_value_strict(
+                                col, name_, codename_));
+                    }
+                }
+                else
+                {
+                    options.columns.push_back(
+                        extract_scalar_integer_value_strict(
+                            std::move(columns), name_, codename_));
+                }
+            }
+        }
+
+        // dtype
+        if (operands.size() > 2 && valid(operands[2]))
+        {
+            auto dtype =
+                value_operand_sync(operands[2], args, name_, codename_, ctx);
+            if (valid(dtype))
+            {
+                options.dtype = map_dtype(
+                    extract_string_value(std::move(dtype), name_, codename_));
+                if (options.dtype == node_data_type_unknown)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::primitives::file_read_csv::"
+                            "eval",
+                        generate_error_message("unsupported dtype"));
+                }
+            }
+        }
+
+        // delimiter
+        if (operands.size() > 3 && valid(operands[3]))
+        {
+            std::string delimiter =
+                string_operand_sync(operands[3], args, name_, codename_, ctx);
+            if (delimiter.size() != 1 || delimiter[0] == '\n' ||
+                delimiter[0] == '\r')
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::primitives::file_read_csv::eval",
+                    generate_error_message(
+                        "the delimiter has to be a single character"));
+            }
+            options.delimiter = delimiter[0];
+        }
+
+        // rows
+        if (operands.size() > 4 && valid(operands[4]))
+        {
+            auto rows =
+                value_operand_sync(operands[4], args, name_, codename_, ctx);
+            if (valid(rows))
+            {
+                auto&& r = extract_list_value_strict(
+                    std::move(rows), name_, codename_);
+                if (r.size() != 2)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::primitives::file_read_csv::"
+                            "eval",
+                        generate_error_message(
+                            "the rows argument has to be a list of two "
+                            "integers: [start, stop)"));
+                }
+
+                auto it = r.begin();
+                std::int64_t start =
+                    extract_scalar_integer_value_strict(*it, name_, codename_);
+                std::int64_t stop = extract_scalar_integer_value_strict(
+                    *++it, name_, codename_);
+                if (start < 0 || stop < 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::primitives::file_read_csv::"
+                            "eval",
+                        generate_error_message(
+                            "the row range must not be negative"));
+                }
+                options.row_begin = std::size_t(start);
+                options.row_end = std::size_t(stop);
+            }
+        }
+
+        // sparse
+        if (operands.size() > 5 && valid(operands[5]))
+        {
+            options.sparse = boolean_operand_sync(
+                operands[5], args, name_, codename_, ctx) != 0;
+            if (options.sparse && options.dtype != node_data_type_double)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::primitives::file_read_csv::eval",
+                    generate_error_message(
+                        "compressed data can be read for the dtype "
+                        "'float64' only"));
+            }
+        }
+
+        auto this_ = this->shared_from_this();
+        return hpx::async(
+            [filename = std::move(filename), options = std::move(options),
+                this_ = std::move(this_)]()
+            ->  primitive_argument_type
+            {
+                switch (options.dtype)
+                {
+                case node_data_type_bool:
+                    return detail::read_csv<std::uint8_t>(
+                        filename, options, this_->name_, this_->codename_);
+
+                case node_data_type_int32:
+                    return detail::read_csv<std::int32_t>(
+                        filename, options, this_->name_, this_->codename_);
+
+                case node_data_type_int64:
+                    return detail::read_csv<std::int64_t>(
+                        filename, options, this_->name_, this_->codename_);
+
+                case node_data_type_float32:
+                    return detail::read_csv<float>(
+                        filename, options, this_->name_, this_->codename_);
+
+                case node_data_type_double: HPX_FALLTHROUGH;
+                default:
+                    break;
+                }
+                return detail::read_csv<double>(
+                    filename, options, this_->name_, this_->codename_);
             });
     }
 }}}
@@ -6,20 +6,26 @@
 #include <phylanx/config.hpp>
 
 #if defined(PHYLANX_HAVE_HIGHFIVE)
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/ir/ranges.hpp>
 #include <phylanx/plugins/fileio/file_read_hdf5.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
+#include <hpx/include/runtime.hpp>
 #include <hpx/include/util.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/util/format.hpp>
 
 #include <phylanx/util/detail/blaze-highfive.hpp>
 #include <highfive/H5DataSet.hpp>
 #include <highfive/H5DataSpace.hpp>
 #include <highfive/H5File.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <utility>
@@ -29,100 +35,357 @@
 namespace phylanx { namespace execution_tree { namespace primitives
 {
     ///////////////////////////////////////////////////////////////////////////
-    match_pattern_type const file_read_hdf5::match_data =
+    std::vector<match_pattern_type> const file_read_hdf5::match_data =
     {
         hpx::util::make_tuple("file_read_hdf5",
-            std::vector<std::string>{"file_read_hdf5(_1, _2)"},
+            std::vector<std::string>{
+                "file_read_hdf5(_1, _2, __arg(_3_rows, nil), "
+                    "__arg(_4_columns, nil))"
+            },
             &create_file_read_hdf5, &create_primitive<file_read_hdf5>,
-            R"(fname,dsetname
+            R"(fname, dsetname, rows, columns
             Args:
 
                 fname (string) : a file name
                 dsetname (string) : a dataset name
+                rows (optional, list) : the rows to read, given as
+                    list(start, stop) or list(start, stop, step) (default:
+                    all rows)
+                columns (optional, list) : the columns to read, given as
+                    list(start, stop) or list(start, stop, step) (default:
+                    all columns)
 
             Returns:
 
-            The dataset, either a matrix or vector.)"
+            The selected part of the dataset, either a matrix or vector. Only
+            the selected hyperslab is read from the file.)"
+            ),
+
+        hpx::util::make_tuple("file_read_hdf5_blocks",
+            std::vector<std::string>{"file_read_hdf5_blocks(_1, _2, _3)"},
+            &create_file_read_hdf5_blocks, &create_primitive<file_read_hdf5>,
+            R"(fname, dsetname, blocksize
+            Args:
+
+                fname (string) : a file name
+                dsetname (string) : a dataset name
+                blocksize (int) : the number of rows in each of the blocks
+
+            Returns:
+
+            A list of functions, each of which reads the next block of rows
+            of the dataset whenever it is evaluated. The list can be iterated
+            using for_each or fold_left, which allows to process datasets that
+            do not fit into memory.)"
             )
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        file_read_hdf5::read_mode extract_read_mode(std::string const& name)
+        {
+            if (name.find("file_read_hdf5_blocks") != std::string::npos)
+            {
+                return file_read_hdf5::read_mode_blocks;
+            }
+            return file_read_hdf5::read_mode_dataset;
+        }
+    }
+
     file_read_hdf5::file_read_hdf5(
             primitive_arguments_type && operands,
             std::string const& name, std::string const& codename)
       : primitive_component_base(std::move(operands), name, codename)
+      , mode_(detail::extract_read_mode(name))
     {
     }
 
-    // read data from given file and return content
-    hpx::future<primitive_argument_type> file_read_hdf5::eval(
-        primitive_arguments_type const& operands,
-        primitive_arguments_type const& args, eval_context ctx) const
+    ///////////////////////////////////////////////////////////////////////////
+    file_read_hdf5::slab file_read_hdf5::extract_slab(
+        primitive_argument_type&& val, std::size_t size,
+        char const* argname) const
     {
-        if (operands.size() != 2)
+        if (!valid(val))
+        {
+            return slab{0, size, 1};
+        }
+
+        auto&& r = extract_list_value_strict(std::move(val), name_, codename_);
+        if (r.size() != 2 && r.size() != 3)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "phylanx::execution_tree::primitives::file_read_hdf5::eval",
-                generate_error_message(
-                    "the file_read_hdf5 primitive requires exactly two "
-                        "literal arguments"));
+                "phylanx::execution_tree::primitives::file_read_hdf5::"
+                    "extract_slab",
+                generate_error_message(hpx::util::format(
+                    "the '{}' argument must be a list of two or three "
+                    "integers: list(start, stop[, step])", argname)));
         }
 
-        if (!valid(operands[0]) || !valid(operands[1]))
+        auto it = r.begin();
+        std::int64_t start =
+            extract_scalar_integer_value_strict(*it, name_, codename_);
+        std::int64_t stop =
+            extract_scalar_integer_value_strict(*++it, name_, codename_);
+        std::int64_t step = 1;
+        if (r.size() == 3)
+        {
+            step = extract_scalar_integer_value_strict(*++it, name_, codename_);
+        }
+
+        // negative indices count from the end of the dimension
+        if (start < 0)
+        {
+            start += size;
+        }
+        if (stop < 0)
+        {
+            stop += size;
+        }
+        stop = (std::min)(stop, std::int64_t(size));
+
+        if (start < 0 || start > stop || step <= 0)
         {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
-                "phylanx::execution_tree::primitives::file_read_hdf5::eval",
-                generate_error_message(
-                    "the file_read_hdf5 primitive requires that the given "
-                        "operand is valid"));
+                "phylanx::execution_tree::primitives::file_read_hdf5::"
+                    "extract_slab",
+                generate_error_message(hpx::util::format(
+                    "invalid '{}' selection: list({}, {}, {}), the dataset "
+                    "has {} elements along this dimension",
+                    argname, start, stop, step, size)));
         }
 
-        std::string filename =
-            string_operand_sync(operands[0], args, name_, codename_, ctx);
-        std::string datasetName =
-            string_operand_sync(operands[1], args, name_, codename_, ctx);
+        return slab{std::size_t(start),
+            std::size_t((stop - start + step - 1) / step), std::size_t(step)};
+    }
 
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type file_read_hdf5::read_dataset(
+        std::string const& filename, std::string const& dataset,
+        primitive_argument_type&& rows, primitive_argument_type&& columns) const
+    {
         HighFive::File infile(filename, HighFive::File::ReadOnly);
-        HighFive::DataSet dataSet = infile.getDataSet(datasetName);
+        HighFive::DataSet dataSet = infile.getDataSet(dataset);
         HighFive::DataSpace dataSpace = dataSet.getSpace();
 
         switch (dataSpace.getNumberDimensions())
         {
         case 0:
             {
+                if (valid(rows) || valid(columns))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::primitives::file_read_hdf5::"
+                            "read_dataset",
+                        generate_error_message(
+                            "a selection can't be applied to a scalar "
+                            "dataset"));
+                }
+
                 // scalar value
                 double scalar;
                 dataSet.read(scalar);
-                return hpx::make_ready_future(
-                    primitive_argument_type{ir::node_data<double>{scalar}});
+                return primitive_argument_type{ir::node_data<double>{scalar}};
             }
 
         case 1:
             {
+                if (valid(columns))
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "phylanx::execution_tree::primitives::file_read_hdf5::"
+                            "read_dataset",
+                        generate_error_message(
+                            "a column selection can't be applied to a "
+                            "one-dimensional dataset"));
+                }
+
                 // vector
                 std::vector<std::size_t> dims = dataSpace.getDimensions();
-                blaze::DynamicVector<double> vector(dims[0]);
-                dataSet.read(vector);
-                return hpx::make_ready_future(primitive_argument_type{
-                    ir::node_data<double>{std::move(vector)}});
+                blaze::DynamicVector<double> vector;
+                if (!valid(rows))
+                {
+                    vector.resize(dims[0]);
+                    dataSet.read(vector);
+                }
+                else
+                {
+                    slab r = extract_slab(std::move(rows), dims[0], "rows");
+                    vector.resize(r.count);
+                    if (r.count != 0)
+                    {
+                        dataSet.select({r.start}, {r.count}, {r.step})
+                            .read(vector);
+                    }
+                }
+                return primitive_argument_type{
+                    ir::node_data<double>{std::move(vector)}};
             }
 
         case 2:
             {
                 // matrix
                 std::vector<std::size_t> dims = dataSpace.getDimensions();
-                blaze::DynamicMatrix<double> matrix(dims[0], dims[1]);
-                dataSet.read(matrix);
-                return hpx::make_ready_future(primitive_argument_type{
-                    ir::node_data<double>{std::move(matrix)}});
+                blaze::DynamicMatrix<double> matrix;
+                if (!valid(rows) && !valid(columns))
+                {
+                    matrix.resize(dims[0], dims[1]);
+                    dataSet.read(matrix);
+                }
+                else
+                {
+                    slab r = extract_slab(std::move(rows), dims[0], "rows");
+                    slab c =
+                        extract_slab(std::move(columns), dims[1], "columns");
+                    matrix.resize(r.count, c.count);
+                    if (r.count != 0 && c.count != 0)
+                    {
+                        dataSet
+                            .select({r.start, c.start}, {r.count, c.count},
+                                {r.step, c.step})
+                            .read(matrix);
+                    }
+                }
+                return primitive_argument_type{
+                    ir::node_data<double>{std::move(matrix)}};
             }
 
         default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "phylanx::execution_tree::primitives::file_read_hdf5::"
+                "read_dataset",
+            generate_error_message(
+                "the input file has incompatible number of dimensions"));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type file_read_hdf5::read_blocks(
+        std::string const& filename, std::string const& dataset,
+        std::int64_t blocksize) const
+    {
+        if (blocksize <= 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_hdf5::"
+                    "read_blocks",
+                generate_error_message("the block size must be positive"));
+        }
+
+        // only the meta data of the dataset is accessed here
+        std::size_t rows = 0;
+        {
+            HighFive::File infile(filename, HighFive::File::ReadOnly);
+            HighFive::DataSpace dataSpace =
+                infile.getDataSet(dataset).getSpace();
+
+            std::size_t numdims = dataSpace.getNumberDimensions();
+            if (numdims != 1 && numdims != 2)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "phylanx::execution_tree::primitives::file_read_hdf5::"
+                        "read_blocks",
+                    generate_error_message(
+                        "the dataset must be one- or two-dimensional to be "
+                        "read in blocks"));
+            }
+            rows = dataSpace.getDimensions()[0];
+        }
+
+        compiler::primitive_name_parts name_parts =
+            compiler::parse_primitive_name(name_);
+        name_parts.primitive = "file_read_hdf5";
+
+        // create one (unevaluated) reader for each of the blocks, the data
+        // is loaded only once the corresponding list element is evaluated;
+        // the readers are referenced through the returned list only, so
+        // they don't need to be registered with AGAS
+        primitive_arguments_type blocks;
+        blocks.reserve((rows + blocksize - 1) / blocksize);
+
+        for (std::size_t start = 0; start < rows; start += blocksize)
+        {
+            std::int64_t stop =
+                (std::min)(std::int64_t(start + blocksize), std::int64_t(rows));
+
+            primitive_arguments_type operands;
+            operands.reserve(4);
+            operands.emplace_back(filename);
+            operands.emplace_back(dataset);
+            operands.emplace_back(ir::range(primitive_arguments_type{
+                primitive_argument_type{std::int64_t(start)},
+                primitive_argument_type{stop}}));
+            operands.emplace_back(primitive_argument_type{});
+
+            name_parts.sequence_number = blocks.size();
+            blocks.emplace_back(create_primitive_component(hpx::find_here(),
+                name_parts.primitive, std::move(operands),
+                compiler::compose_primitive_name(name_parts), codename_,
+                false));
+        }
+
+        return primitive_argument_type{std::move(blocks)};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // read data from given file and return content
+    hpx::future<primitive_argument_type> file_read_hdf5::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (mode_ == read_mode_blocks ? operands.size() != 3 :
+                (operands.size() < 2 || operands.size() > 4))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::execution_tree::primitives::file_read_hdf5::eval",
+                generate_error_message(mode_ == read_mode_blocks ?
+                    "the file_read_hdf5_blocks primitive requires exactly "
+                        "three arguments" :
+                    "the file_read_hdf5 primitive requires between two and "
+                        "four arguments"));
+        }
+
+        if (!valid(operands[0]) || !valid(operands[1]))
+        {
             HPX_THROW_EXCEPTION(hpx::bad_parameter,
                 "phylanx::execution_tree::primitives::file_read_hdf5::eval",
                 generate_error_message(
-                    "the input file has incompatible number of dimensions"));
+                    "the file_read_hdf5 primitive requires that the given "
+                        "operand is valid"));
         }
+
+        std::string filename =
+            string_operand_sync(operands[0], args, name_, codename_, ctx);
+        std::string datasetName =
+            string_operand_sync(operands[1], args, name_, codename_, ctx);
+
+        if (mode_ == read_mode_blocks)
+        {
+            std::int64_t blocksize = extract_scalar_integer_value_strict(
+                value_operand_sync(operands[2], args, name_, codename_, ctx),
+                name_, codename_);
+
+            return hpx::make_ready_future(
+                read_blocks(filename, datasetName, blocksize));
+        }
+
+        primitive_argument_type rows;
+        if (operands.size() > 2 && valid(operands[2]))
+        {
+            rows = value_operand_sync(operands[2], args, name_, codename_, ctx);
+        }
+
+        primitive_argument_type columns;
+        if (operands.size() > 3 && valid(operands[3]))
+        {
+            columns =
+                value_operand_sync(operands[3], args, name_, codename_, ctx);
+        }
+
+        return hpx::make_ready_future(read_dataset(
+            filename, datasetName, std::move(rows), std::move(columns)));
     }
 }}}
 
@@ -5,6 +5,7 @@
 
 #include <phylanx/config.hpp>
 #include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/fileio/array_file.hpp>
 #include <phylanx/plugins/fileio/file_write.hpp>
 #include <phylanx/util/serialization/ast.hpp>
 #include <phylanx/util/serialization/execution_tree.hpp>
@@ -16,7 +17,6 @@
 #include <hpx/runtime/threads/run_as_os_thread.hpp>
 
 #include <cstddef>
-#include <fstream>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -36,7 +36,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
             Args:
 
                 fname (string): the file in which to save the data
-                obj (object): the object to serialize
+                obj (object): the object to serialize, numeric and boolean
+                    arrays are stored in the native array format, which
+                    file_read maps into memory without copying
 
             Returns:)"
             )
@@ -56,20 +58,17 @@ namespace phylanx { namespace execution_tree { namespace primitives
             [this_ = std::move(this_)](
                 primitive_argument_type && val, std::string && filename)
             {
-                std::ofstream outfile(filename.c_str(),
-                    std::ios::binary | std::ios::out | std::ios::trunc);
-                if (!outfile.is_open())
+                if (detail::is_array_file_value(val))
                 {
-                    throw std::runtime_error(this_->generate_error_message(
-                        "couldn't open file: " + filename));
+                    detail::write_array_file(
+                        filename, val, this_->name_, this_->codename_);
                 }
-
-                std::vector<char> data = phylanx::util::serialize(val);
-                if (!outfile.write(data.data(), data.size()))
+                else
                 {
-                    throw std::runtime_error(this_->generate_error_message(
-                        "couldn't read expected number of bytes from file: " +
-                        filename));
+                    std::vector<char> data = phylanx::util::serialize(val);
+                    detail::replace_file(filename,
+                        {{data.data(), data.size()}}, this_->name_,
+                        this_->codename_);
                 }
                 return primitive_argument_type{std::move(val)};
             },
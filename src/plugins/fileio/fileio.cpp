@@ -20,7 +20,9 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(file_write_csv_plugin,
 
 #if defined(PHYLANX_HAVE_HIGHFIVE)
 PHYLANX_REGISTER_PLUGIN_FACTORY(file_read_hdf5_plugin,
-    phylanx::execution_tree::primitives::file_read_hdf5::match_data);
+    phylanx::execution_tree::primitives::file_read_hdf5::match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(file_read_hdf5_blocks_plugin,
+    phylanx::execution_tree::primitives::file_read_hdf5::match_data[1]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(file_write_hdf5_plugin,
     phylanx::execution_tree::primitives::file_write_hdf5::match_data);
 #endif
@@ -585,6 +585,20 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             extract_integer_value(
                                 std::move(op2), this_->name_, this_->codename_));
 
+                    case node_data_type_int32:
+                        return this_->batch_dot_nd(
+                            extract_int32_value(
+                                std::move(op1), this_->name_, this_->codename_),
+                            extract_int32_value(
+                                std::move(op2), this_->name_, this_->codename_));
+
+                    case node_data_type_float32:
+                        return this_->batch_dot_nd(
+                            extract_float32_value(
+                                std::move(op1), this_->name_, this_->codename_),
+                            extract_float32_value(
+                                std::move(op2), this_->name_, this_->codename_));
+
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
                     case node_data_type_double:
@@ -646,6 +660,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(op2), this_->name_, this_->codename_),
                             std::move(axes));
 
+                    case node_data_type_int32:
+                        return this_->batch_dot_nd(
+                            extract_int32_value(
+                                std::move(op1), this_->name_, this_->codename_),
+                            extract_int32_value(
+                                std::move(op2), this_->name_, this_->codename_),
+                            std::move(axes));
+
+                    case node_data_type_float32:
+                        return this_->batch_dot_nd(
+                            extract_float32_value(
+                                std::move(op1), this_->name_, this_->codename_),
+                            extract_float32_value(
+                                std::move(op2), this_->name_, this_->codename_),
+                            std::move(axes));
+
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
                     case node_data_type_double:
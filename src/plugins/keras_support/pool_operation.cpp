@@ -2160,11 +2160,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 extract_boolean_value(std::move(args[0]),
                                     this_->name_, this_->codename_),
                                 std::move(pool_size), std::move(padding));
+                        case node_data_type_int32: HPX_FALLTHROUGH;
                         case node_data_type_int64:
                             return this_->max_pool_nd(
                                 extract_integer_value(std::move(args[0]),
                                     this_->name_, this_->codename_),
                                 std::move(pool_size), std::move(padding));
+                        case node_data_type_float32: HPX_FALLTHROUGH;
                         case node_data_type_double:
                             return this_->max_pool_nd(
                                 extract_numeric_value(std::move(args[0]),
@@ -2201,12 +2203,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                     this_->name_, this_->codename_),
                                 std::move(pool_size), std::move(padding),
                                 std::move(strides));
+                        case node_data_type_int32: HPX_FALLTHROUGH;
                         case node_data_type_int64:
                             return this_->max_pool_nd(
                                 extract_integer_value(std::move(args[0]),
                                     this_->name_, this_->codename_),
                                 std::move(pool_size), std::move(padding),
                                 std::move(strides));
+                        case node_data_type_float32: HPX_FALLTHROUGH;
                         case node_data_type_double:
                             return this_->max_pool_nd(
                                 extract_numeric_value(std::move(args[0]),
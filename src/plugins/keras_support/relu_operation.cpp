@@ -235,6 +235,40 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[0]), this_->name_, this_->codename_),
                         alpha, max_value, threshold);
                 }
+                case node_data_type_int32:
+                {
+                    std::int32_t max_value;
+                    if (args.size() < 3 || !valid(args[2]))
+                    {
+                        max_value = (std::numeric_limits<std::int32_t>::max)();
+                    }
+                    else
+                    {
+                        max_value = extract_scalar_int32_value(
+                            std::move(args[2]), this_->name_, this_->codename_);
+                    }
+                    return this_->relu_helper<std::int32_t>(
+                        extract_int32_value(
+                            std::move(args[0]), this_->name_, this_->codename_),
+                        alpha, max_value, threshold);
+                }
+                case node_data_type_float32:
+                {
+                    float max_value;
+                    if (args.size() < 3 || !valid(args[2]))
+                    {
+                        max_value = (std::numeric_limits<float>::max)();
+                    }
+                    else
+                    {
+                        max_value = extract_scalar_float32_value(
+                            std::move(args[2]), this_->name_, this_->codename_);
+                    }
+                    return this_->relu_helper<float>(
+                        extract_float32_value(
+                            std::move(args[0]), this_->name_, this_->codename_),
+                        alpha, max_value, threshold);
+                }
                 case node_data_type_bool:
                 {
                     std::uint8_t max_value;
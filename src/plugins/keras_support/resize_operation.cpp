@@ -173,6 +173,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(width_factor),
                                 std::move(interpolation));
 
+                        case node_data_type_int32: HPX_FALLTHROUGH;
                         case node_data_type_int64:
                             return this_->nearest(
                                 extract_integer_value(std::move(arg),
@@ -183,6 +184,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
                         case node_data_type_unknown:
                             HPX_FALLTHROUGH;
+                        case node_data_type_float32: HPX_FALLTHROUGH;
                         case node_data_type_double:
                             return this_->nearest(
                                 extract_numeric_value(std::move(arg),
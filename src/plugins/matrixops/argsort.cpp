@@ -8,6 +8,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/argsort.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
+#include <phylanx/util/parallel_sort.hpp>
 
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/lcos.hpp>
@@ -87,7 +88,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         auto flatten = blaze::ravel(mat);
         blaze::DynamicVector<std::int64_t> idx(mat.rows() * mat.columns());
         std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(),
+        util::parallel_sort(idx.begin(), idx.end(),
             [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
         return primitive_argument_type{std::move(idx)};
     }
@@ -102,7 +103,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         blaze::DynamicVector<std::int64_t> idx(
             tensor.pages() * tensor.rows() * tensor.columns());
         std::iota(idx.begin(), idx.end(), 0);
-        std::sort(idx.begin(), idx.end(),
+        util::parallel_sort(idx.begin(), idx.end(),
             [&flatten](size_t a, size_t b) { return flatten[a] < flatten[b]; });
         return primitive_argument_type{std::move(idx)};
     }
@@ -155,11 +156,13 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                 extract_boolean_value_strict(
                     std::move(in_array), name_, codename_),
                 axis, kind, order);
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return argsort_flatten_helper(
                 extract_integer_value_strict(
                     std::move(in_array), name_, codename_),
                 axis, kind, order);
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return argsort_flatten_helper(
                 extract_numeric_value_strict(
@@ -188,7 +191,7 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
             auto vec = in_array.vector();
             blaze::DynamicVector<std::int64_t> idx(vec.size());
             std::iota(idx.begin(), idx.end(), 0);
-            std::sort(idx.begin(), idx.end(),
+            util::parallel_sort(idx.begin(), idx.end(),
                 [&vec](size_t a, size_t b) { return vec[a] < vec[b]; });
             return primitive_argument_type{std::move(idx)};
         }
@@ -206,20 +209,19 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         auto mat = in_array.matrix();
         blaze::DynamicMatrix<std::int64_t> idx(mat.rows(), mat.columns());
 
-        matrix_column_iterator<decltype(mat)> mat_cols_begin(mat);
-        matrix_column_iterator<decltype(mat)> mat_cols_end(mat, mat.columns());
+        matrix_column_iterator<decltype(mat)> const mat_cols_begin(mat);
+        matrix_column_iterator<decltype(idx)> const idx_cols_begin(idx);
 
-        matrix_column_iterator<decltype(idx)> idx_cols_it(idx);
+        util::for_each_slice(mat.columns(), mat.rows(), [&](std::size_t i) {
+            auto mat_col = mat_cols_begin + i;
+            auto idx_col = idx_cols_begin + i;
 
-        for (auto mat_col = mat_cols_begin; mat_col != mat_cols_end;
-             ++mat_col, ++idx_cols_it)
-        {
-            std::iota(idx_cols_it->begin(), idx_cols_it->end(), 0);
-            std::sort(idx_cols_it->begin(), idx_cols_it->end(),
+            std::iota(idx_col->begin(), idx_col->end(), 0);
+            std::sort(idx_col->begin(), idx_col->end(),
                 [mat_col](size_t a, size_t b) {
                     return *(mat_col->begin() + a) < *(mat_col->begin() + b);
                 });
-        }
+        });
 
         return primitive_argument_type{std::move(idx)};
     }
@@ -232,20 +234,19 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         auto mat = in_array.matrix();
         blaze::DynamicMatrix<std::int64_t> idx(mat.rows(), mat.columns());
 
-        matrix_row_iterator<decltype(mat)> mat_rows_begin(mat);
-        matrix_row_iterator<decltype(mat)> mat_rows_end(mat, mat.rows());
+        matrix_row_iterator<decltype(mat)> const mat_rows_begin(mat);
+        matrix_row_iterator<decltype(idx)> const idx_rows_begin(idx);
 
-        matrix_row_iterator<decltype(idx)> idx_rows_it(idx);
+        util::for_each_slice(mat.rows(), mat.columns(), [&](std::size_t i) {
+            auto mat_row = mat_rows_begin + i;
+            auto idx_row = idx_rows_begin + i;
 
-        for (auto mat_row = mat_rows_begin; mat_row != mat_rows_end;
-             ++mat_row, ++idx_rows_it)
-        {
-            std::iota(idx_rows_it->begin(), idx_rows_it->end(), 0);
-            std::sort(idx_rows_it->begin(), idx_rows_it->end(),
+            std::iota(idx_row->begin(), idx_row->end(), 0);
+            std::sort(idx_row->begin(), idx_row->end(),
                 [mat_row](size_t a, size_t b) {
                     return *(mat_row->begin() + a) < *(mat_row->begin() + b);
                 });
-        }
+        });
 
         return primitive_argument_type{std::move(idx)};
     }
@@ -282,30 +283,25 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
 
-        for (size_t row = 0; row < tensor.rows(); ++row)
-        {
-            auto tensor_row_slice = blaze::rowslice(tensor, row);
-            matrix_row_iterator<decltype(tensor_row_slice)> const
-                mat_slice_rows_begin(tensor_row_slice);
-            matrix_row_iterator<decltype(tensor_row_slice)> const
-                mat_slice_rows_end(tensor_row_slice, tensor_row_slice.rows());
-
-            auto idx_row_slice = blaze::rowslice(idx, row);
-            matrix_row_iterator<decltype(idx_row_slice)> const
-                idx_slice_rows_begin(idx_row_slice);
-
-            auto idx_row = idx_slice_rows_begin;
-            for (auto mat_row = mat_slice_rows_begin;
-                 mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
-            {
+        // every row of a row slice is sorted independently
+        util::for_each_slice(tensor.rows() * tensor.columns(), tensor.pages(),
+            [&](std::size_t k) {
+                auto tensor_row_slice =
+                    blaze::rowslice(tensor, k / tensor.columns());
+                matrix_row_iterator<decltype(tensor_row_slice)> const mat_row(
+                    tensor_row_slice, k % tensor.columns());
+
+                auto idx_row_slice = blaze::rowslice(idx, k / tensor.columns());
+                matrix_row_iterator<decltype(idx_row_slice)> const idx_row(
+                    idx_row_slice, k % tensor.columns());
+
                 std::iota(idx_row->begin(), idx_row->end(), 0);
                 std::sort(idx_row->begin(), idx_row->end(),
                     [mat_row](size_t a, size_t b) {
                         return *(mat_row->begin() + a) <
                             *(mat_row->begin() + b);
                     });
-            }
-        }
+            });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -318,31 +314,26 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
 
-        for (size_t page = 0; page < tensor.columns(); ++page)
-        {
-            auto tensor_col_slice = blaze::columnslice(tensor, page);
-            matrix_row_iterator<decltype(tensor_col_slice)> const
-                mat_slice_rows_begin(tensor_col_slice);
-            matrix_row_iterator<decltype(tensor_col_slice)> const
-                mat_slice_rows_end(
-                    tensor_col_slice, tensor_col_slice.columns());
-
-            auto idx_col_slice = blaze::columnslice(idx, page);
-            matrix_row_iterator<decltype(idx_col_slice)> const
-                idx_slice_rows_begin(idx_col_slice);
-
-            auto idx_row = idx_slice_rows_begin;
-            for (auto mat_row = mat_slice_rows_begin;
-                 mat_row != mat_slice_rows_end; ++mat_row, ++idx_row)
-            {
+        // every row of a column slice is sorted independently
+        util::for_each_slice(tensor.columns() * tensor.pages(), tensor.rows(),
+            [&](std::size_t k) {
+                auto tensor_col_slice =
+                    blaze::columnslice(tensor, k / tensor.pages());
+                matrix_row_iterator<decltype(tensor_col_slice)> const mat_row(
+                    tensor_col_slice, k % tensor.pages());
+
+                auto idx_col_slice =
+                    blaze::columnslice(idx, k / tensor.pages());
+                matrix_row_iterator<decltype(idx_col_slice)> const idx_row(
+                    idx_col_slice, k % tensor.pages());
+
                 std::iota(idx_row->begin(), idx_row->end(), 0);
                 std::sort(idx_row->begin(), idx_row->end(),
                     [mat_row](size_t a, size_t b) {
                         return *(mat_row->begin() + a) <
                             *(mat_row->begin() + b);
                     });
-            }
-        }
+            });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -355,32 +346,25 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
         blaze::DynamicTensor<std::int64_t> idx(
             tensor.pages(), tensor.rows(), tensor.columns());
 
-        for (size_t page = 0; page < tensor.pages(); ++page)
-        {
-            auto tensor_page_slice = blaze::pageslice(tensor, page);
-
-            matrix_row_iterator<decltype(tensor_page_slice)> const
-                mat_slice_pages_begin(tensor_page_slice);
-            matrix_row_iterator<decltype(tensor_page_slice)> const
-                mat_slice_pages_end(
-                    tensor_page_slice, tensor_page_slice.rows());
-
-            auto idx_page_slice = blaze::pageslice(idx, page);
-            matrix_row_iterator<decltype(idx_page_slice)> const
-                idx_slice_pages_begin(idx_page_slice);
-
-            auto idx_page = idx_slice_pages_begin;
-            for (auto mat_page = mat_slice_pages_begin;
-                 mat_page != mat_slice_pages_end; ++mat_page, ++idx_page)
-            {
+        // every row of a page is sorted independently
+        util::for_each_slice(tensor.pages() * tensor.rows(), tensor.columns(),
+            [&](std::size_t k) {
+                auto tensor_page_slice =
+                    blaze::pageslice(tensor, k / tensor.rows());
+                matrix_row_iterator<decltype(tensor_page_slice)> const
+                    mat_page(tensor_page_slice, k % tensor.rows());
+
+                auto idx_page_slice = blaze::pageslice(idx, k / tensor.rows());
+                matrix_row_iterator<decltype(idx_page_slice)> const idx_page(
+                    idx_page_slice, k % tensor.rows());
+
                 std::iota(idx_page->begin(), idx_page->end(), 0);
                 std::sort(idx_page->begin(), idx_page->end(),
                     [mat_page](size_t a, size_t b) {
                         return *(mat_page->begin() + a) <
                             *(mat_page->begin() + b);
                     });
-            }
-        }
+            });
         return primitive_argument_type{std::move(idx)};
     }
 
@@ -485,12 +469,14 @@ https://docs.scipy.org/doc/numpy/reference/generated/numpy.argsort.html#numpy.ar
                                     this_->name_, this_->codename_),
                                 axis, kind, order);
 
+                        case node_data_type_int32: HPX_FALLTHROUGH;
                         case node_data_type_int64:
                             return this_->argsort_helper(
                                 extract_integer_value_strict(std::move(args[0]),
                                     this_->name_, this_->codename_),
                                 axis, kind, order);
 
+                        case node_data_type_float32: HPX_FALLTHROUGH;
                         case node_data_type_double:
                             return this_->argsort_helper(
                                 extract_numeric_value_strict(std::move(args[0]),
@@ -67,6 +67,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return astype_helper(extract_node_data<std::int64_t>(
                 std::move(op), name_, codename_));
 
+        case node_data_type_int32:
+            return astype_helper(extract_node_data<std::int32_t>(
+                std::move(op), name_, codename_));
+
+        case node_data_type_float32:
+            return astype_helper(
+                extract_node_data<float>(std::move(op), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return astype_helper(
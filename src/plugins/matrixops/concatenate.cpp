@@ -135,10 +135,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return concatenate1d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return concatenate1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate1d_helper<double>(std::move(args));
 
@@ -332,10 +334,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return concatenate2d_helper<std::uint8_t>(std::move(args), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return concatenate2d_helper<std::int64_t>(std::move(args), axis);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate2d_helper<double>(std::move(args), axis);
 
@@ -417,10 +421,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return concatenate_flatten_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return concatenate_flatten_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate_flatten_helper<double>(std::move(args));
 
@@ -715,10 +721,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return concatenate3d_helper<std::uint8_t>(std::move(args), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return concatenate3d_helper<std::int64_t>(std::move(args), axis);
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return concatenate3d_helper<double>(std::move(args), axis);
 
@@ -91,11 +91,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return diag0d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return diag0d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -126,11 +128,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return diag1d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return diag1d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -161,11 +165,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return diag2d(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 k);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return diag2d(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
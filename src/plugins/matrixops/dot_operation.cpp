@@ -54,7 +54,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
             Returns:
 
             The dot product of two arrays: `a` and `b`. The dot product of an
-            N-D array and an M-D array is of dimension N+M-2)"},
+            N-D array and an M-D array is of dimension N+M-2. Sparse operands
+            are multiplied without being converted to dense arrays, the result
+            is sparse if both operands are sparse (or one is a scalar).)"},
 
         match_pattern_type{"tensordot",
             std::vector<std::string>{
@@ -141,6 +143,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return dot0d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return dot0d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot0d(
@@ -173,6 +185,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return dot1d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return dot1d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot1d(
@@ -205,6 +227,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return dot2d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return dot2d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot2d(
@@ -238,6 +270,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return dot3d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return dot3d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dot3d(
@@ -271,6 +313,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return outer1d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return outer1d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -304,6 +356,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return outer2d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return outer2d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -338,6 +400,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return outer3d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return outer3d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -372,6 +444,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return contraction2d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return contraction2d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -406,6 +488,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return contraction3d(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return contraction3d(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -443,6 +535,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(rhs), name_, codename_), axis_a,
                 axis_b);
 
+        case node_data_type_int32:
+            return tensordot_range_of_scalars(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_), axis_a,
+                axis_b);
+
+        case node_data_type_float32:
+            return tensordot_range_of_scalars(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_), axis_a,
+                axis_b);
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -477,6 +581,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_integer_value(std::move(lhs), name_, codename_),
                 extract_integer_value(std::move(rhs), name_, codename_));
 
+        case node_data_type_int32:
+            return outer_nd_helper(
+                extract_int32_value(std::move(lhs), name_, codename_),
+                extract_int32_value(std::move(rhs), name_, codename_));
+
+        case node_data_type_float32:
+            return outer_nd_helper(
+                extract_float32_value(std::move(lhs), name_, codename_),
+                extract_float32_value(std::move(rhs), name_, codename_));
+
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
         case node_data_type_double:
@@ -676,8 +790,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         std::move(op1), std::move(op2));
 
                 else if (this_->mode_ == dot_product)
-
+                {
+                    if (is_sparse_operand(op1) || is_sparse_operand(op2))
+                    {
+                        return this_->dot_sparse(
+                            std::move(op1), std::move(op2));
+                    }
                     return this_->dot_nd(std::move(op1), std::move(op2));
+                }
 
                 else if (this_->mode_ == doubledot_product)
 
@@ -0,0 +1,205 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/matrixops/dot_operation.hpp>
+
+#include <hpx/throw_exception.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        using dims = std::integral_constant<std::size_t, N>;
+
+        template <typename T>
+        using dims_of = dims<blaze::IsMatrix<T>::value ?
+            2 : (blaze::IsVector<T>::value ? 1 : 0)>;
+
+        // Materialize the given expression, the result is stored in
+        // compressed format only if Blaze deduces a sparse result type
+        // (e.g. for sparse * sparse or sparse * scalar).
+        template <typename Expr>
+        ir::node_data<double> make_node_data(Expr const& expr)
+        {
+            using result_type = blaze::ResultType_t<Expr>;
+            using storage_type = typename std::conditional<
+                blaze::IsMatrix<result_type>::value,
+                typename std::conditional<
+                    blaze::IsSparseMatrix<result_type>::value,
+                    ir::node_data<double>::sparse_storage2d_type,
+                    ir::node_data<double>::storage2d_type>::type,
+                typename std::conditional<
+                    blaze::IsSparseVector<result_type>::value,
+                    ir::node_data<double>::sparse_storage1d_type,
+                    ir::node_data<double>::storage1d_type>::type>::type;
+
+            return ir::node_data<double>{storage_type(expr)};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct sparse_dot
+        {
+            template <typename Lhs, typename Rhs>
+            ir::node_data<double> operator()(
+                Lhs const& lhs, Rhs const& rhs) const
+            {
+                return call(lhs, rhs, dims_of<Lhs>{}, dims_of<Rhs>{});
+            }
+
+        private:
+            template <typename Lhs, typename Rhs>
+            static ir::node_data<double> call(
+                Lhs const& lhs, Rhs const& rhs, dims<0>, dims<0>)
+            {
+                return ir::node_data<double>{lhs * rhs};
+            }
+
+            template <typename Lhs, typename Rhs, std::size_t N>
+            static ir::node_data<double> call(
+                Lhs const& lhs, Rhs const& rhs, dims<0>, dims<N>)
+            {
+                return make_node_data(lhs * rhs);
+            }
+
+            template <typename Lhs, typename Rhs, std::size_t N>
+            static ir::node_data<double> call(
+                Lhs const& lhs, Rhs const& rhs, dims<N>, dims<0>)
+            {
+                return make_node_data(lhs * rhs);
+            }
+
+            template <typename Lhs, typename Rhs>
+            static ir::node_data<double> call(
+                Lhs const& lhs, Rhs const& rhs, dims<1>, dims<1>)
+            {
+                return ir::node_data<double>{double(blaze::dot(lhs, rhs))};
+            }
+
+            template <typename Lhs, typename Rhs>
+            static ir::node_data<double> call(
+                Lhs const& lhs, Rhs const& rhs, dims<1>, dims<2>)
+            {
+                return make_node_data(
+                    blaze::trans(blaze::trans(lhs) * rhs));
+            }
+
+            template <typename Lhs, typename Rhs>
+            static ir::node_data<double> call(
+                Lhs const& lhs, Rhs const& rhs, dims<2>, dims<1>)
+            {
+                return make_node_data(lhs * rhs);
+            }
+
+            template <typename Lhs, typename Rhs>
+            static ir::node_data<double> call(
+                Lhs const& lhs, Rhs const& rhs, dims<2>, dims<2>)
+            {
+                return make_node_data(lhs * rhs);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke the given function with the (dense or sparse) Blaze object
+        // held by the given node_data.
+        template <typename F>
+        ir::node_data<double> visit_array(
+            ir::node_data<double> const& nd, F&& f)
+        {
+            switch (nd.index())
+            {
+            case ir::node_data<double>::storage0d:         HPX_FALLTHROUGH;
+            case ir::node_data<double>::custom_storage0d:
+                return f(nd.scalar());
+
+            case ir::node_data<double>::storage1d:         HPX_FALLTHROUGH;
+            case ir::node_data<double>::custom_storage1d:
+                return f(nd.vector());
+
+            case ir::node_data<double>::storage2d:         HPX_FALLTHROUGH;
+            case ir::node_data<double>::custom_storage2d:
+                return f(nd.matrix());
+
+            case ir::node_data<double>::sparse_storage1d:
+                return f(nd.sparse_vector());
+
+            case ir::node_data<double>::sparse_storage2d:
+                return f(nd.sparse_matrix());
+
+            default:
+                break;
+            }
+
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dot_operation::visit_array",
+                "sparse dot products are supported for operands with up to "
+                "two dimensions only");
+        }
+
+        ir::node_data<double> extract_sparse_operand(
+            primitive_argument_type&& val, std::string const& name,
+            std::string const& codename)
+        {
+            if (is_sparse_operand(val))
+            {
+                return util::get<ir::node_data<double>>(std::move(val));
+            }
+            return extract_numeric_value(std::move(val), name, codename);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type dot_operation::dot_sparse(
+        primitive_argument_type&& op1, primitive_argument_type&& op2) const
+    {
+        ir::node_data<double> lhs =
+            detail::extract_sparse_operand(std::move(op1), name_, codename_);
+        ir::node_data<double> rhs =
+            detail::extract_sparse_operand(std::move(op2), name_, codename_);
+
+        std::size_t lhs_dims = lhs.num_dimensions();
+        std::size_t rhs_dims = rhs.num_dimensions();
+        if (lhs_dims > 2 || rhs_dims > 2)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dot_operation::dot_sparse",
+                generate_error_message(
+                    "sparse dot products are supported for operands with up "
+                    "to two dimensions only"));
+        }
+
+        // the inner dimensions have to match for non-scalar operands
+        if (lhs_dims != 0 && rhs_dims != 0 &&
+            lhs.dimension(int(lhs_dims) - 1) != rhs.dimension(0))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "dot_operation::dot_sparse",
+                generate_error_message(
+                    "the operands have incompatible number of dimensions"));
+        }
+
+        return primitive_argument_type{detail::visit_array(lhs,
+            [&](auto const& l)
+            {
+                return detail::visit_array(rhs,
+                    [&](auto const& r)
+                    {
+                        return detail::sparse_dot{}(l, r);
+                    });
+            })};
+    }
+}}}
@@ -86,10 +86,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return add_dim_0d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return add_dim_0d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return add_dim_0d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -153,10 +155,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return add_dim_1d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return add_dim_1d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return add_dim_1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
@@ -227,10 +231,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return add_dim_2d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return add_dim_2d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_), axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return add_dim_2d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
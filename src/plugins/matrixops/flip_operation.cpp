@@ -794,9 +794,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return flipnd(
                 extract_boolean_value(std::move(arg), name_, codename_));
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return flipnd(
                 extract_integer_value(std::move(arg), name_, codename_));
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return flipnd(
                 extract_numeric_value(std::move(arg), name_, codename_));
@@ -848,9 +850,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return flipud(
                 extract_boolean_value(std::move(arg), name_, codename_));
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return flipud(
                 extract_integer_value(std::move(arg), name_, codename_));
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return flipud(
                 extract_numeric_value(std::move(arg), name_, codename_));
@@ -904,9 +908,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return fliplr(
                 extract_boolean_value(std::move(arg), name_, codename_));
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return fliplr(
                 extract_integer_value(std::move(arg), name_, codename_));
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return fliplr(
                 extract_numeric_value(std::move(arg), name_, codename_));
@@ -966,11 +972,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         extract_boolean_value(
                             std::move(arg), this_->name_, this_->codename_),
                         std::move(axis));
+                case node_data_type_int32: HPX_FALLTHROUGH;
                 case node_data_type_int64:
                     return this_->flipnd(
                         extract_integer_value(
                             std::move(arg), this_->name_, this_->codename_),
                         std::move(axis));
+                case node_data_type_float32: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->flipnd(
                         extract_numeric_value(
@@ -162,10 +162,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return gradient1d(
                 extract_boolean_value(std::move(args[0]), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return gradient1d(
                 extract_integer_value(std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return gradient1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -201,11 +203,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value(std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return gradient2d(
                 extract_integer_value(std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return gradient2d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_), axis);
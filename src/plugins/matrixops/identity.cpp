@@ -76,11 +76,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return identity_helper<std::uint8_t>(std::move(op));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return identity_helper<std::int64_t>(std::move(op));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return identity_helper<double>(std::move(op));
 
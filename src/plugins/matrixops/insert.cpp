@@ -709,6 +709,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             extract_boolean_value(std::move(args[2]),
                                 this_->name_, this_->codename_),
                             axis);
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->insert_nd(
                             extract_integer_value(std::move(args[0]),
@@ -720,6 +721,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             axis);
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->insert_nd(
                             extract_numeric_value(std::move(args[0]),
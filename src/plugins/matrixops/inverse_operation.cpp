@@ -128,10 +128,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return inverse0d(
                 extract_boolean_value(std::move(op), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return inverse0d(
                 extract_integer_value(std::move(op), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return inverse0d(extract_numeric_value_strict(
                 std::move(op), name_, codename_));
@@ -156,11 +158,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return inverse2d(extract_numeric_value_strict(
                 std::move(op), name_, codename_));
 
         case node_data_type_bool:
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
         case node_data_type_unknown:
             return inverse2d(extract_numeric_value(
@@ -183,11 +187,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         switch (extract_common_type(op))
         {
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return inverse3d(extract_numeric_value_strict(
                 std::move(op), name_, codename_));
 
         case node_data_type_bool:
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
         case node_data_type_unknown:
             return inverse3d(extract_numeric_value(
@@ -66,6 +66,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(hsplit_operation_plugin,
     phylanx::execution_tree::primitives::hsplit_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(hstack_operation_plugin,
     phylanx::execution_tree::primitives::stack_operation::match_data[0]);
+PHYLANX_REGISTER_PLUGIN_FACTORY(issparse_plugin,
+    phylanx::execution_tree::primitives::sparse_operations::match_data[2]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(identity_plugin,
     phylanx::execution_tree::primitives::identity::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(insert_plugin,
@@ -104,6 +106,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(slicing_operation_plugin,
     phylanx::execution_tree::primitives::slicing_operation::match_data[0]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(sort_plugin,
     phylanx::execution_tree::primitives::sort::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(sparse_plugin,
+    phylanx::execution_tree::primitives::sparse_operations::match_data[0]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(squeeze_operation_plugin,
     phylanx::execution_tree::primitives::squeeze_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(stack_operation_plugin,
@@ -112,6 +116,8 @@ PHYLANX_REGISTER_PLUGIN_FACTORY(tensordot_operation_plugin,
     phylanx::execution_tree::primitives::dot_operation::match_data[2]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(tile_operation_plugin,
     phylanx::execution_tree::primitives::tile_operation::match_data);
+PHYLANX_REGISTER_PLUGIN_FACTORY(todense_plugin,
+    phylanx::execution_tree::primitives::sparse_operations::match_data[1]);
 PHYLANX_REGISTER_PLUGIN_FACTORY(transpose_operation_plugin,
     phylanx::execution_tree::primitives::transpose_operation::match_data);
 PHYLANX_REGISTER_PLUGIN_FACTORY(tuple_slicing_operation_plugin,
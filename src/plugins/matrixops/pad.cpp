@@ -453,6 +453,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 {
                     switch (extract_common_type(args[0]))
                     {
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->pad_helper(
                             extract_integer_value_strict(std::move(args[0]),
@@ -471,6 +472,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                                 this_->codename_));
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->pad_helper(
                             extract_numeric_value_strict(std::move(args[0]),
@@ -487,6 +489,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                 {
                     switch (extract_common_type(args[0]))
                     {
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->pad_helper(
                             extract_integer_value_strict(std::move(args[0]),
@@ -501,6 +504,7 @@ namespace phylanx { namespace execution_tree { namespace primitives {
                             ir::node_data<std::uint8_t>{0});
                     case node_data_type_unknown:
                         HPX_FALLTHROUGH;
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->pad_helper(
                             extract_numeric_value_strict(std::move(args[0]),
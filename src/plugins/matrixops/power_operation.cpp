@@ -128,8 +128,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         switch (t)
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power0d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
@@ -159,8 +161,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         switch (t)
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power1d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
@@ -190,8 +194,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         switch (t)
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power2d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
@@ -222,8 +228,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         switch (t)
         {
         case node_data_type_bool:    HPX_FALLTHROUGH;
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:   HPX_FALLTHROUGH;
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return power3d(extract_numeric_value(std::move(lhs)),
                 extract_numeric_value(std::move(rhs)));
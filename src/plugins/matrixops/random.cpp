@@ -7,20 +7,26 @@
 #include <phylanx/execution_tree/primitives/generic_function.hpp>
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/random.hpp>
+#include <phylanx/util/philox.hpp>
 #include <phylanx/util/random.hpp>
 #include <phylanx/util/truncated_normal_distribution.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/runtime.hpp>
 #include <hpx/include/util.hpp>
+#include <hpx/runtime/config_entry.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/throw_exception.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <exception>
 #include <map>
 #include <memory>
 #include <random>
@@ -287,47 +293,125 @@ namespace phylanx { namespace execution_tree { namespace primitives
     random::random(primitive_arguments_type&& operands,
             std::string const& name, std::string const& codename)
       : primitive_component_base(std::move(operands), name, codename)
+      , streams_(name)
     {}
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
+        ///////////////////////////////////////////////////////////////////////
+        // The random numbers are generated in blocks of a fixed size, each
+        // block using its own subsequence of the stream assigned to the
+        // current evaluation (see util::random_stream_sequence) and its own
+        // copy of the distribution. Large arrays are filled by running the
+        // blocks concurrently, the generated values depend on the seed only
+        // and not on the number of threads used.
+        constexpr std::size_t random_block_size = 4096;
+
+        // minimal number of elements for an array to be filled in parallel,
+        // zero disables parallel generation
+        std::size_t random_threshold()
+        {
+            static std::size_t const threshold = []() -> std::size_t {
+                try
+                {
+                    return std::stoull(hpx::get_config_entry(
+                        "phylanx.random.threshold", "65536"));
+                }
+                catch (std::exception const&)
+                {
+                    return 65536;
+                }
+            }();
+            return threshold;
+        }
+
+        // invoke f(dist, gen, begin, end) for all blocks of [0, size)
+        template <typename Dist, typename F>
+        void generate_blocks(Dist const& dist, std::uint64_t key,
+            std::size_t size, F const& f)
+        {
+            std::size_t const num_blocks =
+                (size + random_block_size - 1) / random_block_size;
+
+            auto block = [&](std::size_t b)
+            {
+                Dist local_dist(dist);
+                util::philox4x32 gen(key, b);
+
+                std::size_t const begin = b * random_block_size;
+                f(local_dist, gen, begin,
+                    (std::min)(begin + random_block_size, size));
+            };
+
+            std::size_t const threshold = random_threshold();
+            if (num_blocks > 1 && threshold != 0 && size >= threshold &&
+                hpx::get_os_thread_count() > 1)
+            {
+                hpx::parallel::for_loop(hpx::parallel::execution::par,
+                    std::size_t(0), num_blocks, block);
+            }
+            else
+            {
+                for (std::size_t b = 0; b != num_blocks; ++b)
+                {
+                    block(b);
+                }
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Dist, typename T>
-        primitive_argument_type randomize(Dist& dist, T& d)
+        primitive_argument_type randomize(
+            Dist& dist, T& d, std::uint64_t key)
         {
-            d = dist(util::rng_);
+            generate_blocks(dist, key, 1,
+                [&](Dist& local_dist, util::philox4x32& gen, std::size_t,
+                    std::size_t) { d = local_dist(gen); });
+
             return primitive_argument_type{d};
         }
 
         template <typename Dist, typename T>
         primitive_argument_type randomize(
-            Dist& dist, blaze::DynamicVector<T>& v)
+            Dist& dist, blaze::DynamicVector<T>& v, std::uint64_t key)
         {
-            std::size_t const size = v.size();
-
-            for (std::size_t i = 0; i != size; ++i)
-            {
-                v[i] = dist(util::rng_);
-            }
+            generate_blocks(dist, key, v.size(),
+                [&](Dist& local_dist, util::philox4x32& gen,
+                    std::size_t begin, std::size_t end)
+                {
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        v[i] = local_dist(gen);
+                    }
+                });
 
             return primitive_argument_type{std::move(v)};
         }
 
         template <typename Dist, typename T>
         primitive_argument_type randomize(
-            Dist& dist, blaze::DynamicMatrix<T>& m)
+            Dist& dist, blaze::DynamicMatrix<T>& m, std::uint64_t key)
         {
-            std::size_t const rows = m.rows();
             std::size_t const columns = m.columns();
 
-            for (std::size_t i = 0; i != rows; ++i)
-            {
-                for (std::size_t j = 0; j != columns; ++j)
+            // the elements are generated in row-major order
+            generate_blocks(dist, key, m.rows() * columns,
+                [&](Dist& local_dist, util::philox4x32& gen,
+                    std::size_t begin, std::size_t end)
                 {
-                    m(i, j) = dist(util::rng_);
-                }
-            }
+                    std::size_t i = begin / columns;
+                    std::size_t j = begin % columns;
+                    for (std::size_t n = begin; n != end; ++n)
+                    {
+                        m(i, j) = local_dist(gen);
+                        if (++j == columns)
+                        {
+                            j = 0;
+                            ++i;
+                        }
+                    }
+                });
 
             return primitive_argument_type{std::move(m)};
         }
@@ -335,22 +419,33 @@ namespace phylanx { namespace execution_tree { namespace primitives
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
         template <typename Dist, typename T>
         primitive_argument_type randomize(
-            Dist& dist, blaze::DynamicTensor<T>& t)
+            Dist& dist, blaze::DynamicTensor<T>& t, std::uint64_t key)
         {
-            std::size_t const pages = t.pages();
             std::size_t const rows = t.rows();
             std::size_t const columns = t.columns();
 
-            for (std::size_t k = 0; k != pages; ++k)
-            {
-                for (std::size_t i = 0; i != rows; ++i)
+            // the elements are generated in page-major, row-major order
+            generate_blocks(dist, key, t.pages() * rows * columns,
+                [&](Dist& local_dist, util::philox4x32& gen,
+                    std::size_t begin, std::size_t end)
                 {
-                    for (std::size_t j = 0; j != columns; ++j)
+                    std::size_t k = begin / (rows * columns);
+                    std::size_t i = (begin / columns) % rows;
+                    std::size_t j = begin % columns;
+                    for (std::size_t n = begin; n != end; ++n)
                     {
-                        t(k, i, j) = dist(util::rng_);
+                        t(k, i, j) = local_dist(gen);
+                        if (++j == columns)
+                        {
+                            j = 0;
+                            if (++i == rows)
+                            {
+                                i = 0;
+                                ++k;
+                            }
+                        }
                     }
-                }
-            }
+                });
 
             return primitive_argument_type{std::move(t)};
         }
@@ -361,6 +456,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             virtual ~distribution() = default;
 
+            // key of the stream the numbers are drawn from
+            std::uint64_t key_ = 0;
+
             virtual primitive_argument_type call0d() = 0;
             virtual primitive_argument_type call1d(std::size_t dim) = 0;
             virtual primitive_argument_type call2d(
@@ -382,7 +480,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims) override  \
     {                                                                          \
         blaze::DynamicTensor<T> data(dims[0], dims[1], dims[2]);               \
-        return randomize(dist_, data);                                         \
+        return randomize(dist_, data, key_);                                   \
     }                                                                          \
     /**/
 #else
@@ -415,18 +513,18 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type call0d() override                              \
         {                                                                      \
             T data;                                                            \
-            return randomize(dist_, data);                                     \
+            return randomize(dist_, data, key_);                               \
         }                                                                      \
         primitive_argument_type call1d(std::size_t dim) override               \
         {                                                                      \
             blaze::DynamicVector<T> data(dim);                                 \
-            return randomize(dist_, data);                                     \
+            return randomize(dist_, data, key_);                               \
         }                                                                      \
         primitive_argument_type call2d(                                        \
             std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims) override \
         {                                                                      \
             blaze::DynamicMatrix<T> data(dims[0], dims[1]);                    \
-            return randomize(dist_, data);                                     \
+            return randomize(dist_, data, key_);                               \
         }                                                                      \
         PHYLANX_RANDOM_IMPLEMENT_TENSOR(T)                                     \
         stdtype dist_;                                                         \
@@ -463,19 +561,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
         primitive_argument_type call0d() override                              \
         {                                                                      \
             T data;                                                            \
-            return randomize(dist_, data);                                     \
+            return randomize(dist_, data, key_);                               \
         }                                                                      \
         primitive_argument_type call1d(std::size_t dim) override               \
         {                                                                      \
             blaze::DynamicVector<T> data(dim);                                 \
-            return randomize(dist_, data);                                     \
+            return randomize(dist_, data, key_);                               \
         }                                                                      \
         primitive_argument_type call2d(                                        \
             std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims)       \
             override                                                           \
         {                                                                      \
             blaze::DynamicMatrix<T> data(dims[0], dims[1]);                    \
-            return randomize(dist_, data);                                     \
+            return randomize(dist_, data, key_);                               \
         }                                                                      \
         PHYLANX_RANDOM_IMPLEMENT_TENSOR(T)                                     \
         stdtype dist_;                                                         \
@@ -911,8 +1009,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
 
         ///////////////////////////////////////////////////////////////////////
         primitive_argument_type randomize0d(
-            distribution_parameters_type&& params, std::string const& name,
-            std::string const& codename)
+            distribution_parameters_type&& params, std::uint64_t key,
+            std::string const& name, std::string const& codename)
         {
             auto it = distributions.find(std::get<0>(params));
             if (it == distributions.end())
@@ -932,12 +1030,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     util::generate_error_message(
                             msg.str(), name, codename));
             }
-            return (it->second)(params, name, codename)->call0d();
+            auto dist = (it->second)(params, name, codename);
+            dist->key_ = key;
+            return dist->call0d();
         }
 
         primitive_argument_type randomize1d(std::size_t dim,
-            distribution_parameters_type&& params, std::string const& name,
-            std::string const& codename)
+            distribution_parameters_type&& params, std::uint64_t key,
+            std::string const& name, std::string const& codename)
         {
             auto it = distributions.find(std::get<0>(params));
             if (it == distributions.end())
@@ -957,13 +1057,15 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     util::generate_error_message(
                         msg.str(), name, codename));
             }
-            return (it->second)(params, name, codename)->call1d(dim);
+            auto dist = (it->second)(params, name, codename);
+            dist->key_ = key;
+            return dist->call1d(dim);
         }
 
         primitive_argument_type randomize2d(
             std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
-            distribution_parameters_type&& params, std::string const& name,
-            std::string const& codename)
+            distribution_parameters_type&& params, std::uint64_t key,
+            std::string const& name, std::string const& codename)
         {
             auto it = distributions.find(std::get<0>(params));
             if (it == distributions.end())
@@ -983,14 +1085,16 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     util::generate_error_message(
                         msg.str(), name, codename));
             }
-            return (it->second)(params, name, codename)->call2d(dims);
+            auto dist = (it->second)(params, name, codename);
+            dist->key_ = key;
+            return dist->call2d(dims);
         }
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
         primitive_argument_type randomize3d(
             std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
-            distribution_parameters_type&& params, std::string const& name,
-            std::string const& codename)
+            distribution_parameters_type&& params, std::uint64_t key,
+            std::string const& name, std::string const& codename)
         {
             auto it = distributions.find(std::get<0>(params));
             if (it == distributions.end())
@@ -1010,7 +1114,9 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     util::generate_error_message(
                         msg.str(), name, codename));
             }
-            return (it->second)(params, name, codename)->call3d(dims);
+            auto dist = (it->second)(params, name, codename);
+            dist->key_ = key;
+            return dist->call3d(dims);
         }
 #endif
 
@@ -1110,21 +1216,23 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type random::random0d(
         distribution_parameters_type&& params) const
     {
-        return detail::randomize0d(std::move(params), name_, codename_);
+        return detail::randomize0d(
+            std::move(params), streams_.next_key(), name_, codename_);
     }
 
     primitive_argument_type random::random1d(
         std::size_t dim, distribution_parameters_type&& params) const
     {
-        auto result = detail::randomize1d(dim, std::move(params), name_, codename_);
-        return result;
+        return detail::randomize1d(
+            dim, std::move(params), streams_.next_key(), name_, codename_);
     }
 
     primitive_argument_type random::random2d(
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
         distribution_parameters_type&& params) const
     {
-        return detail::randomize2d(dims, std::move(params), name_, codename_);
+        return detail::randomize2d(
+            dims, std::move(params), streams_.next_key(), name_, codename_);
     }
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
@@ -1132,7 +1240,8 @@ namespace phylanx { namespace execution_tree { namespace primitives
         std::array<std::size_t, PHYLANX_MAX_DIMENSIONS> const& dims,
         distribution_parameters_type&& params) const
     {
-        return detail::randomize3d(dims, std::move(params), name_, codename_);
+        return detail::randomize3d(
+            dims, std::move(params), streams_.next_key(), name_, codename_);
     }
 #endif
 }}}
@@ -204,11 +204,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape0d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape0d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -328,11 +330,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape1d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape1d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -474,11 +478,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape2d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape2d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -612,11 +618,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return reshape3d(
                 extract_integer_value_strict(std::move(arr), name_, codename_),
                 std::move(arg));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return reshape3d(
                 extract_numeric_value_strict(std::move(arr), name_, codename_),
@@ -804,10 +812,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                         return this_->flatten_nd(extract_boolean_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
 
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->flatten_nd(extract_integer_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
 
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->flatten_nd(extract_numeric_value_strict(
                             std::move(arr), this_->name_, this_->codename_));
@@ -913,12 +923,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                                 std::move(arr), this_->name_, this_->codename_),
                             std::move(order));
 
+                    case node_data_type_int32: HPX_FALLTHROUGH;
                     case node_data_type_int64:
                         return this_->flatten_nd(
                             extract_integer_value_strict(
                                 std::move(arr), this_->name_, this_->codename_),
                             std::move(order));
 
+                    case node_data_type_float32: HPX_FALLTHROUGH;
                     case node_data_type_double:
                         return this_->flatten_nd(
                             extract_numeric_value_strict(
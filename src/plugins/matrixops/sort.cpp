@@ -9,6 +9,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/sort.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
+#include <phylanx/util/parallel_sort.hpp>
 #include <phylanx/util/tensor_iterators.hpp>
 
 #include <hpx/include/lcos.hpp>
@@ -66,7 +67,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         blaze::DynamicVector<T> result(m.rows() * m.columns());
 
         std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        util::sort_values(result.data(), result.size());
         return primitive_argument_type{std::move(result)};
     }
 
@@ -80,7 +81,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         blaze::DynamicVector<T> result(t.pages() * t.rows() * t.columns());
 
         std::copy(r.begin(), r.end(), result.begin());
-        std::sort(result.begin(), result.begin() + result.size());
+        util::sort_values(result.data(), result.size());
         return primitive_argument_type{std::move(result)};
     }
 #endif
@@ -126,11 +127,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 extract_boolean_value_strict(std::move(arg), name_, codename_),
                 kind);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return sort_flatten_helper(
                 extract_integer_value_strict(std::move(arg), name_, codename_),
                 kind);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return sort_flatten_helper(
                 extract_numeric_value_strict(std::move(arg), name_, codename_),
@@ -157,7 +160,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             auto v = arg.vector();
 
-            std::sort(v.begin(), v.begin() + v.size());
+            util::sort_values(v.data(), v.size());
             return primitive_argument_type{std::move(arg)};
         }
         HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -173,13 +176,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         using phylanx::util::matrix_column_iterator;
         auto m = arg.matrix();
 
-        matrix_column_iterator<decltype(m)> m_begin(m);
-        const matrix_column_iterator<decltype(m)> m_end(m, m.columns());
+        matrix_column_iterator<decltype(m)> const m_begin(m);
 
-        for (auto it = m_begin; it != m_end; ++it)
-        {
+        util::for_each_slice(m.columns(), m.rows(), [&](std::size_t i) {
+            auto it = m_begin + i;
             std::sort(it->begin(), it->end());
-        }
+        });
 
         return primitive_argument_type{std::move(arg)};
     }
@@ -191,13 +193,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         auto m = arg.matrix();
         using phylanx::util::matrix_row_iterator;
 
-        matrix_row_iterator<decltype(m)> m_begin(m);
-        const matrix_row_iterator<decltype(m)> m_end(m, m.rows());
+        matrix_row_iterator<decltype(m)> const m_begin(m);
 
-        for (auto it = m_begin; it != m_end; ++it)
-        {
+        util::for_each_slice(m.rows(), m.columns(), [&](std::size_t i) {
+            auto it = m_begin + i;
             std::sort(it->begin(), it->end());
-        }
+        });
 
         return primitive_argument_type{std::move(arg)};
     }
@@ -234,16 +235,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         using phylanx::util::matrix_row_iterator;
         auto t = arg.tensor();
 
-        for (std::size_t i = 0; i != t.rows(); ++i)
-        {
-            auto slice = blaze::rowslice(t, i);
-            matrix_row_iterator<decltype(slice)> const a_begin(slice);
-            matrix_row_iterator<decltype(slice)> const a_end(
-                slice, slice.rows());
-
-            for (auto it = a_begin; it != a_end; ++it)
+        // every row of a row slice is sorted independently
+        util::for_each_slice(t.rows() * t.columns(), t.pages(),
+            [&](std::size_t k) {
+                auto slice = blaze::rowslice(t, k / t.columns());
+                matrix_row_iterator<decltype(slice)> const it(
+                    slice, k % t.columns());
                 std::sort(it->begin(), it->end());
-        }
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -254,16 +253,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         using phylanx::util::matrix_row_iterator;
         auto t = arg.tensor();
 
-        for (std::size_t i = 0; i != t.columns(); ++i)
-        {
-            auto slice = blaze::columnslice(t, i);
-            matrix_row_iterator<decltype(slice)> const a_begin(slice);
-            matrix_row_iterator<decltype(slice)> const a_end(
-                slice, slice.rows());
-
-            for (auto it = a_begin; it != a_end; ++it)
+        // every row of a column slice is sorted independently
+        util::for_each_slice(t.columns() * t.pages(), t.rows(),
+            [&](std::size_t k) {
+                auto slice = blaze::columnslice(t, k / t.pages());
+                matrix_row_iterator<decltype(slice)> const it(
+                    slice, k % t.pages());
                 std::sort(it->begin(), it->end());
-        }
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -274,16 +271,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
         using phylanx::util::matrix_column_iterator;
         auto t = arg.tensor();
 
-        for (std::size_t i = 0; i != t.rows(); ++i)
-        {
-            auto slice = blaze::rowslice(t, i);
-            matrix_column_iterator<decltype(slice)> const a_begin(slice);
-            matrix_column_iterator<decltype(slice)> const a_end(
-                slice, slice.columns());
-
-            for (auto it = a_begin; it != a_end; ++it)
+        // every column of a row slice is sorted independently
+        util::for_each_slice(t.rows() * t.pages(), t.columns(),
+            [&](std::size_t k) {
+                auto slice = blaze::rowslice(t, k / t.pages());
+                matrix_column_iterator<decltype(slice)> const it(
+                    slice, k % t.pages());
                 std::sort(it->begin(), it->end());
-        }
+            });
         return primitive_argument_type{std::move(arg)};
     }
 
@@ -393,12 +388,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                             std::move(args[0]), this_->name_, this_->codename_),
                         axis, kind);
 
+                case node_data_type_int32: HPX_FALLTHROUGH;
                 case node_data_type_int64:
                     return this_->sort_helper(
                         extract_integer_value_strict(
                             std::move(args[0]), this_->name_, this_->codename_),
                         axis, kind);
 
+                case node_data_type_float32: HPX_FALLTHROUGH;
                 case node_data_type_double:
                     return this_->sort_helper(
                         extract_numeric_value_strict(
@@ -0,0 +1,191 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/primitives/base_primitive.hpp>
+#include <phylanx/ir/node_data.hpp>
+#include <phylanx/plugins/matrixops/sparse_operations.hpp>
+
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/util.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace phylanx { namespace execution_tree { namespace primitives
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<match_pattern_type> const sparse_operations::match_data =
+    {
+        match_pattern_type{"sparse",
+        std::vector<std::string>{"sparse(_1)"},
+        &create_sparse, &create_primitive<sparse_operations>,
+        R"(a
+        Args:
+
+            a (array) : a vector or a matrix
+
+        Returns:
+
+        A copy of the given array storing only its non-zero elements in
+        compressed format)"},
+
+        match_pattern_type{"todense",
+        std::vector<std::string>{"todense(_1)"},
+        &create_todense, &create_primitive<sparse_operations>,
+        R"(a
+        Args:
+
+            a (array) : a scalar, a vector, a matrix, or a tensor
+
+        Returns:
+
+        The dense representation of the given array, arrays that are not
+        stored in compressed format are returned unchanged)"},
+
+        match_pattern_type{"issparse",
+        std::vector<std::string>{"issparse(_1)"},
+        &create_issparse, &create_primitive<sparse_operations>,
+        R"(a
+        Args:
+
+            a (any) : a value
+
+        Returns:
+
+        True if the given value is an array stored in compressed format,
+        False otherwise)"},
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    sparse_operations::sparse_mode extract_sparse_mode(std::string const& name)
+    {
+        sparse_operations::sparse_mode result =
+            sparse_operations::sparse_mode_to_sparse;
+
+        if (name.find("todense") != std::string::npos)
+        {
+            result = sparse_operations::sparse_mode_to_dense;
+        }
+        else if (name.find("issparse") != std::string::npos)
+        {
+            result = sparse_operations::sparse_mode_is_sparse;
+        }
+        return result;
+    }
+
+    sparse_operations::sparse_operations(primitive_arguments_type&& operands,
+            std::string const& name, std::string const& codename)
+      : primitive_component_base(std::move(operands), name, codename)
+      , mode_(extract_sparse_mode(name_))
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    primitive_argument_type sparse_operations::to_sparse(
+        primitive_argument_type&& arg) const
+    {
+        if (is_sparse_operand(arg))
+        {
+            return std::move(arg);
+        }
+
+        auto&& data = extract_numeric_value(std::move(arg), name_, codename_);
+        switch (data.num_dimensions())
+        {
+        case 1:
+            return primitive_argument_type{ir::node_data<double>{
+                ir::node_data<double>::sparse_storage1d_type(data.vector())}};
+
+        case 2:
+            return primitive_argument_type{ir::node_data<double>{
+                ir::node_data<double>::sparse_storage2d_type(data.matrix())}};
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+            "sparse_operations::to_sparse",
+            generate_error_message(
+                "the sparse primitive requires its argument to be either a "
+                "vector or a matrix"));
+    }
+
+    primitive_argument_type sparse_operations::to_dense(
+        primitive_argument_type&& arg) const
+    {
+        if (!is_sparse_operand(arg))
+        {
+            return std::move(arg);
+        }
+        return primitive_argument_type{
+            util::get<ir::node_data<double>>(std::move(arg)).to_dense()};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<primitive_argument_type> sparse_operations::eval(
+        primitive_arguments_type const& operands,
+        primitive_arguments_type const& args, eval_context ctx) const
+    {
+        if (operands.size() != 1)
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "sparse_operations::eval",
+                generate_error_message(
+                    "the sparse_operations primitive requires exactly one "
+                    "operand"));
+        }
+
+        if (!valid(operands[0]))
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "sparse_operations::eval",
+                generate_error_message(
+                    "the sparse_operations primitive requires that the "
+                    "arguments given by the operands array are valid"));
+        }
+
+        auto this_ = this->shared_from_this();
+        return value_operand(
+                operands[0], args, name_, codename_, std::move(ctx))
+            .then(hpx::launch::sync,
+                [this_ = std::move(this_)](
+                        hpx::future<primitive_argument_type>&& f)
+                -> primitive_argument_type
+                {
+                    auto&& arg = f.get();
+                    switch (this_->mode_)
+                    {
+                    case sparse_mode_to_sparse:
+                        return this_->to_sparse(std::move(arg));
+
+                    case sparse_mode_to_dense:
+                        return this_->to_dense(std::move(arg));
+
+                    case sparse_mode_is_sparse:
+                        return primitive_argument_type{
+                            ir::node_data<std::uint8_t>{
+                                is_sparse_operand(arg)}};
+
+                    default:
+                        break;
+                    }
+
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "sparse_operations::eval",
+                        this_->generate_error_message(
+                            "unsupported sparse_operations mode"));
+                });
+    }
+}}}
@@ -305,10 +305,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return hstack0d1d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return hstack0d1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack0d1d_helper<double>(std::move(args));
 
@@ -409,10 +411,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return hstack2d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return hstack2d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack2d_helper<double>(std::move(args));
 
@@ -528,10 +532,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return hstack3d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return hstack3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return hstack3d_helper<double>(std::move(args));
 
@@ -604,10 +610,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return vstack0d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return vstack0d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack0d_helper<double>(std::move(args));
 
@@ -742,10 +750,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return vstack1d2d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return vstack1d2d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack1d2d_helper<double>(std::move(args));
 
@@ -861,10 +871,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return vstack3d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return vstack3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return vstack3d_helper<double>(std::move(args));
 
@@ -936,10 +948,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return dstack0d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dstack0d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack0d_helper<double>(std::move(args));
 
@@ -1041,10 +1055,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return dstack1d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dstack1d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack1d_helper<double>(std::move(args));
 
@@ -1178,10 +1194,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return dstack2d3d_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return dstack2d3d_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return dstack2d3d_helper<double>(std::move(args));
 
@@ -1322,11 +1340,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack1d_axis1_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack1d_axis1_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack1d_axis1_helper<double>(std::move(args));
 
@@ -1479,11 +1499,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack2d_axis0_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack2d_axis0_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack2d_axis0_helper<double>(std::move(args));
 
@@ -1604,11 +1626,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack2d_axis1_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack2d_axis1_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack2d_axis1_helper<double>(std::move(args));
 
@@ -1743,11 +1767,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack3d_axis1_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack3d_axis1_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack3d_axis1_helper<double>(std::move(args));
 
@@ -1830,11 +1856,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return stack3d_axis2_helper<std::uint8_t>(std::move(args));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return stack3d_axis2_helper<std::int64_t>(std::move(args));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return stack3d_axis2_helper<double>(std::move(args));
 
@@ -120,7 +120,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
     primitive_argument_type transpose_operation::transpose2d(
         ir::node_data<T>&& arg) const
     {
-        if (arg.is_ref())
+        if (arg.is_sparse())
+        {
+            arg.sparse_matrix().transpose();
+        }
+        else if (arg.is_ref())
         {
             arg = blaze::trans(arg.matrix());
         }
@@ -140,11 +144,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return transpose2d(extract_boolean_value_strict(std::move(arg)));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose2d(extract_integer_value_strict(std::move(arg)));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
+            if (is_sparse_operand(arg))
+            {
+                // sparse matrices are transposed in compressed format
+                return transpose2d(
+                    util::get<ir::node_data<double>>(std::move(arg)));
+            }
             return transpose2d(extract_numeric_value(std::move(arg)));
 
         default:
@@ -181,13 +193,22 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return transpose2d(
                 extract_boolean_value_strict(std::move(arg)), std::move(axes));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose2d(
                 extract_integer_value_strict(std::move(arg)), std::move(axes));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
+            if (is_sparse_operand(arg))
+            {
+                // sparse matrices are transposed in compressed format
+                return transpose2d(
+                    util::get<ir::node_data<double>>(std::move(arg)),
+                    std::move(axes));
+            }
             return transpose2d(
                 extract_numeric_value(std::move(arg)), std::move(axes));
 
@@ -277,10 +298,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
         case node_data_type_bool:
             return transpose3d(extract_boolean_value_strict(std::move(arg)));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose3d(extract_integer_value_strict(std::move(arg)));
 
         case node_data_type_unknown: HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(extract_numeric_value(std::move(arg)));
 
@@ -326,12 +349,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return transpose3d(
                 extract_boolean_value_strict(std::move(arg)), std::move(axes));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return transpose3d(
                 extract_integer_value_strict(std::move(arg)), std::move(axes));
 
         case node_data_type_unknown:
             HPX_FALLTHROUGH;
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return transpose3d(
                 extract_numeric_value(std::move(arg)), std::move(axes));
@@ -10,6 +10,7 @@
 #include <phylanx/ir/node_data.hpp>
 #include <phylanx/plugins/matrixops/unique.hpp>
 #include <phylanx/util/matrix_iterators.hpp>
+#include <phylanx/util/parallel_sort.hpp>
 
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/naming.hpp>
@@ -77,10 +78,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return unique0d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return unique0d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return unique0d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -106,7 +109,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
     {
         blaze::DynamicVector<T> a = arg.vector();
         // Sorting the vector
-        std::sort(a.begin(), a.end());
+        util::sort_values(a.data(), a.size());
 
         // Use std::unique to remove duplicacy
         auto ip = std::unique(a.begin(), a.end());
@@ -141,10 +144,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
             return unique1d(extract_boolean_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return unique1d(extract_integer_value_strict(
                 std::move(args[0]), name_, codename_));
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return unique1d(extract_numeric_value_strict(
                 std::move(args[0]), name_, codename_));
@@ -184,7 +189,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
         }
 
         // Sorting the vector
-        std::sort(result.begin(), result.end());
+        util::sort_values(result.data(), result.size());
 
         // Use std::unique to remove duplicacy
         auto ip = std::unique(result.begin(), result.end());
@@ -210,7 +215,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             a.rows(), a_begin);
         std::iota(indices.begin(), indices.end(), a_begin);
 
-        std::sort(indices.begin(), indices.end(),
+        util::parallel_sort(indices.begin(), indices.end(),
             [&](const auto& lhs, const auto& rhs) {
                 return std::lexicographical_compare(
                     lhs->begin(), lhs->end(), rhs->begin(), rhs->end());
@@ -239,7 +244,7 @@ namespace phylanx { namespace execution_tree { namespace primitives
             a.columns(), a_begin);
         std::iota(indices.begin(), indices.end(), a_begin);
 
-        std::sort(indices.begin(), indices.end(),
+        util::parallel_sort(indices.begin(), indices.end(),
             [&](const auto& lhs, const auto& rhs) {
                 return std::lexicographical_compare(
                     lhs->begin(), lhs->end(), rhs->begin(), rhs->end());
@@ -314,12 +319,14 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_int32: HPX_FALLTHROUGH;
         case node_data_type_int64:
             return unique2d(numargs,
                 extract_integer_value_strict(
                     std::move(args[0]), name_, codename_),
                 axis);
 
+        case node_data_type_float32: HPX_FALLTHROUGH;
         case node_data_type_double:
             return unique2d(numargs,
                 extract_numeric_value_strict(
@@ -60,6 +60,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     });
             }
 
+            bool combine(statistics_all_op const&, bool lhs, bool rhs) const
+            {
+                return lhs && rhs;
+            }
+
             static constexpr bool finalize(bool value, std::size_t size)
             {
                 return value;
@@ -59,6 +59,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return blaze::sum(blaze::exp(v)) + initial;
             }
 
+            double combine(
+                statistics_logsumexp_op const&, double lhs, double rhs) const
+            {
+                return lhs + rhs;
+            }
+
             static double finalize(double value, std::size_t size)
             {
                 return blaze::log(value);
@@ -58,6 +58,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return (std::max)((blaze::max)(v), initial);
             }
 
+            T combine(statistics_max_op const&, T lhs, T rhs) const
+            {
+                return (std::max)(lhs, rhs);
+            }
+
             static T finalize(T value, std::size_t size)
             {
                 return value;
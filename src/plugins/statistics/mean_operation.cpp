@@ -31,6 +31,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             using result_type = double;
 
+            // zero elements do not change the accumulated sum, compressed
+            // data is reduced over its non-zero elements only
+            static constexpr bool ignores_zero_elements = true;
+
             statistics_mean_op(std::string const& name,
                     std::string const& codename)
               : name_(name), codename_(codename)
@@ -56,6 +60,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return blaze::sum(v) + initial;
             }
 
+            double combine(
+                statistics_mean_op const&, double lhs, double rhs) const
+            {
+                return lhs + rhs;
+            }
+
             double finalize(double value, std::size_t size) const
             {
                 if (size == 0)
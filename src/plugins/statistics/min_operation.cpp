@@ -56,6 +56,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return (std::min)((blaze::min)(v), initial);
             }
 
+            T combine(statistics_min_op const&, T lhs, T rhs) const
+            {
+                return (std::min)(lhs, rhs);
+            }
+
             static T finalize(T value, std::size_t size)
             {
                 return value;
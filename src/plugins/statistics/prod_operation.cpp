@@ -56,6 +56,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return blaze::prod(v) * initial;
             }
 
+            T combine(statistics_prod_op const&, T lhs, T rhs) const
+            {
+                return lhs * rhs;
+            }
+
             static T finalize(T value, std::size_t size)
             {
                 return value;
@@ -32,6 +32,10 @@ namespace phylanx { namespace execution_tree { namespace primitives
         {
             using result_type = T;
 
+            // zero elements do not change the sum, compressed data is summed
+            // over its non-zero elements only
+            static constexpr bool ignores_zero_elements = true;
+
             statistics_sum_op(std::string const& name,
                 std::string const& codename)
             {}
@@ -55,6 +59,11 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return blaze::sum(v) + initial;
             }
 
+            T combine(statistics_sum_op const&, T lhs, T rhs) const
+            {
+                return lhs + rhs;
+            }
+
             static T finalize(T value, std::size_t size)
             {
                 return value;
@@ -37,7 +37,6 @@ namespace phylanx { namespace execution_tree { namespace primitives
             statistics_var_op(std::string const& name,
                     std::string const& codename)
               : name_(name), codename_(codename)
-              , count_(0), mean_(0), m2_(0)
             {}
 
             static constexpr double initial()
@@ -45,23 +44,12 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 return 0.0;
             }
 
-            // Use Welford's online algorithm, see
-            // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-            void process_value(double val)
-            {
-                ++count_;
-                double delta = val - mean_;
-                mean_ += delta / count_;
-                double delta2 = val - mean_;
-                m2_ += delta * delta2;
-            }
-
             template <typename Scalar>
             typename std::enable_if<traits::is_scalar<Scalar>::value,
                 double>::type
             operator()(Scalar s, double initial)
             {
-                process_value(s);
+                acc_.process_value(s);
                 return initial;
             }
 
@@ -70,16 +58,19 @@ namespace phylanx { namespace execution_tree { namespace primitives
                 double>::type
             operator()(Vector& v, double initial)
             {
-                for (auto && elem : v)
-                {
-                    process_value(elem);
-                }
+                acc_.process_values(v);
                 return initial;
             }
 
+            double combine(statistics_var_op const& rhs, double lhs, double)
+            {
+                acc_.merge(rhs.acc_);
+                return lhs;
+            }
+
             double finalize(double value, std::size_t size) const
             {
-                HPX_ASSERT(count_ == size);
+                HPX_ASSERT(acc_.count_ == size);
                 if (size == 0)
                 {
                     HPX_THROW_EXCEPTION(hpx::bad_parameter,
@@ -93,15 +84,13 @@ namespace phylanx { namespace execution_tree { namespace primitives
                     return 0.0;
                 }
 
-                return m2_ / size;
+                return acc_.m2_ / size;
             }
 
             std::string const& name_;
             std::string const& codename_;
 
-            std::size_t count_;
-            double mean_;
-            double m2_;
+            welford_accumulator acc_;
         };
     }
 
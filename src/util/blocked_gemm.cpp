@@ -0,0 +1,53 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/blocked_gemm.hpp>
+
+#include <hpx/runtime/config_entry.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        std::size_t get_gemm_config_entry(
+            char const* key, std::size_t default_value, bool allow_zero)
+        {
+            try
+            {
+                std::size_t value = std::stoull(hpx::get_config_entry(
+                    key, std::to_string(default_value)));
+                if (value != 0 || allow_zero)
+                {
+                    return value;
+                }
+            }
+            catch (std::exception const&)
+            {
+                // fall back to default
+            }
+            return default_value;
+        }
+    }
+
+    blocked_gemm_parameters const& get_blocked_gemm_parameters()
+    {
+        static blocked_gemm_parameters const params = {
+            detail::get_gemm_config_entry("phylanx.dot.tile_rows", 128, false),
+            detail::get_gemm_config_entry(
+                "phylanx.dot.tile_columns", 128, false),
+            detail::get_gemm_config_entry(
+                "phylanx.dot.tile_inner", 256, false),
+            detail::get_gemm_config_entry(
+                "phylanx.dot.gemm_threshold", 2097152, true),
+            detail::get_gemm_config_entry(
+                "phylanx.dot.gemv_threshold", 262144, true)};
+        return params;
+    }
+}}
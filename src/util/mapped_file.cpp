@@ -0,0 +1,217 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/mapped_file.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_file::mapped_file() noexcept
+      : data_(nullptr)
+      , size_(0)
+      , is_open_(false)
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+      , file_(nullptr)
+      , mapping_(nullptr)
+#endif
+    {
+    }
+
+    mapped_file::mapped_file(std::string const& filename, bool copy_on_write)
+      : mapped_file()
+    {
+        open(filename, copy_on_write);
+    }
+
+    mapped_file::mapped_file(mapped_file&& rhs) noexcept
+      : data_(rhs.data_)
+      , size_(rhs.size_)
+      , is_open_(rhs.is_open_)
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+      , file_(rhs.file_)
+      , mapping_(rhs.mapping_)
+#endif
+    {
+        rhs.data_ = nullptr;
+        rhs.size_ = 0;
+        rhs.is_open_ = false;
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+        rhs.file_ = nullptr;
+        rhs.mapping_ = nullptr;
+#endif
+    }
+
+    mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            close();
+
+            std::swap(data_, rhs.data_);
+            std::swap(size_, rhs.size_);
+            std::swap(is_open_, rhs.is_open_);
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+            std::swap(file_, rhs.file_);
+            std::swap(mapping_, rhs.mapping_);
+#endif
+        }
+        return *this;
+    }
+
+    mapped_file::~mapped_file()
+    {
+        close();
+    }
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+    ///////////////////////////////////////////////////////////////////////////
+    bool mapped_file::open(std::string const& filename, bool copy_on_write)
+    {
+        close();
+
+        HANDLE file = ::CreateFileA(filename.c_str(), GENERIC_READ,
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file, &size))
+        {
+            ::CloseHandle(file);
+            return false;
+        }
+
+        file_ = file;
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        is_open_ = true;
+
+        // empty files can't be mapped
+        if (size_ == 0)
+        {
+            return true;
+        }
+
+        HANDLE mapping = ::CreateFileMappingA(file, nullptr,
+            copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            close();
+            return false;
+        }
+        mapping_ = mapping;
+
+        void* data = ::MapViewOfFile(
+            mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            close();
+            return false;
+        }
+
+        data_ = static_cast<char const*>(data);
+        return true;
+    }
+
+    void mapped_file::close() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr)
+        {
+            ::CloseHandle(static_cast<HANDLE>(mapping_));
+        }
+        if (file_ != nullptr)
+        {
+            ::CloseHandle(static_cast<HANDLE>(file_));
+        }
+
+        data_ = nullptr;
+        size_ = 0;
+        is_open_ = false;
+        file_ = nullptr;
+        mapping_ = nullptr;
+    }
+#else
+    ///////////////////////////////////////////////////////////////////////////
+    bool mapped_file::open(std::string const& filename, bool copy_on_write)
+    {
+        close();
+
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1 || !S_ISREG(st.st_mode))
+        {
+            ::close(fd);
+            return false;
+        }
+
+        size_ = static_cast<std::size_t>(st.st_size);
+        is_open_ = true;
+
+        // empty files can't be mapped
+        if (size_ != 0)
+        {
+            int prot = copy_on_write ? (PROT_READ | PROT_WRITE) : PROT_READ;
+            void* data = ::mmap(nullptr, size_, prot, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                size_ = 0;
+                is_open_ = false;
+                return false;
+            }
+
+            // read-only mappings are usually parsed front to back, writable
+            // mappings back arrays that are accessed in arbitrary order
+            if (!copy_on_write)
+            {
+                ::madvise(data, size_, MADV_SEQUENTIAL);
+            }
+            data_ = static_cast<char const*>(data);
+        }
+
+        // the mapping stays valid after the file descriptor was closed
+        ::close(fd);
+        return true;
+    }
+
+    void mapped_file::close() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+
+        data_ = nullptr;
+        size_ = 0;
+        is_open_ = false;
+    }
+#endif
+}}
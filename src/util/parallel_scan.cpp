@@ -0,0 +1,42 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/parallel_scan.hpp>
+
+#include <hpx/runtime/config_entry.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <string>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        std::size_t get_scan_config_entry(
+            char const* key, std::size_t default_value)
+        {
+            try
+            {
+                return std::stoull(hpx::get_config_entry(
+                    key, std::to_string(default_value)));
+            }
+            catch (std::exception const&)
+            {
+                // fall back to default
+            }
+            return default_value;
+        }
+    }
+
+    parallel_scan_parameters const& get_parallel_scan_parameters()
+    {
+        static parallel_scan_parameters const params = {
+            detail::get_scan_config_entry("phylanx.scan.threshold", 65536),
+            detail::get_scan_config_entry("phylanx.scan.chunk_size", 16384)};
+        return params;
+    }
+}}
@@ -0,0 +1,220 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/parallel_sort.hpp>
+
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime/config_entry.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        std::size_t get_sort_config_entry(
+            char const* key, std::size_t default_value)
+        {
+            try
+            {
+                return std::stoull(hpx::get_config_entry(
+                    key, std::to_string(default_value)));
+            }
+            catch (std::exception const&)
+            {
+                // fall back to default
+            }
+            return default_value;
+        }
+    }
+
+    parallel_sort_parameters const& get_parallel_sort_parameters()
+    {
+        static parallel_sort_parameters const params = {
+            detail::get_sort_config_entry("phylanx.sort.threshold", 65536),
+            detail::get_sort_config_entry(
+                "phylanx.sort.radix_threshold", 65536),
+            detail::get_sort_config_entry(
+                "phylanx.sort.slice_threshold", 32768)};
+        return params;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        constexpr std::size_t radix_bits = 8;
+        constexpr std::size_t radix_buckets = std::size_t(1) << radix_bits;
+        constexpr std::size_t radix_passes = 64 / radix_bits;
+
+        // minimal number of elements handled by one chunk
+        constexpr std::size_t radix_min_chunk_size = 16384;
+
+        using histogram = std::array<std::size_t, radix_buckets>;
+
+        // flipping the sign bit makes the unsigned order of the keys match
+        // the signed order of the values
+        inline std::size_t radix_digit(std::int64_t value, std::size_t pass)
+        {
+            std::uint64_t key = static_cast<std::uint64_t>(value) ^
+                (std::uint64_t(1) << 63);
+            return static_cast<std::size_t>(
+                (key >> (pass * radix_bits)) & (radix_buckets - 1));
+        }
+
+        template <typename F>
+        void run_chunks(std::size_t num_chunks, F const& f)
+        {
+            if (num_chunks == 1)
+            {
+                f(0);
+                return;
+            }
+
+            std::vector<hpx::future<void>> chunks;
+            chunks.reserve(num_chunks);
+            for (std::size_t c = 0; c != num_chunks; ++c)
+            {
+                chunks.push_back(hpx::async([&f, c]() { f(c); }));
+            }
+
+            hpx::wait_all(chunks);
+
+            // rethrow exceptions, if any
+            for (auto& chunk : chunks)
+            {
+                chunk.get();
+            }
+        }
+    }
+
+    void radix_sort(std::int64_t* data, std::size_t size)
+    {
+        if (size < 2)
+        {
+            return;
+        }
+
+        std::size_t num_chunks = (std::min)(
+            std::size_t(hpx::get_os_thread_count()),
+            (size + detail::radix_min_chunk_size - 1) /
+                detail::radix_min_chunk_size);
+        if (num_chunks == 0)
+        {
+            num_chunks = 1;
+        }
+        std::size_t const chunk_size = (size + num_chunks - 1) / num_chunks;
+
+        auto chunk_begin = [&](std::size_t c) {
+            return (std::min)(c * chunk_size, size);
+        };
+        auto chunk_end = [&](std::size_t c) {
+            return (std::min)((c + 1) * chunk_size, size);
+        };
+
+        // a single pass over the data determines which digits need sorting,
+        // a digit shared by all values does not change the order
+        std::vector<std::array<detail::histogram, detail::radix_passes>>
+            totals(num_chunks);
+        detail::run_chunks(num_chunks, [&](std::size_t c) {
+            auto& h = totals[c];
+            for (auto& p : h)
+            {
+                p.fill(0);
+            }
+            for (std::size_t i = chunk_begin(c); i != chunk_end(c); ++i)
+            {
+                for (std::size_t pass = 0; pass != detail::radix_passes;
+                     ++pass)
+                {
+                    ++h[pass][detail::radix_digit(data[i], pass)];
+                }
+            }
+        });
+
+        std::vector<std::size_t> passes;
+        for (std::size_t pass = 0; pass != detail::radix_passes; ++pass)
+        {
+            std::size_t digit = detail::radix_digit(data[0], pass);
+            std::size_t count = 0;
+            for (auto const& h : totals)
+            {
+                count += h[pass][digit];
+            }
+            if (count != size)
+            {
+                passes.push_back(pass);
+            }
+        }
+
+        if (passes.empty())
+        {
+            return;     // all values are equal
+        }
+
+        std::unique_ptr<std::int64_t[]> buffer(new std::int64_t[size]);
+        std::int64_t* src = data;
+        std::int64_t* dst = buffer.get();
+
+        std::vector<detail::histogram> offsets(num_chunks);
+        for (std::size_t pass : passes)
+        {
+            // the per-chunk histograms of the first pass are known already
+            if (pass != passes.front())
+            {
+                detail::run_chunks(num_chunks, [&](std::size_t c) {
+                    auto& h = totals[c][pass];
+                    h.fill(0);
+                    for (std::size_t i = chunk_begin(c); i != chunk_end(c);
+                         ++i)
+                    {
+                        ++h[detail::radix_digit(src[i], pass)];
+                    }
+                });
+            }
+
+            // the elements of each chunk are placed after the elements with
+            // a smaller digit and after the elements of the same digit in
+            // preceding chunks, which keeps the sort stable
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d != detail::radix_buckets; ++d)
+            {
+                for (std::size_t c = 0; c != num_chunks; ++c)
+                {
+                    offsets[c][d] = offset;
+                    offset += totals[c][pass][d];
+                }
+            }
+
+            detail::run_chunks(num_chunks, [&](std::size_t c) {
+                auto& o = offsets[c];
+                for (std::size_t i = chunk_begin(c); i != chunk_end(c); ++i)
+                {
+                    dst[o[detail::radix_digit(src[i], pass)]++] = src[i];
+                }
+            });
+
+            std::swap(src, dst);
+        }
+
+        if (src != data)
+        {
+            detail::run_chunks(num_chunks, [&](std::size_t c) {
+                std::copy(src + chunk_begin(c), src + chunk_end(c),
+                    data + chunk_begin(c));
+            });
+        }
+    }
+}}
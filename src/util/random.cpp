@@ -6,8 +6,10 @@
 
 #include <phylanx/util/random.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <random>
+#include <string>
 
 namespace phylanx { namespace util
 {
@@ -22,14 +24,89 @@ namespace phylanx { namespace util
 
     std::mt19937 rng_{default_seed()};    // The Mersenne twister generator.
 
+    // The seed used for the counter-based generator and the number of calls
+    // to set_seed, both are updated by set_seed only.
+    std::atomic<std::uint32_t> stream_seed_(default_seed());
+    std::atomic<std::uint64_t> seed_generation_(0);
+
     void set_seed(std::uint32_t seed)
     {
         seed_ = seed;
         rng_.seed(seed_);
+
+        stream_seed_.store(seed, std::memory_order_relaxed);
+        seed_generation_.fetch_add(1, std::memory_order_release);
     }
 
     std::uint32_t get_seed()
     {
         return seed_;
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // finalizer of the SplitMix64 generator, every bit of the input
+        // affects every bit of the output
+        inline std::uint64_t mix64(std::uint64_t x)
+        {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+    }
+
+    std::uint64_t random_stream_key(
+        std::uint32_t seed, std::uint64_t identity, std::uint64_t count)
+    {
+        return detail::mix64(
+            detail::mix64(detail::mix64(seed) ^ identity) + count);
+    }
+
+    std::uint64_t random_stream_identity(std::string const& name)
+    {
+        // 64 bit FNV-1a
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (char c : name)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    random_stream_sequence::random_stream_sequence()
+      : identity_(0)
+      , state_(0)
+    {
+    }
+
+    random_stream_sequence::random_stream_sequence(std::string const& name)
+      : identity_(random_stream_identity(name))
+      , state_(0)
+    {
+    }
+
+    std::uint64_t random_stream_sequence::next_key()
+    {
+        std::uint64_t const generation =
+            seed_generation_.load(std::memory_order_acquire) & 0xffffffffull;
+
+        // restart counting if set_seed was called since the last stream was
+        // requested
+        std::uint64_t state = state_.load(std::memory_order_relaxed);
+        std::uint64_t count = 0;
+        do
+        {
+            count = (state >> 32) == generation ? (state & 0xffffffffull) : 0;
+        } while (!state_.compare_exchange_weak(state,
+            (generation << 32) | (count + 1), std::memory_order_relaxed));
+
+        return random_stream_key(
+            stream_seed_.load(std::memory_order_relaxed), identity_, count);
+    }
 }}
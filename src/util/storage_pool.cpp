@@ -0,0 +1,394 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/util/storage_pool.hpp>
+
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/config_entry.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+namespace phylanx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // buffers smaller than this are left to the system allocator
+        constexpr std::size_t min_pooled_bytes = 4096;
+
+        // maximal number of cached containers per size class and thread
+        constexpr std::size_t max_entries_per_size_class = 8;
+
+        constexpr std::size_t num_size_classes = 8 * sizeof(std::size_t);
+
+        static std::atomic<std::int64_t> count_hits_(0);
+        static std::atomic<std::int64_t> count_misses_(0);
+        static std::atomic<std::int64_t> count_releases_(0);
+        static std::atomic<std::int64_t> count_discards_(0);
+
+        static std::atomic<bool> enabled_(true);
+
+        // default: cache at most 16MB per thread and element type, and at
+        // most 128MB in total
+        static std::atomic<std::size_t> max_bytes_per_thread_(16ull << 20);
+        static std::atomic<std::size_t> max_bytes_(128ull << 20);
+        static std::atomic<bool> configured_(false);
+
+        // number of bytes currently held by all thread caches
+        static std::atomic<std::size_t> total_cached_bytes_(0);
+
+        // read the configuration once the runtime is available
+        inline void configure()
+        {
+            if (configured_.load(std::memory_order_relaxed) ||
+                hpx::get_runtime_ptr() == nullptr)
+            {
+                return;
+            }
+
+            if (!configured_.exchange(true))
+            {
+                if (hpx::get_config_entry(
+                        "phylanx.storage_pool.enabled", "1") == "0")
+                {
+                    enabled_.store(false);
+                }
+
+                try
+                {
+                    max_bytes_per_thread_.store(std::stoull(
+                        hpx::get_config_entry(
+                            "phylanx.storage_pool.max_bytes_per_thread",
+                            std::to_string(max_bytes_per_thread_.load()))));
+                }
+                catch (std::exception const&)
+                {
+                    // keep default
+                }
+
+                try
+                {
+                    max_bytes_.store(std::stoull(hpx::get_config_entry(
+                        "phylanx.storage_pool.max_bytes",
+                        std::to_string(max_bytes_.load()))));
+                }
+                catch (std::exception const&)
+                {
+                    // keep default
+                }
+            }
+        }
+
+        // reserve the given number of bytes from the process-wide budget
+        inline bool reserve_bytes(std::size_t bytes)
+        {
+            std::size_t const max_bytes =
+                max_bytes_.load(std::memory_order_relaxed);
+            if (total_cached_bytes_.fetch_add(bytes) + bytes > max_bytes)
+            {
+                total_cached_bytes_.fetch_sub(bytes);
+                return false;
+            }
+            return true;
+        }
+
+        inline void release_bytes(std::size_t bytes)
+        {
+            total_cached_bytes_.fetch_sub(bytes);
+        }
+
+        inline bool pooling_enabled()
+        {
+            configure();
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        // power of two size class: ceil(log2(size))
+        inline std::size_t size_class(std::size_t size)
+        {
+            std::size_t result = 0;
+            for (--size; size != 0; size >>= 1)
+            {
+                ++result;
+            }
+            return result;
+        }
+
+        inline std::int64_t get_and_reset_value(
+            std::atomic<std::int64_t>& value, bool reset)
+        {
+            if (reset)
+            {
+                return value.exchange(0);
+            }
+            return value.load();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Container>
+        using free_lists =
+            std::array<std::vector<Container>, num_size_classes>;
+
+        template <typename T>
+        struct thread_cache
+        {
+            thread_cache()
+              : cached_bytes_(0)
+            {}
+
+            ~thread_cache()
+            {
+                release_bytes(cached_bytes_);
+                destroyed() = true;
+            }
+
+            // containers released after the cache was destroyed (during
+            // thread shutdown) are simply freed
+            static bool& destroyed()
+            {
+                static thread_local bool destroyed_ = false;
+                return destroyed_;
+            }
+
+            static thread_cache* get()
+            {
+                if (destroyed())
+                {
+                    return nullptr;
+                }
+                static thread_local thread_cache cache;
+                return &cache;
+            }
+
+            template <typename Container>
+            bool acquire(free_lists<Container>& lists, std::size_t required,
+                Container& result)
+            {
+                // the next larger size class holds only large enough
+                // containers
+                std::size_t sc = size_class(required);
+                for (std::size_t s = sc; s != num_size_classes && s <= sc + 1;
+                     ++s)
+                {
+                    auto& bucket = lists[s];
+                    for (auto it = bucket.rbegin(); it != bucket.rend(); ++it)
+                    {
+                        if (it->capacity() >= required)
+                        {
+                            result = std::move(*it);
+                            bucket.erase(std::next(it).base());
+                            std::size_t bytes = result.capacity() * sizeof(T);
+                            cached_bytes_ -= bytes;
+                            release_bytes(bytes);
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+            template <typename Container>
+            void release(free_lists<Container>& lists, Container&& c)
+            {
+                std::size_t bytes = c.capacity() * sizeof(T);
+                auto& bucket = lists[size_class(c.capacity())];
+
+                if (bucket.size() >= max_entries_per_size_class ||
+                    cached_bytes_ + bytes >
+                        max_bytes_per_thread_.load(std::memory_order_relaxed) ||
+                    !reserve_bytes(bytes))
+                {
+                    ++count_discards_;
+                    return;     // c is freed by the caller
+                }
+
+                try
+                {
+                    bucket.emplace_back(std::move(c));
+                }
+                catch (...)
+                {
+                    release_bytes(bytes);
+                    throw;
+                }
+                cached_bytes_ += bytes;
+                ++count_releases_;
+            }
+
+            void clear() noexcept
+            {
+                for (auto& bucket : vectors_)
+                {
+                    bucket.clear();
+                }
+                for (auto& bucket : matrices_)
+                {
+                    bucket.clear();
+                }
+                release_bytes(cached_bytes_);
+                cached_bytes_ = 0;
+            }
+
+            free_lists<blaze::DynamicVector<T>> vectors_;
+            free_lists<blaze::DynamicMatrix<T>> matrices_;
+            std::size_t cached_bytes_;
+        };
+
+        template <typename T>
+        std::size_t required_capacity(std::size_t rows, std::size_t columns)
+        {
+            // account for padding of the rows
+            return rows *
+                blaze::nextMultiple(columns, blaze::SIMDTrait<T>::size);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    typename storage_pool<T>::vector_type storage_pool<T>::vector(
+        std::size_t size)
+    {
+        if (size * sizeof(T) >= detail::min_pooled_bytes &&
+            detail::pooling_enabled())
+        {
+            auto* cache = detail::thread_cache<T>::get();
+
+            vector_type result;
+            if (cache != nullptr &&
+                cache->acquire(cache->vectors_, size, result))
+            {
+                ++detail::count_hits_;
+                result.resize(size, false);
+                return result;
+            }
+            ++detail::count_misses_;
+        }
+        return vector_type(size);
+    }
+
+    template <typename T>
+    typename storage_pool<T>::matrix_type storage_pool<T>::matrix(
+        std::size_t rows, std::size_t columns)
+    {
+        std::size_t required = detail::required_capacity<T>(rows, columns);
+        if (required * sizeof(T) >= detail::min_pooled_bytes &&
+            detail::pooling_enabled())
+        {
+            auto* cache = detail::thread_cache<T>::get();
+
+            matrix_type result;
+            if (cache != nullptr &&
+                cache->acquire(cache->matrices_, required, result))
+            {
+                ++detail::count_hits_;
+                result.resize(rows, columns, false);
+                return result;
+            }
+            ++detail::count_misses_;
+        }
+        return matrix_type(rows, columns);
+    }
+
+    template <typename T>
+    void storage_pool<T>::release(vector_type&& v) noexcept
+    {
+        if (v.capacity() * sizeof(T) < detail::min_pooled_bytes ||
+            !detail::enabled_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        auto* cache = detail::thread_cache<T>::get();
+        if (cache != nullptr)
+        {
+            try
+            {
+                cache->release(cache->vectors_, std::move(v));
+            }
+            catch (...)
+            {
+                // failing to cache the container is not an error
+            }
+        }
+    }
+
+    template <typename T>
+    void storage_pool<T>::release(matrix_type&& m) noexcept
+    {
+        if (m.capacity() * sizeof(T) < detail::min_pooled_bytes ||
+            !detail::enabled_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        auto* cache = detail::thread_cache<T>::get();
+        if (cache != nullptr)
+        {
+            try
+            {
+                cache->release(cache->matrices_, std::move(m));
+            }
+            catch (...)
+            {
+                // failing to cache the container is not an error
+            }
+        }
+    }
+
+    template <typename T>
+    void storage_pool<T>::clear() noexcept
+    {
+        auto* cache = detail::thread_cache<T>::get();
+        if (cache != nullptr)
+        {
+            cache->clear();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t storage_pool_hit_count(bool reset)
+    {
+        return detail::get_and_reset_value(detail::count_hits_, reset);
+    }
+
+    std::int64_t storage_pool_miss_count(bool reset)
+    {
+        return detail::get_and_reset_value(detail::count_misses_, reset);
+    }
+
+    std::int64_t storage_pool_release_count(bool reset)
+    {
+        return detail::get_and_reset_value(detail::count_releases_, reset);
+    }
+
+    std::int64_t storage_pool_discard_count(bool reset)
+    {
+        return detail::get_and_reset_value(detail::count_discards_, reset);
+    }
+
+    bool enable_storage_pool(bool enable)
+    {
+        detail::configure();
+        return detail::enabled_.exchange(enable);
+    }
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+template class PHYLANX_EXPORT phylanx::util::storage_pool<double>;
+template class PHYLANX_EXPORT phylanx::util::storage_pool<std::uint8_t>;
+template class PHYLANX_EXPORT phylanx::util::storage_pool<std::int64_t>;
+template class PHYLANX_EXPORT phylanx::util::storage_pool<float>;
+template class PHYLANX_EXPORT phylanx::util::storage_pool<std::int32_t>;
@@ -0,0 +1,418 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/config.hpp>
+#include <phylanx/execution_tree/compiler/primitive_name.hpp>
+#include <phylanx/util/trace_events.hpp>
+
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace phylanx { namespace util
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Each OS thread appends its events to its own list of chunks. The
+        // recording thread is the only one writing to the last chunk of its
+        // list, the thread flushing the events is the only one reading and
+        // releasing the chunks. A chunk is released only after its successor
+        // has been linked, after which the recording thread doesn't touch it
+        // anymore.
+        struct trace_event_chunk
+        {
+            static constexpr std::size_t capacity = 256;
+
+            trace_event_chunk()
+              : size_(0)
+              , next_(nullptr)
+            {}
+
+            std::array<trace_event, capacity> events_;
+            std::atomic<std::size_t> size_;
+            std::atomic<trace_event_chunk*> next_;
+        };
+
+        struct trace_event_buffer
+        {
+            trace_event_buffer()
+              : head_(new trace_event_chunk)
+              , read_(0)
+              , tail_(head_)
+            {}
+
+            ~trace_event_buffer()
+            {
+                while (head_ != nullptr)
+                {
+                    trace_event_chunk* next = head_->next_.load();
+                    delete head_;
+                    head_ = next;
+                }
+            }
+
+            // called by the owning thread only
+            void push(trace_event const& event)
+            {
+                trace_event_chunk* chunk = tail_;
+                std::size_t size = chunk->size_.load(std::memory_order_relaxed);
+                if (size == trace_event_chunk::capacity)
+                {
+                    trace_event_chunk* next = new trace_event_chunk;
+                    chunk->next_.store(next, std::memory_order_release);
+                    tail_ = chunk = next;
+                    size = 0;
+                }
+
+                chunk->events_[size] = event;
+                chunk->size_.store(size + 1, std::memory_order_release);
+            }
+
+            // called by the flushing thread only, invokes f for all events
+            // published since the last call
+            template <typename F>
+            void consume(F&& f)
+            {
+                while (true)
+                {
+                    std::size_t size =
+                        head_->size_.load(std::memory_order_acquire);
+                    for (/**/; read_ != size; ++read_)
+                    {
+                        f(head_->events_[read_]);
+                    }
+
+                    if (size != trace_event_chunk::capacity)
+                    {
+                        break;
+                    }
+
+                    trace_event_chunk* next =
+                        head_->next_.load(std::memory_order_acquire);
+                    if (next == nullptr)
+                    {
+                        break;
+                    }
+
+                    delete head_;
+                    head_ = next;
+                    read_ = 0;
+                }
+            }
+
+            trace_event_chunk* head_;
+            std::size_t read_;
+            trace_event_chunk* tail_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct trace_event_registry
+        {
+            std::mutex mtx_;
+            std::vector<std::unique_ptr<trace_event_buffer>> buffers_;
+            std::map<std::pair<std::string, std::string>, std::uint32_t> ids_;
+            std::vector<std::pair<std::string, std::string>> names_;
+        };
+
+        trace_event_registry& get_trace_event_registry()
+        {
+            static trace_event_registry registry;
+            return registry;
+        }
+
+        trace_event_buffer& get_trace_event_buffer()
+        {
+            static thread_local trace_event_buffer* buffer = nullptr;
+            if (buffer == nullptr)
+            {
+                // the buffers are owned by the registry as their events may
+                // be flushed after the recording thread has exited
+                trace_event_registry& registry = get_trace_event_registry();
+
+                std::lock_guard<std::mutex> l(registry.mtx_);
+                registry.buffers_.emplace_back(new trace_event_buffer);
+                buffer = registry.buffers_.back().get();
+            }
+            return *buffer;
+        }
+
+        std::atomic<bool>& trace_events_flag()
+        {
+            static std::atomic<bool> enabled(
+                hpx::get_config_entry("phylanx.trace_events", "0") == "1");
+            return enabled;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_json_string(std::ostream& os, std::string const& s)
+        {
+            os << '"';
+            for (char c : s)
+            {
+                switch (c)
+                {
+                case '"':  os << "\\\""; break;
+                case '\\': os << "\\\\"; break;
+                case '\n': os << "\\n"; break;
+                case '\r': os << "\\r"; break;
+                case '\t': os << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        os << "\\u" << std::hex << std::setw(4)
+                           << std::setfill('0') << int(c) << std::dec
+                           << std::setfill(' ');
+                    }
+                    else
+                    {
+                        os << c;
+                    }
+                    break;
+                }
+            }
+            os << '"';
+        }
+
+        void write_shape(std::ostream& os, trace_event_shape const& shape)
+        {
+            if (shape.ndim_ < 0)
+            {
+                os << "\"-\"";
+                return;
+            }
+
+            os << '[';
+            for (std::int8_t i = 0; i != shape.ndim_; ++i)
+            {
+                if (i != 0)
+                {
+                    os << ',';
+                }
+                os << shape.dims_[i];
+            }
+            os << ']';
+        }
+
+        // timestamps are written in microseconds
+        void write_timestamp(std::ostream& os, std::uint64_t ns)
+        {
+            os << ns / 1000 << '.' << std::setw(3) << std::setfill('0')
+               << ns % 1000 << std::setfill(' ');
+        }
+
+        void write_worker(std::ostream& os, std::uint32_t worker)
+        {
+            if (worker == std::uint32_t(-1))
+            {
+                os << -1;
+            }
+            else
+            {
+                os << worker;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool trace_events_enabled()
+    {
+        return detail::trace_events_flag().load(std::memory_order_relaxed);
+    }
+
+    void enable_trace_events(bool enable)
+    {
+        detail::trace_events_flag().store(enable);
+    }
+
+    std::uint32_t register_trace_event_name(
+        std::string const& name, std::string const& codename)
+    {
+        detail::trace_event_registry& registry =
+            detail::get_trace_event_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+
+        auto p = registry.ids_.emplace(std::make_pair(name, codename),
+            std::uint32_t(registry.names_.size() + 1));
+        if (p.second)
+        {
+            registry.names_.emplace_back(name, codename);
+        }
+        return p.first->second;
+    }
+
+    std::uint32_t trace_event_worker()
+    {
+        // yields -1 if called outside of the HPX worker threads
+        return std::uint32_t(hpx::get_worker_thread_num());
+    }
+
+    void record_trace_event(trace_event const& event)
+    {
+        detail::get_trace_event_buffer().push(event);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t write_trace_events(std::ostream& os)
+    {
+        detail::trace_event_registry& registry =
+            detail::get_trace_event_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+
+        std::uint32_t const locality = hpx::get_locality_id();
+
+        // primitive display names are computed once per name
+        std::vector<std::string> display_names;
+        display_names.reserve(registry.names_.size());
+        for (auto const& name : registry.names_)
+        {
+            execution_tree::compiler::primitive_name_parts parts;
+            if (execution_tree::compiler::parse_primitive_name(
+                    name.first, parts))
+            {
+                display_names.emplace_back(
+                    execution_tree::compiler::compose_primitive_display_name(
+                        parts));
+            }
+            else
+            {
+                display_names.emplace_back(name.first);
+            }
+        }
+
+        std::size_t count = 0;
+        std::size_t records = 0;
+        std::set<std::uint32_t> workers;
+
+        os << "{\"traceEvents\":[";
+        for (auto const& buffer : registry.buffers_)
+        {
+            buffer->consume(
+                [&](trace_event const& event)
+                {
+                    std::size_t const id = event.name_ - 1;
+                    auto const& name = registry.names_[id];
+
+                    os << (records++ == 0 ? "\n" : ",\n");
+                    os << "{\"name\":";
+                    detail::write_json_string(os, display_names[id]);
+                    os << ",\"cat\":\"eval\",\"ph\":\"X\",\"ts\":";
+                    detail::write_timestamp(os, event.begin_);
+                    os << ",\"dur\":";
+                    detail::write_timestamp(os, event.end_ - event.begin_);
+                    os << ",\"pid\":" << locality << ",\"tid\":";
+                    detail::write_worker(os, event.worker_);
+
+                    os << ",\"args\":{\"primitive\":";
+                    detail::write_json_string(os, name.first);
+                    os << ",\"codename\":";
+                    detail::write_json_string(os, name.second);
+
+                    os << (event.last_known_arguments_ ?
+                        ",\"last_known_operand_shapes\":[" :
+                        ",\"arguments\":[");
+                    std::size_t const num_shapes = (std::min)(
+                        std::size_t(event.num_arguments_),
+                        std::size_t(trace_event::max_arguments));
+                    for (std::size_t i = 0; i != num_shapes; ++i)
+                    {
+                        if (i != 0)
+                        {
+                            os << ',';
+                        }
+                        detail::write_shape(os, event.arguments_[i]);
+                    }
+                    if (event.num_arguments_ > trace_event::max_arguments)
+                    {
+                        os << ",\"...\"";
+                    }
+                    os << ']';
+
+                    if (event.has_result_)
+                    {
+                        os << ",\"result\":";
+                        detail::write_shape(os, event.result_);
+                    }
+                    os << "}}";
+
+                    workers.insert(event.worker_);
+                    ++count;
+                });
+        }
+
+        // name the threads after the HPX workers
+        for (std::uint32_t worker : workers)
+        {
+            os << (records++ == 0 ? "\n" : ",\n");
+            os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":"
+               << locality << ",\"tid\":";
+            detail::write_worker(os, worker);
+            os << ",\"args\":{\"name\":\"";
+            if (worker == std::uint32_t(-1))
+            {
+                os << "external thread";
+            }
+            else
+            {
+                os << "worker-thread#" << worker;
+            }
+            os << "\"}}";
+        }
+
+        os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return count;
+    }
+
+    std::size_t write_trace_events(std::string const& filename)
+    {
+        std::ofstream os(filename);
+        if (!os.is_open())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "phylanx::util::write_trace_events",
+                "couldn't open file: " + filename);
+        }
+
+        std::size_t count = write_trace_events(os);
+        if (!os)
+        {
+            HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                "phylanx::util::write_trace_events",
+                "couldn't write trace events to file: " + filename);
+        }
+        return count;
+    }
+
+    void clear_trace_events()
+    {
+        detail::trace_event_registry& registry =
+            detail::get_trace_event_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        for (auto const& buffer : registry.buffers_)
+        {
+            buffer->consume([](trace_event const&) {});
+        }
+    }
+}}
@@ -0,0 +1,93 @@
+//   Copyright (c) 2019 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/util.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#define ITERATIONS std::size_t(1000)
+
+///////////////////////////////////////////////////////////////////////////////
+std::string const small_code = R"(
+    define(f, x, y, x * y + 1)
+    f
+)";
+
+// a larger source consisting of many function definitions
+std::string generate_large_code(std::size_t num_functions)
+{
+    std::string code;
+    for (std::size_t i = 0; i != num_functions; ++i)
+    {
+        std::string const n = std::to_string(i);
+        code += "define(f" + n + ", x, block(\n"
+            "    define(y, x * " + n + "),\n"
+            "    if(y > 100, y - 100, y + x)\n"
+            "))\n";
+    }
+    code += "f0\n";
+    return code;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_time(std::string const& name, std::uint64_t t)
+{
+    std::cout << name << ": " << (t / 1e3 / ITERATIONS) << " us/iteration\n";
+}
+
+void benchmark_environment()
+{
+    hpx::id_type here = hpx::find_here();
+
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != ITERATIONS; ++i)
+    {
+        auto env = phylanx::execution_tree::compiler::default_environment(
+            phylanx::execution_tree::get_all_known_patterns(), here);
+    }
+    print_time("environment (uncached)",
+        hpx::util::high_resolution_clock::now() - t);
+
+    t = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != ITERATIONS; ++i)
+    {
+        auto env = phylanx::execution_tree::compiler::default_environment(here);
+    }
+    print_time("environment (shared builtins)",
+        hpx::util::high_resolution_clock::now() - t);
+}
+
+void benchmark_compile(std::string const& name, std::string const& codestr)
+{
+    // warm up, this also populates the AST cache
+    {
+        phylanx::execution_tree::compiler::function_list snippets;
+        phylanx::execution_tree::compile(codestr, snippets);
+    }
+
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != ITERATIONS; ++i)
+    {
+        phylanx::execution_tree::compiler::function_list snippets;
+        phylanx::execution_tree::compile(codestr, snippets);
+    }
+    print_time(name, hpx::util::high_resolution_clock::now() - t);
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark_environment();
+
+    benchmark_compile("compile (small)", small_code);
+    benchmark_compile("compile (large)", generate_large_code(100));
+
+    return 0;
+}
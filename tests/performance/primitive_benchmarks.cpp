@@ -0,0 +1,486 @@
+//   Copyright (c) 2019 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Micro-benchmarks for the registered primitives. Every primitive known to
+// the compiler for which a benchmark specification is listed below is run
+// over a sweep of argument shapes, element types, and scheduling policies.
+// The results are written as a JSON array, one record per combination:
+//
+//     primitive_benchmarks_test --min-time=0.2 --output=results.json
+//     primitive_benchmarks_test --filter=__add,sum
+//
+// For each combination the harness reports the time per evaluation and per
+// element, the achieved bandwidth (counting the bytes of all arguments and
+// of the result once), and the number of node_data copies and moves per
+// evaluation. Every copy of an array allocates.
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/util.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+#include <blaze_tensor/Math.h>
+#endif
+#include <boost/program_options.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+enum dims_mask
+{
+    scalars = 0x01,
+    vectors = 0x02,
+    matrices = 0x04,
+    tensors = 0x08,
+    arrays = vectors | matrices | tensors,
+    all_dims = scalars | arrays
+};
+
+enum dtype_mask
+{
+    float64 = 0x01,
+    float32 = 0x02,
+    int64 = 0x04,
+    floating = float64 | float32,
+    all_dtypes = floating | int64
+};
+
+struct benchmark_spec
+{
+    char const* primitive;      // the registered name of the primitive
+    char const* expression;     // the benchmarked expression of x (and y)
+    int arity;
+    int dims;
+    int dtypes;
+};
+
+// The primitives in this list are benchmarked if they are registered with the
+// compiler. The second argument of binary expressions has the same shape and
+// element type as the first one.
+benchmark_spec const specs[] = {
+    // arithmetics
+    {"__add", "x + y", 2, all_dims, all_dtypes},
+    {"__sub", "x - y", 2, all_dims, all_dtypes},
+    {"__mul", "x * y", 2, all_dims, all_dtypes},
+    {"__div", "x / y", 2, all_dims, all_dtypes},
+    {"__minus", "-x", 1, all_dims, all_dtypes},
+    {"maximum", "maximum(x, y)", 2, all_dims, all_dtypes},
+    {"minimum", "minimum(x, y)", 2, all_dims, all_dtypes},
+    {"cumsum", "cumsum(x)", 1, arrays, all_dtypes},
+
+    // element-wise functions
+    {"absolute", "absolute(x)", 1, all_dims, all_dtypes},
+    {"exp", "exp(x)", 1, all_dims, floating},
+    {"log", "log(x)", 1, all_dims, floating},
+    {"sqrt", "sqrt(x)", 1, all_dims, floating},
+    {"square", "square(x)", 1, all_dims, all_dtypes},
+    {"tanh", "tanh(x)", 1, all_dims, floating},
+    {"sigmoid", "sigmoid(x)", 1, arrays, floating},
+
+    // comparisons
+    {"__gt", "x > y", 2, all_dims, all_dtypes},
+    {"__eq", "x == y", 2, all_dims, all_dtypes},
+
+    // reductions
+    {"sum", "sum(x)", 1, arrays, all_dtypes},
+    {"mean", "mean(x)", 1, arrays, all_dtypes},
+    {"amax", "amax(x)", 1, arrays, all_dtypes},
+    {"var", "var(x)", 1, arrays, floating},
+    {"argmax", "argmax(x)", 1, arrays, all_dtypes},
+
+    // matrix operations
+    {"dot", "dot(x, y)", 2, vectors | matrices, floating},
+    {"transpose", "transpose(x)", 1, matrices | tensors, all_dtypes},
+    {"sort", "sort(x)", 1, vectors | matrices, all_dtypes},
+    {"flatten", "flatten(x)", 1, arrays, all_dtypes},
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct shape
+{
+    char const* name;
+    int dims;
+    std::vector<std::size_t> extents;
+
+    std::size_t size() const
+    {
+        std::size_t result = 1;
+        for (std::size_t e : extents)
+        {
+            result *= e;
+        }
+        return result;
+    }
+};
+
+std::vector<shape> const shapes = {
+    {"scalar", scalars, {}},
+    {"vector-1e3", vectors, {1000}},
+    {"vector-1e6", vectors, {1000000}},
+    {"matrix-small", matrices, {100, 100}},
+    {"matrix-large", matrices, {1000, 1000}},
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+    {"tensor-small", tensors, {10, 100, 100}},
+    {"tensor-large", tensors, {100, 100, 100}},
+#endif
+};
+
+struct dtype
+{
+    char const* name;
+    int mask;
+    std::size_t element_size;
+};
+
+std::vector<dtype> const dtypes = {
+    {"float64", float64, sizeof(double)},
+    {"float32", float32, sizeof(float)},
+    {"int64", int64, sizeof(std::int64_t)},
+};
+
+char const* const modes[] = {"sync", "async"};
+
+///////////////////////////////////////////////////////////////////////////////
+// arguments hold values in [1, 2) (or [1, 97] for integers), which is a valid
+// domain for all benchmarked functions
+template <typename T>
+T argument_value(std::size_t i, std::size_t seed)
+{
+    std::size_t const v = (i * 31 + seed * 17) % 97;
+    return std::is_integral<T>::value ? T(v + 1) : T(1.0 + v / 97.0);
+}
+
+template <typename T>
+phylanx::execution_tree::primitive_argument_type make_argument(
+    shape const& s, std::size_t seed)
+{
+    switch (s.extents.size())
+    {
+    case 0:
+        return phylanx::ir::node_data<T>(argument_value<T>(0, seed));
+
+    case 1:
+        {
+            blaze::DynamicVector<T> v(s.extents[0]);
+            for (std::size_t i = 0; i != v.size(); ++i)
+            {
+                v[i] = argument_value<T>(i, seed);
+            }
+            return phylanx::ir::node_data<T>(std::move(v));
+        }
+
+    case 2:
+        {
+            blaze::DynamicMatrix<T> m(s.extents[0], s.extents[1]);
+            for (std::size_t i = 0; i != m.rows(); ++i)
+            {
+                for (std::size_t j = 0; j != m.columns(); ++j)
+                {
+                    m(i, j) = argument_value<T>(i * m.columns() + j, seed);
+                }
+            }
+            return phylanx::ir::node_data<T>(std::move(m));
+        }
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+    case 3:
+        {
+            blaze::DynamicTensor<T> t(
+                s.extents[0], s.extents[1], s.extents[2]);
+            for (std::size_t k = 0; k != t.pages(); ++k)
+            {
+                for (std::size_t i = 0; i != t.rows(); ++i)
+                {
+                    for (std::size_t j = 0; j != t.columns(); ++j)
+                    {
+                        t(k, i, j) = argument_value<T>(
+                            (k * t.rows() + i) * t.columns() + j, seed);
+                    }
+                }
+            }
+            return phylanx::ir::node_data<T>(std::move(t));
+        }
+#endif
+
+    default:
+        break;
+    }
+
+    HPX_THROW_EXCEPTION(hpx::bad_parameter, "make_argument",
+        "unsupported number of dimensions");
+}
+
+phylanx::execution_tree::primitive_argument_type make_argument(
+    dtype const& t, shape const& s, std::size_t seed)
+{
+    switch (t.mask)
+    {
+    case float64:
+        return make_argument<double>(s, seed);
+
+    case float32:
+        return make_argument<float>(s, seed);
+
+    case int64:
+        return make_argument<std::int64_t>(s, seed);
+
+    default:
+        break;
+    }
+
+    HPX_THROW_EXCEPTION(hpx::bad_parameter, "make_argument",
+        "unsupported element type");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string compile_code(benchmark_spec const& spec)
+{
+    std::string const args = spec.arity == 1 ? "x" : "x, y";
+    return "define(benchmark, " + args + ", " + spec.expression +
+        ")\nbenchmark";
+}
+
+void write_json_string(std::ostream& os, std::string const& s)
+{
+    os << '"';
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            os << '\\' << c;
+        }
+        else if (c == '\n')
+        {
+            os << "\\n";
+        }
+        else
+        {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+struct benchmark_result
+{
+    std::size_t iterations = 0;
+    double ns_per_iteration = 0.0;
+    std::int64_t bytes = 0;
+    std::int64_t copies = 0;
+    std::int64_t moves = 0;
+    std::string error;
+};
+
+benchmark_result run_benchmark(benchmark_spec const& spec, dtype const& t,
+    shape const& s, double min_time)
+{
+    using namespace phylanx::execution_tree;
+
+    benchmark_result result;
+    try
+    {
+        compiler::function_list snippets;
+        auto const& code = compile(spec.primitive, compile_code(spec),
+            snippets);
+        auto f = code.run();
+
+        // the arguments are passed by reference, they are not copied
+        primitive_arguments_type const args = [&]() {
+            primitive_arguments_type args;
+            for (int i = 0; i != spec.arity; ++i)
+            {
+                args.emplace_back(make_argument(t, s, i));
+            }
+            return args;
+        }();
+
+        // warm up, this also determines the amount of processed data
+        primitive_argument_type value = f(args, eval_context{});
+
+        result.bytes = estimate_data_size(value);
+        for (auto const& arg : args)
+        {
+            result.bytes += estimate_data_size(arg);
+        }
+        result.bytes *= t.element_size;
+
+        phylanx::ir::reset_enable_counts_on_exit counts(true);
+        phylanx::ir::node_data<double>::copy_construction_count(true);
+        phylanx::ir::node_data<double>::move_construction_count(true);
+
+        std::uint64_t const min_ns = std::uint64_t(min_time * 1e9);
+        std::uint64_t const start = hpx::util::high_resolution_clock::now();
+        std::uint64_t elapsed = 0;
+        do
+        {
+            value = f(args, eval_context{});
+            ++result.iterations;
+            elapsed = hpx::util::high_resolution_clock::now() - start;
+        } while (elapsed < min_ns || result.iterations < 3);
+
+        result.ns_per_iteration = double(elapsed) / result.iterations;
+        result.copies =
+            phylanx::ir::node_data<double>::copy_construction_count(true);
+        result.moves =
+            phylanx::ir::node_data<double>::move_construction_count(true);
+    }
+    catch (std::exception const& e)
+    {
+        result.error = e.what();
+    }
+    return result;
+}
+
+void write_result(std::ostream& os, benchmark_spec const& spec,
+    dtype const& t, shape const& s, char const* mode,
+    benchmark_result const& r)
+{
+    os << "{\"primitive\":";
+    write_json_string(os, spec.primitive);
+    os << ",\"expression\":";
+    write_json_string(os, spec.expression);
+    os << ",\"shape_name\":\"" << s.name << "\",\"shape\":[";
+    for (std::size_t i = 0; i != s.extents.size(); ++i)
+    {
+        os << (i == 0 ? "" : ",") << s.extents[i];
+    }
+    os << "],\"dtype\":\"" << t.name << "\",\"mode\":\"" << mode << "\"";
+
+    if (!r.error.empty())
+    {
+        os << ",\"error\":";
+        write_json_string(os, r.error);
+        os << "}";
+        return;
+    }
+
+    double const iterations = double(r.iterations);
+    os << ",\"iterations\":" << r.iterations
+       << ",\"ns_per_iteration\":" << r.ns_per_iteration
+       << ",\"ns_per_element\":" << r.ns_per_iteration / s.size()
+       << ",\"gb_per_s\":" << r.bytes / r.ns_per_iteration
+       << ",\"copies_per_iteration\":" << r.copies / iterations
+       << ",\"moves_per_iteration\":" << r.moves / iterations << "}";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    double const min_time = vm["min-time"].as<double>();
+
+    std::set<std::string> filter;
+    {
+        std::istringstream names(vm["filter"].as<std::string>());
+        std::string name;
+        while (std::getline(names, name, ','))
+        {
+            if (!name.empty())
+            {
+                filter.insert(name);
+            }
+        }
+    }
+
+    // benchmark only the primitives which are actually registered
+    std::set<std::string> registered;
+    for (auto const& pattern :
+        phylanx::execution_tree::get_all_known_patterns())
+    {
+        registered.insert(pattern.data_.primitive_type_);
+    }
+
+    std::ofstream file;
+    std::string const output = vm["output"].as<std::string>();
+    if (!output.empty())
+    {
+        file.open(output);
+        if (!file.is_open())
+        {
+            std::cerr << "primitive_benchmarks: couldn't open output file: "
+                      << output << "\n";
+            return hpx::finalize();
+        }
+    }
+    std::ostream& os = output.empty() ? std::cout : file;
+
+    std::string const policy =
+        phylanx::execution_tree::get_scheduling_policy_name();
+
+    bool first = true;
+    os << "[";
+    for (auto const& spec : specs)
+    {
+        if (registered.find(spec.primitive) == registered.end() ||
+            (!filter.empty() && filter.find(spec.primitive) == filter.end()))
+        {
+            continue;
+        }
+
+        for (char const* mode : modes)
+        {
+            phylanx::execution_tree::set_scheduling_policy(mode);
+
+            for (auto const& t : dtypes)
+            {
+                if ((spec.dtypes & t.mask) == 0)
+                {
+                    continue;
+                }
+
+                for (auto const& s : shapes)
+                {
+                    if ((spec.dims & s.dims) == 0)
+                    {
+                        continue;
+                    }
+
+                    benchmark_result r = run_benchmark(spec, t, s, min_time);
+
+                    os << (first ? "\n" : ",\n");
+                    write_result(os, spec, t, s, mode, r);
+                    os.flush();
+                    first = false;
+                }
+            }
+        }
+    }
+    os << "\n]\n";
+
+    phylanx::execution_tree::set_scheduling_policy(policy);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    boost::program_options::options_description desc(
+        "usage: primitive_benchmarks [options]");
+    desc.add_options()
+        ("min-time",
+            boost::program_options::value<double>()->default_value(0.1),
+            "minimal time (in seconds) spent measuring each combination of "
+            "primitive, shape, element type, and scheduling policy")
+        ("filter",
+            boost::program_options::value<std::string>()->default_value(""),
+            "comma separated list of the primitives to benchmark (default: "
+            "all primitives with a benchmark specification)")
+        ("output",
+            boost::program_options::value<std::string>()->default_value(""),
+            "file to write the results to (default: standard output)");
+
+    return hpx::init(desc, argc, argv);
+}
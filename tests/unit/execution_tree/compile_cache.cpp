@@ -0,0 +1,146 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const code = R"(
+    define(fact, n,
+        if(n <= 1, 1, n * fact(n - 1))
+    )
+    fact(10)
+)";
+
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& compiled = phylanx::execution_tree::compile(codestr, snippets);
+    return compiled.run();
+}
+
+void test_cache_key()
+{
+    using phylanx::execution_tree::compiler::compile_cache_key;
+
+    HPX_TEST_EQ(compile_cache_key(code), compile_cache_key(code));
+    HPX_TEST_NEQ(compile_cache_key(code), compile_cache_key("fact(11)"));
+}
+
+void test_compile_cache(std::string const& directory)
+{
+    using namespace phylanx::execution_tree::compiler;
+
+    set_compile_cache_directory(directory);
+    HPX_TEST_EQ(get_compile_cache_directory(), directory);
+
+    auto expected = phylanx::execution_tree::primitive_argument_type{
+        std::int64_t(3628800)};
+
+    // first compilation generates the AST and stores it on disk
+    auto before = get_compile_cache_statistics();
+    HPX_TEST_EQ(compile_and_run(code), expected);
+
+    auto after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.misses_, before.misses_ + 1);
+    HPX_TEST(!boost::filesystem::is_empty(directory));
+
+    // second compilation reuses the AST from memory
+    before = after;
+    HPX_TEST_EQ(compile_and_run(code), expected);
+
+    after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.memory_hits_, before.memory_hits_ + 1);
+    HPX_TEST_EQ(after.misses_, before.misses_);
+
+    // after clearing the in-memory cache the AST is loaded from disk
+    clear_compile_cache();
+
+    before = after;
+    HPX_TEST_EQ(compile_and_run(code), expected);
+
+    after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.disk_hits_, before.disk_hits_ + 1);
+    HPX_TEST_EQ(after.misses_, before.misses_);
+
+    // disabling the persistent cache falls back to re-generating the AST
+    set_compile_cache_directory("");
+    clear_compile_cache();
+
+    before = after;
+    HPX_TEST_EQ(compile_and_run(code), expected);
+
+    after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.disk_hits_, before.disk_hits_);
+    HPX_TEST_EQ(after.misses_, before.misses_ + 1);
+}
+
+void test_compile_cache_capacity()
+{
+    using namespace phylanx::execution_tree::compiler;
+
+    set_compile_cache_directory("");
+    clear_compile_cache();
+    set_compile_cache_capacity(2);
+    HPX_TEST_EQ(get_compile_cache_capacity(), std::size_t(2));
+
+    generate_ast_cached("1 + 1");
+    generate_ast_cached("2 + 2");
+    generate_ast_cached("1 + 1");       // "2 + 2" is now least recently used
+
+    auto before = get_compile_cache_statistics();
+    generate_ast_cached("3 + 3");       // evicts "2 + 2"
+
+    auto after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.evictions_, before.evictions_ + 1);
+    HPX_TEST_EQ(after.size_, std::size_t(2));
+
+    before = after;
+    generate_ast_cached("1 + 1");
+    after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.memory_hits_, before.memory_hits_ + 1);
+
+    before = after;
+    generate_ast_cached("2 + 2");
+    after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.misses_, before.misses_ + 1);
+
+    // shrinking the capacity evicts entries right away
+    set_compile_cache_capacity(1);
+    HPX_TEST_EQ(get_compile_cache_statistics().size_, std::size_t(1));
+
+    // a capacity of zero disables the in-memory cache
+    set_compile_cache_capacity(0);
+    before = get_compile_cache_statistics();
+    generate_ast_cached("1 + 1");
+    generate_ast_cached("1 + 1");
+    after = get_compile_cache_statistics();
+    HPX_TEST_EQ(after.misses_, before.misses_ + 2);
+    HPX_TEST_EQ(after.size_, std::size_t(0));
+}
+
+int main(int argc, char* argv[])
+{
+    boost::filesystem::path directory =
+        boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path();
+
+    test_cache_key();
+    test_compile_cache(directory.string());
+    test_compile_cache_capacity();
+
+    boost::filesystem::remove_all(directory);
+
+    return hpx::util::report_errors();
+}
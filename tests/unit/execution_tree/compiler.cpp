@@ -152,6 +152,35 @@ void test_builtin_environment_vars_lazy()
             add(ctx, defx.run(ctx), defy.run(ctx))));
 }
 
+void test_shared_builtin_environment()
+{
+    hpx::id_type here = hpx::find_here();
+
+    // both environments share the same table of built-in functions
+    phylanx::execution_tree::compiler::environment env1 =
+        phylanx::execution_tree::compiler::default_environment(here);
+    phylanx::execution_tree::compiler::environment env2 =
+        phylanx::execution_tree::compiler::default_environment(here);
+
+    HPX_TEST(env1.find("__add") != nullptr);
+    HPX_TEST(env1.find("__add") == env2.find("__add"));
+    HPX_TEST_EQ(env1.size(), env2.size());
+
+    // definitions shadow built-ins in one environment only
+    auto create_var = phylanx::execution_tree::compiler::define_operation{here};
+    auto var = create_var(phylanx::ir::node_data<double>{41.0}, "__add");
+    env1.define_variable(
+        "__add", phylanx::execution_tree::compiler::access_variable{var});
+
+    HPX_TEST(env1.find("__add") != nullptr);
+    HPX_TEST(env1.find("__add") != env2.find("__add"));
+    HPX_TEST_EQ(env1.size(), env2.size() + 1);
+
+    phylanx::execution_tree::compiler::environment env3 =
+        phylanx::execution_tree::compiler::default_environment(here);
+    HPX_TEST(env2.find("__add") == env3.find("__add"));
+}
+
 void test_define_variable()
 {
     phylanx::execution_tree::compiler::function_list snippets;
@@ -860,6 +889,7 @@ int main(int argc, char* argv[])
     test_builtin_environment();
     test_builtin_environment_vars();
     test_builtin_environment_vars_lazy();
+    test_shared_builtin_environment();
 
     test_define_variable();
     test_define_variable_block();
@@ -0,0 +1,152 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/agas.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive create_add(std::string const& name)
+{
+    phylanx::execution_tree::primitive_arguments_type operands;
+    operands.emplace_back(phylanx::ir::node_data<double>{41.0});
+    operands.emplace_back(phylanx::ir::node_data<double>{1.0});
+
+    return phylanx::execution_tree::create_primitive_component(
+        hpx::find_here(), "__add", std::move(operands), name);
+}
+
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a lightweight primitive is made known to AGAS only once its id is requested
+void test_promotion()
+{
+    std::string const name = "/phylanx/lightweight$0";
+
+    phylanx::execution_tree::primitive p = create_add(name);
+    HPX_TEST(p.lightweight_component() != nullptr);
+    HPX_TEST_EQ(p.registered_name(), name);
+
+    HPX_TEST_EQ(42.0, phylanx::execution_tree::extract_scalar_numeric_value(
+        p.eval(hpx::launch::sync)));
+
+    hpx::error_code ec(hpx::lightweight);
+    HPX_TEST(!hpx::agas::resolve_name(hpx::launch::sync, name, ec));
+
+    hpx::id_type id = p.get_id();
+    HPX_TEST(id);
+    HPX_TEST(hpx::agas::resolve_name(hpx::launch::sync, name) == id);
+
+    // all clients refer to the same instance
+    phylanx::execution_tree::primitive copy = p;
+    HPX_TEST(copy.get_id() == id);
+    HPX_TEST_EQ(42.0, phylanx::execution_tree::extract_scalar_numeric_value(
+        copy.eval().get()));
+
+    // a client holding the id only evaluates the same instance
+    phylanx::execution_tree::primitive global{hpx::id_type(id)};
+    HPX_TEST_EQ(42.0, phylanx::execution_tree::extract_scalar_numeric_value(
+        global.eval(hpx::launch::sync)));
+}
+
+// a promoted primitive is kept alive by its global id only
+void test_escaped_id()
+{
+    hpx::id_type id;
+    {
+        phylanx::execution_tree::primitive p = create_add("");
+        HPX_TEST(p.lightweight_component() != nullptr);
+        id = p.get_id();
+    }
+
+    phylanx::execution_tree::primitive global{std::move(id)};
+    HPX_TEST_EQ(42.0, phylanx::execution_tree::extract_scalar_numeric_value(
+        global.eval(hpx::launch::sync)));
+}
+
+// the name of a promoted primitive stays registered as long as the primitive
+// is referenced globally
+void test_escaped_name()
+{
+    std::string const name = "/phylanx/lightweight$1";
+
+    hpx::id_type id;
+    {
+        phylanx::execution_tree::primitive p = create_add(name);
+        HPX_TEST(p.lightweight_component() != nullptr);
+        id = p.get_id();
+    }
+
+    HPX_TEST(hpx::agas::resolve_name(hpx::launch::sync, name) == id);
+
+    phylanx::execution_tree::primitive global{
+        hpx::agas::resolve_name(hpx::launch::sync, name)};
+    HPX_TEST_EQ(42.0, phylanx::execution_tree::extract_scalar_numeric_value(
+        global.eval(hpx::launch::sync)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_compile()
+{
+    auto fib = compile_and_run(R"(
+        define(fib, n,
+            if(n < 2, n, fib(n - 1) + fib(n - 2))
+        )
+        fib(15)
+    )");
+    HPX_TEST_EQ(std::int64_t(610),
+        phylanx::execution_tree::extract_scalar_integer_value(fib));
+
+    auto stored = compile_and_run(R"(block(
+        define(a, 57.7),
+        store(a, 42.0),
+        a
+    ))");
+    HPX_TEST_EQ(42.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(stored));
+
+    // functions passed as arguments
+    auto applied = compile_and_run(R"(
+        define(apply, f, x, f(x))
+        define(square, x, x * x)
+        apply(square, 3.0)
+    )");
+    HPX_TEST_EQ(9.0,
+        phylanx::execution_tree::extract_scalar_numeric_value(applied));
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST(!phylanx::execution_tree::lightweight_primitives_enabled());
+    phylanx::execution_tree::enable_lightweight_primitives();
+
+    test_promotion();
+    test_escaped_id();
+    test_escaped_name();
+    test_compile();
+
+    // primitives are created as components once disabled
+    phylanx::execution_tree::enable_lightweight_primitives(false);
+    HPX_TEST(create_add("").lightweight_component() == nullptr);
+
+    return hpx::util::report_errors();
+}
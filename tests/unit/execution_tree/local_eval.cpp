@@ -0,0 +1,150 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive create_add()
+{
+    phylanx::execution_tree::primitive_arguments_type operands;
+    operands.emplace_back(phylanx::ir::node_data<double>{41.0});
+    operands.emplace_back(phylanx::ir::node_data<double>{1.0});
+
+    return phylanx::execution_tree::create_primitive_component(
+        hpx::find_here(), "__add", std::move(operands));
+}
+
+double extract(phylanx::execution_tree::primitive_argument_type const& val)
+{
+    return phylanx::execution_tree::extract_scalar_numeric_value(val);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// all copies of a client evaluate the same component, regardless of whether
+// the local component was resolved before the client was copied
+void test_local_eval()
+{
+    phylanx::execution_tree::primitive p = create_add();
+    phylanx::execution_tree::primitive copy_before = p;
+
+    HPX_TEST_EQ(extract(p.eval().get()), 42.0);
+    HPX_TEST_EQ(extract(p.eval(hpx::launch::sync)), 42.0);
+
+    phylanx::execution_tree::primitive copy_after = p;
+    HPX_TEST_EQ(extract(copy_before.eval().get()), 42.0);
+    HPX_TEST_EQ(extract(copy_after.eval(hpx::launch::sync)), 42.0);
+
+    phylanx::execution_tree::primitive assigned;
+    assigned = copy_after;
+    HPX_TEST_EQ(extract(assigned.eval().get()), 42.0);
+
+    phylanx::execution_tree::primitive moved = std::move(assigned);
+    HPX_TEST(!assigned.valid());
+    HPX_TEST_EQ(extract(moved.eval().get()), 42.0);
+
+    // concurrent first evaluations of the same client
+    phylanx::execution_tree::primitive fresh = create_add();
+    std::vector<hpx::future<phylanx::execution_tree::primitive_argument_type>>
+        results;
+    for (int i = 0; i != 16; ++i)
+    {
+        results.push_back(hpx::async([&]() { return fresh.eval().get(); }));
+    }
+    for (auto& f : results)
+    {
+        HPX_TEST_EQ(extract(f.get()), 42.0);
+    }
+}
+
+// clients holding an unmanaged id take the action path
+void test_unmanaged_eval()
+{
+    phylanx::execution_tree::primitive p = create_add();
+
+    phylanx::execution_tree::primitive unmanaged(hpx::id_type(
+        p.get_id().get_gid(), hpx::id_type::unmanaged));
+
+    HPX_TEST_EQ(extract(unmanaged.eval().get()), 42.0);
+    HPX_TEST_EQ(extract(unmanaged.eval(hpx::launch::sync)), 42.0);
+}
+
+// every evaluation counts as exactly one scheduling decision
+void test_eval_decisions(std::string const& name)
+{
+    using phylanx::execution_tree::eval_mode;
+
+    phylanx::execution_tree::set_scheduling_policy(name);
+
+    phylanx::execution_tree::primitive p = create_add();
+    auto comp = hpx::get_ptr<
+        phylanx::execution_tree::primitives::primitive_component>(
+        hpx::launch::sync, p.get_id());
+
+    phylanx::execution_tree::primitive_arguments_type args;
+    HPX_TEST_EQ(extract(p.eval_fov(args).get()), 42.0);
+
+    std::int64_t decisions = 0;
+    for (eval_mode mode : {eval_mode::undecided, eval_mode::async,
+             eval_mode::sync, eval_mode::fork})
+    {
+        decisions += comp->get_eval_decisions(mode, false);
+    }
+    HPX_TEST_EQ(decisions, std::int64_t(1));
+
+    phylanx::execution_tree::set_scheduling_policy("hysteresis");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const code = R"(
+    define(fib, n,
+        if(n < 2, n, fib(n - 1) + fib(n - 2))
+    )
+    fib(15)
+)";
+
+void test_run_with_policy(std::string const& name)
+{
+    phylanx::execution_tree::set_scheduling_policy(name);
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& fib = phylanx::execution_tree::compile(code, snippets, env);
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(std::int64_t(610),
+            phylanx::execution_tree::extract_scalar_integer_value(
+                fib.run()));
+    }
+
+    phylanx::execution_tree::set_scheduling_policy("hysteresis");
+}
+
+int main(int argc, char* argv[])
+{
+    test_local_eval();
+    test_unmanaged_eval();
+
+    test_eval_decisions("sync");
+    test_eval_decisions("async");
+
+    for (char const* name : {"hysteresis", "cost_model", "sync", "async"})
+    {
+        test_run_with_policy(name);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/execution_tree/primitives/broadcasting.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+void test_broadcasting(std::string const& code, std::string const& expected)
+{
+    HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected));
+}
+
+bool test_incompatible(std::string const& code)
+{
+    bool caught_exception = false;
+    try
+    {
+        compile_and_run(code);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    return caught_exception;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_shapes()
+{
+    using phylanx::execution_tree::broadcast_shape;
+    using phylanx::execution_tree::broadcast_shapes;
+
+    broadcast_shape column{2, {{1, 3, 1}}};
+    broadcast_shape row{1, {{1, 1, 4}}};
+
+    broadcast_shape result = broadcast_shapes(column, row, "", "");
+    HPX_TEST_EQ(result.numdims_, std::size_t(2));
+    HPX_TEST_EQ(result.dims_[0], std::size_t(1));
+    HPX_TEST_EQ(result.dims_[1], std::size_t(3));
+    HPX_TEST_EQ(result.dims_[2], std::size_t(4));
+
+    broadcast_shape pages{3, {{2, 1, 1}}};
+    result = broadcast_shapes(pages, column, "", "");
+    HPX_TEST_EQ(result.numdims_, std::size_t(3));
+    HPX_TEST_EQ(result.dims_[0], std::size_t(2));
+    HPX_TEST_EQ(result.dims_[1], std::size_t(3));
+    HPX_TEST_EQ(result.dims_[2], std::size_t(1));
+}
+
+void test_arithmetics()
+{
+    // (3, 1) + (2,) -> (3, 2)
+    test_broadcasting("[[1], [2], [3]] + [10, 20]",
+        "[[11, 21], [12, 22], [13, 23]]");
+    test_broadcasting("[10., 20.] - [[1.], [2.]]",
+        "[[9., 19.], [8., 18.]]");
+
+    // (2, 1) * (1, 3) -> (2, 3)
+    test_broadcasting("[[1], [2]] * [[1, 2, 3]]",
+        "[[1, 2, 3], [2, 4, 6]]");
+
+    // more than two operands
+    test_broadcasting("__add([[1], [2]], [10, 20], 100)",
+        "[[111, 121], [112, 122]]");
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+    // (2, 1, 1) + (2, 2) -> (2, 2, 2)
+    test_broadcasting("[[[1]], [[2]]] + [[10, 20], [30, 40]]",
+        "[[[11, 21], [31, 41]], [[12, 22], [32, 42]]]");
+
+    // (1, 2, 1) + (2, 1, 3) -> (2, 2, 3)
+    test_broadcasting("[[[1], [2]]] + [[[10, 20, 30]], [[40, 50, 60]]]",
+        "[[[11, 21, 31], [12, 22, 32]], [[41, 51, 61], [42, 52, 62]]]");
+#endif
+}
+
+// scalars, rows and columns combined with arrays use dedicated code paths
+void test_scalars_rows_and_columns()
+{
+    test_broadcasting("10 - [1, 2]", "[9, 8]");
+    test_broadcasting("[[1, 2]] - 1", "[[0, 1]]");
+    test_broadcasting("2. / [[1., 4.]]", "[[2., 0.5]]");
+
+    test_broadcasting("[[1, 2], [3, 4]] - [1, 2]", "[[0, 0], [2, 2]]");
+    test_broadcasting("[1, 2] - [[1, 2], [3, 4]]", "[[0, 0], [-2, -2]]");
+    test_broadcasting("[[2., 4.]] / [[1., 2.], [4., 8.]]",
+        "[[2., 2.], [0.5, 0.5]]");
+
+    test_broadcasting("[[1, 2], [3, 4]] - [[1], [2]]", "[[0, 1], [1, 2]]");
+    test_broadcasting("[[1], [2]] - [[1, 2], [3, 4]]", "[[0, -1], [-1, -2]]");
+
+    // referenced operands are left untouched
+    test_broadcasting(R"(block(
+            define(a, [[1, 2], [3, 4]]),
+            define(b, a - [1, 1]),
+            define(c, 1 - a),
+            list(a, b, c)
+        ))", "list([[1, 2], [3, 4]], [[0, 1], [2, 3]], [[0, -1], [-2, -3]])");
+}
+
+void test_comparisons_and_logicals()
+{
+    test_broadcasting("[[1], [2], [3]] < [2, 3]",
+        "[[true, true], [false, true], [false, false]]");
+    test_broadcasting("[[0], [1]] && [1, 0, 1]",
+        "[[false, false, false], [true, false, true]]");
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+    test_broadcasting("[[[1]], [[2]]] == [1, 2]",
+        "[[[true, false]], [[false, true]]]");
+#endif
+}
+
+void test_where()
+{
+    // the condition is broadcast against both operands
+    test_broadcasting("where([[true], [false]], [1, 2], [[10, 20]])",
+        "[[1, 2], [10, 20]]");
+    test_broadcasting("where([true, false], [[1], [2]], 0)",
+        "[[1, 0], [2, 0]]");
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+    test_broadcasting("where([[[true]], [[false]]], [1, 2], [3, 4])",
+        "[[[1, 2]], [[3, 4]]]");
+#endif
+}
+
+void test_incompatible_shapes()
+{
+    HPX_TEST(test_incompatible("[1, 2, 3] + [1, 2]"));
+    HPX_TEST(test_incompatible("[[1, 2], [3, 4]] * [[1, 2, 3]]"));
+    HPX_TEST(test_incompatible("[[1], [2]] < [[1], [2], [3]]"));
+    HPX_TEST(test_incompatible("where([true, false], [1, 2, 3], 0)"));
+}
+
+int main(int argc, char* argv[])
+{
+    test_shapes();
+    test_arithmetics();
+    test_scalars_rows_and_columns();
+    test_comparisons_and_logicals();
+    test_where();
+    test_incompatible_shapes();
+
+    return hpx::util::report_errors();
+}
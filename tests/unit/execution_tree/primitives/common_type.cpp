@@ -0,0 +1,138 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_promote_common_type()
+{
+    using namespace phylanx::execution_tree;
+
+    HPX_TEST_EQ(promote_common_type(node_data_type_float32,
+        node_data_type_int64), node_data_type_double);
+    HPX_TEST_EQ(promote_common_type(node_data_type_int32,
+        node_data_type_float32), node_data_type_double);
+    HPX_TEST_EQ(promote_common_type(node_data_type_float32,
+        node_data_type_bool), node_data_type_float32);
+    HPX_TEST_EQ(promote_common_type(node_data_type_int32,
+        node_data_type_int64), node_data_type_int64);
+    HPX_TEST_EQ(promote_common_type(node_data_type_int32,
+        node_data_type_bool), node_data_type_int32);
+    HPX_TEST_EQ(promote_common_type(node_data_type_unknown,
+        node_data_type_float32), node_data_type_float32);
+}
+
+void test_extract_common_type()
+{
+    using namespace phylanx::execution_tree;
+
+    primitive_argument_type f{phylanx::ir::node_data<float>(1.0f)};
+    primitive_argument_type i32{phylanx::ir::node_data<std::int32_t>(1)};
+    primitive_argument_type i64{phylanx::ir::node_data<std::int64_t>(1)};
+    primitive_argument_type b{phylanx::ir::node_data<std::uint8_t>(true)};
+
+    HPX_TEST_EQ(extract_common_type(f, b), node_data_type_float32);
+    HPX_TEST_EQ(extract_common_type(f, i32), node_data_type_double);
+    HPX_TEST_EQ(extract_common_type(b, f, i64), node_data_type_double);
+    HPX_TEST_EQ(extract_common_type(i32, i64), node_data_type_int64);
+
+    HPX_TEST_EQ(extract_common_type(primitive_arguments_type{f, b}),
+        node_data_type_float32);
+    HPX_TEST_EQ(extract_common_type(primitive_arguments_type{i32, f}),
+        node_data_type_double);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// scalars don't change the precision of arrays, unless they are of a higher
+// kind (as in NumPy)
+void test_scalar_promotion()
+{
+    using namespace phylanx::execution_tree;
+
+    HPX_TEST_EQ(promote_common_type_scalar(node_data_type_float32,
+        node_data_type_double), node_data_type_float32);
+    HPX_TEST_EQ(promote_common_type_scalar(node_data_type_float32,
+        node_data_type_int64), node_data_type_float32);
+    HPX_TEST_EQ(promote_common_type_scalar(node_data_type_int32,
+        node_data_type_int64), node_data_type_int32);
+    HPX_TEST_EQ(promote_common_type_scalar(node_data_type_int32,
+        node_data_type_float32), node_data_type_double);
+    HPX_TEST_EQ(promote_common_type_scalar(node_data_type_bool,
+        node_data_type_int64), node_data_type_int64);
+    HPX_TEST_EQ(promote_common_type_scalar(node_data_type_unknown,
+        node_data_type_int32), node_data_type_int32);
+
+    primitive_argument_type fv{
+        phylanx::ir::node_data<float>(blaze::DynamicVector<float>{1.f, 2.f})};
+    primitive_argument_type iv{phylanx::ir::node_data<std::int32_t>(
+        blaze::DynamicVector<std::int32_t>{1, 2})};
+    primitive_argument_type d{phylanx::ir::node_data<double>(1.5)};
+    primitive_argument_type i64{phylanx::ir::node_data<std::int64_t>(2)};
+    primitive_argument_type large{
+        phylanx::ir::node_data<std::int64_t>(std::int64_t(1) << 40)};
+
+    HPX_TEST_EQ(extract_common_type(fv, d), node_data_type_float32);
+    HPX_TEST_EQ(extract_common_type(i64, fv), node_data_type_float32);
+    HPX_TEST_EQ(extract_common_type(iv, i64), node_data_type_int32);
+    HPX_TEST_EQ(extract_common_type(iv, d), node_data_type_double);
+    HPX_TEST_EQ(extract_common_type(fv, iv), node_data_type_double);
+
+    // integer values not representable by the array's type widen the result
+    HPX_TEST_EQ(extract_common_type(iv, large), node_data_type_int64);
+
+    HPX_TEST_EQ(extract_common_type(primitive_arguments_type{fv, d, i64}),
+        node_data_type_float32);
+
+    // the elementwise operations keep single precision
+    HPX_TEST(is_float32_operand_strict(compile_and_run(
+        R"(astype([1.0, 2.0], "float32") + 2.5)")));
+    HPX_TEST(is_float32_operand_strict(compile_and_run(
+        R"(3 * astype([1.0, 2.0], "float32"))")));
+    HPX_TEST(is_int32_operand_strict(compile_and_run(
+        R"(astype([1, 2], "int32") - 1)")));
+    HPX_TEST(is_numeric_operand_strict(compile_and_run(
+        R"(astype([1, 2], "int32") * 0.5)")));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the dtype suffixes for the 32 bit types are known to the compiler
+void test_dtype_suffix()
+{
+    auto f = compile_and_run("sum__float32([1, 2, 3])");
+    HPX_TEST(phylanx::execution_tree::is_float32_operand_strict(f));
+
+    auto i = compile_and_run("sum__int32([1, 2, 3])");
+    HPX_TEST(phylanx::execution_tree::is_int32_operand_strict(i));
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(i),
+        std::int64_t(6));
+}
+
+int main(int argc, char* argv[])
+{
+    test_promote_common_type();
+    test_extract_common_type();
+    test_scalar_promotion();
+    test_dtype_suffix();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/serialization/execution_tree.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <blaze/Math.h>
+
+using phylanx::execution_tree::primitive_argument_type;
+
+///////////////////////////////////////////////////////////////////////////////
+primitive_argument_type compile_and_run(std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+phylanx::ir::node_data<float> float32_result(std::string const& codestr)
+{
+    auto result = compile_and_run(codestr);
+    HPX_TEST(phylanx::execution_tree::is_float32_operand_strict(result));
+    return phylanx::execution_tree::extract_float32_value_strict(
+        std::move(result));
+}
+
+phylanx::ir::node_data<std::int32_t> int32_result(std::string const& codestr)
+{
+    auto result = compile_and_run(codestr);
+    HPX_TEST(phylanx::execution_tree::is_int32_operand_strict(result));
+    return phylanx::execution_tree::extract_int32_value_strict(
+        std::move(result));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_arithmetics()
+{
+    HPX_TEST(float32_result(R"(
+            astype([1.0, 2.0], "float32") + astype([0.5, 0.5], "float32")
+        )") == phylanx::ir::node_data<float>(
+            blaze::DynamicVector<float>{1.5f, 2.5f}));
+
+    HPX_TEST(float32_result(R"(
+            astype([1.0, 2.0], "float32") * astype([2.0, 3.0], "float32")
+        )") == phylanx::ir::node_data<float>(
+            blaze::DynamicVector<float>{2.0f, 6.0f}));
+
+    HPX_TEST(int32_result(R"(
+            astype([1, 2], "int32") - astype([3, 1], "int32")
+        )") == phylanx::ir::node_data<std::int32_t>(
+            blaze::DynamicVector<std::int32_t>{-2, 1}));
+
+    HPX_TEST(int32_result(R"(-astype([1, 2], "int32"))") ==
+        phylanx::ir::node_data<std::int32_t>(
+            blaze::DynamicVector<std::int32_t>{-1, -2}));
+}
+
+void test_dot()
+{
+    HPX_TEST(float32_result(R"(dot(
+            astype([[1.0, 2.0], [3.0, 4.0]], "float32"),
+            astype([1.0, 1.0], "float32")
+        ))") == phylanx::ir::node_data<float>(
+            blaze::DynamicVector<float>{3.0f, 7.0f}));
+
+    HPX_TEST(int32_result(R"(dot(
+            astype([1, 2, 3], "int32"), astype([1, 2, 3], "int32")
+        ))") == phylanx::ir::node_data<std::int32_t>(14));
+}
+
+void test_reductions()
+{
+    HPX_TEST(float32_result(R"(sum(astype([1.0, 2.0, 3.0], "float32")))") ==
+        phylanx::ir::node_data<float>(6.0f));
+    HPX_TEST(float32_result(R"(mean(astype([1.0, 2.0, 3.0], "float32")))") ==
+        phylanx::ir::node_data<float>(2.0f));
+
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(
+        compile_and_run(R"(sum(astype([1, 2, 3], "int32")))")),
+        std::int64_t(6));
+}
+
+void test_slicing()
+{
+    HPX_TEST(float32_result(R"(
+            slice(astype([1.0, 2.0, 3.0], "float32"), 1)
+        )") == phylanx::ir::node_data<float>(2.0f));
+
+    HPX_TEST(float32_result(R"(
+            slice(astype([1.0, 2.0, 3.0], "float32"), list(0, 2))
+        )") == phylanx::ir::node_data<float>(
+            blaze::DynamicVector<float>{1.0f, 2.0f}));
+
+    HPX_TEST(int32_result(R"(
+            slice(astype([[1, 2], [3, 4]], "int32"), 1, 0)
+        )") == phylanx::ir::node_data<std::int32_t>(3));
+}
+
+// primitives without native support widen the values
+void test_widening()
+{
+    auto t = compile_and_run(R"(
+            transpose(astype([[1, 2], [3, 4]], "int32"))
+        )");
+    HPX_TEST(phylanx::execution_tree::extract_integer_value(t) ==
+        phylanx::ir::node_data<std::int64_t>(
+            blaze::DynamicMatrix<std::int64_t>{{1, 3}, {2, 4}}));
+
+    auto d = compile_and_run(R"(diag(astype([1.0, 2.0], "float32")))");
+    HPX_TEST(phylanx::execution_tree::extract_numeric_value(d) ==
+        phylanx::ir::node_data<double>(
+            blaze::DynamicMatrix<double>{{1.0, 0.0}, {0.0, 2.0}}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_serialization(primitive_argument_type const& value)
+{
+    primitive_argument_type result;
+
+    std::vector<char> buffer = phylanx::util::serialize(value);
+    phylanx::util::unserialize(buffer, result);
+
+    HPX_TEST_EQ(result.index(), value.index());
+    HPX_TEST(result == value);
+}
+
+void test_serialization()
+{
+    test_serialization(primitive_argument_type{
+        phylanx::ir::node_data<float>(1.5f)});
+    test_serialization(primitive_argument_type{phylanx::ir::node_data<float>(
+        blaze::DynamicMatrix<float>{{1.0f, 2.0f}, {3.0f, 4.0f}})});
+    test_serialization(primitive_argument_type{
+        phylanx::ir::node_data<std::int32_t>(42)});
+    test_serialization(primitive_argument_type{
+        phylanx::ir::node_data<std::int32_t>(
+            blaze::DynamicVector<std::int32_t>{1, -2, 3})});
+}
+
+int main(int argc, char* argv[])
+{
+    test_arithmetics();
+    test_dot();
+    test_reductions();
+    test_slicing();
+    test_widening();
+    test_serialization();
+
+    return hpx::util::report_errors();
+}
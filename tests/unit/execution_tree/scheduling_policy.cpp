@@ -0,0 +1,173 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cost_model()
+{
+    phylanx::execution_tree::cost_model model;
+    HPX_TEST_EQ(model.samples(), std::int64_t(0));
+
+    // t(n) = 1000 + 10 * n
+    for (std::int64_t n = 1; n <= 100; ++n)
+    {
+        model.add_sample(n, 1000 + 10 * n);
+    }
+
+    HPX_TEST_EQ(model.samples(), std::int64_t(100));
+    HPX_TEST(std::abs(model.predict(0) - 1000.0) < 1.0);
+    HPX_TEST(std::abs(model.predict(1000) - 11000.0) < 10.0);
+
+    // all samples with the same size predict the mean
+    model.reset();
+    for (int i = 0; i != 10; ++i)
+    {
+        model.add_sample(42, 500);
+    }
+    HPX_TEST(std::abs(model.predict(4200) - 500.0) < 1.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_estimate_data_size()
+{
+    using phylanx::execution_tree::estimate_data_size;
+    using phylanx::execution_tree::primitive_argument_type;
+
+    HPX_TEST_EQ(estimate_data_size(primitive_argument_type{42.0}),
+        std::int64_t(1));
+    HPX_TEST_EQ(estimate_data_size(primitive_argument_type{
+        blaze::DynamicMatrix<double>(10, 20)}), std::int64_t(200));
+    HPX_TEST_EQ(estimate_data_size(primitive_argument_type{
+        std::string("text")}), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_select_policy()
+{
+    auto policies = phylanx::execution_tree::list_scheduling_policies();
+    for (char const* name : {"hysteresis", "cost_model", "sync", "async"})
+    {
+        HPX_TEST(std::find(policies.begin(), policies.end(), name) !=
+            policies.end());
+    }
+
+    HPX_TEST_EQ(phylanx::execution_tree::get_scheduling_policy_name(),
+        std::string("hysteresis"));
+
+    bool caught_exception = false;
+    try
+    {
+        phylanx::execution_tree::set_scheduling_policy("unknown");
+    }
+    catch (std::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(phylanx::execution_tree::get_scheduling_policy_name(),
+        std::string("hysteresis"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// records the input sizes the policy is asked to make a decision for
+struct recording_policy : phylanx::execution_tree::scheduling_policy
+{
+    phylanx::execution_tree::eval_mode select(
+        phylanx::execution_tree::scheduling_data const& data) const override
+    {
+        input_sizes_.push_back(data.input_size);
+        return phylanx::execution_tree::eval_mode::sync;
+    }
+
+    mutable std::vector<std::int64_t> input_sizes_;
+};
+
+// the input size is estimated from the arguments of the current invocation
+void test_input_size()
+{
+    auto policy = std::make_shared<recording_policy>();
+    phylanx::execution_tree::register_scheduling_policy("recording", policy);
+    phylanx::execution_tree::set_scheduling_policy("recording");
+
+    phylanx::execution_tree::primitive add =
+        phylanx::execution_tree::create_primitive_component(hpx::find_here(),
+            "__add", phylanx::execution_tree::primitive_arguments_type{});
+
+    for (std::size_t size : {10, 1000, 100000})
+    {
+        phylanx::execution_tree::primitive_arguments_type args;
+        args.emplace_back(blaze::DynamicVector<double>(size, 1.0));
+        args.emplace_back(blaze::DynamicVector<double>(size, 2.0));
+
+        policy->input_sizes_.clear();
+        add.eval(std::move(args)).get();
+
+        HPX_TEST(!policy->input_sizes_.empty());
+        HPX_TEST_LTE(std::int64_t(2 * size), policy->input_sizes_.front());
+    }
+
+    phylanx::execution_tree::set_scheduling_policy("hysteresis");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const code = R"(
+    define(fib, n,
+        if(n < 2, n, fib(n - 1) + fib(n - 2))
+    )
+    fib(15)
+)";
+
+void test_run_with_policy(std::string const& name)
+{
+    phylanx::execution_tree::set_scheduling_policy(name);
+    HPX_TEST_EQ(phylanx::execution_tree::get_scheduling_policy_name(), name);
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& fib = phylanx::execution_tree::compile(code, snippets, env);
+
+    // run repeatedly to let the policies adapt
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST_EQ(std::int64_t(610),
+            phylanx::execution_tree::extract_scalar_integer_value(
+                fib.run()));
+    }
+
+    phylanx::execution_tree::set_scheduling_policy("hysteresis");
+}
+
+int main(int argc, char* argv[])
+{
+    test_cost_model();
+    test_estimate_data_size();
+    test_select_policy();
+    test_input_size();
+
+    test_run_with_policy("hysteresis");
+    test_run_with_policy("cost_model");
+    test_run_with_policy("sync");
+    test_run_with_policy("async");
+
+    return hpx::util::report_errors();
+}
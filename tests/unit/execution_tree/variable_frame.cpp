@@ -0,0 +1,137 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using phylanx::execution_tree::eval_context;
+using phylanx::execution_tree::extract_scalar_integer_value;
+using phylanx::execution_tree::primitive_argument_type;
+using phylanx::execution_tree::variable_slot;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_slot_lookup()
+{
+    eval_context ctx;
+    phylanx::util::hashed_string x("x");
+    phylanx::util::hashed_string y("y");
+
+    variable_slot define_x, define_y;
+    ctx.set_var(x, primitive_argument_type{std::int64_t(1)}, define_x);
+    ctx.set_var(y, primitive_argument_type{std::int64_t(2)}, define_y);
+
+    std::size_t depth = 0, index = 0;
+    HPX_TEST(define_y.get(depth, index));
+    HPX_TEST_EQ(depth, std::size_t(0));
+    HPX_TEST_EQ(index, std::size_t(1));
+
+    // the location is cached after the first lookup
+    eval_context inner = add_frame(eval_context(ctx));
+
+    variable_slot access_x;
+    HPX_TEST(!access_x.get(depth, index));
+
+    for (int i = 0; i != 2; ++i)
+    {
+        auto* var = inner.get_var(x, access_x);
+        HPX_TEST(var != nullptr);
+        HPX_TEST_EQ(extract_scalar_integer_value(*var), std::int64_t(1));
+
+        HPX_TEST(access_x.get(depth, index));
+        HPX_TEST_EQ(depth, std::size_t(1));
+        HPX_TEST_EQ(index, std::size_t(0));
+    }
+
+    // a variable of the same name defined in an inner frame shadows the
+    // cached location
+    inner.set_var(x, primitive_argument_type{std::int64_t(3)});
+
+    auto* var = inner.get_var(x, access_x);
+    HPX_TEST(var != nullptr);
+    HPX_TEST_EQ(extract_scalar_integer_value(*var), std::int64_t(3));
+
+    HPX_TEST(access_x.get(depth, index));
+    HPX_TEST_EQ(depth, std::size_t(0));
+
+    // unknown variables are not found
+    HPX_TEST(inner.get_var(phylanx::util::hashed_string("z"), access_x) ==
+        nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// defining more variables in a frame does not move the existing ones
+void test_stable_references()
+{
+    eval_context ctx;
+    phylanx::util::hashed_string x("x");
+
+    variable_slot define_x;
+    primitive_argument_type& ref =
+        ctx.set_var(x, primitive_argument_type{std::int64_t(42)}, define_x);
+    primitive_argument_type* ptr = ctx.get_var(x);
+    HPX_TEST(ptr == &ref);
+
+    for (std::int64_t i = 0; i != 100; ++i)
+    {
+        ctx.set_var(
+            phylanx::util::hashed_string("v" + std::to_string(i)),
+            primitive_argument_type{i});
+    }
+
+    HPX_TEST(ctx.get_var(x) == ptr);
+    HPX_TEST(ctx.get_var(x, define_x) == ptr);
+    HPX_TEST_EQ(extract_scalar_integer_value(ref), std::int64_t(42));
+
+    // redefining a variable reuses its location
+    ctx.set_var(x, primitive_argument_type{std::int64_t(43)});
+    HPX_TEST(ctx.get_var(x) == ptr);
+    HPX_TEST_EQ(extract_scalar_integer_value(*ptr), std::int64_t(43));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t compile_and_run(std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return extract_scalar_integer_value(code.run());
+}
+
+void test_loop_variables()
+{
+    HPX_TEST_EQ(compile_and_run(R"(block(
+        define(z, 0),
+        for_each(lambda(i, store(z, z + i)), range(10)),
+        z
+    ))"), std::int64_t(45));
+
+    // variables defined in the loop body are recreated in each iteration
+    HPX_TEST_EQ(compile_and_run(R"(block(
+        define(z, 0),
+        define(f, x, x + z),
+        for_each(
+            lambda(i, block(define(t, f(i)), store(z, t))),
+            range(5)
+        ),
+        z
+    ))"), std::int64_t(0 + 1 + 2 + 3 + 4));
+}
+
+int main(int argc, char* argv[])
+{
+    test_slot_lookup();
+    test_stable_references();
+    test_loop_variables();
+
+    return hpx::util::report_errors();
+}
@@ -217,11 +217,26 @@ void test_cumsum_3d()
 }
 #endif
 
+// arrays large enough to be scanned in parallel
+void test_cumsum_large()
+{
+    test_cumsum(R"(cumsum(constant(1, 100000, "int")))",
+        R"(arange(1, 100001, 1, __arg(dtype, "int")))");
+    test_cumsum(R"(cumsum(constant(1, list(400, 300), "int")))",
+        R"(arange(1, 120001, 1, __arg(dtype, "int")))");
+
+    test_cumsum(R"(sum(cumsum(constant(1, list(400, 300), "int"), 0)))",
+        "24060000");
+    test_cumsum(R"(sum(cumsum(constant(1, list(400, 300), "int"), 1)))",
+        "18060000");
+}
+
 int main(int argc, char* argv[])
 {
     test_cumsum_0d();
     test_cumsum_1d();
     test_cumsum_2d();
+    test_cumsum_large();
 
 #if defined(PHYLANX_HAVE_BLAZE_TENSOR)
     test_cumsum_3d();
@@ -0,0 +1,173 @@
+//   Copyright (c) 2019 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+void test_elementwise_operation(std::string const& code,
+    std::string const& expected_str)
+{
+    HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_explicit_program()
+{
+    // a * b + c
+    test_elementwise_operation(
+        R"(__elementwise("$0 $1 * $2 +", 2.0, 3.0, 4.0))", "10.0");
+    test_elementwise_operation(
+        R"(__elementwise("$0 $1 * $2 +", [1, 2, 3], 2, [4, 5, 6]))",
+        "[6, 9, 12]");
+
+    // -(a - b) / c
+    test_elementwise_operation(
+        R"(__elementwise("$0 $1 - neg $2 /", [8.0, 4.0], 2.0, [2.0, 4.0]))",
+        "[-3.0, -0.5]");
+
+    // (a + b) * c with broadcasting of a vector to a matrix
+    test_elementwise_operation(
+        R"(__elementwise("$0 $1 + $2 *",
+            [[1.0, 2.0], [3.0, 4.0]], [1.0, 2.0], 2.0))",
+        "[[4.0, 8.0], [8.0, 12.0]]");
+
+    // sqrt(a) * exp(b)
+    test_elementwise_operation(
+        R"(__elementwise("$0 sqrt $1 exp *", [4.0, 9.0], 0.0))",
+        "[2.0, 3.0]");
+
+    // a * b < c
+    test_elementwise_operation(
+        R"(__elementwise("$0 $1 * $2 <", [1, 2, 3], 2, 5))",
+        "[true, true, false]");
+}
+
+void test_fused_expressions()
+{
+    // the compiler fuses these expressions as phylanx.fuse_elementwise=1
+    test_elementwise_operation(
+        "1.0 + 2.0 * 3.0 - 4.0 / 2.0",
+        "__sub(__add(1.0, __mul(2.0, 3.0)), __div(4.0, 2.0))");
+    test_elementwise_operation(
+        "10 - 4 - 3",
+        "__sub(__sub(10, 4), 3)");
+    test_elementwise_operation(
+        "-[1.0, 2.0, 3.0] * ([4.0, 5.0, 6.0] - 1.0)",
+        "__mul(__minus([1.0, 2.0, 3.0]), __sub([4.0, 5.0, 6.0], 1.0))");
+    test_elementwise_operation(
+        "[[1, 2], [3, 4]] * [[5, 6], [7, 8]] + [1, 2] - 3",
+        "__sub(__add(__mul([[1, 2], [3, 4]], [[5, 6], [7, 8]]), [1, 2]), 3)");
+    test_elementwise_operation(
+        "[1, 2, 3] * 2.5 + [1.0, 1.0, 1.0]",
+        "__add(__mul([1, 2, 3], 2.5), [1.0, 1.0, 1.0])");
+
+    // integer divisions are not turned into floating point divisions
+    test_elementwise_operation(
+        "[7, 8] / 2 + 0.5",
+        "__add(__div([7, 8], 2), 0.5)");
+
+    // a final comparison is fused as well
+    test_elementwise_operation(
+        "(1.0 + 2.0 * 3.0) < 2.0 * 4.0 - 1.0",
+        "__lt(__add(1.0, __mul(2.0, 3.0)), __sub(__mul(2.0, 4.0), 1.0))");
+    test_elementwise_operation(
+        "[[1.0, 2.0], [3.0, 4.0]] * 2.0 + 1.0 >= [4.0, 8.0]",
+        "__ge(__add(__mul([[1.0, 2.0], [3.0, 4.0]], 2.0), 1.0), [4.0, 8.0])");
+
+    // as are elementwise functions
+    test_elementwise_operation(
+        "absolute([-1.0, 2.0]) * square([3.0, -2.0]) - log([1.0, 1.0])",
+        "__sub(__mul(absolute([-1.0, 2.0]), square([3.0, -2.0])), "
+            "log([1.0, 1.0]))");
+    test_elementwise_operation(
+        "exp(sin([0.0, 0.0]) + tanh(0.0)) * cos(0.0) + sqrt([16.0, 25.0])",
+        "__add(__mul(exp(__add(sin([0.0, 0.0]), tanh(0.0))), cos(0.0)), "
+            "sqrt([16.0, 25.0]))");
+
+    // non-fusable operations are evaluated separately
+    test_elementwise_operation(
+        "([1, 2] < [2, 1]) * 3 + 1",
+        "__add(__mul(__lt([1, 2], [2, 1]), 3), 1)");
+    test_elementwise_operation(
+        "[1.0, 2.0] < 2.0 == [true, false]",
+        "__eq(__lt([1.0, 2.0], 2.0), [true, false])");
+}
+
+void test_large_arrays()
+{
+    // large arrays are processed concurrently (the threshold is set to 1000)
+    test_elementwise_operation(
+        "arange(0, 100000) * 3 - 7",
+        "__sub(__mul(arange(0, 100000), 3), 7)");
+    test_elementwise_operation(
+        "arange(0, 100000) * 2 + 1 > 1000",
+        "__gt(__add(__mul(arange(0, 100000), 2), 1), 1000)");
+    test_elementwise_operation(
+        "constant(1.5, list(500, 300)) * 2.0 - constant(1.0, list(300)) * 3.0",
+        "__sub(__mul(constant(1.5, list(500, 300)), 2.0), "
+            "__mul(constant(1.0, list(300)), 3.0))");
+    test_elementwise_operation(
+        "constant(1.5, list(10, 20000)) * 2.0 - 1.0",
+        "__sub(__mul(constant(1.5, list(10, 20000)), 2.0), 1.0)");
+}
+
+void test_fallback()
+{
+    // values not handled by the fused kernel are evaluated one by one
+    test_elementwise_operation(
+        "true + false * true - true",
+        "__sub(__add(true, __mul(false, true)), true)");
+    test_elementwise_operation(
+        "list(1, 2) + 3 + list(4) + 5",
+        "list(1, 2, 3, 4, 5)");
+
+    // the same primitive is evaluated repeatedly, with and without fusion
+    test_elementwise_operation(R"(
+            define(f, a, b, __elementwise("$0 absolute $1 <", a, b))
+            list(f(astype([-1, 4], "int32"), 2), f(-1.0, 3.0),
+                f(astype([4, -1], "int32"), 2))
+        )",
+        "list([true, false], true, [false, true])");
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    test_explicit_program();
+    test_fused_expressions();
+    test_large_arrays();
+    test_fallback();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "phylanx.fuse_elementwise=1",
+        "phylanx.elementwise.threshold=1000"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -83,5 +83,25 @@ int main(int argc, char* argv[])
         "nonzero([[0., 1.], [2., 0.]])",
         "list([0, 1], [1, 0])");
 
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+    // test 3d data (tensor)
+    test_nonzero_operation(
+        "nonzero([[[0, 1], [2, 0]], [[0, 0], [0, 3]]])",
+        "list([0, 0, 1], [0, 1, 1], [1, 0, 1])");
+#endif
+
+    // large arrays are scanned in parallel
+    test_nonzero_operation(
+        "nonzero(arange(0, 100000) > 49999)",
+        R"(list(arange(50000, 100000, 1, __arg(dtype, "int"))))");
+    test_nonzero_operation(
+        R"(nonzero(constant(1, 100000, "int")))",
+        R"(list(arange(0, 100000, 1, __arg(dtype, "int"))))");
+
+    test_nonzero_operation(
+        R"(define(indices, nonzero(constant(1., list(400, 300))))
+           list(sum(slice(indices, 0)), sum(slice(indices, 1))))",
+        "list(23940000, 17940000)");
+
     return hpx::util::report_errors();
 }
@@ -0,0 +1,107 @@
+//   Copyright (c) 2019 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+void test_where_compare_operation(std::string const& code,
+    std::string const& expected_str)
+{
+    HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_explicit_comparison()
+{
+    test_where_compare_operation(
+        R"(__where_compare("__lt", [1, 5, 3], [4, 2, 3], [1, 2, 3], 0))",
+        "[1, 0, 0]");
+    test_where_compare_operation(
+        R"(__where_compare("__le", [1, 5, 3], [4, 2, 3], [1, 2, 3], 0))",
+        "[1, 0, 3]");
+    test_where_compare_operation(
+        R"(__where_compare("__gt", [1., 5., 3.], 2, 1., -1.))",
+        "[-1., 1., 1.]");
+    test_where_compare_operation(
+        R"(__where_compare("__ge", [1., 5., 3.], 3, 1, -1))",
+        "[-1, 1, 1]");
+    test_where_compare_operation(
+        R"(__where_compare("__eq", 2, 2, 42, 43))", "42");
+    test_where_compare_operation(
+        R"(__where_compare("__ne", [[1, 2], [3, 4]], [1, 0], true, false))",
+        "[[false, true], [true, true]]");
+}
+
+void test_fused_where()
+{
+    // the compiler fuses these expressions as phylanx.fuse_elementwise=1
+    test_where_compare_operation(
+        "where([1, 5, 3] < [4, 2, 3], [10, 20, 30], [-1, -2, -3])",
+        "where(__lt([1, 5, 3], [4, 2, 3]), [10, 20, 30], [-1, -2, -3])");
+    test_where_compare_operation(
+        "where([[1.0], [2.0]] >= [1.5, 2.5], [[1.0, 2.0]], 0.0)",
+        "where(__ge([[1.0], [2.0]], [1.5, 2.5]), [[1.0, 2.0]], 0.0)");
+    test_where_compare_operation(
+        "where(([1, 2] + 1) == 2, true, false)",
+        "where(__eq(__add([1, 2], 1), 2), true, false)");
+
+    // large arrays
+    test_where_compare_operation(
+        "sum(where(arange(0, 100000) < 50000, 1, 0))", "50000");
+
+#if defined(PHYLANX_HAVE_BLAZE_TENSOR)
+    test_where_compare_operation(
+        "where([[[1]], [[2]]] != [1, 2], [3, 4], 0)",
+        "[[[0, 4]], [[3, 0]]]");
+#endif
+}
+
+void test_fallback()
+{
+    // arguments not handled by the fused kernel are compared by the
+    // comparison primitives
+    test_where_compare_operation(
+        "where([true, false] == [true, true], 1, 2)", "[1, 2]");
+    test_where_compare_operation(
+        R"(where("abc" == "abc", 1, 2))", "1");
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    test_explicit_comparison();
+    test_fused_where();
+    test_fallback();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> cfg = {
+        "phylanx.fuse_elementwise=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
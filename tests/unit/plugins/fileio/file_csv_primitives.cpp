@@ -10,7 +10,9 @@
 #include <hpx/util/lightweight_test.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <fstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -91,6 +93,100 @@ void test_file_io(phylanx::ir::node_data<double> const& in)
     test_file_io_primitive(in);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+void test_file_read_csv_options()
+{
+    std::string filename = std::tmpnam(nullptr);
+    {
+        std::ofstream out(filename);
+        out << "a;b;c\r\n"
+               "1;2;3\r\n"
+               "\r\n"
+               "4; 5 ;6\r\n"
+               "7;8;9\r\n";
+    }
+
+    std::string const fname = "\"" + filename + "\"";
+
+    // header line is skipped, blank lines are ignored
+    HPX_TEST_EQ(compile_and_run("file_read_csv(" + fname +
+                    ", __arg(delimiter, \";\"))"),
+        compile_and_run("[[1.0, 2.0, 3.0], [4.0, 5.0, 6.0], [7.0, 8.0, 9.0]]"));
+
+    // column selection, negative indices count from the end
+    HPX_TEST_EQ(compile_and_run("file_read_csv(" + fname +
+                    ", __arg(columns, list(-1, 0)), __arg(delimiter, \";\"))"),
+        compile_and_run("[[3.0, 1.0], [6.0, 4.0], [9.0, 7.0]]"));
+
+    HPX_TEST_EQ(compile_and_run("file_read_csv(" + fname +
+                    ", __arg(columns, 1), __arg(delimiter, \";\"))"),
+        compile_and_run("[[2.0], [5.0], [8.0]]"));
+
+    // row ranges
+    HPX_TEST_EQ(compile_and_run("file_read_csv(" + fname +
+                    ", __arg(delimiter, \";\"), __arg(rows, list(1, 3)))"),
+        compile_and_run("[[4.0, 5.0, 6.0], [7.0, 8.0, 9.0]]"));
+
+    HPX_TEST_EQ(compile_and_run("file_read_csv(" + fname +
+                    ", __arg(delimiter, \";\"), __arg(rows, list(1, 2)))"),
+        compile_and_run("[4.0, 5.0, 6.0]"));
+
+    HPX_TEST_EQ(compile_and_run("file_read_csv(" + fname +
+                    ", 2, nil, \";\", list(2, 3))"),
+        compile_and_run("9.0"));
+
+    // element type
+    auto result = compile_and_run("file_read_csv(" + fname +
+        ", __arg(dtype, \"int\"), __arg(delimiter, \";\"))");
+    HPX_TEST(phylanx::execution_tree::extract_integer_value_strict(result) ==
+        phylanx::ir::node_data<std::int64_t>(blaze::DynamicMatrix<std::int64_t>{
+            {1, 2, 3}, {4, 5, 6}, {7, 8, 9}}));
+
+    std::remove(filename.c_str());
+}
+
+void test_file_read_csv_sparse()
+{
+    std::string filename = std::tmpnam(nullptr);
+    {
+        std::ofstream out(filename);
+        out << "1,0,0,2\n"
+               "0,0,0,0\n"
+               "0,3,0,4\n";
+    }
+
+    std::string const fname = "\"" + filename + "\"";
+
+    auto result = compile_and_run(
+        "file_read_csv(" + fname + ", __arg(sparse, true))");
+    HPX_TEST(phylanx::execution_tree::is_sparse_operand(result));
+    HPX_TEST_EQ(
+        compile_and_run("todense(file_read_csv(" + fname +
+            ", __arg(sparse, true)))"),
+        compile_and_run("[[1.0, 0.0, 0.0, 2.0], [0.0, 0.0, 0.0, 0.0], "
+            "[0.0, 3.0, 0.0, 4.0]]"));
+
+    // column and row selection
+    HPX_TEST_EQ(
+        compile_and_run("todense(file_read_csv(" + fname +
+            ", __arg(columns, list(3, 1)), __arg(rows, list(1, 3)), "
+            "__arg(sparse, true)))"),
+        compile_and_run("[[0.0, 0.0], [4.0, 3.0]]"));
+
+    std::remove(filename.c_str());
+}
+
 int main(int argc, char* argv[])
 {
     blaze::Rand<blaze::DynamicVector<double>> gen{};
@@ -109,5 +205,8 @@ int main(int argc, char* argv[])
     blaze::DynamicMatrix<double> m = gen2.generate(101UL, 101UL);
     test_file_io(phylanx::ir::node_data<double>(std::move(m)));
 
+    test_file_read_csv_options();
+    test_file_read_csv_sparse();
+
     return hpx::util::report_errors();
 }
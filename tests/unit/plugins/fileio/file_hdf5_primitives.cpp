@@ -10,6 +10,9 @@
 #include <hpx/util/lightweight_test.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <utility>
@@ -93,6 +96,147 @@ void test_file_io(phylanx::ir::node_data<double> const& in)
     test_file_io_primitive(in);
 }
 
+void test_file_read_hyperslab(blaze::DynamicMatrix<double> const& m)
+{
+    std::string filename = std::tmpnam(nullptr);
+    std::string dataset_name("dataset");
+
+    // write to file
+    {
+        phylanx::execution_tree::primitive outfile =
+            phylanx::execution_tree::primitives::create_file_write_hdf5(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{filename,
+                    dataset_name, phylanx::ir::node_data<double>{m}});
+
+        auto f = outfile.eval();
+        f.get();
+    }
+
+    // read rows [10, 20), every third column
+    {
+        phylanx::execution_tree::primitive infile =
+            phylanx::execution_tree::primitives::create_file_read_hdf5(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{filename,
+                    dataset_name,
+                    phylanx::ir::range(
+                        phylanx::execution_tree::primitive_arguments_type{
+                            std::int64_t(10), std::int64_t(20)}),
+                    phylanx::ir::range(
+                        phylanx::execution_tree::primitive_arguments_type{
+                            std::int64_t(0), std::int64_t(-1),
+                            std::int64_t(3)})});
+
+        blaze::DynamicMatrix<double> expected(10, (m.columns() + 1) / 3);
+        for (std::size_t i = 0; i != expected.rows(); ++i)
+        {
+            for (std::size_t j = 0; j != expected.columns(); ++j)
+            {
+                expected(i, j) = m(i + 10, 3 * j);
+            }
+        }
+
+        HPX_TEST(phylanx::ir::node_data<double>{std::move(expected)} ==
+            phylanx::execution_tree::extract_numeric_value(
+                infile.eval().get()));
+    }
+
+    // read the dataset in blocks of 16 rows
+    {
+        phylanx::execution_tree::primitive infile =
+            phylanx::execution_tree::primitives::create_file_read_hdf5_blocks(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{
+                    filename, dataset_name, std::int64_t(16)});
+
+        auto blocks = phylanx::execution_tree::extract_list_value(
+            infile.eval().get());
+        HPX_TEST_EQ(blocks.size(), (m.rows() + 15) / 16);
+
+        std::size_t row = 0;
+        for (auto const& block : blocks)
+        {
+            auto data = phylanx::execution_tree::extract_numeric_value(
+                phylanx::execution_tree::value_operand_sync(block,
+                    phylanx::execution_tree::primitive_arguments_type{}));
+
+            std::size_t rows = (std::min)(std::size_t(16), m.rows() - row);
+            HPX_TEST(data ==
+                phylanx::ir::node_data<double>{blaze::DynamicMatrix<double>{
+                    blaze::submatrix(m, row, 0, rows, m.columns())}});
+            row += rows;
+        }
+        HPX_TEST_EQ(row, m.rows());
+    }
+
+    std::remove(filename.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets);
+    return code.run();
+}
+
+// the blocks are read while being consumed by fold_left and for_each
+void test_file_read_blocks_lazily(blaze::DynamicMatrix<double> const& m)
+{
+    std::string filename = std::tmpnam(nullptr);
+
+    {
+        phylanx::execution_tree::primitive outfile =
+            phylanx::execution_tree::primitives::create_file_write_hdf5(
+                hpx::find_here(),
+                phylanx::execution_tree::primitive_arguments_type{filename,
+                    std::string("dataset"), phylanx::ir::node_data<double>{m}});
+        outfile.eval().get();
+    }
+
+    double const expected = blaze::sum(m);
+
+    std::string const fold_code = R"(
+        fold_left(
+            lambda(total, b, total + sum(b)),
+            0.0,
+            file_read_hdf5_blocks(")" + filename + R"(", "dataset", 16)
+        )
+    )";
+    double const folded = phylanx::execution_tree::extract_scalar_numeric_value(
+        compile_and_run(fold_code));
+    HPX_TEST_LT(std::abs(folded - expected), 1e-10 * std::abs(expected));
+
+    std::string const for_each_code = R"(
+        block(
+            define(total, 0.0),
+            define(rows, 0),
+            for_each(
+                lambda(b, block(
+                    store(total, total + sum(b)),
+                    store(rows, rows + shape(b, 0))
+                )),
+                file_read_hdf5_blocks(")" + filename + R"(", "dataset", 7)
+            ),
+            make_list(total, rows)
+        )
+    )";
+    auto result = phylanx::execution_tree::extract_list_value(
+        compile_and_run(for_each_code));
+    HPX_TEST_EQ(result.size(), std::size_t(2));
+
+    auto it = result.begin();
+    double const total =
+        phylanx::execution_tree::extract_scalar_numeric_value(*it);
+    HPX_TEST_LT(std::abs(total - expected), 1e-10 * std::abs(expected));
+    HPX_TEST_EQ(phylanx::execution_tree::extract_scalar_integer_value(*++it),
+        std::int64_t(m.rows()));
+
+    std::remove(filename.c_str());
+}
+
 int main(int argc, char* argv[])
 {
     test_file_io(phylanx::ir::node_data<double>(42.0));
@@ -108,7 +252,10 @@ int main(int argc, char* argv[])
     blaze::Rand<blaze::DynamicMatrix<double>> gen2{};
 
     blaze::DynamicMatrix<double> m = gen2.generate(101UL, 102UL);
-    test_file_io(phylanx::ir::node_data<double>(std::move(m)));
+    test_file_io(phylanx::ir::node_data<double>(m));
+
+    test_file_read_hyperslab(m);
+    test_file_read_blocks_lazily(m);
 
     return hpx::util::report_errors();
 }
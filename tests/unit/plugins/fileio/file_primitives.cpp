@@ -5,13 +5,16 @@
 
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/util/serialization/execution_tree.hpp>
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <fstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -98,6 +101,98 @@ void test_file_io(phylanx::ir::node_data<double> const& in)
     test_file_io_primitive(in);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type write_and_read(
+    std::string const& filename,
+    phylanx::execution_tree::primitive_argument_type const& in)
+{
+    phylanx::execution_tree::primitive outfile =
+        phylanx::execution_tree::primitives::create_file_write(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{{filename}, in});
+    outfile.eval().get();
+
+    phylanx::execution_tree::primitive infile =
+        phylanx::execution_tree::primitives::create_file_read(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{{filename}});
+    return infile.eval().get();
+}
+
+// arrays are stored in the native array format and mapped when read back
+void test_array_file()
+{
+    using phylanx::execution_tree::primitive_argument_type;
+
+    std::string filename = std::tmpnam(nullptr);
+
+    blaze::Rand<blaze::DynamicMatrix<double>> gen{};
+    phylanx::ir::node_data<double> m(gen.generate(64UL, 64UL));
+
+    auto result = phylanx::execution_tree::extract_numeric_value(
+        write_and_read(filename, primitive_argument_type{m}));
+    HPX_TEST(m == result);
+    HPX_TEST(result.is_ref());
+
+    // overwriting the file must not change the data read before
+    phylanx::ir::node_data<double> m2(gen.generate(64UL, 64UL));
+    auto result2 = phylanx::execution_tree::extract_numeric_value(
+        write_and_read(filename, primitive_argument_type{m2}));
+    HPX_TEST(m2 == result2);
+    HPX_TEST(m == result);
+
+    // copies keep the mapping alive after the arrays they were made from
+    // went away
+    phylanx::ir::node_data<double> copy;
+    {
+        auto result3 = phylanx::execution_tree::extract_numeric_value(
+            write_and_read(filename, primitive_argument_type{m}));
+        HPX_TEST(result3.is_ref());
+        copy = result3;
+    }
+    write_and_read(filename, primitive_argument_type{m2});
+    HPX_TEST(m == copy);
+
+    // other element types
+    blaze::DynamicVector<std::int64_t> iv{1, 2, 3, 4, 5, 6, 7};
+    phylanx::ir::node_data<std::int64_t> i(iv);
+    HPX_TEST(i ==
+        phylanx::execution_tree::extract_integer_value(write_and_read(
+            filename, primitive_argument_type{i})));
+
+    blaze::DynamicMatrix<std::uint8_t> bm{{1, 0, 1}, {0, 1, 0}};
+    phylanx::ir::node_data<std::uint8_t> b(bm);
+    HPX_TEST(b ==
+        phylanx::execution_tree::extract_boolean_value(write_and_read(
+            filename, primitive_argument_type{b})));
+
+    std::remove(filename.c_str());
+}
+
+// files holding serialized data written by older versions are still read
+void test_serialized_file()
+{
+    std::string filename = std::tmpnam(nullptr);
+
+    phylanx::ir::node_data<double> in(blaze::DynamicVector<double>{1.0, 2.0});
+    {
+        std::vector<char> data = phylanx::util::serialize(
+            phylanx::execution_tree::primitive_argument_type{in});
+        std::ofstream outfile(filename.c_str(), std::ios::binary);
+        outfile.write(data.data(), data.size());
+    }
+
+    phylanx::execution_tree::primitive infile =
+        phylanx::execution_tree::primitives::create_file_read(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{{filename}});
+
+    HPX_TEST(in ==
+        phylanx::execution_tree::extract_numeric_value(infile.eval().get()));
+
+    std::remove(filename.c_str());
+}
+
 int main(int argc, char* argv[])
 {
     blaze::Rand<blaze::DynamicVector<double>> gen{};
@@ -116,6 +211,9 @@ int main(int argc, char* argv[])
     blaze::DynamicMatrix<double> m = gen2.generate(101UL, 101UL);
     test_file_io(phylanx::ir::node_data<double>(std::move(m)));
 
+    test_array_file();
+    test_serialized_file();
+
     return hpx::util::report_errors();
 }
 
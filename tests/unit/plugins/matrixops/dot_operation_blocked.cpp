@@ -0,0 +1,110 @@
+//   Copyright (c) 2019 Hartmut Kaiser
+//
+//   Distributed under the Boost Software License, Version 1.0. (See accompanying
+//   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test is run with small tiles and thresholds (see CMakeLists.txt) to
+// exercise the tiled implementation of matrix products.
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/blocked_gemm.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Use small integral values only, this makes the results independent of the
+// order of the summation.
+template <typename T>
+blaze::DynamicMatrix<T> generate_matrix(std::size_t rows, std::size_t columns)
+{
+    blaze::Rand<blaze::DynamicMatrix<std::int64_t>> gen{};
+    return blaze::DynamicMatrix<T>(gen.generate(rows, columns, -10, 10));
+}
+
+template <typename T>
+blaze::DynamicVector<T> generate_vector(std::size_t size)
+{
+    blaze::Rand<blaze::DynamicVector<std::int64_t>> gen{};
+    return blaze::DynamicVector<T>(gen.generate(size, -10, 10));
+}
+
+template <typename T>
+phylanx::execution_tree::primitive_argument_type dot(
+    phylanx::ir::node_data<T>&& lhs, phylanx::ir::node_data<T>&& rhs)
+{
+    phylanx::execution_tree::primitive dot =
+        phylanx::execution_tree::primitives::create_dot_operation(
+            hpx::find_here(),
+            phylanx::execution_tree::primitive_arguments_type{
+                std::move(lhs), std::move(rhs)});
+
+    return dot.eval().get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_blocked_gemm(
+    std::size_t rows, std::size_t inner, std::size_t columns)
+{
+    blaze::DynamicMatrix<T> m1 = generate_matrix<T>(rows, inner);
+    blaze::DynamicMatrix<T> m2 = generate_matrix<T>(inner, columns);
+
+    HPX_TEST(phylanx::util::use_blocked_gemm(m1, m2));
+
+    blaze::DynamicMatrix<T> expected = m1 * m2;
+    HPX_TEST_EQ(phylanx::util::blocked_gemm<T>(m1, m2), expected);
+
+    HPX_TEST_EQ(phylanx::ir::node_data<T>(std::move(expected)),
+        phylanx::execution_tree::extract_node_data<T>(
+            dot(phylanx::ir::node_data<T>(std::move(m1)),
+                phylanx::ir::node_data<T>(std::move(m2)))));
+}
+
+template <typename T>
+void test_blocked_gemv(std::size_t rows, std::size_t columns)
+{
+    blaze::DynamicMatrix<T> m = generate_matrix<T>(rows, columns);
+    blaze::DynamicVector<T> v1 = generate_vector<T>(columns);
+    blaze::DynamicVector<T> v2 = generate_vector<T>(rows);
+
+    HPX_TEST(phylanx::util::use_blocked_gemv(m, v1));
+
+    // matrix * vector
+    blaze::DynamicVector<T> expected1 = m * v1;
+    HPX_TEST_EQ(phylanx::util::blocked_gemv<T>(m, v1), expected1);
+
+    HPX_TEST_EQ(phylanx::ir::node_data<T>(std::move(expected1)),
+        phylanx::execution_tree::extract_node_data<T>(
+            dot(phylanx::ir::node_data<T>(m),
+                phylanx::ir::node_data<T>(std::move(v1)))));
+
+    // vector * matrix
+    blaze::DynamicVector<T> expected2 =
+        blaze::trans(blaze::trans(v2) * m);
+
+    HPX_TEST_EQ(phylanx::ir::node_data<T>(std::move(expected2)),
+        phylanx::execution_tree::extract_node_data<T>(
+            dot(phylanx::ir::node_data<T>(std::move(v2)),
+                phylanx::ir::node_data<T>(std::move(m)))));
+}
+
+int main(int argc, char* argv[])
+{
+    // sizes that are not multiples of the tile sizes
+    test_blocked_gemm<double>(37, 29, 41);
+    test_blocked_gemm<std::int64_t>(37, 29, 41);
+    test_blocked_gemm<double>(64, 64, 64);
+
+    test_blocked_gemv<double>(53, 27);
+    test_blocked_gemv<std::int64_t>(53, 27);
+
+    return hpx::util::report_errors();
+}
@@ -4,6 +4,8 @@
 //   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <phylanx/phylanx.hpp>
+#include <phylanx/util/philox.hpp>
+#include <phylanx/util/random.hpp>
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/util/lightweight_test.hpp>
@@ -21,13 +23,39 @@
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
-phylanx::execution_tree::compiler::function compile(std::string const& codestr)
+// find the name of the random primitive in the given expression topology
+std::string find_random_primitive(
+    phylanx::execution_tree::topology const& topology)
+{
+    if (topology.name_.find("/phylanx/random$") == 0)
+    {
+        return topology.name_;
+    }
+    for (auto const& child : topology.children_)
+    {
+        std::string name = find_random_primitive(child);
+        if (!name.empty())
+        {
+            return name;
+        }
+    }
+    return std::string();
+}
+
+phylanx::execution_tree::compiler::function compile(
+    std::string const& codestr, std::string* random_name = nullptr)
 {
     phylanx::execution_tree::compiler::function_list snippets;
     phylanx::execution_tree::compiler::environment env =
         phylanx::execution_tree::compiler::default_environment();
 
     auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    if (random_name != nullptr)
+    {
+        *random_name = find_random_primitive(
+            snippets.program_.get_expression_topology());
+        HPX_TEST(!random_name->empty());
+    }
     return code.run();
 }
 
@@ -56,6 +84,29 @@ void set_seed(std::uint32_t seed)
 
     call(static_cast<std::int64_t>(seed));
 }
+
+// Every evaluation of a random primitive draws its numbers from a new
+// stream of the counter-based generator, this mirrors the sequence of
+// streams used by the primitive with the given name after set_seed
+struct random_streams
+{
+    random_streams(std::uint32_t seed, std::string const& name)
+      : seed_(seed)
+      , identity_(phylanx::util::random_stream_identity(name))
+      , count_(0)
+    {}
+
+    phylanx::util::philox4x32 next_stream()
+    {
+        return phylanx::util::philox4x32(
+            phylanx::util::random_stream_key(seed_, identity_, count_++));
+    }
+
+    std::uint32_t seed_;
+    std::uint64_t identity_;
+    std::uint64_t count_;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // generate single random double value
 template <typename T, typename Gen, typename Dist>
@@ -67,9 +118,10 @@ void generate_0d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto eng = gen.next_stream();
 
     HPX_TEST_EQ(
-        static_cast<T>(dist(gen)),
+        static_cast<T>(dist(eng)),
         static_cast<T>(
             phylanx::execution_tree::extract_node_data<T>(result)[0]));
 }
@@ -85,11 +137,12 @@ void generate_1d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto eng = gen.next_stream();
 
     blaze::DynamicVector<T> v(32);
     for (auto& val : v)
     {
-        val = dist(gen);
+        val = dist(eng);
     }
 
     HPX_TEST_EQ(phylanx::ir::node_data<T>(std::move(v)),
@@ -107,13 +160,14 @@ void generate_2d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto eng = gen.next_stream();
 
     blaze::DynamicMatrix<T> m(32, 16);
     for (std::size_t row = 0; row != blaze::rows(m); ++row)
     {
         for (auto& val : blaze::row(m, row))
         {
-            val = dist(gen);
+            val = dist(eng);
         }
     }
 
@@ -134,6 +188,7 @@ void generate_3d(phylanx::execution_tree::compiler::function const& call,
     };
 
     auto result = call(dims);
+    auto eng = gen.next_stream();
 
     blaze::DynamicTensor<T> t(3, 32, 16);
     for (std::size_t page = 0; page != blaze::pages(t); ++page)
@@ -142,7 +197,7 @@ void generate_3d(phylanx::execution_tree::compiler::function const& call,
         {
             for (auto& val : blaze::row(blaze::pageslice(t, page), row))
             {
-                val = dist(gen);
+                val = dist(eng);
             }
         }
     }
@@ -153,14 +208,16 @@ void generate_3d(phylanx::execution_tree::compiler::function const& call,
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_normal_distribution_implicit(std::mt19937& gen)
+void test_normal_distribution_implicit(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size)),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::normal_distribution<double> dist;
@@ -182,14 +239,16 @@ void test_normal_distribution_implicit(std::mt19937& gen)
 #endif
 }
 
-void test_uniform_distribution_explicit(std::mt19937& gen)
+void test_uniform_distribution_explicit(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "uniform")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::uniform_real_distribution<double> dist;
@@ -211,14 +270,16 @@ void test_uniform_distribution_explicit(std::mt19937& gen)
 #endif
 }
 
-void test_uniform_distribution_explicit_params(std::mt19937& gen)
+void test_uniform_distribution_explicit_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("uniform", 2.0, 4.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::uniform_real_distribution<double> dist{2.0, 4.0};
@@ -241,14 +302,16 @@ void test_uniform_distribution_explicit_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_uniform_int_distribution_explicit(std::mt19937& gen)
+void test_uniform_int_distribution_explicit(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "uniform_int")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::uniform_int_distribution<std::int64_t> dist;
@@ -270,14 +333,16 @@ void test_uniform_int_distribution_explicit(std::mt19937& gen)
 #endif
 }
 
-void test_uniform_int_distribution_explicit_params(std::mt19937& gen)
+void test_uniform_int_distribution_explicit_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("uniform_int", 200, 400))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::uniform_int_distribution<std::int64_t> dist{200, 400};
@@ -300,14 +365,16 @@ void test_uniform_int_distribution_explicit_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_bernoulli_distribution(std::mt19937& gen)
+void test_bernoulli_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "bernoulli")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::bernoulli_distribution dist;
@@ -329,14 +396,16 @@ void test_bernoulli_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_bernoulli_distribution_params(std::mt19937& gen)
+void test_bernoulli_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("bernoulli", 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::bernoulli_distribution dist{0.8};
@@ -359,14 +428,16 @@ void test_bernoulli_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_binomial_distribution(std::mt19937& gen)
+void test_binomial_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("binomial", 1.0, 0.5))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::binomial_distribution<int> dist;
@@ -388,14 +459,16 @@ void test_binomial_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_binomial_distribution_params(std::mt19937& gen)
+void test_binomial_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("binomial", 10, 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::binomial_distribution<int> dist{10, 0.8};
@@ -418,14 +491,16 @@ void test_binomial_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_negative_binomial_distribution(std::mt19937& gen)
+void test_negative_binomial_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("negative_binomial", 1.0, 0.5))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::negative_binomial_distribution<int> dist;
@@ -447,14 +522,16 @@ void test_negative_binomial_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_negative_binomial_distribution_params(std::mt19937& gen)
+void test_negative_binomial_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("negative_binomial", 10, 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::negative_binomial_distribution<int> dist{10, 0.8};
@@ -477,14 +554,16 @@ void test_negative_binomial_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_geometric_distribution(std::mt19937& gen)
+void test_geometric_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("geometric", 0.5))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::geometric_distribution<int> dist;
@@ -506,14 +585,16 @@ void test_geometric_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_geometric_distribution_params(std::mt19937& gen)
+void test_geometric_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("geometric", 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::geometric_distribution<int> dist{0.8};
@@ -536,14 +617,16 @@ void test_geometric_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_poisson_distribution(std::mt19937& gen)
+void test_poisson_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("poisson", 1.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::poisson_distribution<int> dist;
@@ -565,14 +648,16 @@ void test_poisson_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_poisson_distribution_params(std::mt19937& gen)
+void test_poisson_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("poisson", 4))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::poisson_distribution<int> dist{4};
@@ -595,14 +680,16 @@ void test_poisson_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_exponential_distribution(std::mt19937& gen)
+void test_exponential_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("exponential", 1.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::exponential_distribution<double> dist;
@@ -624,14 +711,16 @@ void test_exponential_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_exponential_distribution_params(std::mt19937& gen)
+void test_exponential_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("exponential", 2.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::exponential_distribution<double> dist{2.0};
@@ -654,14 +743,16 @@ void test_exponential_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_gamma_distribution(std::mt19937& gen)
+void test_gamma_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("gamma", 1.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::gamma_distribution<double> dist;
@@ -683,14 +774,16 @@ void test_gamma_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_gamma_distribution_params(std::mt19937& gen)
+void test_gamma_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("gamma", 0.8, 1.2))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::gamma_distribution<double> dist{0.8, 1.2};
@@ -713,14 +806,16 @@ void test_gamma_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_weibull_distribution(std::mt19937& gen)
+void test_weibull_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("weibull", 1.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::weibull_distribution<double> dist;
@@ -742,14 +837,16 @@ void test_weibull_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_weibull_distribution_params(std::mt19937& gen)
+void test_weibull_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("weibull", 0.8, 1.2))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::weibull_distribution<double> dist{0.8, 1.2};
@@ -772,14 +869,16 @@ void test_weibull_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_extreme_value_distribution(std::mt19937& gen)
+void test_extreme_value_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "extreme_value")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::extreme_value_distribution<double> dist;
@@ -801,14 +900,16 @@ void test_extreme_value_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_extreme_value_distribution_params(std::mt19937& gen)
+void test_extreme_value_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("extreme_value", 0.8, 1.2))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::extreme_value_distribution<double> dist{0.8, 1.2};
@@ -831,14 +932,16 @@ void test_extreme_value_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_normal_distribution(std::mt19937& gen)
+void test_normal_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "normal")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::normal_distribution<double> dist;
@@ -860,14 +963,16 @@ void test_normal_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_normal_distribution_params(std::mt19937& gen)
+void test_normal_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("normal", 0.8, 1.2))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::normal_distribution<double> dist{0.8, 1.2};
@@ -890,14 +995,16 @@ void test_normal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_truncated_normal_distribution(std::mt19937& gen)
+void test_truncated_normal_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "truncated_normal")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         phylanx::util::truncated_normal_distribution<double> dist;
@@ -919,7 +1026,7 @@ void test_truncated_normal_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_truncated_normal_distribution_params(std::mt19937& gen)
+void test_truncated_normal_distribution_params(std::uint32_t seed)
 {
     using namespace phylanx::execution_tree::primitives;
 
@@ -930,7 +1037,9 @@ void test_truncated_normal_distribution_params(std::mt19937& gen)
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         phylanx::util::truncated_normal_distribution<double> dist{0.8, 1.2};
@@ -953,14 +1062,16 @@ void test_truncated_normal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_lognormal_distribution(std::mt19937& gen)
+void test_lognormal_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "lognormal")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::lognormal_distribution<double> dist;
@@ -982,14 +1093,16 @@ void test_lognormal_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_lognormal_distribution_params(std::mt19937& gen)
+void test_lognormal_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("lognormal", 0.8, 1.2))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::lognormal_distribution<double> dist{0.8, 1.2};
@@ -1012,14 +1125,16 @@ void test_lognormal_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_chi_squared_distribution(std::mt19937& gen)
+void test_chi_squared_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("chi_squared", 1.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::chi_squared_distribution<double> dist;
@@ -1041,14 +1156,16 @@ void test_chi_squared_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_chi_squared_distribution_params(std::mt19937& gen)
+void test_chi_squared_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("chi_squared", 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::chi_squared_distribution<double> dist{0.8};
@@ -1071,14 +1188,16 @@ void test_chi_squared_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_cauchy_distribution(std::mt19937& gen)
+void test_cauchy_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, "cauchy")),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::cauchy_distribution<double> dist;
@@ -1100,14 +1219,16 @@ void test_cauchy_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_cauchy_distribution_params(std::mt19937& gen)
+void test_cauchy_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("cauchy", 0.6, 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::cauchy_distribution<double> dist{0.6, 0.8};
@@ -1130,14 +1251,16 @@ void test_cauchy_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_fisher_f_distribution(std::mt19937& gen)
+void test_fisher_f_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("fisher_f", 1.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::fisher_f_distribution<double> dist;
@@ -1159,14 +1282,16 @@ void test_fisher_f_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_fisher_f_distribution_params(std::mt19937& gen)
+void test_fisher_f_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("fisher_f", 0.6, 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::fisher_f_distribution<double> dist{0.6, 0.8};
@@ -1189,14 +1314,16 @@ void test_fisher_f_distribution_params(std::mt19937& gen)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void test_student_t_distribution(std::mt19937& gen)
+void test_student_t_distribution(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("student_t", 1.0))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::student_t_distribution<double> dist;
@@ -1218,14 +1345,16 @@ void test_student_t_distribution(std::mt19937& gen)
 #endif
 }
 
-void test_student_t_distribution_params(std::mt19937& gen)
+void test_student_t_distribution_params(std::uint32_t seed)
 {
     std::string const code = R"(block(
             define(call, size, random(size, list("student_t", 0.8))),
             call
         ))";
 
-    auto call = compile(code);
+    std::string name;
+    auto call = compile(code, &name);
+    random_streams gen(seed, name);
 
     {
         std::student_t_distribution<double> dist{0.8};
@@ -1247,6 +1376,38 @@ void test_student_t_distribution_params(std::mt19937& gen)
 #endif
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The numbers generated by a primitive depend on the seed and the number of
+// its preceding evaluations only, not on the evaluation of other primitives
+void test_evaluation_order(std::uint32_t seed)
+{
+    auto normal = compile(R"(block(
+            define(call, size, random(size)),
+            call
+        ))");
+    auto uniform = compile(R"(block(
+            define(call_uniform, size, random(size, "uniform")),
+            call_uniform
+        ))");
+
+    phylanx::execution_tree::primitive_arguments_type dims = {
+        phylanx::execution_tree::primitive_argument_type{std::int64_t{32}},
+        phylanx::execution_tree::primitive_argument_type{std::int64_t{0}}
+    };
+
+    set_seed(seed);
+    auto normal1 = normal(dims);
+    auto uniform1 = uniform(dims);
+    auto normal2 = normal(dims);
+
+    set_seed(seed);
+    HPX_TEST_EQ(uniform(dims), uniform1);
+    HPX_TEST_EQ(normal(dims), normal1);
+    HPX_TEST_EQ(normal(dims), normal2);
+
+    HPX_TEST_NEQ(normal1, normal2);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
@@ -1255,63 +1416,63 @@ int main(int argc, char* argv[])
     set_seed(seed);
     HPX_TEST_EQ(get_seed(), seed);
 
-    std::mt19937 gen(seed);
+    test_normal_distribution_implicit(seed);
 
-    test_normal_distribution_implicit(gen);
+    test_uniform_distribution_explicit(seed);
+    test_uniform_distribution_explicit_params(seed);
 
-    test_uniform_distribution_explicit(gen);
-    test_uniform_distribution_explicit_params(gen);
+    test_uniform_int_distribution_explicit(seed);
+    test_uniform_int_distribution_explicit_params(seed);
 
-    test_uniform_int_distribution_explicit(gen);
-    test_uniform_int_distribution_explicit_params(gen);
+    test_bernoulli_distribution(seed);
+    test_bernoulli_distribution_params(seed);
 
-    test_bernoulli_distribution(gen);
-    test_bernoulli_distribution_params(gen);
+    test_binomial_distribution(seed);
+    test_binomial_distribution_params(seed);
 
-    test_binomial_distribution(gen);
-    test_binomial_distribution_params(gen);
+    test_negative_binomial_distribution(seed);
+    test_negative_binomial_distribution_params(seed);
 
-    test_negative_binomial_distribution(gen);
-    test_negative_binomial_distribution_params(gen);
+    test_geometric_distribution(seed);
+    test_geometric_distribution_params(seed);
 
-    test_geometric_distribution(gen);
-    test_geometric_distribution_params(gen);
+    test_poisson_distribution(seed);
+    test_poisson_distribution_params(seed);
 
-    test_poisson_distribution(gen);
-    test_poisson_distribution_params(gen);
+    test_exponential_distribution(seed);
+    test_exponential_distribution_params(seed);
 
-    test_exponential_distribution(gen);
-    test_exponential_distribution_params(gen);
+    test_gamma_distribution(seed);
+    test_gamma_distribution_params(seed);
 
-    test_gamma_distribution(gen);
-    test_gamma_distribution_params(gen);
+    test_weibull_distribution(seed);
+    test_weibull_distribution_params(seed);
 
-    test_weibull_distribution(gen);
-    test_weibull_distribution_params(gen);
+    test_extreme_value_distribution(seed);
+    test_extreme_value_distribution_params(seed);
 
-    test_extreme_value_distribution(gen);
-    test_extreme_value_distribution_params(gen);
+    test_normal_distribution(seed);
+    test_normal_distribution_params(seed);
 
-    test_normal_distribution(gen);
-    test_normal_distribution_params(gen);
+    test_truncated_normal_distribution(seed);
+    test_truncated_normal_distribution_params(seed);
 
-    test_truncated_normal_distribution(gen);
-    test_truncated_normal_distribution_params(gen);
+    test_lognormal_distribution(seed);
+    test_lognormal_distribution_params(seed);
 
-    test_lognormal_distribution(gen);
-    test_lognormal_distribution_params(gen);
+    test_chi_squared_distribution(seed);
+    test_chi_squared_distribution_params(seed);
 
-    test_chi_squared_distribution(gen);
-    test_chi_squared_distribution_params(gen);
+    test_cauchy_distribution(seed);
+    test_cauchy_distribution_params(seed);
 
-    test_cauchy_distribution(gen);
-    test_cauchy_distribution_params(gen);
+    test_fisher_f_distribution(seed);
+    test_fisher_f_distribution_params(seed);
 
-    test_fisher_f_distribution(gen);
-    test_fisher_f_distribution_params(gen);
+    test_student_t_distribution(seed);
+    test_student_t_distribution_params(seed);
 
-    test_student_t_distribution(gen);
-    test_student_t_distribution_params(gen);
+    test_evaluation_order(seed);
 
     return hpx::util::report_errors();
 }
@@ -0,0 +1,153 @@
+// Copyright (c) 2019 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+void test_sparse_operation(std::string const& code,
+    std::string const& expected_str)
+{
+    HPX_TEST_EQ(compile_and_run(code), compile_and_run(expected_str));
+}
+
+void test_is_sparse(std::string const& code, bool expected)
+{
+    HPX_TEST_EQ(
+        phylanx::execution_tree::is_sparse_operand(compile_and_run(code)),
+        expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // conversion
+    test_is_sparse("sparse([1.0, 0.0, 0.0, 2.0])", true);
+    test_is_sparse("sparse([[1.0, 0.0], [0.0, 2.0]])", true);
+    test_is_sparse("todense(sparse([1.0, 0.0, 0.0, 2.0]))", false);
+    test_is_sparse("[1.0, 0.0, 0.0, 2.0]", false);
+
+    test_sparse_operation("issparse(sparse([[1.0, 0.0], [0.0, 2.0]]))", "true");
+    test_sparse_operation("issparse([[1.0, 0.0], [0.0, 2.0]])", "false");
+
+    test_sparse_operation(
+        "todense(sparse([1.0, 0.0, 0.0, 2.0]))", "[1.0, 0.0, 0.0, 2.0]");
+    test_sparse_operation("todense(sparse([[1.0, 0.0], [0.0, 2.0]]))",
+        "[[1.0, 0.0], [0.0, 2.0]]");
+    test_sparse_operation("todense([1.0, 2.0])", "[1.0, 2.0]");
+
+    // element-wise arithmetics keep sparse results where possible
+    test_is_sparse(
+        "sparse([1.0, 0.0, 2.0]) + sparse([0.0, 0.0, 3.0])", true);
+    test_sparse_operation(
+        "todense(sparse([1.0, 0.0, 2.0]) + sparse([0.0, 0.0, 3.0]))",
+        "[1.0, 0.0, 5.0]");
+    test_sparse_operation(
+        "todense(sparse([[1.0, 0.0], [0.0, 2.0]]) - "
+            "sparse([[0.0, 1.0], [0.0, 2.0]]))",
+        "[[1.0, -1.0], [0.0, 0.0]]");
+    test_is_sparse("sparse([[1.0, 0.0], [0.0, 2.0]]) * 2.0", true);
+    test_sparse_operation(
+        "todense(2.0 * sparse([[1.0, 0.0], [0.0, 2.0]]))",
+        "[[2.0, 0.0], [0.0, 4.0]]");
+    test_sparse_operation(
+        "todense(sparse([[1.0, 0.0], [0.0, 2.0]]) * [[3.0, 3.0], [3.0, 3.0]])",
+        "[[3.0, 0.0], [0.0, 6.0]]");
+    test_sparse_operation(
+        "todense(sparse([1.0, 0.0, 4.0]) / 2.0)", "[0.5, 0.0, 2.0]");
+
+    // mixed operations fall back to dense results
+    test_sparse_operation(
+        "sparse([1.0, 0.0, 2.0]) + [1.0, 1.0, 1.0]", "[2.0, 1.0, 3.0]");
+
+    // dot products
+    test_sparse_operation(
+        "dot(sparse([1.0, 0.0, 2.0]), [1.0, 2.0, 3.0])", "7.0");
+    test_sparse_operation(
+        "todense(dot(sparse([[1.0, 0.0], [0.0, 2.0]]), [1.0, 2.0]))",
+        "[1.0, 4.0]");
+    test_sparse_operation(
+        "todense(dot(sparse([[1.0, 0.0], [0.0, 2.0]]), "
+            "sparse([[0.0, 1.0], [3.0, 0.0]])))",
+        "[[0.0, 1.0], [6.0, 0.0]]");
+
+    // transpose
+    test_sparse_operation(
+        "todense(transpose(sparse([[1.0, 0.0], [3.0, 2.0]])))",
+        "[[1.0, 3.0], [0.0, 2.0]]");
+
+    // reductions over the non-zero elements
+    test_sparse_operation("sum(sparse([[1.0, 0.0], [3.0, 2.0]]))", "6.0");
+    test_sparse_operation("sum(sparse([1.0, 0.0, 3.0]), 0, true)", "[4.0]");
+    test_sparse_operation(
+        "sum(sparse([[1.0, 0.0, 4.0], [3.0, 0.0, 2.0]]), 0)",
+        "[4.0, 0.0, 6.0]");
+    test_sparse_operation(
+        "sum(sparse([[1.0, 0.0, 4.0], [3.0, 0.0, 2.0]]), -1, true)",
+        "[[5.0], [5.0]]");
+    test_sparse_operation(
+        "sum(sparse([[1.0, 0.0], [3.0, 2.0]]), nil, false, 1.0)", "7.0");
+    test_sparse_operation("mean(sparse([[1.0, 0.0], [3.0, 2.0]]))", "1.5");
+    test_sparse_operation(
+        "mean(sparse([[1.0, 0.0, 4.0], [3.0, 0.0, 2.0]]), 0)",
+        "[2.0, 0.0, 3.0]");
+    test_sparse_operation(
+        "mean(sparse([[1.0, 0.0, 5.0], [3.0, 0.0, 0.0]]), 1)", "[2.0, 1.0]");
+
+    // other reductions are performed on dense data
+    test_sparse_operation("amax(sparse([[-1.0, 0.0], [-3.0, -2.0]]))", "0.0");
+
+    // slicing consecutive elements keeps the data compressed
+    test_is_sparse("slice(sparse([1.0, 0.0, 3.0, 2.0]), list(1, 3))", true);
+    test_sparse_operation(
+        "todense(slice(sparse([1.0, 0.0, 3.0, 2.0]), list(1, 3)))",
+        "[0.0, 3.0]");
+    test_sparse_operation("slice(sparse([1.0, 0.0, 3.0, 2.0]), -2)", "3.0");
+    test_is_sparse("slice(sparse([[1.0, 0.0], [3.0, 2.0]]), 1)", true);
+    test_sparse_operation(
+        "todense(slice(sparse([[1.0, 0.0], [3.0, 2.0]]), 1))", "[3.0, 2.0]");
+    test_sparse_operation(
+        "slice(sparse([[1.0, 0.0], [3.0, 2.0]]), 1, 0)", "3.0");
+    test_sparse_operation(
+        "todense(slice(sparse([[1.0, 0.0, 4.0], [3.0, 0.0, 2.0]]), "
+            "list(0, 2), list(1, 3)))",
+        "[[0.0, 4.0], [0.0, 2.0]]");
+    test_sparse_operation(
+        "todense(slice(sparse([[1.0, 0.0, 4.0], [3.0, 0.0, 2.0]]), "
+            "nil, 2))",
+        "[4.0, 2.0]");
+
+    // everything else is sliced from dense data
+    test_sparse_operation(
+        "slice(sparse([1.0, 0.0, 3.0, 2.0]), list(0, 4, 2))", "[1.0, 3.0]");
+
+    // variables referring to compressed data share it until it is modified
+    test_sparse_operation(
+        R"(block(
+            define(a, sparse([1.0, 0.0, 2.0])),
+            define(b, a),
+            store(b, b * 2.0),
+            todense(a)
+        ))",
+        "[1.0, 0.0, 2.0]");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,161 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The reductions in this test are large enough for the statistics primitives
+// to split them into chunks (see the test parameters in CMakeLists.txt).
+
+#include <phylanx/phylanx.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run();
+}
+
+blaze::DynamicMatrix<double> generate_matrix(
+    std::size_t rows, std::size_t columns)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+
+    blaze::DynamicMatrix<double> m(rows, columns);
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        for (std::size_t j = 0; j != columns; ++j)
+        {
+            m(i, j) = dist(gen);
+        }
+    }
+    return m;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Vector>
+double expected_var(Vector const& v)
+{
+    double mean = 0.0;
+    for (auto it = v.begin(); it != v.end(); ++it)
+    {
+        mean += *it;
+    }
+    mean /= v.size();
+
+    double var = 0.0;
+    for (auto it = v.begin(); it != v.end(); ++it)
+    {
+        var += (*it - mean) * (*it - mean);
+    }
+    return var / v.size();
+}
+
+bool is_close(double lhs, double rhs)
+{
+    return std::abs(lhs - rhs) <= 1e-8 * (std::max)(1.0, std::abs(rhs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_flat_reductions()
+{
+    blaze::DynamicMatrix<double> m = generate_matrix(1000, 77);
+    blaze::DynamicVector<double> v(m.rows() * m.columns());
+    for (std::size_t i = 0; i != m.rows(); ++i)
+    {
+        for (std::size_t j = 0; j != m.columns(); ++j)
+        {
+            v[i * m.columns() + j] = m(i, j);
+        }
+    }
+
+    auto sum = compile_and_run("define(f, x, sum(x))\nf");
+    auto mean = compile_and_run("define(f, x, mean(x))\nf");
+    auto var = compile_and_run("define(f, x, var(x))\nf");
+    auto stddev = compile_and_run("define(f, x, std(x))\nf");
+    auto max = compile_and_run("define(f, x, amax(x))\nf");
+
+    using phylanx::execution_tree::extract_scalar_numeric_value;
+
+    double const expected_sum = blaze::sum(v);
+    double const expected_variance = expected_var(v);
+
+    HPX_TEST(is_close(extract_scalar_numeric_value(sum(v)), expected_sum));
+    HPX_TEST(is_close(extract_scalar_numeric_value(sum(m)), expected_sum));
+    HPX_TEST(is_close(
+        extract_scalar_numeric_value(mean(v)), expected_sum / v.size()));
+    HPX_TEST(is_close(
+        extract_scalar_numeric_value(mean(m)), expected_sum / v.size()));
+    HPX_TEST(
+        is_close(extract_scalar_numeric_value(var(v)), expected_variance));
+    HPX_TEST(
+        is_close(extract_scalar_numeric_value(var(m)), expected_variance));
+    HPX_TEST(is_close(extract_scalar_numeric_value(stddev(m)),
+        std::sqrt(expected_variance)));
+    HPX_TEST_EQ(extract_scalar_numeric_value(max(v)), blaze::max(v));
+    HPX_TEST_EQ(extract_scalar_numeric_value(max(m)), blaze::max(m));
+}
+
+void test_axis_reductions()
+{
+    // the number of columns is not a multiple of the tile size
+    blaze::DynamicMatrix<double> m = generate_matrix(517, 301);
+
+    auto sum0 = compile_and_run("define(f, x, sum(x, 0))\nf");
+    auto sum1 = compile_and_run("define(f, x, sum(x, 1))\nf");
+    auto var0 = compile_and_run("define(f, x, var(x, 0))\nf");
+    auto var1 = compile_and_run("define(f, x, var(x, 1))\nf");
+    auto max0 = compile_and_run("define(f, x, amax(x, 0))\nf");
+
+    using phylanx::execution_tree::extract_numeric_value;
+
+    blaze::DynamicVector<double> s0 = extract_numeric_value(sum0(m)).vector();
+    blaze::DynamicVector<double> v0 = extract_numeric_value(var0(m)).vector();
+    blaze::DynamicVector<double> m0 = extract_numeric_value(max0(m)).vector();
+    HPX_TEST_EQ(s0.size(), m.columns());
+    HPX_TEST_EQ(v0.size(), m.columns());
+    HPX_TEST_EQ(m0.size(), m.columns());
+    for (std::size_t j = 0; j != m.columns(); ++j)
+    {
+        auto col = blaze::column(m, j);
+        HPX_TEST(is_close(s0[j], blaze::sum(col)));
+        HPX_TEST(is_close(v0[j], expected_var(col)));
+        HPX_TEST_EQ(m0[j], blaze::max(col));
+    }
+
+    blaze::DynamicVector<double> s1 = extract_numeric_value(sum1(m)).vector();
+    blaze::DynamicVector<double> v1 = extract_numeric_value(var1(m)).vector();
+    HPX_TEST_EQ(s1.size(), m.rows());
+    HPX_TEST_EQ(v1.size(), m.rows());
+    for (std::size_t i = 0; i != m.rows(); ++i)
+    {
+        auto row = blaze::row(m, i);
+        HPX_TEST(is_close(s1[i], blaze::sum(row)));
+        HPX_TEST(is_close(v1[i], expected_var(row)));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    test_flat_reductions();
+    test_axis_reductions();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,54 @@
+# Copyright (c) 2019 Hartmut Kaiser
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+import asyncio
+import numpy as np
+from phylanx import Phylanx
+
+
+@Phylanx
+def scale(m, factor):
+    return m * factor
+
+
+@Phylanx
+def fail(m):
+    return np.dot(m, np.array([1, 2]))
+
+
+m = np.arange(6.0).reshape(2, 3)
+
+# the result is available through the future
+f = scale.async_call(m, 2.0)
+assert (f.result() == m * 2.0).all()
+assert f.done()
+
+# several invocations can be in flight at the same time, the arguments may
+# be released before the evaluation has finished
+futures = [scale.async_call(np.full((100, 100), i), 3.0) for i in range(10)]
+for i, f in enumerate(futures):
+    assert (f.result() == np.full((100, 100), i * 3.0)).all()
+
+# errors are reported through the future
+f = fail.async_call(m)
+try:
+    f.result()
+    assert False
+except Exception:
+    pass
+assert f.exception() is not None
+
+# the futures can be awaited in coroutines
+async def run():
+    a = scale.async_call(m, 2.0)
+    b = scale.async_call(m, 3.0)
+    return (await a) + (await b)
+
+
+loop = asyncio.get_event_loop()
+assert (loop.run_until_complete(run()) == m * 5.0).all()
+
+# the lazily bound function can be invoked asynchronously as well
+assert (scale.lazy(m, 4.0).async_eval().result() == m * 4.0).all()
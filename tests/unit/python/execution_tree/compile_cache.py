@@ -0,0 +1,44 @@
+#  Copyright (c) 2019 Hartmut Kaiser
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# The compilation cache statistics and controls are exposed to Python
+
+import phylanx
+from phylanx import PhylanxSession
+
+PhylanxSession.init(1)
+
+et = phylanx.execution_tree
+cs = et.compiler_state(__name__)
+
+et.set_compile_cache_directory("")
+et.clear_compile_cache()
+
+code = "block(define(answer, x, x * 6), answer)"
+
+before = et.get_compile_cache_statistics()
+assert et.eval(cs, code, 7) == 42
+
+after = et.get_compile_cache_statistics()
+assert after.misses == before.misses + 1
+assert after.size >= 1
+
+assert et.eval(cs, code, 7) == 42
+assert et.get_compile_cache_statistics().memory_hits == after.memory_hits + 1
+
+# clearing the cache forces the code to be compiled again
+et.clear_compile_cache()
+assert et.get_compile_cache_statistics().size == 0
+
+before = et.get_compile_cache_statistics()
+assert et.eval(cs, code, 7) == 42
+assert et.get_compile_cache_statistics().misses == before.misses + 1
+
+# the number of cached snippets is bounded
+et.set_compile_cache_capacity(1)
+et.eval(cs, "block(define(twice, x, x * 2), twice)", 1)
+stats = et.get_compile_cache_statistics()
+assert stats.size == 1
+assert stats.evictions >= 1
@@ -0,0 +1,49 @@
+#  Copyright (c) 2019 Hartmut Kaiser
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# float32 and int32 arrays keep their element type when passed to and
+# returned from Phylanx functions
+
+import numpy as np
+
+import phylanx
+from phylanx import Phylanx
+
+
+@Phylanx
+def add(x, y):
+    return x + y
+
+
+@Phylanx
+def scale(x):
+    return x * 2
+
+
+@Phylanx
+def transpose(x):
+    return np.transpose(x)
+
+
+for dtype in [np.float32, np.int32]:
+    a = np.arange(6, dtype=dtype).reshape((2, 3))
+    b = np.ones((2, 3), dtype=dtype)
+
+    r = add(a, b)
+    assert r.dtype == dtype
+    assert np.array_equal(r, a + b)
+
+    # scalars don't change the element type of arrays
+    r = scale(a)
+    assert r.dtype == dtype
+    assert np.array_equal(r, a * 2)
+
+    # primitives without native support for the type widen the values
+    assert np.array_equal(transpose(a), np.transpose(a))
+
+# float32 combined with int32 arrays results in float64 (as in NumPy)
+r = add(np.ones(3, dtype=np.float32), np.ones(3, dtype=np.int32))
+assert r.dtype == np.float64
+assert np.array_equal(r, np.full(3, 2.0))
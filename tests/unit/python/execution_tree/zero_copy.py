@@ -0,0 +1,81 @@
+#  Copyright (c) 2019 Hartmut Kaiser
+#
+#  Distributed under the Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Arrays passed as arguments are referenced in place (if requested and
+# possible); make sure results never alias the arguments and that stored
+# values are copied.
+
+import numpy as np
+
+import phylanx
+from phylanx import Phylanx, execution_tree
+
+
+@Phylanx
+def identity(x):
+    return x
+
+
+@Phylanx
+def add(x, y):
+    return x + y
+
+
+for shape in [(64,), (64, 64), (7,), (7, 5)]:
+    a = np.random.rand(*shape)
+    b = np.random.rand(*shape)
+
+    assert np.allclose(add(a, b), a + b)
+
+    # the result must not reference the argument
+    r = identity(a)
+    assert np.array_equal(r, a)
+    r[...] = 0.0
+    assert not np.array_equal(r, a)
+
+    # int64 and bool arrays
+    i = np.arange(np.prod(shape), dtype=np.int64).reshape(shape)
+    assert np.array_equal(add(i, i), i + i)
+
+    m = i % 2 == 0
+    assert np.array_equal(identity(m), m)
+
+# variables hold a copy of the array they were created from
+a = np.ones((64, 64))
+v = execution_tree.variable(a)
+a[...] = 2.0
+assert np.array_equal(v.eval(), np.ones((64, 64)))
+
+
+def aligned_zeros(size, alignment=64):
+    buf = np.zeros(size + alignment // 8)
+    offset = (-buf.ctypes.data % alignment) // 8
+    return buf[offset:offset + size]
+
+
+# arguments are copied by default, modifying them inside a function is not
+# visible to the caller
+@Phylanx
+def set_first(x):
+    x[0] = 42.0
+    return x[0]
+
+
+for a in [aligned_zeros(64), np.zeros(65), np.zeros(7)]:
+    assert set_first(a) == 42.0
+    assert a[0] == 0.0
+
+
+# sharing the arguments has to be requested explicitly, arrays are then
+# referenced in place if their layout is compatible with Blaze
+@Phylanx(share_arguments=True)
+def set_first_shared(x):
+    x[0] = 42.0
+    return x[0]
+
+
+a = aligned_zeros(64)
+assert set_first_shared(a) == 42.0
+assert a[0] == 42.0
@@ -0,0 +1,94 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/future_or_value.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_dataflow_values()
+{
+    phylanx::util::future_or_value<int> lhs(41);
+    phylanx::util::future_or_value<int> rhs(1);
+
+    HPX_TEST(lhs.has_value_only());
+
+    auto result = phylanx::util::dataflow_or_value(
+        [](int a, int b) { return a + b; }, std::move(lhs), std::move(rhs));
+
+    // no shared state is created if all arguments are values
+    HPX_TEST(result.has_value_only());
+    HPX_TEST_EQ(result.get(), 42);
+}
+
+void test_dataflow_futures()
+{
+    phylanx::util::future_or_value<int> lhs(hpx::async([]() { return 41; }));
+    phylanx::util::future_or_value<int> rhs(1);
+
+    auto result = phylanx::util::dataflow_or_value(
+        [](int a, int b) { return a + b; }, std::move(lhs), std::move(rhs));
+
+    HPX_TEST_EQ(result.get_future().get(), 42);
+}
+
+void test_dataflow_exception()
+{
+    phylanx::util::future_or_value<int> arg(1);
+
+    auto result = phylanx::util::dataflow_or_value(
+        [](int) -> int { throw std::runtime_error("error"); }, std::move(arg));
+
+    HPX_TEST(result.has_exception());
+
+    bool caught_exception = false;
+    try
+    {
+        result.get();
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_value_operand_fov()
+{
+    using namespace phylanx::execution_tree;
+
+    // literal values are returned without creating a future
+    auto value = value_operand_fov(
+        primitive_argument_type{std::int64_t(42)}, primitive_arguments_type{});
+
+    HPX_TEST(value.has_value_only());
+    HPX_TEST_EQ(extract_scalar_integer_value(value.get()), std::int64_t(42));
+
+    compiler::function_list snippets;
+    compiler::environment env = compiler::default_environment();
+
+    auto const& code = compile("41 + 1", snippets, env);
+    HPX_TEST_EQ(extract_scalar_integer_value(code.run()), std::int64_t(42));
+}
+
+int main(int argc, char* argv[])
+{
+    test_dataflow_values();
+    test_dataflow_futures();
+    test_dataflow_exception();
+
+    test_value_operand_fov();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,143 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/parallel_scan.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::int64_t> expected_scan(
+    std::vector<std::int64_t> const& values, std::int64_t init)
+{
+    std::vector<std::int64_t> result(values.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        init += values[i];
+        result[i] = init;
+    }
+    return result;
+}
+
+void test_inclusive_scan(std::size_t size)
+{
+    std::mt19937_64 gen(size);
+
+    std::vector<std::int64_t> values(size);
+    for (auto& v : values)
+    {
+        v = std::int64_t(gen() % 1000) - 500;
+    }
+
+    std::vector<std::int64_t> expected = expected_scan(values, 42);
+
+    std::vector<std::int64_t> result(size);
+    auto last = phylanx::util::parallel_inclusive_scan(values.begin(),
+        values.end(), result.begin(), std::int64_t(42), std::plus<>{});
+    HPX_TEST(last == result.end());
+    HPX_TEST(result == expected);
+
+    // in place
+    phylanx::util::parallel_inclusive_scan(values.data(),
+        values.data() + size, values.data(), std::int64_t(42),
+        std::plus<>{});
+    HPX_TEST(values == expected);
+}
+
+void test_inclusive_scan()
+{
+    for (std::size_t size : {0, 1, 2, 1023, 1024, 1025, 4097, 100003})
+    {
+        test_inclusive_scan(size);
+    }
+
+    // the initial value is applied exactly once
+    std::vector<double> values(10000, 1.0);
+    std::vector<double> result(values.size());
+    phylanx::util::parallel_inclusive_scan(values.begin(), values.end(),
+        result.begin(), 2.0, std::multiplies<>{});
+    HPX_TEST_EQ(result.front(), 2.0);
+    HPX_TEST_EQ(result.back(), 2.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_scan_columns(std::size_t slices, std::size_t rows,
+    std::size_t columns)
+{
+    std::size_t const size = slices * rows * columns;
+
+    std::vector<std::int64_t> values(size);
+    std::iota(values.begin(), values.end(), std::int64_t(0));
+
+    std::vector<std::int64_t> result(size);
+    phylanx::util::scan_columns(slices, rows, columns, std::int64_t(1),
+        std::plus<>{},
+        [&](std::size_t slice, std::size_t row) -> std::int64_t const*
+        {
+            return values.data() + (slice * rows + row) * columns;
+        },
+        [&](std::size_t slice, std::size_t row) -> std::int64_t*
+        {
+            return result.data() + (slice * rows + row) * columns;
+        });
+
+    for (std::size_t s = 0; s != slices; ++s)
+    {
+        for (std::size_t j = 0; j != columns; ++j)
+        {
+            std::int64_t sum = 1;
+            for (std::size_t i = 0; i != rows; ++i)
+            {
+                std::size_t const index = (s * rows + i) * columns + j;
+                sum += values[index];
+                HPX_TEST_EQ(result[index], sum);
+            }
+        }
+    }
+}
+
+void test_scan_columns()
+{
+    test_scan_columns(1, 1, 1);
+    test_scan_columns(1, 300, 700);
+    test_scan_columns(3, 50, 257);
+    test_scan_columns(2, 0, 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_for_each_scan_slice()
+{
+    std::vector<std::atomic<int>> visited(1000);
+    for (auto& v : visited)
+    {
+        v = 0;
+    }
+
+    phylanx::util::for_each_scan_slice(visited.size(), 100,
+        [&](std::size_t i) { ++visited[i]; });
+
+    for (auto const& v : visited)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    test_inclusive_scan();
+    test_scan_columns();
+    test_for_each_scan_slice();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,142 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/parallel_sort.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_radix_sort(std::vector<std::int64_t> values)
+{
+    std::vector<std::int64_t> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    phylanx::util::radix_sort(values.data(), values.size());
+    HPX_TEST(values == expected);
+}
+
+void test_radix_sort()
+{
+    std::mt19937_64 gen(42);
+
+    // indices, only the lower digits differ
+    std::vector<std::int64_t> indices(200000);
+    for (auto& v : indices)
+    {
+        v = std::int64_t(gen() % 1000000);
+    }
+    test_radix_sort(indices);
+
+    // full range, including negative values
+    std::vector<std::int64_t> values(100003);
+    for (auto& v : values)
+    {
+        v = static_cast<std::int64_t>(gen());
+    }
+    test_radix_sort(values);
+
+    // corner cases
+    test_radix_sort({});
+    test_radix_sort({-1});
+    test_radix_sort({3, -3, 0, 3, -3});
+    test_radix_sort(std::vector<std::int64_t>(70000, 7));
+}
+
+void test_parallel_sort()
+{
+    std::mt19937_64 gen(43);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    blaze::DynamicVector<double> v(100000);
+    for (auto& d : v)
+    {
+        d = dist(gen);
+    }
+
+    phylanx::util::sort_values(v.data(), v.size());
+    HPX_TEST(std::is_sorted(v.begin(), v.end()));
+
+    phylanx::util::parallel_sort(v.begin(), v.end(), std::greater<double>());
+    HPX_TEST(std::is_sorted(v.begin(), v.end(), std::greater<double>()));
+}
+
+void test_for_each_slice()
+{
+    std::vector<std::atomic<int>> visited(1000);
+    for (auto& v : visited)
+    {
+        v = 0;
+    }
+
+    phylanx::util::for_each_slice(
+        visited.size(), 100, [&](std::size_t i) { ++visited[i]; });
+
+    for (auto const& v : visited)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+void test_sort_primitives()
+{
+    // large enough to exercise the parallel code paths
+    auto sorted = phylanx::execution_tree::extract_integer_value(
+        compile_and_run(
+            R"(sort(random(100000, list("uniform_int", 0, 999)), -1))"));
+    auto v = sorted.vector();
+    HPX_TEST(std::is_sorted(v.begin(), v.end()));
+
+    auto rows = phylanx::execution_tree::extract_numeric_value(
+        compile_and_run("sort(random(list(1000, 100)), 1)"));
+    auto m = rows.matrix();
+    for (std::size_t i = 0; i != m.rows(); ++i)
+    {
+        auto r = blaze::row(m, i);
+        HPX_TEST(std::is_sorted(r.begin(), r.end()));
+    }
+
+    auto unique = phylanx::execution_tree::extract_integer_value(
+        compile_and_run(
+            R"(unique(random(100000, list("uniform_int", 0, 99))))"));
+    HPX_TEST(unique.size() <= 100);
+    auto u = unique.vector();
+    HPX_TEST(std::adjacent_find(u.begin(), u.end(),
+                 std::greater_equal<std::int64_t>()) == u.end());
+}
+
+int main(int argc, char* argv[])
+{
+    test_radix_sort();
+    test_parallel_sort();
+    test_for_each_slice();
+    test_sort_primitives();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,142 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/philox.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// known answers taken from the Random123 test vectors
+void test_known_answers()
+{
+    using phylanx::util::philox4x32;
+
+    HPX_TEST(philox4x32::generate({{0, 0, 0, 0}}, {{0, 0}}) ==
+        (std::array<std::uint32_t, 4>{
+            {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}}));
+
+    HPX_TEST(philox4x32::generate(
+                 {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+                 {{0xffffffff, 0xffffffff}}) ==
+        (std::array<std::uint32_t, 4>{
+            {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}}));
+
+    HPX_TEST(philox4x32::generate(
+                 {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}},
+                 {{0xa4093822, 0x299f31d0}}) ==
+        (std::array<std::uint32_t, 4>{
+            {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}));
+
+    // the engine enumerates the counters of its subsequence
+    philox4x32 gen;
+    HPX_TEST_EQ(gen(), 0x6627e8d5u);
+    HPX_TEST_EQ(gen(), 0xe169c58du);
+    HPX_TEST_EQ(gen(), 0xbc57ac4cu);
+    HPX_TEST_EQ(gen(), 0x9b00dbd8u);
+}
+
+void test_discard()
+{
+    phylanx::util::philox4x32 gen(42, 7);
+
+    std::vector<std::uint32_t> values(103);
+    for (auto& v : values)
+    {
+        v = gen();
+    }
+
+    for (std::size_t n : {0, 1, 3, 4, 5, 17, 64, 102})
+    {
+        phylanx::util::philox4x32 skipped(42, 7);
+        skipped.discard(n);
+        HPX_TEST_EQ(skipped(), values[n]);
+
+        // discarding from the middle of a block of four values
+        phylanx::util::philox4x32 partial(42, 7);
+        partial();
+        partial.discard(n);
+        HPX_TEST_EQ(partial(), values[n + 1]);
+    }
+
+    // different subsequences and keys yield different values
+    phylanx::util::philox4x32 other_subsequence(42, 8);
+    phylanx::util::philox4x32 other_key(43, 7);
+    HPX_TEST_NEQ(other_subsequence(), values[0]);
+    HPX_TEST_NEQ(other_key(), values[0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+phylanx::execution_tree::primitive_argument_type compile_and_run(
+    std::string const& codestr)
+{
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile(codestr, snippets, env);
+    return code.run().arg_;
+}
+
+// Large arrays are generated concurrently in blocks of 4096 elements, each
+// using its own subsequence of the stream. The result must be the same as
+// generating the blocks one after the other.
+void test_parallel_generation()
+{
+    std::size_t const size = 100000;
+    std::uint32_t const seed = 42;
+
+    auto first = phylanx::execution_tree::extract_numeric_value(
+        compile_and_run(R"(block(
+            set_seed(42),
+            random(100000)
+        ))"));
+
+    blaze::DynamicVector<double> expected(size);
+    for (std::size_t b = 0; b * 4096 < size; ++b)
+    {
+        // the first stream after set_seed
+        phylanx::util::philox4x32 gen(seed, b);
+        std::normal_distribution<double> dist;
+
+        std::size_t const end = (std::min)((b + 1) * 4096, size);
+        for (std::size_t i = b * 4096; i != end; ++i)
+        {
+            expected[i] = dist(gen);
+        }
+    }
+
+    HPX_TEST(first.vector() == expected);
+
+    // consecutive evaluations use different streams
+    auto equal = phylanx::execution_tree::extract_scalar_boolean_value(
+        compile_and_run(R"(block(
+            set_seed(42),
+            define(x, random(list(300, 300))),
+            define(y, random(list(300, 300))),
+            all(x == y)
+        ))"));
+    HPX_TEST(!equal);
+}
+
+int main(int argc, char* argv[])
+{
+    test_known_answers();
+    test_discard();
+    test_parallel_generation();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,98 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/storage_pool.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <blaze/Math.h>
+
+void test_vector_reuse()
+{
+    using pool = phylanx::util::storage_pool<double>;
+
+    pool::clear();
+    phylanx::util::storage_pool_hit_count(true);
+    phylanx::util::storage_pool_miss_count(true);
+
+    auto v1 = pool::vector(1024);
+    HPX_TEST_EQ(v1.size(), std::size_t(1024));
+    HPX_TEST_EQ(phylanx::util::storage_pool_miss_count(false), 1);
+
+    double const* data = v1.data();
+    pool::release(std::move(v1));
+
+    // a slightly smaller vector falls into the same size class
+    auto v2 = pool::vector(1000);
+    HPX_TEST_EQ(v2.size(), std::size_t(1000));
+    HPX_TEST_EQ(v2.data(), data);
+    HPX_TEST_EQ(phylanx::util::storage_pool_hit_count(false), 1);
+
+    // small vectors are never pooled
+    auto v3 = pool::vector(8);
+    HPX_TEST_EQ(phylanx::util::storage_pool_miss_count(false), 1);
+    HPX_TEST_EQ(phylanx::util::storage_pool_hit_count(false), 1);
+
+    pool::clear();
+}
+
+void test_matrix_reuse()
+{
+    using pool = phylanx::util::storage_pool<std::int64_t>;
+
+    pool::clear();
+    phylanx::util::storage_pool_hit_count(true);
+
+    auto m1 = pool::matrix(64, 64);
+    std::int64_t const* data = m1.data();
+    pool::release(std::move(m1));
+
+    auto m2 = pool::matrix(32, 120);
+    HPX_TEST_EQ(m2.rows(), std::size_t(32));
+    HPX_TEST_EQ(m2.columns(), std::size_t(120));
+    HPX_TEST_EQ(m2.data(), data);
+    HPX_TEST_EQ(phylanx::util::storage_pool_hit_count(false), 1);
+
+    pool::clear();
+}
+
+void test_node_data_release()
+{
+    using pool = phylanx::util::storage_pool<double>;
+
+    pool::clear();
+    phylanx::util::storage_pool_hit_count(true);
+
+    double const* data = nullptr;
+    {
+        blaze::DynamicVector<double> v(2048, 1.0);
+        data = v.data();
+        phylanx::ir::node_data<double> nd{std::move(v)};
+    }
+
+    // the storage of the destroyed node_data is handed out again
+    auto v = phylanx::util::pooled_vector<double>(
+        blaze::DynamicVector<double>(2048, 2.0) * 2.0);
+    HPX_TEST_EQ(v.data(), data);
+    HPX_TEST_EQ(v[0], 4.0);
+    HPX_TEST_EQ(phylanx::util::storage_pool_hit_count(false), 1);
+
+    pool::clear();
+}
+
+int main(int argc, char* argv[])
+{
+    test_vector_reuse();
+    test_matrix_reuse();
+    test_node_data_release();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,144 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <phylanx/phylanx.hpp>
+#include <phylanx/util/trace_events.hpp>
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <blaze/Math.h>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t count_occurrences(std::string const& s, std::string const& what)
+{
+    std::size_t count = 0;
+    for (std::size_t pos = s.find(what); pos != std::string::npos;
+         pos = s.find(what, pos + what.size()))
+    {
+        ++count;
+    }
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// events recorded concurrently by many threads, spanning several chunks of
+// the per-thread buffers
+void test_concurrent_recording()
+{
+    phylanx::util::clear_trace_events();
+
+    std::uint32_t name =
+        phylanx::util::register_trace_event_name("test", "<test>");
+    HPX_TEST_NEQ(name, std::uint32_t(0));
+    HPX_TEST_EQ(
+        phylanx::util::register_trace_event_name("test", "<test>"), name);
+
+    std::size_t const num_tasks = 16;
+    std::size_t const events_per_task = 1000;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&, t]() {
+            phylanx::util::trace_event event{};
+            event.worker_ = phylanx::util::trace_event_worker();
+            event.name_ = name;
+            event.num_arguments_ = 1;
+            event.arguments_[0].ndim_ = 1;
+            event.arguments_[0].dims_[0] = std::int64_t(t);
+            event.has_result_ = false;
+
+            for (std::size_t i = 0; i != events_per_task; ++i)
+            {
+                event.begin_ = 1000 * i;
+                event.end_ = 1000 * i + 500;
+                phylanx::util::record_trace_event(event);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+    for (auto& f : tasks)
+    {
+        f.get();
+    }
+
+    std::ostringstream os;
+    HPX_TEST_EQ(phylanx::util::write_trace_events(os),
+        num_tasks * events_per_task);
+
+    std::string const trace = os.str();
+    HPX_TEST_EQ(count_occurrences(trace, "\"ph\":\"X\""),
+        num_tasks * events_per_task);
+    HPX_TEST_EQ(count_occurrences(trace, "\"dur\":0.500"),
+        num_tasks * events_per_task);
+    HPX_TEST_EQ(count_occurrences(trace, "\"codename\":\"<test>\""),
+        num_tasks * events_per_task);
+    HPX_TEST_EQ(count_occurrences(trace, "\"arguments\":[[7]]"),
+        events_per_task);
+
+    // the events were removed from the buffers
+    std::ostringstream empty;
+    HPX_TEST_EQ(phylanx::util::write_trace_events(empty), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_primitive_evaluation()
+{
+    phylanx::util::clear_trace_events();
+    phylanx::util::enable_trace_events();
+
+    phylanx::execution_tree::compiler::function_list snippets;
+    phylanx::execution_tree::compiler::environment env =
+        phylanx::execution_tree::compiler::default_environment();
+
+    auto const& code = phylanx::execution_tree::compile("trace_events",
+        "define(f, x, y, x * y + 1.0)\nf", snippets, env);
+    auto f = code.run();
+
+    blaze::DynamicMatrix<double> m(10, 20, 2.0);
+    auto result = f(m, 3.0);
+
+    phylanx::util::enable_trace_events(false);
+
+    HPX_TEST(phylanx::execution_tree::extract_numeric_value(result).matrix() ==
+        blaze::DynamicMatrix<double>(10, 20, 7.0));
+
+    std::ostringstream os;
+    HPX_TEST_LT(std::size_t(0), phylanx::util::write_trace_events(os));
+
+    std::string const trace = os.str();
+    HPX_TEST_NEQ(trace.find("\"codename\":\"trace_events\""),
+        std::string::npos);
+    // the multiplication and the addition report the last known shapes of
+    // their operands
+    HPX_TEST_LTE(std::size_t(2), count_occurrences(trace,
+        "\"last_known_operand_shapes\":[[10,20],[]]"));
+    HPX_TEST_NEQ(trace.find("\"result\":[10,20]"), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"name\":\"thread_name\""), std::string::npos);
+
+    // nothing is recorded while disabled
+    f(m, 3.0);
+
+    std::ostringstream empty;
+    HPX_TEST_EQ(phylanx::util::write_trace_events(empty), std::size_t(0));
+}
+
+int main(int argc, char* argv[])
+{
+    test_concurrent_recording();
+    test_primitive_evaluation();
+
+    return hpx::util::report_errors();
+}